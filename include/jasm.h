@@ -14,6 +14,15 @@ typedef struct {
     char *inname;
     char *outname;
     OutFormat outformat;
+    bool optimize;
+    uint32_t align_loops;   // 0, or the --align-loops boundary
+    bool branch_align;      // -mbranches-within-32B-boundaries
+    char *profile;          // --profile=FILE for hot/cold layout
+    bool function_sections; // --function-sections
+    char *march;            // -march=, NULL to accept every instruction
+    uint32_t isa;           // features -march allows
+    bool vzeroupper;        // -mvzeroupper: insert vzeroupper before call/ret
+    bool verbose;           // -v: report layout, extern and merge statistics
 } args_t;
 
 extern FILE* infile;
@@ -31,13 +40,24 @@ typedef enum {
     OP_LABELREF,
 } OperandType;
 
+// @ suffix of a symbol reference
+typedef enum {
+    SYM_PLAIN,
+    SYM_PLT,            // foo@PLT
+    SYM_GOTPCREL,       // foo@GOTPCREL(%rip)
+} SymModifier;
+
 typedef struct {
     char* base;
     char* index;
     int scale;
     long disp;
+    char* sym;          // sym+disp(%rip)
+    SymModifier symmod;
     bool has_disp;
     int size;
+    uint8_t bcst;       // {1toN} embedded broadcast: N, 0 if none
+    char* seg;          // %fs:8(%rax) segment override, NULL if none
 } MemOperand;
 
 typedef struct {
@@ -46,24 +66,113 @@ typedef struct {
     char* reg;
     long imm;
     char* labelref;
+    SymModifier labelmod;
     MemOperand mem;
+    bool indirect;      // written with * (jmp *%rax)
 } Operand;
 
+// Instruction prefixes written before the mnemonic
+enum {
+    PREFIX_LOCK = 1 << 0,
+    PREFIX_REP = 1 << 1,    // rep, repe, repz (F3)
+    PREFIX_REPNE = 1 << 2,  // repne, repnz (F2)
+};
+
+// AVX-512 {rn-sae}/{rd-sae}/{ru-sae}/{rz-sae} rounding and {sae}
+typedef enum {
+    ROUND_NONE,
+    ROUND_RN,
+    ROUND_RD,
+    ROUND_RU,
+    ROUND_RZ,
+    ROUND_SAE,
+} Rounding;
+
 typedef struct {
     char* opcode;
     Operand** operands;
     size_t noperands;
     char* commment;
+    bool rel8;          // label branch uses the short rel8 form (set by layout)
+    uint8_t prefixes;   // PREFIX_*
+    uint8_t opmask;     // {%kN} on the destination, 0 if unmasked
+    bool zeroing;       // {z}
+    uint8_t rounding;   // Rounding
 } Instruction;
 
+// Symbol reference in a data directive, resolved once labels are placed.
+typedef struct {
+    size_t offset;      // within the directive's bytes
+    uint8_t size;
+    char* label;
+    int64_t addend;
+} DataFixup;
+
 typedef struct {
     char* name;
     char** args;
     size_t nargs;
+    char* raw;          // operand text of a data directive, not split into args
+    int fd;             // .incbin source, open from layout until output
+    uint64_t file_off;
+
+    // bytes of a data directive, built once on first use
+    bool built;
+    uint8_t* data;
+    size_t len;
+    DataFixup* fixups;
+    size_t nfixups;
 } Directive;
 
+// Index into G_sections; .text and .data always exist.
+typedef int Section;
+enum {
+    SECTION_UNDEF = -1, // symbols referenced but not defined in the file
+    SECTION_CODE,
+    SECTION_DATA,
+};
+
+typedef struct {
+    char* name;
+    uint64_t flags;     // SHF_*
+    uint32_t type;      // SHT_*
+    uint32_t entsize;
+    uint32_t align;     // sh_addralign, raised by .align in the section
+    bool declared;      // attributes given explicitly by .section
+} SectionDef;
+
+typedef struct {
+    SectionDef *entries;
+    size_t count;
+    size_t capacity;
+} SectionTable;
+
+typedef struct {
+    Section sec;
+    int sub;
+} SectionRef;
+
+// Section state while walking the program: current and previous section
+// (for .previous) and the .pushsection stack.
+#define SECTION_STACK_MAX 64
+
+typedef struct {
+    SectionRef cur, prev;
+    struct { SectionRef cur, prev; } stack[SECTION_STACK_MAX];
+    size_t depth;
+} SectionState;
+
 typedef struct Node {
     NodeType kind;
+    int line;
+
+    // layout, filled in by compute_offsets
+    Section section;
+    int subsection;
+    uint32_t offset;    // start within the section, before padding
+    uint32_t pad;       // padding emitted in front of the node
+    uint32_t size;      // bytes the node itself encodes to
+    uint32_t align;     // NOP-pad the node to this boundary (0 = none)
 
     union {
         char* label;
@@ -79,16 +188,18 @@ typedef struct {
 
 Program* parse_program(FILE* f);
 void dump_program(Program* p);
+size_t format_instruction(char *buf, size_t n, const Instruction *inst);
 
-typedef enum {
-    SECTION_CODE,
-    SECTION_DATA,
-} Section;
+void peephole_program(Program *prog);
+void apply_profile(Program *prog, const char *path);
+void vzeroupper_program(Program *prog, bool insert);
+void merge_sections(Program *prog);
 
 typedef struct {
     char *name;
     uint32_t address;
     Section section;
+    bool local;         // .L names and .lcomm symbols
 } Label;
 
 typedef struct {
@@ -101,6 +212,8 @@ typedef struct {
     Label *label;        // The label being referenced
     uint32_t offset;     // Where in the section the relocation occurs
     Section section;     // Which section this relocation belongs to
+    uint32_t type;       // R_X86_64_*
+    int64_t addend;
 } Reloc;
 
 typedef struct {
@@ -110,21 +223,49 @@ typedef struct {
 } RelocTable;
 
 
+// Section ranges the writers produce without the section buffer: large
+// zero fills, left as file holes, and .incbin payloads, copied from fd.
+typedef struct {
+    Section section;
+    size_t offset;
+    size_t len;
+    int fd;             // -1 for zeros
+    uint64_t file_off;
+} OutSpan;
+
 struct asm_ret {
-    uint8_t* code;
-    size_t code_size;
-    uint8_t* data;
-    size_t data_size;
+    uint8_t** sec;          // indexed by Section, NULL for @nobits
+    size_t* sec_size;
+    uint32_t* sec_align;
+    size_t nsec;
+    OutSpan* spans;         // in offset order within each section
+    size_t nspans;
 };
 
 
 struct asm_ret* assemble_program(Program *prog);
 size_t encode_instruction(uint8_t *out, Instruction *inst, Program *prog, size_t pos, LabelTable *label_table);
+size_t calculate_instruction_size(Instruction *inst);
+size_t encode_directive(uint8_t* out, Directive* directive);
+bool is_data_directive(const char *name);
+
+void section_state_init(SectionState *st);
+bool section_directive(Directive *d, SectionState *st);
+Section section_lookup(const char *name);
+bool is_code_section(Section sec);
+bool is_nobits_section(Section sec);
+int reg_code(const char *r);
+int reg_size(const char *r);
+const char *reg_name(int code, int size);
+int cond_code(const char *name);
+bool parse_march(const char *spec, uint32_t *isa);
 int write_elf64(const char *filename, struct asm_ret *asmres, LabelTable *labels, RelocTable *relocs);
+int write_section(int fd, struct asm_ret *asmres, Section s, size_t file_off);
 
 extern LabelTable* G_labels;
 extern args_t* args;
 extern RelocTable G_relocs;
+extern SectionTable G_sections;
 
 void init_reloc_table(RelocTable *tbl);
-void emit_reloc(RelocTable *tbl, Label* label, uint32_t offset, Section section);
\ No newline at end of file
+void emit_reloc(RelocTable *tbl, Label* label, uint32_t offset, Section section, uint32_t type, int64_t addend);
\ No newline at end of file
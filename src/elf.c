@@ -1,4 +1,4 @@
-#define _XOPEN_SOURCE 500
+#define _GNU_SOURCE
 
 #include "jasm.h"
 
@@ -6,17 +6,14 @@
 #include <elf.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
+#include <sys/sendfile.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <errno.h>
 
 
-static size_t find_name_offset(const char *sh_names, const char *name) {
-    const char *p = strstr(sh_names, name);
-    return p ? (size_t)(p - sh_names) : 0;
-}
-
 void init_reloc_table(RelocTable *tbl) {
     tbl->entries = NULL;
     tbl->count = 0;
@@ -31,7 +28,7 @@ static void grow_reloc_table(RelocTable *tbl) {
     tbl->capacity = new_cap;
 }
 
-void emit_reloc(RelocTable *tbl, Label* label, uint32_t offset, Section section) {
+void emit_reloc(RelocTable *tbl, Label* label, uint32_t offset, Section section, uint32_t type, int64_t addend) {
     if (tbl->count >= tbl->capacity) {
         grow_reloc_table(tbl);
     }
@@ -42,97 +39,209 @@ void emit_reloc(RelocTable *tbl, Label* label, uint32_t offset, Section section)
     r->label = label;
     r->offset = offset;
     r->section = section;
+    r->type = type;
+    r->addend = addend;
 }
 
-static size_t find_sym_index(const LabelTable *labels, const char *name) {
-    size_t i;
-    for (i = 0; i < labels->count; i++) {
-        if (strcmp(name, labels->entries[i].name) == 0)
-            return i + 1; /* +1 since sym[0] = undefined */
+#define ALIGN_UP(x, a) (((x) + (a - 1)) & ~(a - 1))
+
+/* Copy an .incbin payload into the output without passing it through user
+ * space when the kernel can: copy_file_range, then sendfile, then a mapping
+ * of the source. */
+static int copy_payload(int out, OutSpan *sp, off_t at) {
+    loff_t in_off = sp->file_off, out_off = at;
+    size_t left = sp->len;
+
+    while (left) {
+        ssize_t n = copy_file_range(sp->fd, &in_off, out, &out_off, left, 0);
+        if (n <= 0) break;
+        left -= n;
     }
-    return 0;
+    if (left && lseek(out, out_off, SEEK_SET) == out_off) {
+        off_t off = in_off;
+        while (left) {
+            ssize_t n = sendfile(out, sp->fd, &off, left);
+            if (n <= 0) break;
+            left -= n;
+        }
+        in_off = off;
+        out_off = at + (sp->len - left);
+    }
+    if (!left) return 0;
+
+    long page = sysconf(_SC_PAGESIZE);
+    off_t base = in_off & ~(off_t)(page - 1);
+    size_t skew = in_off - base;
+    uint8_t *map = mmap(NULL, left + skew, PROT_READ, MAP_PRIVATE, sp->fd, base);
+    if (map == MAP_FAILED) return -1;
+    ssize_t n = pwrite(out, map + skew, left, out_off);
+    munmap(map, left + skew);
+    return n == (ssize_t)left ? 0 : -1;
 }
 
-static size_t strtab_offset(const char *strtab, const char *name) {
-    const char *p = strtab;
-    size_t offset = 0;
-    while (*p) {
-        if (strcmp(p, name) == 0) return offset;
-        offset += strlen(p) + 1;
-        p += strlen(p) + 1;
+/* Write section s at file_off: the buffer, except for its spans, which are
+ * left as holes (zeros) or copied from their file (.incbin). */
+int write_section(int fd, struct asm_ret *asmres, Section s, size_t file_off) {
+    size_t pos = 0;
+    for (size_t i = 0; i <= asmres->nspans; i++) {
+        OutSpan *sp = i < asmres->nspans ? &asmres->spans[i] : NULL;
+        if (sp && sp->section != s) continue;
+
+        size_t end = sp ? sp->offset : asmres->sec_size[s];
+        if (end > pos && pwrite(fd, asmres->sec[s] + pos, end - pos, file_off + pos) < 0) return -1;
+        if (!sp) break;
+        if (sp->fd >= 0 && copy_payload(fd, sp, file_off + sp->offset) < 0) return -1;
+        pos = sp->offset + sp->len;
     }
     return 0;
 }
 
-static size_t sym_index(LabelTable *labels, const char *name) {
-    for (size_t i = 0; i < labels->count; i++)
-        if (strcmp(labels->entries[i].name, name) == 0) return i + 1;
-    return 0;
+static size_t add_str(char *buf, size_t *off, const char *s) {
+    size_t at = *off;
+    strcpy(buf + at, s);
+    *off += strlen(s) + 1;
+    return at;
 }
 
-#define ALIGN_UP(x, a) (((x) + (a - 1)) & ~(a - 1))
-
 /* --- Main ELF writer --- */
 int write_elf64(const char *filename, struct asm_ret *asmres, LabelTable *labels, RelocTable *relocs) {
     int fd = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
     if (fd < 0) { perror("open"); return -1; }
 
+    /* --- Section header indices: every section in the table, in order of first use --- */
+    size_t nsec = asmres->nsec;
+    size_t shnum = 1;
+    size_t *shndx = calloc(nsec, sizeof(size_t));
+    size_t *nrela = calloc(nsec, sizeof(size_t));
+    size_t *rela_ndx = calloc(nsec, sizeof(size_t));
+    if (!shndx || !nrela || !rela_ndx) { perror("calloc"); exit(1); }
+
+    for (size_t s = 0; s < nsec; s++) shndx[s] = shnum++;
+    size_t symtab_ndx = shnum++;
+    size_t strtab_ndx = shnum++;
+    size_t shstrndx = shnum++;
+
+    for (size_t i = 0; i < relocs->count; i++) nrela[relocs->entries[i].section]++;
+    for (size_t s = 0; s < nsec; s++)
+        if (nrela[s]) rela_ndx[s] = shnum++;
+
+    Elf64_Shdr *shdr = calloc(shnum, sizeof(Elf64_Shdr));
+    Elf64_Sym *syms = NULL;
+    char *strtab_buf = NULL;
+    size_t *symidx = NULL;
+
     /* --- Build .shstrtab dynamically --- */
-    const char *section_names[] = { "", ".text", ".data", ".symtab", ".strtab",
-                                    ".shstrtab", ".rela.text", ".rela.data" };
-    size_t shstrtab_size = 1; /* initial null byte */
-    for (size_t i = 1; i < 8; i++) shstrtab_size += strlen(section_names[i]) + 1;
+    size_t shstrtab_size = 1 + strlen(".symtab") + 1 + strlen(".strtab") + 1 + strlen(".shstrtab") + 1;
+    for (size_t s = 0; s < nsec; s++) {
+        shstrtab_size += strlen(G_sections.entries[s].name) + 1;
+        if (rela_ndx[s]) shstrtab_size += strlen(".rela") + strlen(G_sections.entries[s].name) + 1;
+    }
     char *shstrtab_buf = calloc(1, shstrtab_size);
     size_t off = 1;
-    for (size_t i = 1; i < 8; i++) {
-        strcpy(&shstrtab_buf[off], section_names[i]);
-        off += strlen(section_names[i]) + 1;
+    for (size_t s = 0; s < nsec; s++)
+        shdr[shndx[s]].sh_name = add_str(shstrtab_buf, &off, G_sections.entries[s].name);
+    shdr[symtab_ndx].sh_name = add_str(shstrtab_buf, &off, ".symtab");
+    shdr[strtab_ndx].sh_name = add_str(shstrtab_buf, &off, ".strtab");
+    shdr[shstrndx].sh_name = add_str(shstrtab_buf, &off, ".shstrtab");
+    for (size_t s = 0; s < nsec; s++) {
+        if (!rela_ndx[s]) continue;
+        const char *sname = G_sections.entries[s].name;
+        char *name = malloc(strlen(".rela") + strlen(sname) + 1);
+        if (!name) { perror("malloc"); exit(1); }
+        sprintf(name, ".rela%s", sname);
+        shdr[rela_ndx[s]].sh_name = add_str(shstrtab_buf, &off, name);
+        free(name);
     }
 
-    /* --- Build .strtab dynamically --- */
+    /* --- Symbol order: locals (.L) must precede globals --- */
+    size_t nsyms = labels->count + 1;
+    symidx = malloc((labels->count + 1) * sizeof(size_t));
+    size_t next = 1;
+    for (size_t i = 0; i < labels->count; i++)
+        if (labels->entries[i].local) symidx[i] = next++;
+    size_t first_global = next;
+    for (size_t i = 0; i < labels->count; i++)
+        if (!labels->entries[i].local) symidx[i] = next++;
+
+    /* --- Build .strtab and .symtab --- */
     size_t strtab_size = 1;
     for (size_t i = 0; i < labels->count; i++) strtab_size += strlen(labels->entries[i].name) + 1;
-    char *strtab_buf = calloc(1, strtab_size);
+    strtab_buf = calloc(1, strtab_size);
+    syms = calloc(nsyms, sizeof(Elf64_Sym));
+    syms[0].st_info = ELF64_ST_INFO(STB_LOCAL, STT_NOTYPE);
+    syms[0].st_shndx = SHN_UNDEF;
     off = 1;
     for (size_t i = 0; i < labels->count; i++) {
-        strcpy(&strtab_buf[off], labels->entries[i].name);
-        off += strlen(labels->entries[i].name) + 1;
+        Label *l = &labels->entries[i];
+        Elf64_Sym *sym = &syms[symidx[i]];
+        sym->st_name = add_str(strtab_buf, &off, l->name);
+        sym->st_other = STV_DEFAULT;
+        if (l->section == SECTION_UNDEF) {
+            /* external: resolved by the linker */
+            sym->st_info = ELF64_ST_INFO(STB_GLOBAL, STT_NOTYPE);
+            sym->st_shndx = SHN_UNDEF;
+            continue;
+        }
+        bool code = is_code_section(l->section);
+        if (l->local)
+            sym->st_info = ELF64_ST_INFO(STB_LOCAL, STT_NOTYPE);
+        else
+            sym->st_info = ELF64_ST_INFO(STB_GLOBAL, code ? STT_FUNC : STT_OBJECT);
+        sym->st_shndx = shndx[l->section];
+        sym->st_value = l->address;
     }
 
     /* --- Section offsets --- */
-    size_t shnum = 8;
-    size_t shstrndx = 5;
-
     size_t offset = sizeof(Elf64_Ehdr); /* we will write shdr later at e_shoff */
 
-    size_t text_offset = ALIGN_UP(offset, 16);
-    size_t text_size = asmres->code_size ? asmres->code_size : 1;
-    offset = text_offset + text_size;
-
-    size_t data_offset = ALIGN_UP(offset, 8);
-    size_t data_size = asmres->data_size ? asmres->data_size : 1;
-    offset = data_offset + data_size;
-
-    size_t symtab_offset = ALIGN_UP(offset, 8);
-    size_t nsyms = labels->count + 1;
-    offset = symtab_offset + nsyms * sizeof(Elf64_Sym);
+    for (size_t s = 0; s < nsec; s++) {
+        SectionDef *def = &G_sections.entries[s];
+        Elf64_Shdr *sh = &shdr[shndx[s]];
+        size_t align = asmres->sec_align[s];
+        sh->sh_type = def->type;
+        sh->sh_flags = def->flags;
+        sh->sh_offset = ALIGN_UP(offset, align);
+        sh->sh_size = asmres->sec_size[s];
+        sh->sh_addralign = align;
+        sh->sh_entsize = def->entsize;
+        /* SHT_NOBITS occupies no space in the file */
+        if (def->type != SHT_NOBITS) offset = sh->sh_offset + sh->sh_size;
+    }
 
-    size_t strtab_offset = offset;
+    shdr[symtab_ndx].sh_type = SHT_SYMTAB;
+    shdr[symtab_ndx].sh_offset = ALIGN_UP(offset, 8);
+    shdr[symtab_ndx].sh_size = nsyms * sizeof(Elf64_Sym);
+    shdr[symtab_ndx].sh_link = strtab_ndx;
+    shdr[symtab_ndx].sh_info = first_global; /* first non-local symbol index */
+    shdr[symtab_ndx].sh_addralign = 8;
+    shdr[symtab_ndx].sh_entsize = sizeof(Elf64_Sym);
+    offset = shdr[symtab_ndx].sh_offset + shdr[symtab_ndx].sh_size;
+
+    shdr[strtab_ndx].sh_type = SHT_STRTAB;
+    shdr[strtab_ndx].sh_offset = offset;
+    shdr[strtab_ndx].sh_size = strtab_size;
+    shdr[strtab_ndx].sh_addralign = 1;
     offset += strtab_size;
 
-    size_t shstrtab_offset = offset;
+    shdr[shstrndx].sh_type = SHT_STRTAB;
+    shdr[shstrndx].sh_offset = offset;
+    shdr[shstrndx].sh_size = shstrtab_size;
+    shdr[shstrndx].sh_addralign = 1;
     offset += shstrtab_size;
 
-    size_t n_rela_text = 0, n_rela_data = 0;
-    for (size_t i = 0; i < relocs->count; i++) {
-        if (relocs->entries[i].section == SECTION_CODE) n_rela_text++;
-        else n_rela_data++;
+    for (size_t s = 0; s < nsec; s++) {
+        if (!rela_ndx[s]) continue;
+        Elf64_Shdr *sh = &shdr[rela_ndx[s]];
+        sh->sh_type = SHT_RELA;
+        sh->sh_offset = ALIGN_UP(offset, 8);
+        sh->sh_size = nrela[s] * sizeof(Elf64_Rela);
+        sh->sh_link = symtab_ndx;
+        sh->sh_info = shndx[s];
+        sh->sh_flags = SHF_INFO_LINK;
+        sh->sh_addralign = 8;
+        sh->sh_entsize = sizeof(Elf64_Rela);
+        offset = sh->sh_offset + sh->sh_size;
     }
-    size_t rela_text_offset = ALIGN_UP(offset, 8);
-    offset = rela_text_offset + n_rela_text * sizeof(Elf64_Rela);
-
-    size_t rela_data_offset = ALIGN_UP(offset, 8);
-    offset = rela_data_offset + n_rela_data * sizeof(Elf64_Rela);
 
     /* --- ELF header --- */
     Elf64_Ehdr ehdr;
@@ -149,148 +258,64 @@ int write_elf64(const char *filename, struct asm_ret *asmres, LabelTable *labels
     ehdr.e_shentsize = sizeof(Elf64_Shdr);
     ehdr.e_shnum = shnum;
     ehdr.e_shstrndx = shstrndx;
-    ehdr.e_shoff = offset; /* section headers will be written at end */
+    ehdr.e_shoff = ALIGN_UP(offset, 8); /* section headers will be written at end */
 
     if (write(fd, &ehdr, sizeof(ehdr)) != sizeof(ehdr)) { perror("write ehdr"); goto fail; }
 
     /* --- Write sections --- */
-    if (pwrite(fd, asmres->code, text_size, text_offset) < 0) { perror("write .text"); goto fail; }
-    if (pwrite(fd, asmres->data, data_size, data_offset) < 0) { perror("write .data"); goto fail; }
-    if (pwrite(fd, strtab_buf, strtab_size, strtab_offset) < 0) { perror("write .strtab"); goto fail; }
-    if (pwrite(fd, shstrtab_buf, shstrtab_size, shstrtab_offset) < 0) { perror("write .shstrtab"); goto fail; }
-
-    /* --- Symbol table --- */
-    Elf64_Sym *syms = calloc(nsyms, sizeof(Elf64_Sym));
-    syms[0].st_info = ELF64_ST_INFO(STB_LOCAL, STT_NOTYPE);
-    syms[0].st_shndx = SHN_UNDEF;
-    off = 1;
-    for (size_t i = 0; i < labels->count; i++) {
-        syms[i+1].st_name = off;
-        syms[i+1].st_info = ELF64_ST_INFO(STB_GLOBAL, labels->entries[i].section == SECTION_CODE ? STT_FUNC : STT_OBJECT);
-        syms[i+1].st_other = STV_DEFAULT;
-        syms[i+1].st_shndx = labels->entries[i].section == SECTION_CODE ? 1 : 2;
-        syms[i+1].st_value = labels->entries[i].address;
-        off += strlen(labels->entries[i].name) + 1;
+    for (size_t s = 0; s < nsec; s++) {
+        Elf64_Shdr *sh = &shdr[shndx[s]];
+        if (sh->sh_type == SHT_NOBITS || !sh->sh_size) continue;
+        if (write_section(fd, asmres, s, sh->sh_offset) < 0) { perror("write section"); goto fail; }
     }
-    if (pwrite(fd, syms, nsyms * sizeof(Elf64_Sym), symtab_offset) < 0) { perror("write .symtab"); goto fail; }
+    if (pwrite(fd, syms, nsyms * sizeof(Elf64_Sym), shdr[symtab_ndx].sh_offset) < 0) { perror("write .symtab"); goto fail; }
+    if (pwrite(fd, strtab_buf, strtab_size, shdr[strtab_ndx].sh_offset) < 0) { perror("write .strtab"); goto fail; }
+    if (pwrite(fd, shstrtab_buf, shstrtab_size, shdr[shstrndx].sh_offset) < 0) { perror("write .shstrtab"); goto fail; }
 
     /* --- Relocations --- */
-    if (n_rela_text > 0) {
-        Elf64_Rela *rela = calloc(n_rela_text, sizeof(Elf64_Rela));
+    for (size_t s = 0; s < nsec; s++) {
+        if (!rela_ndx[s]) continue;
+        Elf64_Rela *rela = calloc(nrela[s], sizeof(Elf64_Rela));
         size_t idx = 0;
         for (size_t i = 0; i < relocs->count; i++) {
-            if (relocs->entries[i].section != SECTION_CODE) continue;
-            rela[idx].r_offset = relocs->entries[i].offset;
-            rela[idx].r_info = ELF64_R_INFO(sym_index(labels, relocs->entries[i].label->name), R_X86_64_32);
-            rela[idx].r_addend = 0;
+            Reloc *r = &relocs->entries[i];
+            if ((size_t)r->section != s) continue;
+            rela[idx].r_offset = r->offset;
+            rela[idx].r_info = ELF64_R_INFO(symidx[r->label - labels->entries], r->type);
+            rela[idx].r_addend = r->addend;
             idx++;
         }
-        if (pwrite(fd, rela, n_rela_text * sizeof(Elf64_Rela), rela_text_offset) < 0) { perror("write .rela.text"); goto fail; }
-        free(rela);
-    }
-
-    if (n_rela_data > 0) {
-        Elf64_Rela *rela = calloc(n_rela_data, sizeof(Elf64_Rela));
-        size_t idx = 0;
-        for (size_t i = 0; i < relocs->count; i++) {
-            if (relocs->entries[i].section != SECTION_DATA) continue;
-            rela[idx].r_offset = relocs->entries[i].offset;
-            rela[idx].r_info = ELF64_R_INFO(sym_index(labels, relocs->entries[i].label->name), R_X86_64_64);
-            rela[idx].r_addend = 0;
-            idx++;
+        if (pwrite(fd, rela, nrela[s] * sizeof(Elf64_Rela), shdr[rela_ndx[s]].sh_offset) < 0) {
+            perror("write .rela");
+            free(rela);
+            goto fail;
         }
-        if (pwrite(fd, rela, n_rela_data * sizeof(Elf64_Rela), rela_data_offset) < 0) { perror("write .rela.data"); goto fail; }
         free(rela);
     }
 
     /* --- Section headers --- */
-    Elf64_Shdr shdr[8];
-    memset(shdr, 0, sizeof(shdr));
-
-    /* Null section */
-    shdr[0].sh_type = SHT_NULL;
-
-    /* Helper for offsets in .shstrtab */
-    size_t shstr_offsets[8];
-    shstr_offsets[0] = 0;
-    size_t accum = 1;
-    for (size_t i = 1; i < 8; i++) {
-        shstr_offsets[i] = accum;
-        accum += strlen(section_names[i]) + 1;
-    }
-
-    /* .text */
-    shdr[1].sh_name = shstr_offsets[1];
-    shdr[1].sh_type = SHT_PROGBITS;
-    shdr[1].sh_flags = SHF_ALLOC | SHF_EXECINSTR;
-    shdr[1].sh_offset = text_offset;
-    shdr[1].sh_size = text_size;
-    shdr[1].sh_addralign = 16;
-
-    /* .data */
-    shdr[2].sh_name = shstr_offsets[2];
-    shdr[2].sh_type = SHT_PROGBITS;
-    shdr[2].sh_flags = SHF_ALLOC | SHF_WRITE;
-    shdr[2].sh_offset = data_offset;
-    shdr[2].sh_size = data_size;
-    shdr[2].sh_addralign = 8;
-
-    /* .symtab */
-    shdr[3].sh_name = shstr_offsets[3];
-    shdr[3].sh_type = SHT_SYMTAB;
-    shdr[3].sh_offset = symtab_offset;
-    shdr[3].sh_size = nsyms * sizeof(Elf64_Sym);
-    shdr[3].sh_link = 4; /* .strtab */
-    shdr[3].sh_info = 1; /* first non-local symbol index */
-    shdr[3].sh_addralign = 8;
-    shdr[3].sh_entsize = sizeof(Elf64_Sym);
-
-    /* .strtab */
-    shdr[4].sh_name = shstr_offsets[4];
-    shdr[4].sh_type = SHT_STRTAB;
-    shdr[4].sh_offset = strtab_offset;
-    shdr[4].sh_size = strtab_size;
-    shdr[4].sh_addralign = 1;
-
-    /* .shstrtab */
-    shdr[5].sh_name = shstr_offsets[5];
-    shdr[5].sh_type = SHT_STRTAB;
-    shdr[5].sh_offset = shstrtab_offset;
-    shdr[5].sh_size = shstrtab_size;
-    shdr[5].sh_addralign = 1;
-
-    /* .rela.text */
-    shdr[6].sh_name = shstr_offsets[6];
-    shdr[6].sh_type = SHT_RELA;
-    shdr[6].sh_offset = rela_text_offset;
-    shdr[6].sh_size = n_rela_text * sizeof(Elf64_Rela);
-    shdr[6].sh_link = 3; /* symtab */
-    shdr[6].sh_info = 1; /* text section index */
-    shdr[6].sh_addralign = 8;
-    shdr[6].sh_entsize = sizeof(Elf64_Rela);
-
-    /* .rela.data */
-    shdr[7].sh_name = shstr_offsets[7];
-    shdr[7].sh_type = SHT_RELA;
-    shdr[7].sh_offset = rela_data_offset;
-    shdr[7].sh_size = n_rela_data * sizeof(Elf64_Rela);
-    shdr[7].sh_link = 3; /* symtab */
-    shdr[7].sh_info = 2; /* data section index */
-    shdr[7].sh_addralign = 8;
-    shdr[7].sh_entsize = sizeof(Elf64_Rela);
-
-    if (pwrite(fd, shdr, sizeof(shdr), ehdr.e_shoff) < 0) { perror("write shdr"); goto fail; }
+    if (pwrite(fd, shdr, shnum * sizeof(Elf64_Shdr), ehdr.e_shoff) < 0) { perror("write shdr"); goto fail; }
 
+    free(shndx);
+    free(nrela);
+    free(rela_ndx);
+    free(shdr);
     free(shstrtab_buf);
     free(strtab_buf);
     free(syms);
+    free(symidx);
     close(fd);
     return 0;
 
 fail:
+    free(shndx);
+    free(nrela);
+    free(rela_ndx);
+    free(shdr);
     free(shstrtab_buf);
     free(strtab_buf);
     free(syms);
+    free(symidx);
     close(fd);
     return -1;
 }
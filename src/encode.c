@@ -1,10 +1,16 @@
 #define _XOPEN_SOURCE 500
+#define _POSIX_C_SOURCE 200809L
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
 #include <stdbool.h>
+#include <ctype.h>
+#include <elf.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #include "jasm.h"
 
 // -------------------- Register encoding --------------------
@@ -48,10 +54,40 @@ static RegMap regs[] = {
     {"%r12w",12}, {"%r13w",13}, {"%r14w",14}, {"%r15w",15},
     {"%r8b",8}, {"%r9b",9}, {"%r10b",10}, {"%r11b",11},
     {"%r12b",12}, {"%r13b",13}, {"%r14b",14}, {"%r15b",15},
+    // SSE
+    {"%xmm0",0}, {"%xmm1",1}, {"%xmm2",2}, {"%xmm3",3},
+    {"%xmm4",4}, {"%xmm5",5}, {"%xmm6",6}, {"%xmm7",7},
+    {"%xmm8",8}, {"%xmm9",9}, {"%xmm10",10}, {"%xmm11",11},
+    {"%xmm12",12}, {"%xmm13",13}, {"%xmm14",14}, {"%xmm15",15},
+    // AVX
+    {"%ymm0",0}, {"%ymm1",1}, {"%ymm2",2}, {"%ymm3",3},
+    {"%ymm4",4}, {"%ymm5",5}, {"%ymm6",6}, {"%ymm7",7},
+    {"%ymm8",8}, {"%ymm9",9}, {"%ymm10",10}, {"%ymm11",11},
+    {"%ymm12",12}, {"%ymm13",13}, {"%ymm14",14}, {"%ymm15",15},
+    // AVX-512: registers 16-31 need EVEX
+    {"%xmm16",16}, {"%xmm17",17}, {"%xmm18",18}, {"%xmm19",19},
+    {"%xmm20",20}, {"%xmm21",21}, {"%xmm22",22}, {"%xmm23",23},
+    {"%xmm24",24}, {"%xmm25",25}, {"%xmm26",26}, {"%xmm27",27},
+    {"%xmm28",28}, {"%xmm29",29}, {"%xmm30",30}, {"%xmm31",31},
+    {"%ymm16",16}, {"%ymm17",17}, {"%ymm18",18}, {"%ymm19",19},
+    {"%ymm20",20}, {"%ymm21",21}, {"%ymm22",22}, {"%ymm23",23},
+    {"%ymm24",24}, {"%ymm25",25}, {"%ymm26",26}, {"%ymm27",27},
+    {"%ymm28",28}, {"%ymm29",29}, {"%ymm30",30}, {"%ymm31",31},
+    {"%zmm0",0}, {"%zmm1",1}, {"%zmm2",2}, {"%zmm3",3},
+    {"%zmm4",4}, {"%zmm5",5}, {"%zmm6",6}, {"%zmm7",7},
+    {"%zmm8",8}, {"%zmm9",9}, {"%zmm10",10}, {"%zmm11",11},
+    {"%zmm12",12}, {"%zmm13",13}, {"%zmm14",14}, {"%zmm15",15},
+    {"%zmm16",16}, {"%zmm17",17}, {"%zmm18",18}, {"%zmm19",19},
+    {"%zmm20",20}, {"%zmm21",21}, {"%zmm22",22}, {"%zmm23",23},
+    {"%zmm24",24}, {"%zmm25",25}, {"%zmm26",26}, {"%zmm27",27},
+    {"%zmm28",28}, {"%zmm29",29}, {"%zmm30",30}, {"%zmm31",31},
+    // AVX-512 opmasks
+    {"%k0",0}, {"%k1",1}, {"%k2",2}, {"%k3",3},
+    {"%k4",4}, {"%k5",5}, {"%k6",6}, {"%k7",7},
     {NULL,0}
 };
 
-static int reg_code(const char *r) {
+int reg_code(const char *r) {
     if(!r) return -1;
     for(int i=0; regs[i].name; i++)
         if(strcmp(r,regs[i].name)==0) return regs[i].code;
@@ -59,10 +95,14 @@ static int reg_code(const char *r) {
 }
 
 
-static int reg_size(const char *r) {
+int reg_size(const char *r) {
     if (!r) return 64;
     if (r[0] == '%') r++;
     size_t len = strlen(r);
+    if (!strncmp(r, "xmm", 3)) return 128;
+    if (!strncmp(r, "ymm", 3)) return 256;
+    if (!strncmp(r, "zmm", 3)) return 512;
+    if (r[0] == 'k') return 64;
 
     // 8-bit new low
     if (r[len-1] == 'l') return 8;  // legacy low?
@@ -74,10 +114,10 @@ static int reg_size(const char *r) {
     return 16; // else
 }
 
-inline static bool check_need_sib(int rm) {
-
-    if (rm == 4 || rm == 12) return true;
-    return false;
+const char *reg_name(int code, int size) {
+    for (int i = 0; regs[i].name; i++)
+        if (regs[i].code == code && reg_size(regs[i].name) == size) return regs[i].name;
+    return NULL;
 }
 
 // -------------------- REX prefix --------------------
@@ -90,1940 +130,4163 @@ static void emit_rex(uint8_t **out, bool w, bool r, bool b, bool x) {
     *(*out)++ = rex;
 }
 
-static void emit_sib(uint8_t **out, int scale, int index, int base) {
-    uint8_t sib = 0x00;
-    sib |= (scale << 6);
-    if (index == -1) sib |= 4;
-    else sib |= (index & 5) << 3;
-    sib |= base & 5;
-    *(*out)++ = sib;
+// %spl, %bpl, %sil and %dil are only reachable with a REX prefix
+static bool is_rex_byte_reg(const char *r) {
+    return r && (!strcmp(r, "%sil") || !strcmp(r, "%dil") || !strcmp(r, "%bpl") || !strcmp(r, "%spl"));
 }
 
+// %k0-%k7: AVX-512 opmasks, not general registers
+static bool is_mask_reg(const char *r) {
+    return r && !strncmp(r, "%k", 2) && reg_code(r) >= 0;
+}
 
+static bool is_high_byte_reg(const char *r) {
+    return r && r[strlen(r)-1] == 'h';
+}
 
-size_t encode_mov_reg_reg(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
-    int sz = reg_size(dst->reg);
-    if (sz != reg_size(src->reg)) {
-        fprintf(stderr, "Size mismatch: %s vs %s\n", dst->reg, src->reg);
-        return 0;
-    }
-
-    int r = reg_code(src->reg);
-    int rm = reg_code(dst->reg);
+static size_t emit_imm(uint8_t *out, long imm, int bytes) {
+    for (int i = 0; i < bytes; i++) out[i] = (uint8_t)(imm >> (8 * i));
+    return bytes;
+}
 
-    bool rex_w = (sz == 64);
-    bool rex_r = (r & 8) != 0;
-    bool rex_b = (rm & 8) != 0;
+// -------------------- Memory operands --------------------
+// disp(base, index, scale) goes into ModRM, an optional SIB byte and a 0, 1 or
+// 4 byte displacement. Two encodings are taken: rm=100 means "SIB follows",
+// so %rsp/%r12 bases need a SIB byte, and mod=00 rm=101 means RIP-relative
+// (SIB base=101 means "no base"), so %rbp/%r13 bases need a displacement.
+// sym(%rip) operands are resolved once the instruction's length is known.
+
+// the sym(%rip) operand last encoded, its disp32 field, and the opcode, ModRM
+// reg field and REX use of its instruction (for choosing a GOT relocation)
+static MemOperand rip_ref;
+static uint8_t *rip_disp;
+static uint32_t rip_opcode;
+static int rip_reg;
+static bool rip_rex;
+
+static bool is_rip(MemOperand *m) {
+    return m->base && !strcmp(m->base, "%rip");
+}
 
-    // force REX for new 8-bit registers
-    bool needs_rex = rex_w || rex_r || rex_b ||
-        !strcmp(dst->reg, "%sil") || !strcmp(dst->reg, "%dil") || !strcmp(dst->reg, "%bpl") || !strcmp(dst->reg, "%spl") ||
-        !strcmp(src->reg, "%sil") || !strcmp(src->reg, "%dil") || !strcmp(src->reg, "%bpl") || !strcmp(src->reg, "%spl");
+static int scale_bits(int scale) {
+    switch (scale) {
+        case 1: return 0;
+        case 2: return 1;
+        case 4: return 2;
+        case 8: return 3;
+        default: return -1;
+    }
+}
 
-    bool high = (src->reg[strlen(src->reg)-1] == 'h') || (dst->reg[strlen(dst->reg)-1] == 'h');
+// vsib: the index is a vector register, one address per element (gathers)
+static bool mem_regs(MemOperand *m, int *base, int *index, bool vsib) {
+    *base = m->base ? reg_code(m->base) : -1;
+    *index = m->index ? reg_code(m->index) : -1;
 
+    if (is_rip(m)) {
+        if (m->index) {
+            fprintf(stderr, "%%rip cannot be used with an index register\n");
+            return false;
+        }
+        return true;
+    }
+    if (m->sym) {
+        fprintf(stderr, "Symbol %s needs a %%rip base\n", m->sym);
+        return false;
+    }
+    if (m->base && (*base < 0 || reg_size(m->base) < 32 || reg_size(m->base) > 64)) {
+        fprintf(stderr, "Invalid base register: %s\n", m->base);
+        return false;
+    }
+    if (m->index && (*index < 0 || reg_size(m->index) < 32 || (reg_size(m->index) > 64) != vsib)) {
+        fprintf(stderr, "Invalid index register: %s\n", m->index);
+        return false;
+    }
+    if (*index == 4 && !vsib) {
+        fprintf(stderr, "%s cannot be an index register\n", m->index);
+        return false;
+    }
+    if (m->base && m->index && !vsib && reg_size(m->base) != reg_size(m->index)) {
+        fprintf(stderr, "Address size mismatch: %s vs %s\n", m->base, m->index);
+        return false;
+    }
+    if (scale_bits(m->scale) < 0) {
+        fprintf(stderr, "Invalid scale: %d\n", m->scale);
+        return false;
+    }
+    if (m->disp < INT32_MIN || m->disp > INT32_MAX) {
+        fprintf(stderr, "Displacement out of range: %ld\n", m->disp);
+        return false;
+    }
+    return true;
+}
 
-    if (high && needs_rex) {
-        fprintf(stderr, "High register not supported with REX prefix\n");
-        exit(1);
+// n scales an 8-bit displacement (EVEX disp8*N), 1 otherwise
+static void emit_modrm_mem(uint8_t **out, int reg, MemOperand *m, int n) {
+    int base = m->base ? reg_code(m->base) : -1;
+    int index = m->index ? reg_code(m->index) : -1;
+    int32_t disp = (int32_t)m->disp;
+    uint8_t *p = *out;
+    reg &= 7;
+
+    if (is_rip(m)) {
+        *p++ = (reg << 3) | 5;
+        if (m->sym) {
+            rip_ref = *m;
+            rip_disp = p;
+        }
+        p += emit_imm(p, disp, 4);
+        *out = p;
+        return;
     }
 
-    switch (sz) {
-        case 8:
-            if (needs_rex && !high) {emit_rex(&out, rex_w, rex_r, rex_b, 0);}
-            *out++ = 0x88; // MOV r/m8, r8
-            *out++ = (0b11 << 6) | ((r & 7) << 3) | (rm & 7);
-            size += needs_rex ? 3 : 2;
-            break;
-        case 16:
-            *out++ = 0x66; // operand-size prefix
-            if (needs_rex && !high) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x89; 
-            *out++ = (0b11 << 6) | ((r & 7) << 3) | (rm & 7);
-            size += 3;
-            break;
-        case 64:
-        case 32:
-            if (needs_rex && !high) {emit_rex(&out, rex_w, rex_r, rex_b, 0);}
-            *out++ = 0x89;
-            *out++ = (0b11 << 6) | ((r & 7) << 3) | (rm & 7);
-            size += needs_rex ? 3 : 2;
-            break;
+    if (base < 0) {
+        // no base: SIB with base=101 and a disp32, index 100 if there is none
+        *p++ = (reg << 3) | 4;
+        *p++ = (scale_bits(m->scale) << 6) | ((index < 0 ? 4 : index & 7) << 3) | 5;
+        p += emit_imm(p, disp, 4);
+        *out = p;
+        return;
     }
-    return size;
-}
 
-size_t encode_mov_imm_reg(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
+    bool disp8 = disp % n == 0 && disp / n >= -128 && disp / n <= 127;
+    int mod = (disp == 0 && (base & 7) != 5) ? 0 : disp8 ? 1 : 2;
+    bool sib = index >= 0 || (base & 7) == 4;
 
-    int sz = reg_size(dst->reg);
+    *p++ = (mod << 6) | (reg << 3) | (sib ? 4 : base & 7);
+    if (sib)
+        *p++ = (scale_bits(m->scale) << 6) | ((index < 0 ? 4 : index & 7) << 3) | (base & 7);
+    if (mod == 1) p += emit_imm(p, disp / n, 1);
+    if (mod == 2) p += emit_imm(p, disp, 4);
+    *out = p;
+}
 
-    
-    int rm = reg_code(dst->reg);
+// Opcodes are written as their byte sequence: 0x01, 0x0FAF, 0x0F38F0.
+static void emit_opcode(uint8_t **out, uint32_t opcode) {
+    if (opcode > 0xFFFF) *(*out)++ = opcode >> 16;
+    if (opcode > 0xFF) *(*out)++ = opcode >> 8;
+    *(*out)++ = opcode;
+}
+
+// Instruction with a ModRM operand: [67] [66] [prefix] [REX] opcode ModRM
+// [SIB] [disp]. reg is the ModRM reg field, a register code or the /digit of
+// a group opcode, and regname the register (NULL for a /digit). rm is a
+// register or memory operand. sz is the operand size (16 adds 66, 64 REX.W),
+// 0 for instructions whose size does not depend on prefixes; prefix is a
+// mandatory F2/F3 prefix or 0.
+static size_t encode_rm(uint8_t *out, uint8_t prefix, uint32_t opcode, int sz, int reg, const char *regname, Operand *rm) {
+    uint8_t *start = out;
+    int base = -1, index = -1;
+    const char *rmname = NULL;
+
+    if (rm->kind == OP_MEM) {
+        if (!mem_regs(&rm->mem, &base, &index, false)) return 0;
+    } else if (rm->kind == OP_REG && (base = reg_code(rm->reg)) >= 0) {
+        rmname = rm->reg;
+    } else {
+        fprintf(stderr, "Invalid operand: %s\n", rm->kind == OP_REG ? rm->reg : "expected register or memory");
+        return 0;
+    }
+    if (regname && reg < 0) {
+        fprintf(stderr, "Invalid register: %s\n", regname);
+        return 0;
+    }
+    // registers 16-31 and the opmasks have no REX encoding
+    if (reg > 15 || is_mask_reg(regname) || base > 15 || is_mask_reg(rmname)) {
+        fprintf(stderr, "Invalid register: %s\n", reg > 15 || is_mask_reg(regname) ? regname : rmname);
+        return 0;
+    }
 
     bool rex_w = (sz == 64);
-    bool rex_b = (rm & 8) != 0;
+    bool rex_r = (reg & 8) != 0;
+    bool rex_x = index >= 0 && (index & 8);
+    bool rex_b = base >= 0 && (base & 8);
+    bool needs_rex = rex_w || rex_r || rex_x || rex_b || is_rex_byte_reg(regname) || is_rex_byte_reg(rmname);
 
+    if ((is_high_byte_reg(regname) || is_high_byte_reg(rmname)) && needs_rex) {
+        fprintf(stderr, "High register not supported with REX prefix\n");
+        exit(1);
+    }
 
+    // 32-bit address registers take the address-size prefix
+    MemOperand *m = rm->kind == OP_MEM ? &rm->mem : NULL;
+    if (m && ((m->base && reg_size(m->base) == 32) || (m->index && reg_size(m->index) == 32)))
+        *out++ = 0x67;
+    if (sz == 16) *out++ = 0x66;
+    if (prefix) *out++ = prefix;
+    if (needs_rex) emit_rex(&out, rex_w, rex_r, rex_b, rex_x);
+    emit_opcode(&out, opcode);
+
+    if (!m) {
+        *out++ = (0b11 << 6) | ((reg & 7) << 3) | (base & 7);
+        return out - start;
+    }
 
-    bool needs_rex = rex_w || rex_b ||
-        !strcmp(dst->reg, "%sil") || !strcmp(dst->reg, "%dil") || !strcmp(dst->reg, "%bpl") || !strcmp(dst->reg, "%spl");
+    emit_modrm_mem(&out, reg, m, 1);
+    if (is_rip(m) && m->sym) {
+        rip_opcode = opcode;
+        rip_reg = reg & 7;
+        rip_rex = needs_rex;
+    }
+    return out - start;
+}
 
-    switch (sz) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0xB0 + reg_code(dst->reg);
-            *out++ = (uint8_t)src->imm;
-            size += 2;
-            break;
-        case 16:
-            *out++ = 0x66;
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            if (rm > 7) rm -= 8;
-            *out++ = 0xB8 + rm;
-            *((uint16_t*)out) = (uint16_t)src->imm;
-            out += 2;
-            size += 4;
-            break;
-        case 32:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            if (rm > 7) rm -= 8;
-            *out++ = 0xB8 + rm;
-            *((uint32_t*)out) = (uint32_t)src->imm;
-            out += 4;
-            size += 6;
-            break;
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            if (rm > 7) rm -= 8;
-            *out++ = 0xC7;
-            *out++ = (0b11 << 6) | (rm & 7);
-            *((uint32_t*)out) = (uint32_t)src->imm;
-            out += 4;
-            size += 6;
-            break;
+// Register in the low bits of the opcode (push, pop, mov $imm, xchg, bswap):
+// [66] [REX] opcode+r
+static size_t encode_opreg(uint8_t *out, uint32_t opcode, int sz, Operand *r) {
+    uint8_t *start = out;
+    int code = reg_code(r->reg);
+    if (code < 0) {
+        fprintf(stderr, "Invalid register: %s\n", r->reg);
+        return 0;
     }
-    return size;
+    bool rex_w = (sz == 64);
+    bool rex_b = (code & 8) != 0;
+    if (sz == 16) *out++ = 0x66;
+    if (rex_w || rex_b || is_rex_byte_reg(r->reg)) emit_rex(&out, rex_w, 0, rex_b, 0);
+    emit_opcode(&out, opcode + (code & 7));
+    return out - start;
 }
 
-size_t encode_mov_reg_mem(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
+// -------------------- Immediates --------------------
 
-    int sz = reg_size(src->reg);
+// imm as the sz-bit value the instruction sees (sign-extended when a 64-bit
+// operation takes a 32-bit immediate)
+static long imm_value(long imm, int sz) {
+    switch (sz) {
+        case 8: return (int8_t)imm;
+        case 16: return (int16_t)imm;
+        case 32: return (int32_t)imm;
+        default: return imm;
+    }
+}
 
-    int src_sz = reg_size(dst->mem.base);
+static bool imm_fits(long imm, int sz) {
+    switch (sz) {
+        case 8: return imm >= INT8_MIN && imm <= UINT8_MAX;
+        case 16: return imm >= INT16_MIN && imm <= UINT16_MAX;
+        case 32: return imm >= INT32_MIN && imm <= UINT32_MAX;
+        default: return imm >= INT32_MIN && imm <= INT32_MAX;
+    }
+}
 
-    int rm = reg_code(dst->mem.base);
-    int reg = reg_code(src->reg);
+static bool is_imm8(long imm, int sz) {
+    long v = imm_value(imm, sz);
+    return v >= INT8_MIN && v <= INT8_MAX;
+}
 
-    bool rex_w = (sz == 64);
-    bool rex_r = (reg & 8) != 0;
-    bool rex_b = (rm & 8) != 0;
+// bytes of a full-size immediate: ib, iw or id (64-bit operations take id)
+static int imm_bytes(int sz) {
+    return sz == 8 ? 1 : sz == 16 ? 2 : 4;
+}
 
-    bool needs_rex = rex_w || rex_b || rex_r ||
-        !strcmp(src->reg, "%sil") || !strcmp(src->reg, "%dil") || !strcmp(src->reg, "%bpl") || !strcmp(src->reg, "%spl");
+static Label *lookup_label(LabelTable *label_table, const char *name) {
+    for (Label *l = label_table->entries; l < label_table->entries + label_table->count; l++) {
+        if (strcmp(l->name, name) == 0)
+            return l;
+    }
+    return NULL;
+}
 
+// jmp
 
-    bool needs_sib = check_need_sib(rm);
+// opcode is the rel32 form (E9, or the second byte of 0F 8x); layout decides
+// whether the target is close enough for the rel8 form (EB / 7x).
+static size_t encode_rel_jmps(uint8_t *out, Operand* dst, size_t pos, LabelTable *label_table, uint8_t opcode, bool opcode16, bool rel8) {
+    size_t size = rel8 ? 2 : (opcode16 ? 6 : 5);
 
+    if (!label_table) {
+        return size;
+    }
 
-    if (src_sz != 32 && src_sz != 64) {
-        fprintf(stderr, "Invalid source size: %d\n", src_sz);
+    Label* l = lookup_label(label_table, dst->labelref);
+    if (!l) {
+        fprintf(stderr, "Label not found: %s\n", dst->labelref);
         return 0;
     }
 
-    if (rm > 7) rm -= 8;
-    if (reg > 7) reg -= 8;
+    int32_t offset = l->address - pos - size;
 
-    if (src_sz == 32) {
-        *out++ = 0x67;
-        size++;
+    // the linker places other sections, so the displacement becomes a PC32
+    // reloc; external and @PLT targets go through the PLT if they need one
+    bool reloc = args->outformat == OF_ELF && l->section != cur_section;
+    if (reloc) {
+        offset = 0;
+        bool plt = l->section == SECTION_UNDEF || dst->labelmod == SYM_PLT;
+        if (stage == STAGE2)
+            emit_reloc(&G_relocs, l, pos + size - 4, cur_section, plt ? R_X86_64_PLT32 : R_X86_64_PC32, -4);
     }
 
-    
-    if (rm == 0b101) {
-        // modrm would give rip as base
-        switch (sz) {
-            case 8:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x88;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-            case 16:
-                *out++ = 0x66;
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x89;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 4;
-                break;
-            case 32:
-            case 64:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x89;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-        }
+    if (rel8) {
+        *out++ = opcode16 ? 0x70 | (opcode & 0x0F) : 0xEB;
+        *out++ = (int8_t)offset;
         return size;
     }
 
-    switch (sz) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x88;
-            if (reg > 7) reg -= 8;
-            if (rm > 7) rm -= 8;
-            *out++ = (reg << 3) | rm;
-            size += 2;
-            break;
-        case 16:
-            *out++ = 0x66;
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x89;
-            if (reg > 7) reg -= 8;
-            if (rm > 7) rm -= 8;
-            *out++ = (reg << 3) | rm;
-            size += 3;
-            break;
-        case 32:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x89;
-            if (reg > 7) reg -= 8;
-            if (rm > 7) rm -= 8;
-            *out++ = (reg << 3) | rm;
-            size += 3;
-            break;
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x89;
-            if (reg > 7) reg -= 8;
-            if (rm > 7) rm -= 8;
-            *out++ = (reg << 3) | rm;
-            size += 3;
-            break;
-    }
-
-    if (needs_sib) {
-        emit_sib(&out, 0, 0b100, reg_code(dst->mem.base));
-        size++;
+    if (opcode16) {
+        *out++ = 0x0F;
     }
+    *out++ = opcode & 0xFF;
+
+    *((int32_t*)out) = (int32_t)offset;
+    out += 4;
+
     return size;
 }
 
-size_t encode_mov_mem_reg(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
-    int sz = reg_size(dst->reg);
-
+// int
 
-    int mem_sz = reg_size(src->mem.base);
+static size_t encode_int(uint8_t *out, Operand* dst) {
+    int imm = dst->imm;
 
+    if (imm == 3) {
+        *out++ = 0xCC;
+        return 1;
+    }
     
-    int rm = reg_code(src->mem.base);
-    int reg = reg_code(dst->reg);
+    if (imm == 1) {
+        *out++ = 0xF1;
+        return 1;
+    }
 
-    bool needs_sib = check_need_sib(rm);
+    if (imm <= 0xFF) {
+        *out++ = 0xCD;
+        *out++ = imm;
+        return 2;
+    }
+    return 0;
+}
 
-    bool rex_w = (sz == 64);
-    bool rex_b = (rm & 8) != 0;
-    bool rex_r = (reg & 8) != 0;
+// -------------------- Strip suffix --------------------
+static void base_opcode(const char *opc,char *buf){
+    size_t len=strlen(opc);
+    strcpy(buf,opc);
+    if (!strcmp(opc, "sub") || !strcmp(opc, "syscall") || !strcmp(opc, "call"))
+        return;
+    if(len>1){
+        char last=opc[len-1];
+        if(last=='b'||last=='w'||last=='l'||last=='q') buf[len-1]=0;
+    }
+}
 
+// -------------------- Integer instructions --------------------
+// One table entry per mnemonic; the encoder picks the form from the operand
+// kinds. Operands are in AT&T order: source first, destination last.
 
+typedef struct InsnDef InsnDef;
 
-    bool needs_rex = rex_w || rex_b || rex_r ||
-        !strcmp(dst->reg, "%sil") || !strcmp(dst->reg, "%dil") || !strcmp(dst->reg, "%bpl") || !strcmp(dst->reg, "%spl");
+typedef struct {
+    Instruction *inst;
+    const InsnDef *def;
+    int suffix;             // operand size from a b/w/l/q suffix, 0 if none
+    size_t pos;
+    LabelTable *label_table;
+    uint8_t cc;             // condition code of jcc, setcc and cmovcc
+} InsnCtx;
+
+// where a lock prefix is legal: read-modify-write forms with a memory
+// destination, or for xchg a memory operand on either side
+enum { LOCK_MEM_DST = 1, LOCK_MEM_ANY };
+
+// CPU features beyond baseline x86-64 (SSE2), for -march
+enum {
+    ISA_SSE3 = 1 << 0,
+    ISA_SSSE3 = 1 << 1,
+    ISA_SSE41 = 1 << 2,
+    ISA_SSE42 = 1 << 3,
+    ISA_POPCNT = 1 << 4,
+    ISA_CX16 = 1 << 5,
+    ISA_AVX = 1 << 6,
+    ISA_AVX2 = 1 << 7,
+    ISA_BMI1 = 1 << 8,
+    ISA_BMI2 = 1 << 9,
+    ISA_FMA = 1 << 10,
+    ISA_LZCNT = 1 << 11,
+    ISA_MOVBE = 1 << 12,
+    ISA_AVX512F = 1 << 13,
+    ISA_AVX512VL = 1 << 14,
+    ISA_AVX512BW = 1 << 15,
+    ISA_AVX512DQ = 1 << 16,
+    ISA_AVX512CD = 1 << 17,
+    ISA_ADX = 1 << 18,
+    ISA_CLFLUSHOPT = 1 << 19,
+    ISA_CLWB = 1 << 20,
+    ISA_PRFCHW = 1 << 21,
+    ISA_RDTSCP = 1 << 22,
+    ISA_SERIALIZE = 1 << 23,
+
+    // VEX integer instructions: AVX on %xmm, AVX2 on %ymm
+    ISA_AVX_INT = ISA_AVX | ISA_AVX2,
+};
 
+// x86-64 psABI microarchitecture levels
+#define ISA_V2 (ISA_CX16 | ISA_POPCNT | ISA_SSE3 | ISA_SSSE3 | ISA_SSE41 | ISA_SSE42)
+#define ISA_V3 (ISA_V2 | ISA_AVX | ISA_AVX2 | ISA_BMI1 | ISA_BMI2 | ISA_FMA | ISA_LZCNT | ISA_MOVBE)
+#define ISA_V4 (ISA_V3 | ISA_AVX512F | ISA_AVX512VL | ISA_AVX512BW | ISA_AVX512DQ | ISA_AVX512CD)
+
+// gas spellings, used for +feat/-feat and in diagnostics
+static const struct { const char *name; uint32_t bit; } isa_names[] = {
+    {"sse3", ISA_SSE3}, {"ssse3", ISA_SSSE3}, {"sse4.1", ISA_SSE41}, {"sse4.2", ISA_SSE42},
+    {"popcnt", ISA_POPCNT}, {"cx16", ISA_CX16}, {"avx", ISA_AVX}, {"avx2", ISA_AVX2},
+    {"bmi", ISA_BMI1}, {"bmi2", ISA_BMI2}, {"fma", ISA_FMA}, {"lzcnt", ISA_LZCNT}, {"movbe", ISA_MOVBE},
+    {"avx512f", ISA_AVX512F}, {"avx512vl", ISA_AVX512VL}, {"avx512bw", ISA_AVX512BW},
+    {"avx512dq", ISA_AVX512DQ}, {"avx512cd", ISA_AVX512CD}, {"adx", ISA_ADX},
+    {"clflushopt", ISA_CLFLUSHOPT}, {"clwb", ISA_CLWB}, {"prfchw", ISA_PRFCHW},
+    {"rdtscp", ISA_RDTSCP}, {"serialize", ISA_SERIALIZE},
+};
 
-    if (mem_sz == 32) {
-        *out++ = 0x67;
-        size++;
+// -march=LEVEL[+feat|-feat]..., LEVEL one of x86-64, x86-64-v2/v3/v4 or v2/v3/v4
+bool parse_march(const char *spec, uint32_t *isa) {
+    static const struct { const char *name; uint32_t isa; } levels[] = {
+        {"x86-64-v4", ISA_V4}, {"x86-64-v3", ISA_V3}, {"x86-64-v2", ISA_V2}, {"x86-64", 0},
+        {"v4", ISA_V4}, {"v3", ISA_V3}, {"v2", ISA_V2},
+    };
+    const char *p = NULL;
+    for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]) && !p; i++) {
+        size_t n = strlen(levels[i].name);
+        if (!strncmp(spec, levels[i].name, n) && (!spec[n] || spec[n] == '+' || spec[n] == '-')) {
+            *isa = levels[i].isa;
+            p = spec + n;
+        }
     }
-
-    if (rm > 7) rm -= 8;
-    if (reg > 7) reg -= 8;
-
-    if (rm == 0b101) {
-        // modrm would give rip as base
-        switch (sz) {
-            case 8:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x8A;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-            case 16:
-                *out++ = 0x66;
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x8B;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 4;
-                break;
-            case 32:
-            case 64:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x8B;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
+    if (!p) {
+        fprintf(stderr, "Unknown -march level: %s\n", spec);
+        return false;
+    }
+    while (*p) {
+        bool on = *p++ == '+';
+        size_t n = strcspn(p, "+-");
+        size_t i = 0;
+        while (i < sizeof(isa_names) / sizeof(isa_names[0]) &&
+               (strlen(isa_names[i].name) != n || strncmp(p, isa_names[i].name, n))) i++;
+        if (i == sizeof(isa_names) / sizeof(isa_names[0])) {
+            fprintf(stderr, "Unknown -march feature: %.*s\n", (int)n, p);
+            return false;
         }
-        return size;
+        *isa = on ? *isa | isa_names[i].bit : *isa & ~isa_names[i].bit;
+        p += n;
     }
+    return true;
+}
 
+// features the instruction last encoded needs, ISA_* bits
+static uint32_t insn_isa;
 
+struct InsnDef {
+    const char *name;
+    size_t (*encode)(uint8_t *out, InsnCtx *c);
+    uint32_t op;            // opcode, or the base opcode of the family
+    uint8_t ext;            // ModRM /digit, or the source size of movzx/movsx
+    uint8_t size;           // fixed operand size, 0 if given by the operands
+    uint8_t lock;           // LOCK_*, 0 if lock is not allowed
+    uint32_t isa;           // ISA_* features required, 0 for baseline x86-64
+};
 
-    switch (sz) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x8A;
-            *out++ = (reg << 3) | rm;
-            size += 2;
-            break;
-        case 16:
-            *out++ = 0x66;
-            /* FALLTHRU */
-        case 32:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x8B;
-            *out++ = (reg << 3) | rm;
-            size += 3;
-            break;
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x8B;
-            *out++ = (reg << 3) | rm;
-            size += 3;
-            break;
-    }
-    
-    if (needs_sib) {
-        emit_sib(&out, 0, 0b100, reg_code(src->mem.base));
-        size++;
-    }
-
-    return size;
+static size_t bad_operands(InsnCtx *c) {
+    fprintf(stderr, "Invalid operands for %s\n", c->inst->opcode);
+    return 0;
 }
 
-size_t encode_mov_mem_imm(uint8_t *out, Operand* dst, Operand* src, Label* label) {
-    size_t size = 0;
+static Operand *operand(InsnCtx *c, size_t i) {
+    return c->inst->operands[i];
+}
 
-    int mem_reg_size = reg_size(dst->mem.base);
-    int mem_sz = dst->mem.size;
+static bool is_gpr_operand(const Operand *o) {
+    return o->kind == OP_REG && reg_code(o->reg) >= 0 && reg_size(o->reg) <= 64 && !is_mask_reg(o->reg);
+}
 
-    if (mem_sz == 0) {
-        fprintf(stderr, "mov imm, mem: size not specified\n");
-        return 0;
+// Operand size from the register operands, which must be general registers
+// and agree with each other and with a suffix; memory and immediate forms
+// need the suffix.
+static int insn_size(InsnCtx *c, Operand *a, Operand *b) {
+    int sz = 0;
+    Operand *ops[2] = {a, b};
+    for (int i = 0; i < 2; i++) {
+        if (!ops[i] || ops[i]->kind != OP_REG) continue;
+        // vector and mask registers have no general-register encoding
+        if (!is_gpr_operand(ops[i])) return bad_operands(c);
+        int s = reg_size(ops[i]->reg);
+        if (sz && s != sz) {
+            fprintf(stderr, "Size mismatch: %s vs %s\n", a->reg, b->reg);
+            return 0;
+        }
+        sz = s;
     }
+    if (c->suffix) {
+        if (sz && sz != c->suffix) {
+            fprintf(stderr, "Size mismatch: %s with %d-bit register\n", c->inst->opcode, sz);
+            return 0;
+        }
+        sz = c->suffix;
+    }
+    if (!sz) fprintf(stderr, "%s: operand size not specified\n", c->inst->opcode);
+    return sz;
+}
 
-    int rm = reg_code(dst->mem.base);
-
+static bool check_imm(long imm, int sz) {
+    if (imm_fits(imm, sz)) return true;
+    fprintf(stderr, "Immediate out of range for %d-bit operand: %ld\n", sz, imm);
+    return false;
+}
 
-    bool rex_w = (mem_sz == 64);
-    bool rex_b = (rm & 8) != 0;
+// Group-1 immediate: 80 /ext ib, 83 /ext ib or 81 /ext iw/id, or the short
+// accumulator form acc/acc+1 when the immediate needs its full size
+static size_t encode_grp1(uint8_t *out, int ext, uint8_t acc, Operand *dst, long imm, int sz) {
+    if (!check_imm(imm, sz)) return 0;
+    bool imm8 = sz == 8 || is_imm8(imm, sz);
+
+    if (dst->kind == OP_REG && reg_code(dst->reg) == 0 && (sz == 8 || !imm8)) {
+        uint8_t *start = out;
+        if (sz == 16) *out++ = 0x66;
+        if (sz == 64) emit_rex(&out, 1, 0, 0, 0);
+        *out++ = acc + (sz != 8);
+        out += emit_imm(out, imm, imm_bytes(sz));
+        return out - start;
+    }
 
-    if (rm > 7) rm -= 8;
+    size_t size = encode_rm(out, 0, sz == 8 ? 0x80 : imm8 ? 0x83 : 0x81, sz, ext, NULL, dst);
+    if (!size) return 0;
+    return size + emit_imm(out + size, imm, imm8 ? 1 : imm_bytes(sz));
+}
 
+// add or adc sbb and sub xor cmp: op is the r/m8, r8 opcode of the family
+static size_t enc_alu(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    int sz = insn_size(c, src, dst);
+    if (!sz) return 0;
+
+    uint8_t op = c->def->op;
+    if (src->kind == OP_IMM) return encode_grp1(out, c->def->ext, op + 4, dst, src->imm, sz);
+    if (src->kind == OP_REG) return encode_rm(out, 0, op + (sz != 8), sz, reg_code(src->reg), src->reg, dst);
+    if (dst->kind == OP_REG) return encode_rm(out, 0, op + 2 + (sz != 8), sz, reg_code(dst->reg), dst->reg, src);
+    return bad_operands(c);
+}
 
-    bool needs_rex = rex_w || rex_b;
-    if (mem_reg_size == 32) {
-        *out++ = 0x67;
-        size++;
-    }
-
-    switch (mem_sz) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0xc6;
-            
-            *out++ = rm;
-            *out++ = src->imm;
-            size += 3;
-            break;
-        case 16:
-            *out++ = 0x66;
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0xc7;
-            *out++ = rm;
-            *((uint16_t*)out) = (uint16_t)src->imm;
-            out += 2;
-            size += 5;
-            break;
-        case 32:
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0xc7;
-            *out++ = rm;
-            *((uint32_t*)out) = (uint32_t)src->imm;
-            out += 4;
-            size += 7;
-            break;
+static size_t enc_test(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    if (src->kind == OP_MEM && dst->kind == OP_REG) {
+        // test is symmetric; the register goes in the reg field
+        Operand *t = src; src = dst; dst = t;
+    }
+    int sz = insn_size(c, src, dst);
+    if (!sz) return 0;
+
+    if (src->kind == OP_IMM) {
+        if (!check_imm(src->imm, sz)) return 0;
+        uint8_t *start = out;
+        if (dst->kind == OP_REG && reg_code(dst->reg) == 0) {
+            if (sz == 16) *out++ = 0x66;
+            if (sz == 64) emit_rex(&out, 1, 0, 0, 0);
+            *out++ = sz == 8 ? 0xA8 : 0xA9;
+        } else {
+            size_t size = encode_rm(out, 0, sz == 8 ? 0xF6 : 0xF7, sz, 0, NULL, dst);
+            if (!size) return 0;
+            out += size;
         }
-
-    return size;
+        out += emit_imm(out, src->imm, imm_bytes(sz));
+        return out - start;
+    }
+    if (src->kind == OP_REG) return encode_rm(out, 0, sz == 8 ? 0x84 : 0x85, sz, reg_code(src->reg), src->reg, dst);
+    return bad_operands(c);
 }
 
-size_t encode_mov_reg_label(uint8_t *out, Operand* dst, Operand* src, LabelTable* label_table) {
-    printf("here\n");
-
-    if (label_table == NULL) {
-        src->imm = 0;
-        return encode_mov_imm_reg(out, dst, src);
+// mov $imm, %reg: B0+r ib / B8+r iw/id, C7 /0 id when a 64-bit value fits a
+// sign-extended imm32, otherwise B8+r io (movabs)
+static size_t encode_mov_imm(uint8_t *out, Operand *dst, long imm, int sz) {
+    size_t size;
+    if (sz == 64 && imm_value(imm, 32) == imm) {
+        size = encode_rm(out, 0, 0xC7, 64, 0, NULL, dst);
+        return size ? size + emit_imm(out + size, imm, 4) : 0;
     }
+    if (sz != 64 && !check_imm(imm, sz)) return 0;
+    size = encode_opreg(out, sz == 8 ? 0xB0 : 0xB8, sz, dst);
+    return size ? size + emit_imm(out + size, imm, sz == 64 ? 8 : imm_bytes(sz)) : 0;
+}
 
+// mov label, %reg loads the label's address
+static size_t encode_mov_reg_label(uint8_t *out, Operand* dst, Operand* src, LabelTable* label_table) {
     if (reg_size(dst->reg) != 64) {
         fprintf(stderr, "Invalid size: %s\n", dst->reg);
         return 0;
     }
 
-
-    for (size_t i = 0; i < G_labels->count; i++) {
-        if (!strcmp(G_labels->entries[i].name, src->labelref)) {
-            if (args->outformat == OF_BINARY) {
-                src->imm = G_labels->entries[i].address;
-                return encode_mov_imm_reg(out, dst, src);
-            }
-
-            if (args->outformat == OF_ELF) {
-                Label* l = &G_labels->entries[i];
-
-                printf("Label %s is in section %d, but current section is %d\n", l->name, l->section, cur_section);
-                printf("emitting reloc\n");
-                size_t size = 0;
-                int sz = reg_size(dst->reg);
-                int rm = reg_code(dst->reg);
-                bool rex_w = (sz == 64);
-                bool rex_b = (rm & 8) != 0;
-                bool needs_rex = rex_w || rex_b;
-                if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-                if (rm > 7) rm -= 8;
-                *out++ = 0xC7;
-                *out++ = (0b11 << 6) | (rm & 7);
-                *((uint32_t*)out) = 0;
-                out += 4;
-                size += 6;
-                printf("size: %#x\n", (uint32_t)size-4 + *(uint32_t*)(code_pos));
-                if (stage == STAGE2)
-                    emit_reloc(&G_relocs, l, (uint32_t)size-4 + *(uint32_t*)(code_pos), SECTION_CODE);
-                return size;
-            }
-        }
+    // object files load the address position-independently, as
+    // lea label(%rip), %reg, instead of an absolute imm32 needing R_X86_64_32
+    if (args->outformat == OF_ELF) {
+        Operand m = {.kind = OP_MEM, .mem = {.base = "%rip", .sym = src->labelref, .scale = 1, .has_disp = true}};
+        return encode_rm(out, 0, 0x8D, 64, reg_code(dst->reg), dst->reg, &m);
     }
 
-    fprintf(stderr, "Label not found: %s\n", src->labelref);
-    return 0;
-}
+    if (label_table == NULL)
+        return encode_mov_imm(out, dst, 0, 64);
 
-size_t encode_add_reg_reg(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
-    int sz = reg_size(dst->reg);
-    if (sz != reg_size(src->reg)) {
-        fprintf(stderr, "Size mismatch: %s vs %s\n", dst->reg, src->reg);
+    Label *l = lookup_label(label_table, src->labelref);
+    if (!l) {
+        fprintf(stderr, "Label not found: %s\n", src->labelref);
         return 0;
     }
+    return encode_mov_imm(out, dst, l->address, 64);
+}
 
-    int reg = reg_code(src->reg);
-    int rm = reg_code(dst->reg);
+static size_t enc_mov(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    if (src->kind == OP_LABELREF && dst->kind == OP_REG)
+        return encode_mov_reg_label(out, dst, src, c->label_table);
 
-    bool rex_w = (sz == 64);
-    bool rex_r = (reg & 8) != 0;
-    bool rex_b = (rm & 8) != 0;
+    int sz = insn_size(c, src, dst);
+    if (!sz) return 0;
 
-    if (reg > 7) reg -= 8;
-    if (rm > 7) rm -= 8;
+    if (src->kind == OP_IMM && dst->kind == OP_REG) return encode_mov_imm(out, dst, src->imm, sz);
+    if (src->kind == OP_IMM) {
+        if (!check_imm(src->imm, sz)) return 0;
+        size_t size = encode_rm(out, 0, sz == 8 ? 0xC6 : 0xC7, sz, 0, NULL, dst);
+        return size ? size + emit_imm(out + size, src->imm, imm_bytes(sz)) : 0;
+    }
+    if (src->kind == OP_REG) return encode_rm(out, 0, sz == 8 ? 0x88 : 0x89, sz, reg_code(src->reg), src->reg, dst);
+    if (dst->kind == OP_REG) return encode_rm(out, 0, sz == 8 ? 0x8A : 0x8B, sz, reg_code(dst->reg), dst->reg, src);
+    return bad_operands(c);
+}
 
-    // force REX for new 8-bit registers
-    bool needs_rex = rex_w || rex_r || rex_b ||
-        !strcmp(dst->reg, "%sil") || !strcmp(dst->reg, "%dil") || !strcmp(dst->reg, "%bpl") || !strcmp(dst->reg, "%spl");
+// movabs $imm64, %reg: always the 10-byte B8+r io form
+static size_t enc_movabs(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || operand(c, 0)->kind != OP_IMM || operand(c, 1)->kind != OP_REG ||
+        reg_size(operand(c, 1)->reg) != 64)
+        return bad_operands(c);
+    size_t size = encode_opreg(out, 0xB8, 64, operand(c, 1));
+    return size ? size + emit_imm(out + size, operand(c, 0)->imm, 8) : 0;
+}
 
+static size_t enc_xchg(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2) return bad_operands(c);
+    Operand *a = operand(c, 0), *b = operand(c, 1);
+    int sz = insn_size(c, a, b);
+    if (!sz) return 0;
+
+    if (a->kind == OP_REG && b->kind == OP_REG && sz != 8) {
+        // 90+r with the accumulator. xchg %eax, %eax must still zero the
+        // upper half, so it can't be 90 (nop); xchg %rax, %rax can.
+        int ca = reg_code(a->reg), cb = reg_code(b->reg);
+        if (ca == 0 && cb == 0)
+            return sz == 32 ? encode_rm(out, 0, 0x87, 32, 0, a->reg, b) : encode_opreg(out, 0x90, sz == 16 ? 16 : 0, b);
+        if (ca == 0 || cb == 0)
+            return encode_opreg(out, 0x90, sz, ca == 0 ? b : a);
+    }
+    if (a->kind == OP_REG) return encode_rm(out, 0, sz == 8 ? 0x86 : 0x87, sz, reg_code(a->reg), a->reg, b);
+    if (b->kind == OP_REG) return encode_rm(out, 0, sz == 8 ? 0x86 : 0x87, sz, reg_code(b->reg), b->reg, a);
+    return bad_operands(c);
+}
 
-    bool high = (src->reg[strlen(src->reg)-1] == 'h') || (dst->reg[strlen(dst->reg)-1] == 'h');
+// xadd, cmpxchg: register into r/m; op is the 8-bit opcode
+static size_t enc_xadd(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || operand(c, 0)->kind != OP_REG) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    int sz = insn_size(c, src, dst);
+    if (!sz) return 0;
+    return encode_rm(out, 0, c->def->op + (sz != 8), sz, reg_code(src->reg), src->reg, dst);
+}
 
+// cmpxchg8b m64, cmpxchg16b m128 (REX.W): 0F C7 /1
+static size_t enc_cmpxchgnb(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 1 || operand(c, 0)->kind != OP_MEM) return bad_operands(c);
+    return encode_rm(out, 0, 0x0FC7, c->def->size == 128 ? 64 : 0, 1, NULL, operand(c, 0));
+}
 
-    if (high && needs_rex) {
-        fprintf(stderr, "High register not supported with REX prefix\n");
-        exit(1);
-    }
+static size_t enc_lea(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || operand(c, 0)->kind != OP_MEM || operand(c, 1)->kind != OP_REG)
+        return bad_operands(c);
+    Operand *dst = operand(c, 1);
+    int sz = insn_size(c, dst, NULL);
+    if (!sz) return 0;
+    if (sz == 8) return bad_operands(c);
+    return encode_rm(out, 0, 0x8D, sz, reg_code(dst->reg), dst->reg, operand(c, 0));
+}
 
-    switch (sz) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0);}
-            *out++ = 0x00;
-            *out++ = (0b11 << 6) | ((reg & 7) << 3) | (rm & 7);
-            size += needs_rex ? 3 : 2;
-            break;
-        case 16:
-            *out++ = 0x66; // operand-size prefix
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x01;
-            *out++ = (0b11 << 6) | ((reg & 7) << 3) | (rm & 7);
-            size += 3;
-            break;
-        case 64:
-        case 32:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x01;
-            *out++ = (0b11 << 6) | ((reg & 7) << 3) | (rm & 7);
-            size += 2;
-            break;
+// push and pop are 64-bit (or 16-bit with 66) without REX.W
+static size_t enc_push(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 1) return bad_operands(c);
+    Operand *o = operand(c, 0);
+    bool pop = c->def->op == 0x58;
+    int sz = o->kind == OP_REG ? reg_size(o->reg) : c->suffix ? c->suffix : 64;
+    if (sz != 16 && sz != 64) {
+        fprintf(stderr, "%s: only 16- and 64-bit operands are encodable\n", c->inst->opcode);
+        return 0;
+    }
+    int psz = sz == 16 ? 16 : 0;
+
+    if (o->kind == OP_REG) return encode_opreg(out, c->def->op, psz, o);
+    if (o->kind == OP_MEM) return encode_rm(out, 0, pop ? 0x8F : 0xFF, psz, pop ? 0 : 6, NULL, o);
+    if (o->kind == OP_IMM && !pop) {
+        uint8_t *start = out;
+        bool imm8 = is_imm8(o->imm, sz);
+        if (!check_imm(o->imm, sz)) return 0;
+        if (sz == 16) *out++ = 0x66;
+        *out++ = imm8 ? 0x6A : 0x68;
+        out += emit_imm(out, o->imm, imm8 ? 1 : imm_bytes(sz));
+        return out - start;
     }
+    return bad_operands(c);
+}
 
-    return size;
+// inc dec not neg mul div idiv: op is the 8-bit opcode (FE or F6)
+static size_t enc_unary(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 1) return bad_operands(c);
+    Operand *o = operand(c, 0);
+    int sz = insn_size(c, o, NULL);
+    if (!sz) return 0;
+    return encode_rm(out, 0, c->def->op + (sz != 8), sz, c->def->ext, NULL, o);
 }
 
-size_t encode_add_imm_reg(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
+// rol ror rcl rcr shl/sal shr sar: by 1 (D0/D1), by %cl (D2/D3) or by imm8 (C0/C1)
+static size_t enc_shift(uint8_t *out, InsnCtx *c) {
+    size_t n = c->inst->noperands;
+    if (n != 1 && n != 2) return bad_operands(c);
+    Operand *cnt = n == 2 ? operand(c, 0) : NULL, *dst = operand(c, n - 1);
+    int sz = insn_size(c, dst, NULL);
+    if (!sz) return 0;
+
+    int w = sz != 8;
+    if (!cnt || (cnt->kind == OP_IMM && cnt->imm == 1))
+        return encode_rm(out, 0, 0xD0 + w, sz, c->def->ext, NULL, dst);
+    if (cnt->kind == OP_REG && !strcmp(cnt->reg, "%cl"))
+        return encode_rm(out, 0, 0xD2 + w, sz, c->def->ext, NULL, dst);
+    if (cnt->kind == OP_IMM) {
+        if (cnt->imm < 0 || cnt->imm > 255) {
+            fprintf(stderr, "Shift count out of range: %ld\n", cnt->imm);
+            return 0;
+        }
+        size_t size = encode_rm(out, 0, 0xC0 + w, sz, c->def->ext, NULL, dst);
+        return size ? size + emit_imm(out + size, cnt->imm, 1) : 0;
+    }
+    return bad_operands(c);
+}
 
-    int sz = reg_size(dst->reg);
+// imul r/m (F6/F7 /5), imul r/m, reg (0F AF), imul $imm, [r/m,] reg (6B/69)
+static size_t enc_imul(uint8_t *out, InsnCtx *c) {
+    size_t n = c->inst->noperands;
+    if (n == 1) return enc_unary(out, c);
+    if (n != 2 && n != 3) return bad_operands(c);
 
-    int rm = reg_code(dst->reg);
+    Operand *dst = operand(c, n - 1);
+    Operand *src = operand(c, n - 2);
+    Operand *imm = operand(c, 0)->kind == OP_IMM ? operand(c, 0) : NULL;
+    if (n == 2 && imm) src = dst;
+    if (dst->kind != OP_REG || (n == 3 && !imm)) return bad_operands(c);
 
-    bool rex_w = (sz == 64);
-    bool rex_b = (rm & 8) != 0;
+    int sz = insn_size(c, src, dst);
+    if (!sz) return 0;
+    if (sz == 8) return bad_operands(c);
 
-    if (rm > 7) rm -= 8;
-    
-    // force REX for new 8-bit registers
-    bool needs_rex = rex_w || rex_b ||
-    !strcmp(dst->reg, "%sil") || !strcmp(dst->reg, "%dil") || !strcmp(dst->reg, "%bpl") || !strcmp(dst->reg, "%spl");
-    
-    if (rm == 0) {
-        switch(sz) {
-            case 8:
-                *out++ = 0x04;
-                *out++ = src->imm;
-                size += 2;
-                break;
-            case 16:
-                *out++ = 0x66;
-                *out++ = 0x05;
-                *((uint16_t*)out) = (uint16_t)src->imm;
-                out += 2;
-                size += 4;
-                break;
-            case 64:
-                if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-                // FALLTHRU
-            case 32:
-                *out++ = 0x05;
-                *((uint32_t*)out) = (uint32_t)src->imm;
-                out += 4;
-                size += 6;
-                break;
-        }
-        return size;
-    }
+    if (!imm) return encode_rm(out, 0, 0x0FAF, sz, reg_code(dst->reg), dst->reg, src);
 
-    switch (sz) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x80;
-            *out++ = (0b11 << 6) | (rm & 7);
-            *out++ = src->imm;
-            size += 3;
-            break;
-        case 16:
-            *out++ = 0x66;
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x81;
-            *out++ = (0b11 << 6) | (rm & 7);
-            *((uint16_t*)out) = (uint16_t)src->imm;
-            out += 2;
-            size += 5;
-            break;
-        case 32:
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x81;
-            *out++ = (0b11 << 6) | (rm & 7);
-            *((uint32_t*)out) = (uint32_t)src->imm;
-            out += 4;
-            size += 7;
-            break;
+    if (!check_imm(imm->imm, sz)) return 0;
+    bool imm8 = is_imm8(imm->imm, sz);
+    size_t size = encode_rm(out, 0, imm8 ? 0x6B : 0x69, sz, reg_code(dst->reg), dst->reg, src);
+    return size ? size + emit_imm(out + size, imm->imm, imm8 ? 1 : imm_bytes(sz)) : 0;
+}
 
-    }
+// movzx/movsx (0F B6/B7, 0F BE/BF): ext is the source size and size the
+// destination size of the AT&T spellings (movzbl, movswq, ...)
+static size_t enc_movx(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || operand(c, 1)->kind != OP_REG) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    int to = reg_size(dst->reg);
+    int from = src->kind == OP_REG ? reg_size(src->reg) : c->def->ext;
 
-    return size;
+    if ((c->def->ext && from != c->def->ext) || (c->def->size && to != c->def->size)) {
+        fprintf(stderr, "Size mismatch: %s\n", c->inst->opcode);
+        return 0;
+    }
+    if (!from) {
+        fprintf(stderr, "%s: operand size not specified\n", c->inst->opcode);
+        return 0;
+    }
+    if ((from != 8 && from != 16) || from >= to) return bad_operands(c);
+    return encode_rm(out, 0, c->def->op + (from == 16), to, reg_code(dst->reg), dst->reg, src);
 }
 
-size_t encode_add_imm_mem(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
+// movslq/movsxd r/m32, r64: REX.W 63 /r
+static size_t enc_movsxd(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || operand(c, 1)->kind != OP_REG) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    if ((src->kind == OP_REG && reg_size(src->reg) != 32) || reg_size(dst->reg) != 64) {
+        fprintf(stderr, "Size mismatch: %s\n", c->inst->opcode);
+        return 0;
+    }
+    return encode_rm(out, 0, 0x63, 64, reg_code(dst->reg), dst->reg, src);
+}
 
-    int mem_reg_sz = reg_size(dst->mem.base);
+// jmp/call: rel8/rel32 to a label, or FF /4 (/2) through a register or memory
+static size_t enc_branch(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 1) return bad_operands(c);
+    Operand *o = operand(c, 0);
+    if (o->kind == OP_LABELREF) return encode_rel_jmps(out, o, c->pos, c->label_table, c->def->op, false, c->inst->rel8);
+    if (o->kind == OP_REG && reg_size(o->reg) != 64) return bad_operands(c);
+    if (o->kind == OP_MEM && !o->indirect && !o->mem.base && !o->mem.index && !o->mem.sym) {
+        fprintf(stderr, "%s to an absolute address is not supported; use %s *%#lx for an indirect one\n",
+            c->inst->opcode, c->inst->opcode, o->mem.disp);
+        return 0;
+    }
+    return encode_rm(out, 0, 0xFF, 0, c->def->ext, NULL, o);
+}
 
-    int mem_size = dst->mem.size;
+// movs cmps stos lods scas: A4/A6/AA/AC/AE, +1 above 8 bits, sized by the
+// suffix. The operands are implicit (%rsi, %rdi, the accumulator).
+static size_t enc_string(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 0) return bad_operands(c);
+    if (!c->suffix) {
+        fprintf(stderr, "%s: operand size not specified\n", c->inst->opcode);
+        return 0;
+    }
+    uint8_t *start = out;
+    if (c->suffix == 16) *out++ = 0x66;
+    if (c->suffix == 64) emit_rex(&out, 1, 0, 0, 0);
+    *out++ = c->def->op + (c->suffix != 8);
+    return out - start;
+}
 
-    int rm = reg_code(dst->mem.base);
+// jcc label: 0F 80+cc rel32, or 70+cc rel8 when layout finds the target close
+static size_t enc_jcc(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 1 || operand(c, 0)->kind != OP_LABELREF) return bad_operands(c);
+    return encode_rel_jmps(out, operand(c, 0), c->pos, c->label_table, 0x80 | c->cc, true, c->inst->rel8);
+}
 
-    bool rex_w = (mem_size == 64);
-    bool rex_b = (rm & 8) != 0;
+// setcc r/m8: 0F 90+cc /0
+static size_t enc_setcc(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 1) return bad_operands(c);
+    Operand *o = operand(c, 0);
+    if (o->kind == OP_REG ? !is_gpr_operand(o) || reg_size(o->reg) != 8 : o->kind != OP_MEM) return bad_operands(c);
+    if (c->suffix && c->suffix != 8) return bad_operands(c);
+    return encode_rm(out, 0, c->def->op | c->cc, 0, 0, NULL, o);
+}
 
-    if (rm > 7) rm -= 8;
+// cmovcc r/m, reg of 16, 32 or 64 bits: 0F 40+cc
+static size_t enc_cmov(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_gpr_operand(operand(c, 1))) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    int sz = insn_size(c, src, dst);
+    if (!sz) return 0;
+    if (sz == 8) return bad_operands(c);
+    return encode_rm(out, 0, c->def->op | c->cc, sz, reg_code(dst->reg), dst->reg, src);
+}
 
-    // force REX for new 8-bit registers
-    bool needs_rex = rex_w || rex_b;
-    if (mem_reg_sz == 32) {
-        *out++ = 0x67;
-        size++;
-    }
-
-    switch (mem_size) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x80;
-            *out++ = (rm & 7);
-            *out++ = src->imm;
-            size += 3;
-            break;
-        case 16:
-            *out++ = 0x66;
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x81;
-            *out++ = (rm & 7);
-            *((uint16_t*)out) = (uint16_t)src->imm;
-            out += 2;
-            size += 5;
-            break;
-        case 32:
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x81;
-            *out++ = (rm & 7);
-            *((uint32_t*)out) = (uint32_t)src->imm;
-            out += 4;
-            size += 7;
-            break;
+static size_t enc_ret(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands == 0) {
+        *out = 0xC3;
+        return 1;
     }
+    if (c->inst->noperands != 1 || operand(c, 0)->kind != OP_IMM) return bad_operands(c);
+    out[0] = 0xC2;
+    return 1 + emit_imm(out + 1, operand(c, 0)->imm, 2);
+}
 
-    return size;
+static size_t enc_int(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 1 || operand(c, 0)->kind != OP_IMM) return bad_operands(c);
+    return encode_int(out, operand(c, 0));
 }
 
-static size_t encode_add_reg_mem(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
+static size_t enc_bswap(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 1 || operand(c, 0)->kind != OP_REG) return bad_operands(c);
+    int sz = insn_size(c, operand(c, 0), NULL);
+    if (sz != 32 && sz != 64) return bad_operands(c);
+    return encode_opreg(out, 0x0FC8, sz, operand(c, 0));
+}
 
-    int mem_reg_sz = reg_size(dst->mem.base);
+// bsf bsr popcnt lzcnt tzcnt: r/m, reg of 16, 32 or 64 bits; op carries the
+// F3 of popcnt/lzcnt/tzcnt above the 0F xx opcode
+static size_t enc_bitscan(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_gpr_operand(operand(c, 1))) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    int sz = insn_size(c, src, dst);
+    if (!sz) return 0;
+    if (sz == 8) return bad_operands(c);
+    return encode_rm(out, c->def->op >> 16, c->def->op & 0xFFFF, sz, reg_code(dst->reg), dst->reg, src);
+}
 
-    int mem_size = reg_size(src->reg);
+// bt bts btr btc: reg, r/m (0F A3/AB/B3/BB) or $imm8, r/m (0F BA /ext ib)
+static size_t enc_bt(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2) return bad_operands(c);
+    Operand *bit = operand(c, 0), *dst = operand(c, 1);
+    if (bit->kind != OP_IMM && bit->kind != OP_REG) return bad_operands(c);
+    int sz = insn_size(c, bit->kind == OP_REG ? bit : NULL, dst);
+    if (!sz) return 0;
+    if (sz == 8) return bad_operands(c);
+
+    if (bit->kind == OP_REG) return encode_rm(out, 0, c->def->op, sz, reg_code(bit->reg), bit->reg, dst);
+    if (!check_imm(bit->imm, 8)) return 0;
+    size_t size = encode_rm(out, 0, 0x0FBA, sz, c->def->ext, NULL, dst);
+    return size ? size + emit_imm(out + size, bit->imm, 1) : 0;
+}
 
-    if (mem_reg_sz == 32) {
-        *out++ = 0x67;
-        size++;
-    }
+// adcx (66) and adox (F3) 0F 38 F6: r/m, reg of 32 or 64 bits
+static size_t enc_adcx(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_gpr_operand(operand(c, 1))) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    int sz = insn_size(c, src, dst);
+    if (!sz) return 0;
+    if (sz != 32 && sz != 64) return bad_operands(c);
+    return encode_rm(out, c->def->op >> 24, c->def->op & 0xFFFFFF, sz, reg_code(dst->reg), dst->reg, src);
+}
 
-    int mod = reg_code(src->reg);
-    int rm = reg_code(dst->mem.base);
+// movnti r32/r64, m: 0F C3, a non-temporal store
+static size_t enc_movnti(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_gpr_operand(operand(c, 0)) || operand(c, 1)->kind != OP_MEM)
+        return bad_operands(c);
+    Operand *src = operand(c, 0);
+    int sz = insn_size(c, src, NULL);
+    if (!sz) return 0;
+    if (sz != 32 && sz != 64) return bad_operands(c);
+    return encode_rm(out, 0, 0x0FC3, sz, reg_code(src->reg), src->reg, operand(c, 1));
+}
 
-    bool rex_w = (mem_size == 64);
-    bool rex_b = (rm & 8) != 0;
-    bool rex_r = (mod & 8) != 0;
+// movbe: byte-swapping load (0F 38 F0) or store (0F 38 F1), 16/32/64-bit
+static size_t enc_movbe(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    int sz = insn_size(c, src, dst);
+    if (!sz) return 0;
+    if (sz == 8) return bad_operands(c);
+    if (src->kind == OP_MEM && is_gpr_operand(dst))
+        return encode_rm(out, 0, 0x0F38F0, sz, reg_code(dst->reg), dst->reg, src);
+    if (is_gpr_operand(src) && dst->kind == OP_MEM)
+        return encode_rm(out, 0, 0x0F38F1, sz, reg_code(src->reg), src->reg, dst);
+    return bad_operands(c);
+}
 
-    bool high = (src->reg[strlen(src->reg)-1] == 'h');
+// no operands: the opcode bytes as they are
+static size_t enc_fixed(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 0) return bad_operands(c);
+    uint8_t *start = out;
+    emit_opcode(&out, c->def->op);
+    return out - start;
+}
 
-    bool needs_sib = check_need_sib(rm);
+// -------------------- SSE --------------------
+// Opcodes are written with their mandatory prefix, as in the Intel manuals:
+// 0x660F3800 is pshufb (66 0F 38 00). The prefix is split off so that REX
+// lands between it and the 0F escape.
 
+static bool is_xmm(const Operand *o) {
+    return o->kind == OP_REG && reg_code(o->reg) >= 0 && reg_size(o->reg) == 128;
+}
 
-    bool needs_rex = rex_w || rex_b || rex_r ||
-        !strcmp(src->reg, "%sil") || !strcmp(src->reg, "%dil") || !strcmp(src->reg, "%bpl") || !strcmp(src->reg, "%spl");
+static bool is_xmm_or_mem(const Operand *o) {
+    return is_xmm(o) || o->kind == OP_MEM;
+}
 
-    if (high && needs_rex) {
-        fprintf(stderr, "High register not supported with REX prefix\n");
-        exit(1);
+static size_t encode_sse(uint8_t *out, uint32_t op, bool w, int reg, const char *regname, Operand *rm) {
+    uint8_t top = op > 0xFFFFFF ? op >> 24 : op > 0xFFFF ? op >> 16 : op >> 8;
+    uint8_t prefix = 0;
+    if (op > 0xFF && (top == 0x66 || top == 0xF2 || top == 0xF3)) {
+        prefix = top;
+        op &= op > 0xFFFFFF ? 0xFFFFFF : op > 0xFFFF ? 0xFFFF : 0xFF;
     }
+    return encode_rm(out, prefix, op, w ? 64 : 0, reg, regname, rm);
+}
 
-    if (mod > 7) mod -= 8;
-    if (rm > 7) rm -= 8;
+static size_t encode_sse_imm(uint8_t *out, uint32_t op, bool w, int reg, const char *regname, Operand *rm, Operand *imm) {
+    if (!check_imm(imm->imm, 8)) return 0;
+    size_t size = encode_sse(out, op, w, reg, regname, rm);
+    return size ? size + emit_imm(out + size, imm->imm, 1) : 0;
+}
 
+// op xmm/m, xmm
+static size_t enc_sse(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_xmm_or_mem(operand(c, 0)) || !is_xmm(operand(c, 1))) return bad_operands(c);
+    Operand *dst = operand(c, 1);
+    return encode_sse(out, c->def->op, false, reg_code(dst->reg), dst->reg, operand(c, 0));
+}
 
-    if (rm == 0b101) {
-        // modrm would give rip as base
-        switch (mem_size) {
-            case 8:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x00;
-                *out++ = (0b01 << 6) | (mod << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-            case 16:
-                *out++ = 0x66;
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x01;
-                *out++ = (0b01 << 6) | (mod << 3) | 5;
-                *out++ = 0x00;
-                size += 4;
-                break;
-            case 32:
-            case 64:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x01;
-                *out++ = (0b01 << 6) | (mod << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-        }
-        return size;
-    }
+// op m, xmm: lddqu, movntdqa
+static size_t enc_sse_load(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || operand(c, 0)->kind != OP_MEM) return bad_operands(c);
+    return enc_sse(out, c);
+}
 
+// op xmm, m: the non-temporal stores movntps, movntpd, movntdq
+static size_t enc_sse_store(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_xmm(operand(c, 0)) || operand(c, 1)->kind != OP_MEM) return bad_operands(c);
+    Operand *src = operand(c, 0);
+    return encode_sse(out, c->def->op, false, reg_code(src->reg), src->reg, operand(c, 1));
+}
 
+// op $imm8, xmm/m, xmm
+static size_t enc_sse_imm(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || operand(c, 0)->kind != OP_IMM || !is_xmm_or_mem(operand(c, 1)) ||
+        !is_xmm(operand(c, 2)))
+        return bad_operands(c);
+    Operand *dst = operand(c, 2);
+    return encode_sse_imm(out, c->def->op, false, reg_code(dst->reg), dst->reg, operand(c, 1), operand(c, 0));
+}
 
+// cmpeqps, cmpltsd and the other predicate forms of cmpps/cmppd/cmpss/cmpsd:
+// op xmm/m, xmm with the predicate (ext) as the imm8
+static size_t enc_sse_cmp(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_xmm_or_mem(operand(c, 0)) || !is_xmm(operand(c, 1))) return bad_operands(c);
+    Operand *dst = operand(c, 1);
+    size_t size = encode_sse(out, c->def->op, false, reg_code(dst->reg), dst->reg, operand(c, 0));
+    return size ? size + emit_imm(out + size, c->def->ext, 1) : 0;
+}
 
-    switch (mem_size) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x00;
-            *out++ = (mod << 3) | rm;
-            size += 2;
-            break;
-        case 16:
-            *out++ = 0x66;
-            size++;
-            // FALLTHRU
-        case 32:
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x01;
-            *out++ = (mod << 3) | rm;
-            // if (needs_sib) {emit_sib(&out, 0, 0b100, reg_code(dst->mem.base)); size++;}
-            size += 2;
-            break;
+// maskmovdqu xmm, xmm: byte-masked store to (%rdi); both operands are registers
+static size_t enc_maskmov(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_xmm(operand(c, 0))) return bad_operands(c);
+    return enc_sse(out, c);
+}
 
-    }
+// pblendvb/blendvps/blendvpd take %xmm0 as an implicit selector, which AT&T
+// syntax may spell out as the first operand
+static size_t enc_sse_blendv(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3) return enc_sse(out, c);
+    Operand *sel = operand(c, 0);
+    if (sel->kind != OP_REG || strcmp(sel->reg, "%xmm0") || !is_xmm_or_mem(operand(c, 1)) || !is_xmm(operand(c, 2)))
+        return bad_operands(c);
+    Operand *dst = operand(c, 2);
+    return encode_sse(out, c->def->op, false, reg_code(dst->reg), dst->reg, operand(c, 1));
+}
+
+// moves with a load (op) and a store form (ext is the store opcode's last
+// byte); register to register uses the load form, as gas does
+static size_t enc_sse_mov(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    if (is_xmm(dst) && is_xmm_or_mem(src))
+        return encode_sse(out, c->def->op, false, reg_code(dst->reg), dst->reg, src);
+    if (is_xmm(src) && dst->kind == OP_MEM)
+        return encode_sse(out, (c->def->op & ~0xFFu) | c->def->ext, false, reg_code(src->reg), src->reg, dst);
+    return bad_operands(c);
+}
 
+// psllw/pslld/psllq, psrlw/psrld/psrlq, psraw/psrad: the count is an xmm/m128
+// (op) or an imm8, using group 0F 71/72/73 with the last opcode nibble and
+// /ext. pslldq/psrldq only have the immediate form.
+static size_t enc_sse_shift(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_xmm(operand(c, 1))) return bad_operands(c);
+    Operand *cnt = operand(c, 0), *dst = operand(c, 1);
+    uint32_t op = c->def->op;
+    if (cnt->kind == OP_IMM)
+        return encode_sse_imm(out, (op & ~0xFFu) | (0x70 + (op & 0x0F)), false, c->def->ext, NULL, dst, cnt);
+    if ((op & 0xF0) == 0x70) return bad_operands(c);
+    return enc_sse(out, c);
+}
 
-    if (needs_sib) {
-        emit_sib(&out, 0, 0b100, reg_code(dst->mem.base));
-        size++;
+// movd/movq between xmm and a general register or memory (66 0F 6E/7E, REX.W
+// for 64 bits), and movq between xmm registers and memory (F3 0F 7E, 66 0F D6).
+// movq without an xmm operand is the integer mov.
+static size_t enc_movd(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    bool q = c->def->size == 64;
+
+    if (!is_xmm(src) && !is_xmm(dst)) {
+        if (!q) return bad_operands(c);
+        c->suffix = 64;
+        return enc_mov(out, c);
     }
+    if (q && is_xmm(dst) && is_xmm_or_mem(src))
+        return encode_sse(out, 0xF30F7E, false, reg_code(dst->reg), dst->reg, src);
+    if (q && is_xmm(src) && dst->kind == OP_MEM)
+        return encode_sse(out, 0x660FD6, false, reg_code(src->reg), src->reg, dst);
+
+    Operand *x = is_xmm(dst) ? dst : src, *g = is_xmm(dst) ? src : dst;
+    int sz = is_gpr_operand(g) ? reg_size(g->reg) : g->kind == OP_MEM ? c->def->size : 0;
+    if (sz != 32 && sz != 64) return bad_operands(c);
+    return encode_sse(out, x == dst ? 0x660F6E : 0x660F7E, sz == 64, reg_code(x->reg), x->reg, g);
+}
 
+// xmm into a 32- or 64-bit general register. Conversions also take memory and
+// need REX.W for a 64-bit result; the movmsk forms ignore W, and gas leaves it off.
+static size_t encode_sse_gpr(uint8_t *out, InsnCtx *c, bool cvt) {
+    if (c->inst->noperands != 2) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    if (!(is_xmm(src) || (cvt && src->kind == OP_MEM)) || !is_gpr_operand(dst)) return bad_operands(c);
+    int sz = insn_size(c, dst, NULL);
+    if (sz != 32 && sz != 64) return bad_operands(c);
+    return encode_sse(out, c->def->op, cvt && sz == 64, reg_code(dst->reg), dst->reg, src);
+}
 
-    return size;
+// pmovmskb, movmskps, movmskpd
+static size_t enc_movmsk(uint8_t *out, InsnCtx *c) {
+    return encode_sse_gpr(out, c, false);
 }
 
-size_t encode_add_mem_reg(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
-    int sz = reg_size(dst->reg);
+// cvtss2si, cvttss2si, cvtsd2si, cvttsd2si
+static size_t enc_cvt2si(uint8_t *out, InsnCtx *c) {
+    return encode_sse_gpr(out, c, true);
+}
 
+// cvtsi2ss, cvtsi2sd: r/m32 or r/m64 (suffix l/q) into xmm
+static size_t enc_cvtsi2(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_xmm(operand(c, 1))) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    if (!is_gpr_operand(src) && src->kind != OP_MEM) return bad_operands(c);
+    int sz = insn_size(c, src->kind == OP_REG ? src : NULL, NULL);
+    if (!sz) return 0;
+    if (sz != 32 && sz != 64) return bad_operands(c);
+    return encode_sse(out, c->def->op, sz == 64, reg_code(dst->reg), dst->reg, src);
+}
 
-    int mem_sz = reg_size(src->mem.base);
-
-    
-    int rm = reg_code(src->mem.base);
-    int reg = reg_code(dst->reg);
-
-    bool needs_sib = check_need_sib(rm);
-
-    bool rex_w = (sz == 64);
-    bool rex_b = (rm & 8) != 0;
-    bool rex_r = (reg & 8) != 0;
+// pextrb/w/d/q, extractps $imm8, xmm, r/m (size is the element size). The
+// register form of pextrw keeps its original SSE2 encoding, 66 0F C5.
+static size_t enc_pextr(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || operand(c, 0)->kind != OP_IMM || !is_xmm(operand(c, 1))) return bad_operands(c);
+    Operand *imm = operand(c, 0), *x = operand(c, 1), *dst = operand(c, 2);
+    bool q = c->def->size == 64;
+    if (dst->kind != OP_MEM) {
+        if (!is_gpr_operand(dst)) return bad_operands(c);
+        int sz = reg_size(dst->reg);
+        if (q ? sz != 64 : sz != 32 && sz != 64) return bad_operands(c);
+    }
+    if (c->def->size == 16 && dst->kind == OP_REG)
+        return encode_sse_imm(out, 0x660FC5, false, reg_code(dst->reg), dst->reg, x, imm);
+    return encode_sse_imm(out, c->def->op, q, reg_code(x->reg), x->reg, dst, imm);
+}
 
+// pinsrb/w/d/q $imm8, r/m, xmm
+static size_t enc_pinsr(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || operand(c, 0)->kind != OP_IMM || !is_xmm(operand(c, 2))) return bad_operands(c);
+    Operand *imm = operand(c, 0), *src = operand(c, 1), *x = operand(c, 2);
+    bool q = c->def->size == 64;
+    if (src->kind != OP_MEM) {
+        if (!is_gpr_operand(src)) return bad_operands(c);
+        int sz = reg_size(src->reg);
+        if (q ? sz != 64 : sz != 32) return bad_operands(c);
+    }
+    return encode_sse_imm(out, c->def->op, q, reg_code(x->reg), x->reg, src, imm);
+}
 
+// crc32 r/m8/16/32/64, r32/r64: F2 0F 38 F0 (8-bit source) or F1
+static size_t enc_crc32(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_gpr_operand(operand(c, 1))) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    int from = insn_size(c, src->kind == OP_REG ? src : NULL, NULL);
+    if (!from) return 0;
+    int to = reg_size(dst->reg);
+    if ((to != 32 && to != 64) || (to == 64 && from != 8 && from != 64) || (to == 32 && from == 64))
+        return bad_operands(c);
+    return encode_rm(out, 0xF2, 0x0F38F0 + (from != 8), to == 64 ? 64 : from == 16 ? 16 : 0,
+        reg_code(dst->reg), dst->reg, src);
+}
 
-    bool needs_rex = rex_w || rex_b || rex_r ||
-        !strcmp(dst->reg, "%sil") || !strcmp(dst->reg, "%dil") || !strcmp(dst->reg, "%bpl") || !strcmp(dst->reg, "%spl");
+// one memory operand and a /digit: ldmxcsr, stmxcsr, prefetch*, clflush, clwb
+static size_t enc_m(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 1 || operand(c, 0)->kind != OP_MEM) return bad_operands(c);
+    return encode_sse(out, c->def->op, false, c->def->ext, NULL, operand(c, 0));
+}
 
+// -------------------- VEX --------------------
+// VEX replaces REX, the mandatory prefix and the 0F/0F38/0F3A escape with two
+// (C5) or three (C4) bytes, and adds a second source register (vvvv) and the
+// vector length (L). AT&T operands run backwards from Intel's: the last is
+// ModRM.reg, the one before it vvvv, and the first the r/m operand.
 
-    if (mem_sz == 32) {
-        *out++ = 0x67;
-        size++;
+typedef struct {
+    uint32_t op;        // with mandatory prefix and escape, as for SSE
+    bool w;
+    uint8_t l;          // 0 128-bit, 1 256-bit, 2 512-bit; EVEX rounding mode if b is set without memory
+    int vvvv;           // register code of the extra source, 0 if unused
+    bool vsib;          // the memory operand has a vector index (gathers)
+    bool evex;          // EVEX-encoded; the fields below are EVEX only
+    uint8_t aaa;        // opmask, 0 if unmasked
+    bool z;             // zeroing-masking
+    bool b;             // broadcast, or rounding/sae on a register form
+    int disp8n;         // disp8 scale
+} VexInsn;
+
+static void emit_vex(uint8_t **out, bool r, bool x, bool b, int map, bool w, int vvvv, bool l, int pp) {
+    if (!x && !b && !w && map == 1) {
+        *(*out)++ = 0xC5;
+        *(*out)++ = (!r << 7) | ((~vvvv & 15) << 3) | (l << 2) | pp;
+        return;
     }
+    *(*out)++ = 0xC4;
+    *(*out)++ = (!r << 7) | (!x << 6) | (!b << 5) | map;
+    *(*out)++ = (w << 7) | ((~vvvv & 15) << 3) | (l << 2) | pp;
+}
 
-    if (rm > 7) rm -= 8;
-    if (reg > 7) reg -= 8;
+// EVEX: 62, P0 = R X B R' 0 0 mm, P1 = W vvvv 1 pp, P2 = z L'L b V' aaa, with
+// R, X, B, R', V' and vvvv inverted. R' and V' are bit 4 of ModRM.reg and of
+// vvvv (of the index, for VSIB); X is bit 4 of a register in ModRM.rm.
+static void emit_evex(uint8_t **out, const VexInsn *v, int map, int pp, int reg, int base, int index, bool rm_reg) {
+    bool x = rm_reg ? base & 16 : index >= 0 && (index & 8);
+    bool b = base >= 0 && (base & 8);
+    bool vhi = v->vsib ? index & 16 : v->vvvv & 16;
+    *(*out)++ = 0x62;
+    *(*out)++ = (!(reg & 8) << 7) | (!x << 6) | (!b << 5) | (!(reg & 16) << 4) | map;
+    *(*out)++ = (v->w << 7) | ((~v->vvvv & 15) << 3) | (1 << 2) | pp;
+    *(*out)++ = (v->z << 7) | (v->l << 5) | (v->b << 4) | (!vhi << 3) | v->aaa;
+}
 
-    if (rm == 0b101) {
-        // modrm would give rip as base
-        switch (sz) {
-            case 8:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x02;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-            case 16:
-                *out++ = 0x66;
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x03;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 4;
-                break;
-            case 32:
-            case 64:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x03;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-        }
-        return size;
+// 0x660F3800 -> pp 01 (66), map 2 (0F 38), opcode 00
+static uint8_t vex_split(uint32_t op, int *pp, int *map) {
+    uint8_t bytes[4];
+    int n = 0;
+    for (int shift = 24; shift >= 0; shift -= 8)
+        if ((op >> shift) || shift == 0) bytes[n++] = op >> shift;
+    int i = 0;
+    *pp = bytes[0] == 0x66 ? 1 : bytes[0] == 0xF3 ? 2 : bytes[0] == 0xF2 ? 3 : 0;
+    if (*pp) i++;
+    i++;    // 0F
+    *map = 1;
+    if (i < n - 1) {
+        *map = bytes[i] == 0x38 ? 2 : 3;
+        i++;
     }
+    return bytes[n - 1];
+}
 
+static size_t encode_vex(uint8_t *out, const VexInsn *v, int reg, const char *regname, Operand *rm) {
+    uint8_t *start = out;
+    int base = -1, index = -1;
 
-
-    switch (sz) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x02;
-            *out++ = (reg << 3) | rm;
-            size += 2;
-            break;
-        case 16:
-            *out++ = 0x66;
-            /* FALLTHRU */
-        case 32:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x03;
-            *out++ = (reg << 3) | rm;
-            size += 3;
-            break;
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x03;
-            *out++ = (reg << 3) | rm;
-            size += 3;
-            break;
+    if (rm->kind == OP_MEM) {
+        if (!mem_regs(&rm->mem, &base, &index, v->vsib)) return 0;
+    } else if (rm->kind != OP_REG || (base = reg_code(rm->reg)) < 0) {
+        fprintf(stderr, "Invalid operand: %s\n", rm->kind == OP_REG ? rm->reg : "expected register or memory");
+        return 0;
     }
-    
-    if (needs_sib) {
-        emit_sib(&out, 0, 0b100, reg_code(src->mem.base));
-        size++;
+    if (regname && reg < 0) {
+        fprintf(stderr, "Invalid register: %s\n", regname);
+        return 0;
     }
 
-    return size;
-}
-
+    MemOperand *m = rm->kind == OP_MEM ? &rm->mem : NULL;
+    if (m && ((m->base && reg_size(m->base) == 32) || (!v->vsib && m->index && reg_size(m->index) == 32)))
+        *out++ = 0x67;
 
-// -------------------- Subtraction --------------------
-size_t encode_sub_reg_reg(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
-    int sz = reg_size(dst->reg);
-    if (sz != reg_size(src->reg)) {
-        fprintf(stderr, "Size mismatch: %s vs %s\n", dst->reg, src->reg);
-        return 0;
+    int pp, map;
+    uint8_t opcode = vex_split(v->op, &pp, &map);
+    if (v->evex)
+        emit_evex(&out, v, map, pp, reg, base, index, !m);
+    else
+        emit_vex(&out, reg & 8, index >= 0 && (index & 8), base >= 0 && (base & 8), map, v->w, v->vvvv, v->l, pp);
+    *out++ = opcode;
+
+    if (!m) {
+        *out++ = (0b11 << 6) | ((reg & 7) << 3) | (base & 7);
+        return out - start;
+    }
+    emit_modrm_mem(&out, reg, m, v->evex ? v->disp8n : 1);
+    if (is_rip(m) && m->sym) {
+        rip_opcode = v->op;
+        rip_reg = reg & 7;
+        rip_rex = false;
     }
+    return out - start;
+}
 
-    int reg = reg_code(src->reg);
-    int rm = reg_code(dst->reg);
+static bool is_vec(const Operand *o) {
+    int sz = o->kind == OP_REG && reg_code(o->reg) >= 0 ? reg_size(o->reg) : 0;
+    return sz == 128 || sz == 256 || sz == 512;
+}
 
-    bool rex_w = (sz == 64);
-    bool rex_r = (reg & 8) != 0;
-    bool rex_b = (rm & 8) != 0;
+static bool is_mask(const Operand *o) {
+    return o->kind == OP_REG && is_mask_reg(o->reg);
+}
 
-    if (reg > 7) reg -= 8;
-    if (rm > 7) rm -= 8;
+static bool is_vec_or_mem(const Operand *o) {
+    return is_vec(o) || o->kind == OP_MEM;
+}
 
-    // force REX for new 8-bit registers
-    bool needs_rex = rex_w || rex_r || rex_b ||
-        !strcmp(dst->reg, "%sil") || !strcmp(dst->reg, "%dil") || !strcmp(dst->reg, "%bpl") || !strcmp(dst->reg, "%spl");
+// -------------------- EVEX --------------------
+// EVEX (AVX-512) adds %xmm16-31, %ymm16-31 and %zmm0-31, opmask registers
+// ({%k1}, {z}), broadcast of one memory element ({1toN}) and static rounding.
+// Its disp8 is scaled by N, the size of the memory access, which the
+// instruction's tuple type gives. Instructions with a VEX form use it unless
+// an operand or decoration needs EVEX, as gas does.
 
+typedef enum {
+    TUPLE_FV,           // full vector, or one element when broadcasting
+    TUPLE_FVM,          // full vector, no broadcast
+    TUPLE_HV,           // half vector (widening conversions), or one element
+    TUPLE_HVM,          // half, quarter and eighth vector (zero/sign extension)
+    TUPLE_QVM,
+    TUPLE_OVM,
+    TUPLE_FIXED,        // elem bytes: scalars, broadcasts, gathers, 128-bit lanes
+} Tuple;
+
+enum {
+    EVEX_ONLY = 1 << 0,     // no VEX form
+    EVEX_KDST = 1 << 1,     // writes an opmask (compares and tests)
+    EVEX_ER = 1 << 2,       // takes {rn-sae}, {rd-sae}, {ru-sae}, {rz-sae}
+    EVEX_SAE = 1 << 3,      // takes {sae}
+    EVEX_NARROW = 1 << 4,   // the destination is half the source (vcvtpd2ps)
+    EVEX_NOMASK = 1 << 5,   // no {%k} or {z}
+    EVEX_LIG = 1 << 6,      // scalar or 128-bit only: needs no AVX512VL
+    EVEX_NO128 = 1 << 7,    // 256 and 512 bits only (128-bit lane shuffles)
+};
 
-    bool high = (src->reg[strlen(src->reg)-1] == 'h') || (dst->reg[strlen(dst->reg)-1] == 'h');
+typedef struct {
+    const char *name;
+    uint8_t tuple;          // Tuple
+    uint8_t elem;           // element size in bytes, N for TUPLE_FIXED
+    bool w;                 // EVEX.W
+    uint8_t flags;          // EVEX_*
+    uint32_t isa;           // ISA_AVX512BW, DQ or CD, 0 if AVX512F has it
+} EvexDef;
+
+static const EvexDef *find_evex(const char *name);
+
+// Vector length from the widest vector register, counting a VSIB index
+static int vec_len(InsnCtx *c) {
+    int len = 0;
+    for (size_t i = 0; i < c->inst->noperands; i++) {
+        Operand *o = operand(c, i);
+        const char *r = o->kind == OP_REG ? o->reg : o->kind == OP_MEM ? o->mem.index : NULL;
+        int sz = r && !is_mask_reg(r) ? reg_size(r) : 0;
+        if (sz == 512) len = 2;
+        else if (sz == 256 && len < 1) len = 1;
+    }
+    return len;
+}
 
+static MemOperand *mem_operand(InsnCtx *c) {
+    for (size_t i = 0; i < c->inst->noperands; i++)
+        if (operand(c, i)->kind == OP_MEM) return &operand(c, i)->mem;
+    return NULL;
+}
 
-    if (high && needs_rex) {
-        fprintf(stderr, "High register not supported with REX prefix\n");
-        exit(1);
+// registers 16-31, %zmm, opmasks and the {} decorations exist only in EVEX
+static bool wants_evex(InsnCtx *c, int len) {
+    Instruction *in = c->inst;
+    if (len == 2 || in->opmask || in->zeroing || in->rounding) return true;
+    for (size_t i = 0; i < in->noperands; i++) {
+        Operand *o = operand(c, i);
+        if (o->kind == OP_REG && (reg_code(o->reg) > 15 || is_mask_reg(o->reg))) return true;
+        if (o->kind == OP_MEM && (o->mem.bcst || (o->mem.index && reg_code(o->mem.index) > 15))) return true;
     }
+    return false;
+}
 
-    switch (sz) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0);}
-            *out++ = 0x28;
-            *out++ = (0b11 << 6) | ((reg & 7) << 3) | (rm & 7);
-            size += needs_rex ? 3 : 2;
-            break;
-        case 16:
-            *out++ = 0x66; // operand-size prefix
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x29;
-            *out++ = (0b11 << 6) | ((reg & 7) << 3) | (rm & 7);
-            size += 3;
-            break;
-        case 64:
-        case 32:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x29;
-            *out++ = (0b11 << 6) | ((reg & 7) << 3) | (rm & 7);
-            size += 2;
-            break;
+static int disp8_scale(const EvexDef *e, int len, bool bcst) {
+    int vl = 16 << len;
+    switch (e->tuple) {
+    case TUPLE_FV: return bcst ? e->elem : vl;
+    case TUPLE_HV: return bcst ? e->elem : vl / 2;
+    case TUPLE_FVM: return vl;
+    case TUPLE_HVM: return vl / 2;
+    case TUPLE_QVM: return vl / 4;
+    case TUPLE_OVM: return vl / 8;
+    default: return e->elem;
     }
-
-    return size;
 }
 
-size_t encode_sub_imm_reg(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
+// VEX or EVEX fields for the instruction: W, the vector length, and for EVEX
+// the opmask, broadcast, rounding and disp8 scale
+static bool evex_insn(InsnCtx *c, const EvexDef *e, int len, VexInsn *v);
 
-    int sz = reg_size(dst->reg);
+static bool vex_insn(InsnCtx *c, int vvvv, VexInsn *v) {
+    const EvexDef *e = find_evex(c->def->name);
+    int len = vec_len(c);
+    // the memory source of a narrowing conversion is twice the destination
+    if (e && (e->flags & EVEX_NARROW) && len && operand(c, 0)->kind == OP_MEM) len++;
 
-    int rm = reg_code(dst->reg);
+    *v = (VexInsn){.op = c->def->op, .w = c->def->size == 64, .l = len, .vvvv = vvvv};
+    if ((insn_isa & ISA_AVX_INT) == ISA_AVX_INT) insn_isa &= len ? ~ISA_AVX : ~ISA_AVX2;
+    if (!(e && (e->flags & EVEX_ONLY)) && !wants_evex(c, len)) return true;
+    return evex_insn(c, e, len, v);
+}
 
-    bool rex_w = (sz == 64);
-    bool rex_b = (rm & 8) != 0;
+// Switch v to EVEX: W, opmask, broadcast, disp8*N and rounding
+static bool evex_insn(InsnCtx *c, const EvexDef *e, int len, VexInsn *v) {
+    Instruction *in = c->inst;
+    MemOperand *m = mem_operand(c);
+    if (!e) {
+        fprintf(stderr, "%s has no EVEX (AVX-512) form\n", in->opcode);
+        return false;
+    }
+    if ((e->flags & EVEX_NO128) && len == 0) {
+        fprintf(stderr, "%s needs %%ymm or %%zmm operands\n", in->opcode);
+        return false;
+    }
+    v->evex = true;
+    v->w = e->w;
+    insn_isa = ISA_AVX512F | e->isa | (len < 2 && !(e->flags & EVEX_LIG) ? ISA_AVX512VL : 0);
+    v->aaa = in->opmask;
+    v->z = in->zeroing;
+    if ((v->aaa || v->z) && (e->flags & EVEX_NOMASK)) {
+        fprintf(stderr, "%s cannot be masked\n", in->opcode);
+        return false;
+    }
+    if (v->z && !v->aaa) {
+        fprintf(stderr, "%s: {z} needs an opmask {%%k1}-{%%k7}\n", in->opcode);
+        return false;
+    }
+    if (v->z && (e->flags & EVEX_KDST)) {
+        fprintf(stderr, "%s: {z} cannot be used with a mask destination\n", in->opcode);
+        return false;
+    }
 
-    if (rm > 7) rm -= 8;
-    
-    // force REX for new 8-bit registers
-    bool needs_rex = rex_w || rex_b ||
-    !strcmp(dst->reg, "%sil") || !strcmp(dst->reg, "%dil") || !strcmp(dst->reg, "%bpl") || !strcmp(dst->reg, "%spl");
-    
-    if (rm == 0) {
-        switch(sz) {
-            case 8:
-                *out++ = 0x2c;
-                *out++ = src->imm;
-                size += 2;
-                break;
-            case 16:
-                *out++ = 0x66;
-                *out++ = 0x2d;
-                *((uint16_t*)out) = (uint16_t)src->imm;
-                out += 2;
-                size += 4;
-                break;
-            case 64:
-                if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-                // FALLTHRU
-            case 32:
-                *out++ = 0x2d;
-                *((uint32_t*)out) = (uint32_t)src->imm;
-                out += 4;
-                size += 6;
-                break;
+    if (m && m->bcst) {
+        int bytes = m->bcst * e->elem * (e->tuple == TUPLE_HV ? 2 : 1);
+        int l = bytes == 16 ? 0 : bytes == 32 ? 1 : bytes == 64 ? 2 : -1;
+        if (e->tuple != TUPLE_FV && e->tuple != TUPLE_HV) {
+            fprintf(stderr, "%s cannot broadcast a memory operand\n", in->opcode);
+            return false;
         }
-        return size;
+        if (l < 0 || (l != len && !((e->flags & EVEX_NARROW) && l == len + 1))) {
+            fprintf(stderr, "%s: {1to%d} does not match the vector length\n", in->opcode, m->bcst);
+            return false;
+        }
+        v->l = l;
+        v->b = true;
     }
+    v->disp8n = disp8_scale(e, v->l, v->b);
 
-    switch (sz) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x80;
-            *out++ = (0b11 << 6) | (5 << 3) | (rm & 7);
-            *out++ = src->imm;
-            size += 3;
-            break;
-        case 16:
-            *out++ = 0x66;
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x81;
-            *out++ = (0b11 << 6) | (5 << 3) | (rm & 7);
-            *((uint16_t*)out) = (uint16_t)src->imm;
-            out += 2;
-            size += 5;
-            break;
-        case 32:
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x81;
-            *out++ = (0b11 << 6) | (5 << 3) | (rm & 7);
-            *((uint32_t*)out) = (uint32_t)src->imm;
-            out += 4;
-            size += 7;
-            break;
-
+    if (in->rounding) {
+        bool sae = in->rounding == ROUND_SAE;
+        if (!(e->flags & (sae ? EVEX_SAE : EVEX_ER))) {
+            fprintf(stderr, "%s does not take %s\n", in->opcode, sae ? "{sae}" : "a rounding mode");
+            return false;
+        }
+        if (m || (len != 2 && e->tuple != TUPLE_FIXED)) {
+            fprintf(stderr, "%s: rounding needs %s\n", in->opcode, m ? "register operands" : "512-bit operands");
+            return false;
+        }
+        v->b = true;
+        v->l = sae ? 0 : in->rounding - ROUND_RN;
     }
-
-    return size;
+    return true;
 }
 
-size_t encode_sub_imm_mem(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
-
-    int mem_reg_sz = reg_size(dst->mem.base);
+// vector register operands from..to must all be the same width
+static bool same_vec_size(InsnCtx *c, size_t from, size_t to) {
+    const char *first = NULL;
+    for (size_t i = from; i <= to; i++) {
+        Operand *o = operand(c, i);
+        if (!is_vec(o)) continue;
+        if (!first) {
+            first = o->reg;
+        } else if (reg_size(o->reg) != reg_size(first)) {
+            fprintf(stderr, "Size mismatch: %s vs %s\n", first, o->reg);
+            return false;
+        }
+    }
+    return true;
+}
 
-    int mem_size = dst->mem.size;
+// a vector register, or an opmask for the compares and tests that write one
+static bool is_vec_dst(InsnCtx *c, const Operand *o) {
+    if (is_vec(o)) return true;
+    const EvexDef *e = is_mask(o) ? find_evex(c->def->name) : NULL;
+    return e && (e->flags & EVEX_KDST);
+}
 
-    int rm = reg_code(dst->mem.base);
+// {z} has nothing to zero when the destination is memory
+static bool store_masking(InsnCtx *c, const Operand *dst) {
+    if (dst->kind == OP_MEM && c->inst->zeroing) {
+        fprintf(stderr, "%s: {z} cannot be used with a memory destination\n", c->inst->opcode);
+        return false;
+    }
+    return true;
+}
 
-    bool rex_w = (mem_size == 64);
-    bool rex_b = (rm & 8) != 0;
+static size_t encode_vex_imm(uint8_t *out, const VexInsn *v, int reg, const char *regname, Operand *rm, Operand *imm) {
+    if (!check_imm(imm->imm, 8)) return 0;
+    size_t size = encode_vex(out, v, reg, regname, rm);
+    return size ? size + emit_imm(out + size, imm->imm, 1) : 0;
+}
 
-    if (rm > 7) rm -= 8;
+// op src2(r/m), src1(vvvv), dst
+static size_t enc_vex(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || !is_vec_or_mem(operand(c, 0)) || !is_vec(operand(c, 1)) ||
+        !is_vec_dst(c, operand(c, 2)))
+        return bad_operands(c);
+    if (!same_vec_size(c, 0, 2)) return 0;
+    Operand *dst = operand(c, 2);
+    VexInsn v;
+    if (!vex_insn(c, reg_code(operand(c, 1)->reg), &v)) return 0;
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, operand(c, 0));
+}
 
-    // force REX for new 8-bit registers
-    bool needs_rex = rex_w || rex_b;
-    if (mem_reg_sz == 32) {
-        *out++ = 0x67;
-        size++;
-    }
-
-    switch (mem_size) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x80;
-            *out++ = (5 << 3) | (rm & 7);
-            *out++ = src->imm;
-            size += 3;
-            break;
-        case 16:
-            *out++ = 0x66;
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x81;
-            *out++ = (5 << 3) | (rm & 7);
-            *((uint16_t*)out) = (uint16_t)src->imm;
-            out += 2;
-            size += 5;
-            break;
-        case 32:
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x81;
-            *out++ = (5 << 3) | (rm & 7);
-            *((uint32_t*)out) = (uint32_t)src->imm;
-            out += 4;
-            size += 7;
-            break;
-    }
+// op src(r/m), dst: no vvvv; the operands may differ in size (conversions,
+// broadcasts, zero/sign extension)
+static size_t enc_vex_2op(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_vec_or_mem(operand(c, 0)) || !is_vec(operand(c, 1))) return bad_operands(c);
+    Operand *dst = operand(c, 1);
+    VexInsn v;
+    if (!vex_insn(c, 0, &v)) return 0;
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, operand(c, 0));
+}
 
-    return size;
+// op m, dst: vlddqu, vmovntdqa, vbroadcastf128/i128
+static size_t enc_vex_load(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || operand(c, 0)->kind != OP_MEM) return bad_operands(c);
+    return enc_vex_2op(out, c);
 }
 
-static size_t encode_sub_reg_mem(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
+// op src, m: vmovntps, vmovntpd, vmovntdq
+static size_t enc_vex_store(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_vec(operand(c, 0)) || operand(c, 1)->kind != OP_MEM) return bad_operands(c);
+    Operand *src = operand(c, 0);
+    VexInsn v;
+    if (!vex_insn(c, 0, &v)) return 0;
+    return encode_vex(out, &v, reg_code(src->reg), src->reg, operand(c, 1));
+}
 
-    int mem_reg_sz = reg_size(dst->mem.base);
+// op $imm8, src2(r/m), src1(vvvv), dst; src2 may be narrower (vinserti128)
+static size_t enc_vex_imm(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 4 || operand(c, 0)->kind != OP_IMM || !is_vec_or_mem(operand(c, 1)) ||
+        !is_vec(operand(c, 2)) || !is_vec_dst(c, operand(c, 3)))
+        return bad_operands(c);
+    if (!same_vec_size(c, 2, 3)) return 0;
+    Operand *dst = operand(c, 3);
+    VexInsn v;
+    if (!vex_insn(c, reg_code(operand(c, 2)->reg), &v)) return 0;
+    return encode_vex_imm(out, &v, reg_code(dst->reg), dst->reg, operand(c, 1), operand(c, 0));
+}
 
-    int mem_size = reg_size(src->reg);
+// op $imm8, src(r/m), dst
+static size_t enc_vex_2op_imm(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || operand(c, 0)->kind != OP_IMM || !is_vec_or_mem(operand(c, 1)) ||
+        !is_vec(operand(c, 2)))
+        return bad_operands(c);
+    Operand *dst = operand(c, 2);
+    VexInsn v;
+    if (!vex_insn(c, 0, &v)) return 0;
+    return encode_vex_imm(out, &v, reg_code(dst->reg), dst->reg, operand(c, 1), operand(c, 0));
+}
 
-    if (mem_reg_sz == 32) {
-        *out++ = 0x67;
-        size++;
+// vpermilps/vpermilpd: a variable control vector (0F 38, NDS) or an imm8
+// (0F 3A, opcode byte in ext)
+static size_t enc_vex_permil(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands == 3 && operand(c, 0)->kind == OP_IMM) {
+        InsnDef def = *c->def;
+        def.op = 0x660F3A00 | def.ext;
+        InsnCtx imm = *c;
+        imm.def = &def;
+        return enc_vex_2op_imm(out, &imm);
     }
+    return enc_vex(out, c);
+}
 
-    int mod = reg_code(src->reg);
-    int rm = reg_code(dst->mem.base);
+// vextractf128/i128 (and the 32x4/64x4 forms) $imm8, src, dst(r/m): the
+// source is ModRM.reg
+static size_t enc_vex_extract(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || operand(c, 0)->kind != OP_IMM || !is_vec(operand(c, 1)) ||
+        !is_vec_or_mem(operand(c, 2)))
+        return bad_operands(c);
+    if (!store_masking(c, operand(c, 2))) return 0;
+    Operand *src = operand(c, 1);
+    VexInsn v;
+    if (!vex_insn(c, 0, &v)) return 0;
+    return encode_vex_imm(out, &v, reg_code(src->reg), src->reg, operand(c, 2), operand(c, 0));
+}
 
-    bool rex_w = (mem_size == 64);
-    bool rex_b = (rm & 8) != 0;
-    bool rex_r = (mod & 8) != 0;
+// vblendvps/vblendvpd/vpblendvb sel, src2(r/m), src1(vvvv), dst: the selector
+// register goes in the top four bits of an imm8 (/is4)
+static size_t enc_vex_blendv(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 4 || !is_vec(operand(c, 0))) return bad_operands(c);
+    Operand sel = {.kind = OP_IMM, .imm = reg_code(operand(c, 0)->reg) << 4};
+    Operand *ops[4] = {&sel, operand(c, 1), operand(c, 2), operand(c, 3)};
+    if (!is_vec_or_mem(ops[1]) || !is_vec(ops[2]) || !is_vec(ops[3])) return bad_operands(c);
+    if (!same_vec_size(c, 0, 3)) return 0;
+    VexInsn v;
+    if (!vex_insn(c, reg_code(ops[2]->reg), &v)) return 0;
+    return encode_vex_imm(out, &v, reg_code(ops[3]->reg), ops[3]->reg, ops[1], ops[0]);
+}
 
-    bool high = (src->reg[strlen(src->reg)-1] == 'h');
+// A register move whose source needs VEX.B and whose destination does not
+// fits the two-byte C5 prefix with the store opcode, which swaps them: VEX.R
+// is in C5 and VEX.B is not. gas does the same.
+static bool vex_store_form(const VexInsn *v, const Operand *src, const Operand *dst) {
+    return !v->evex && src->kind == OP_REG && (reg_code(src->reg) & 8) && !(reg_code(dst->reg) & 8);
+}
 
+// loads and stores (ext is the store opcode's last byte, as for SSE)
+static size_t enc_vex_mov(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    VexInsn v;
+    if (!vex_insn(c, 0, &v)) return 0;
+    if (is_vec(dst) && is_vec_or_mem(src)) {
+        if (!same_vec_size(c, 0, 1)) return 0;
+        if (vex_store_form(&v, src, dst)) {
+            v.op = (v.op & ~0xFFu) | c->def->ext;
+            return encode_vex(out, &v, reg_code(src->reg), src->reg, dst);
+        }
+        return encode_vex(out, &v, reg_code(dst->reg), dst->reg, src);
+    }
+    if (is_vec(src) && dst->kind == OP_MEM) {
+        if (!store_masking(c, dst)) return 0;
+        v.op = (v.op & ~0xFFu) | c->def->ext;
+        return encode_vex(out, &v, reg_code(src->reg), src->reg, dst);
+    }
+    return bad_operands(c);
+}
 
-    bool needs_sib = check_need_sib(rm);
+// vmovss/vmovsd: a load or store, or a merge of two registers
+static size_t enc_vex_movs(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands == 2) return enc_vex_mov(out, c);
+    if (c->inst->noperands != 3 || !is_xmm(operand(c, 0)) || !is_xmm(operand(c, 1)) || !is_xmm(operand(c, 2)))
+        return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 2);
+    VexInsn v;
+    if (!vex_insn(c, reg_code(operand(c, 1)->reg), &v)) return 0;
+    if (vex_store_form(&v, src, dst)) {
+        v.op = (v.op & ~0xFFu) | c->def->ext;
+        return encode_vex(out, &v, reg_code(src->reg), src->reg, dst);
+    }
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, src);
+}
 
+// vpsllw/d/q, vpsrlw/d/q, vpsraw/d by xmm/m128 or imm8, as for SSE; the
+// immediate form puts the destination in vvvv and /ext in ModRM.reg
+static size_t enc_vex_shift(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || !is_vec_or_mem(operand(c, 1)) || !is_vec(operand(c, 2))) return bad_operands(c);
+    Operand *cnt = operand(c, 0), *src = operand(c, 1), *dst = operand(c, 2);
+    if (!same_vec_size(c, 1, 2)) return 0;
+    VexInsn v;
+    if (cnt->kind == OP_IMM) {
+        if (!vex_insn(c, reg_code(dst->reg), &v)) return 0;
+        // only EVEX has a memory source for the immediate count
+        if (src->kind == OP_MEM && !v.evex && !evex_insn(c, find_evex(c->def->name), v.l, &v)) return 0;
+        v.op = (v.op & ~0xFFu) | (0x70 + (v.op & 0x0F));
+        return encode_vex_imm(out, &v, c->def->ext, NULL, src, cnt);
+    }
+    if ((c->def->op & 0xF0) == 0x70 || src->kind != OP_REG || !(is_xmm(cnt) || cnt->kind == OP_MEM))
+        return bad_operands(c);
+    if (!vex_insn(c, reg_code(src->reg), &v)) return 0;
+    v.disp8n = 16;      // the count is always 128 bits
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, cnt);
+}
 
-    bool needs_rex = rex_w || rex_b || rex_r ||
-        !strcmp(src->reg, "%sil") || !strcmp(src->reg, "%dil") || !strcmp(src->reg, "%bpl") || !strcmp(src->reg, "%spl");
+// the vector index of a gather or scatter, and EVEX's mandatory opmask
+static bool check_vsib(InsnCtx *c, MemOperand *m, const VexInsn *v) {
+    if (!m->index || reg_size(m->index) < 128) {
+        fprintf(stderr, "%s needs a vector index register\n", c->inst->opcode);
+        return false;
+    }
+    if (v->evex && (!v->aaa || v->z)) {
+        fprintf(stderr, "%s needs an opmask {%%k1}-{%%k7} and no {z}\n", c->inst->opcode);
+        return false;
+    }
+    return true;
+}
 
-    if (high && needs_rex) {
-        fprintf(stderr, "High register not supported with REX prefix\n");
-        exit(1);
+// gathers. VEX: mask(vvvv), VSIB memory, dst; EVEX: VSIB memory, dst{%k}.
+// The mask, index and destination must all differ, or the instruction faults.
+static size_t enc_vex_gather(uint8_t *out, InsnCtx *c) {
+    size_t n = c->inst->noperands;
+    if ((n != 2 && n != 3) || (n == 3 && !is_vec(operand(c, 0))) || operand(c, n - 2)->kind != OP_MEM ||
+        !is_vec(operand(c, n - 1)))
+        return bad_operands(c);
+    Operand *dst = operand(c, n - 1);
+    MemOperand *m = &operand(c, n - 2)->mem;
+    int cm = n == 3 ? reg_code(operand(c, 0)->reg) : -1;
+    VexInsn v;
+    if (!vex_insn(c, n == 3 ? cm : 0, &v)) return 0;
+    if (v.evex != (n == 2)) return bad_operands(c);
+    if (!check_vsib(c, m, &v)) return 0;
+    int ci = reg_code(m->index), cd = reg_code(dst->reg);
+    if (cm == ci || cm == cd || ci == cd) {
+        fprintf(stderr, "%s: mask, index and destination must be different registers\n", c->inst->opcode);
+        return 0;
     }
+    v.vsib = true;
+    return encode_vex(out, &v, cd, dst->reg, operand(c, n - 2));
+}
 
-    if (mod > 7) mod -= 8;
-    if (rm > 7) rm -= 8;
+// scatters: src, VSIB memory{%k}
+static size_t enc_evex_scatter(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_vec(operand(c, 0)) || operand(c, 1)->kind != OP_MEM) return bad_operands(c);
+    Operand *src = operand(c, 0);
+    VexInsn v;
+    if (!vex_insn(c, 0, &v) || !check_vsib(c, &operand(c, 1)->mem, &v)) return 0;
+    v.vsib = true;
+    return encode_vex(out, &v, reg_code(src->reg), src->reg, operand(c, 1));
+}
 
+// vpcompressd/q, vcompressps/pd: src, dst(r/m); the source is ModRM.reg
+static size_t enc_evex_compress(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_vec(operand(c, 0)) || !is_vec_or_mem(operand(c, 1))) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    if (!same_vec_size(c, 0, 1) || !store_masking(c, dst)) return 0;
+    VexInsn v;
+    if (!vex_insn(c, 0, &v)) return 0;
+    return encode_vex(out, &v, reg_code(src->reg), src->reg, dst);
+}
 
-    if (rm == 0b101) {
-        // modrm would give rip as base
-        switch (mem_size) {
-            case 8:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x28;
-                *out++ = (0b01 << 6) | (mod << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-            case 16:
-                *out++ = 0x66;
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x29;
-                *out++ = (0b01 << 6) | (mod << 3) | 5;
-                *out++ = 0x00;
-                size += 4;
-                break;
-            case 32:
-            case 64:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x29;
-                *out++ = (0b01 << 6) | (mod << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-        }
-        return size;
+// vpmovdb, vpmovqw and the other down-converts, with their saturating forms:
+// src, dst(r/m), the source being ModRM.reg. The destination is a half,
+// quarter or eighth of the source (the tuple), but at least an %xmm.
+static size_t enc_evex_pmov(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_vec(operand(c, 0)) || !is_vec_or_mem(operand(c, 1))) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    const EvexDef *e = find_evex(c->def->name);
+    int want = reg_size(src->reg) / (e->tuple == TUPLE_HVM ? 2 : e->tuple == TUPLE_QVM ? 4 : 8);
+    if (is_vec(dst) && reg_size(dst->reg) != (want < 128 ? 128 : want)) {
+        fprintf(stderr, "Size mismatch: %s vs %s\n", src->reg, dst->reg);
+        return 0;
     }
+    if (!store_masking(c, dst)) return 0;
+    VexInsn v;
+    if (!vex_insn(c, 0, &v)) return 0;
+    return encode_vex(out, &v, reg_code(src->reg), src->reg, dst);
+}
 
+// vpmovm2b/w/d/q, vpbroadcastmb2q, vpbroadcastmw2d: opmask(r/m), dst
+static size_t enc_evex_k2vec(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_mask(operand(c, 0)) || !is_vec(operand(c, 1))) return bad_operands(c);
+    Operand *dst = operand(c, 1);
+    VexInsn v;
+    if (!vex_insn(c, 0, &v)) return 0;
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, operand(c, 0));
+}
 
+// vpmovb2m/w2m/d2m/q2m: vector register(r/m), opmask
+static size_t enc_evex_vec2k(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_vec(operand(c, 0)) || !is_mask(operand(c, 1))) return bad_operands(c);
+    Operand *dst = operand(c, 1);
+    VexInsn v;
+    if (!vex_insn(c, 0, &v)) return 0;
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, operand(c, 0));
+}
 
+// vpbroadcastb/w/d/q from xmm/m, or in EVEX from a general register (r32, r64
+// for q) with the opcode byte in ext
+static size_t enc_vex_bcst(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_gpr_operand(operand(c, 0))) return enc_vex_2op(out, c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    const EvexDef *e = find_evex(c->def->name);
+    if (!is_vec(dst) || reg_size(src->reg) != (e->w ? 64 : 32)) return bad_operands(c);
+    VexInsn v;
+    if (!vex_insn(c, 0, &v)) return 0;
+    if (!v.evex && !evex_insn(c, e, v.l, &v)) return 0;
+    v.op = (v.op & ~0xFFu) | c->def->ext;
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, src);
+}
 
-    switch (mem_size) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x28;
-            *out++ = (mod << 3) | rm;
-            size += 2;
-            break;
-        case 16:
-            *out++ = 0x66;
-            size++;
-            // FALLTHRU
-        case 32:
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x29;
-            *out++ = (mod << 3) | rm;
-            // if (needs_sib) {emit_sib(&out, 0, 0b100, reg_code(dst->mem.base)); size++;}
-            size += 2;
-            break;
+// vpmovmskb, vmovmskps, vmovmskpd: vector into a 32/64-bit register
+static size_t enc_vex_movmsk(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_vec(operand(c, 0)) || !is_gpr_operand(operand(c, 1))) return bad_operands(c);
+    Operand *dst = operand(c, 1);
+    if (reg_size(dst->reg) != 32 && reg_size(dst->reg) != 64) return bad_operands(c);
+    VexInsn v;
+    if (!vex_insn(c, 0, &v)) return 0;
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, operand(c, 0));
+}
 
+// vmovd/vmovq, as movd/movq. W is set for a 64-bit general register or
+// memory operand; the xmm-to-xmm and m64 forms of vmovq (F3 0F 7E, 66 0F D6)
+// ignore it, and gas leaves it off for them. In EVEX gas moves m64 with the
+// general-register opcodes (66 0F 6E/7E, W1) instead.
+static size_t enc_vex_movd(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    bool q = c->def->size == 64;
+    InsnDef def = *c->def;
+    InsnCtx x = *c;
+    x.def = &def;
+    VexInsn v;
+
+    if (q && is_xmm(dst) && is_xmm_or_mem(src)) {
+        def.op = 0xF30F7E;
+        def.size = 0;
+        if (!vex_insn(&x, 0, &v)) return 0;
+        if (vex_store_form(&v, src, dst)) {
+            v.op = 0x660FD6;
+            return encode_vex(out, &v, reg_code(src->reg), src->reg, dst);
+        }
+        if (v.evex && src->kind == OP_MEM) v.op = 0x660F6E;
+        return encode_vex(out, &v, reg_code(dst->reg), dst->reg, src);
     }
+    if (q && is_xmm(src) && dst->kind == OP_MEM) {
+        def.op = 0x660FD6;
+        def.size = 0;
+        if (!vex_insn(&x, 0, &v)) return 0;
+        if (v.evex) v.op = 0x660F7E;
+        return encode_vex(out, &v, reg_code(src->reg), src->reg, dst);
+    }
+    if (!is_xmm(src) && !is_xmm(dst)) return bad_operands(c);
+
+    Operand *xr = is_xmm(dst) ? dst : src, *g = is_xmm(dst) ? src : dst;
+    int sz = is_gpr_operand(g) ? reg_size(g->reg) : g->kind == OP_MEM ? c->def->size : 0;
+    if (sz != (q ? 64 : 32)) return bad_operands(c);
+    def.op = xr == dst ? 0x660F6E : 0x660F7E;
+    if (!vex_insn(&x, 0, &v)) return 0;
+    return encode_vex(out, &v, reg_code(xr->reg), xr->reg, g);
+}
 
-
-    if (needs_sib) {
-        emit_sib(&out, 0, 0b100, reg_code(dst->mem.base));
-        size++;
+// vpextrb/w/d/q, vextractps $imm8, xmm, r/m, as pextr*; the register form of
+// vpextrw is 66 0F C5
+static size_t enc_vex_pextr(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || operand(c, 0)->kind != OP_IMM || !is_xmm(operand(c, 1))) return bad_operands(c);
+    Operand *imm = operand(c, 0), *xr = operand(c, 1), *dst = operand(c, 2);
+    bool q = c->def->size == 64;
+    if (dst->kind != OP_MEM) {
+        if (!is_gpr_operand(dst)) return bad_operands(c);
+        int sz = reg_size(dst->reg);
+        if (q ? sz != 64 : sz != 32 && sz != 64) return bad_operands(c);
     }
+    InsnDef def = *c->def;
+    InsnCtx x = *c;
+    x.def = &def;
+    VexInsn v;
+    if (c->def->size == 16 && dst->kind == OP_REG) {
+        def.op = 0x660FC5;
+        if (!vex_insn(&x, 0, &v)) return 0;
+        return encode_vex_imm(out, &v, reg_code(dst->reg), dst->reg, xr, imm);
+    }
+    if (!vex_insn(&x, 0, &v)) return 0;
+    return encode_vex_imm(out, &v, reg_code(xr->reg), xr->reg, dst, imm);
+}
 
+// vpinsrb/w/d/q $imm8, r/m, src1(vvvv), dst
+static size_t enc_vex_pinsr(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 4 || operand(c, 0)->kind != OP_IMM || !is_xmm(operand(c, 2)) ||
+        !is_xmm(operand(c, 3)))
+        return bad_operands(c);
+    Operand *imm = operand(c, 0), *src = operand(c, 1), *dst = operand(c, 3);
+    bool q = c->def->size == 64;
+    if (src->kind != OP_MEM) {
+        if (!is_gpr_operand(src)) return bad_operands(c);
+        int sz = reg_size(src->reg);
+        if (q ? sz != 64 : sz != 32) return bad_operands(c);
+    }
+    VexInsn v;
+    if (!vex_insn(c, reg_code(operand(c, 2)->reg), &v)) return 0;
+    return encode_vex_imm(out, &v, reg_code(dst->reg), dst->reg, src, imm);
+}
 
-    return size;
+// vcvtsi2ss/vcvtsi2sd r/m32 or r/m64 (suffix l/q), src1(vvvv), dst; W selects
+// the 64-bit source, in EVEX too
+static size_t enc_vex_cvtsi2(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || !is_xmm(operand(c, 1)) || !is_xmm(operand(c, 2))) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 2);
+    if (!is_gpr_operand(src) && src->kind != OP_MEM) return bad_operands(c);
+    int sz = insn_size(c, src->kind == OP_REG ? src : NULL, NULL);
+    if (!sz) return 0;
+    if (sz != 32 && sz != 64) return bad_operands(c);
+    InsnDef def = *c->def;
+    def.size = sz;
+    InsnCtx x = *c;
+    x.def = &def;
+    VexInsn v;
+    if (!vex_insn(&x, reg_code(operand(c, 1)->reg), &v)) return 0;
+    if (v.evex) {
+        v.w = sz == 64;
+        v.disp8n = sz / 8;
+    }
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, src);
 }
 
-size_t encode_sub_mem_reg(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
-    int sz = reg_size(dst->reg);
+// vcvtss2si, vcvttss2si, vcvtsd2si, vcvttsd2si xmm/m, r32/r64; W for a 64-bit
+// result, in EVEX too
+static size_t enc_vex_cvt2si(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_xmm_or_mem(operand(c, 0)) || !is_gpr_operand(operand(c, 1)))
+        return bad_operands(c);
+    Operand *dst = operand(c, 1);
+    int sz = insn_size(c, dst, NULL);
+    if (sz != 32 && sz != 64) return bad_operands(c);
+    InsnDef def = *c->def;
+    def.size = sz;
+    InsnCtx x = *c;
+    x.def = &def;
+    VexInsn v;
+    if (!vex_insn(&x, 0, &v)) return 0;
+    if (v.evex) v.w = sz == 64;
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, operand(c, 0));
+}
 
+// vmaskmovps/pd, vpmaskmovd/q: a masked load m, mask(vvvv), dst, or a masked
+// store src, mask(vvvv), m, whose opcode is two above the load's
+static size_t enc_vex_maskmov(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || !is_vec(operand(c, 1))) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 2);
+    if (src->kind == OP_MEM && is_vec(dst)) return enc_vex(out, c);
+    if (!is_vec(src) || dst->kind != OP_MEM) return bad_operands(c);
+    if (!same_vec_size(c, 0, 1)) return 0;
+    VexInsn v;
+    if (!vex_insn(c, reg_code(operand(c, 1)->reg), &v)) return 0;
+    v.op += 2;
+    return encode_vex(out, &v, reg_code(src->reg), src->reg, dst);
+}
 
-    int mem_sz = reg_size(src->mem.base);
+// vzeroupper (L=0), vzeroall (L=1, given as ext)
+static size_t enc_vex_fixed(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 0) return bad_operands(c);
+    uint8_t *start = out;
+    int pp, map;
+    uint8_t opcode = vex_split(c->def->op, &pp, &map);
+    emit_vex(&out, false, false, false, map, false, 0, c->def->ext, pp);
+    *out++ = opcode;
+    return out - start;
+}
 
-    
-    int rm = reg_code(src->mem.base);
-    int reg = reg_code(dst->reg);
+// BMI1/BMI2 on general registers; W for 64-bit operands
+static int bmi_size(InsnCtx *c, Operand *a, Operand *b) {
+    int sz = insn_size(c, a, b);
+    if (sz && sz != 32 && sz != 64) {
+        bad_operands(c);
+        return 0;
+    }
+    return sz;
+}
 
-    bool needs_sib = check_need_sib(rm);
+// andn, pdep, pext, mulx: src2(r/m), src1(vvvv), dst
+static size_t enc_bmi(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || !is_gpr_operand(operand(c, 1)) || !is_gpr_operand(operand(c, 2)))
+        return bad_operands(c);
+    Operand *src = operand(c, 0), *vsrc = operand(c, 1), *dst = operand(c, 2);
+    int sz = bmi_size(c, src->kind == OP_REG ? src : vsrc, dst);
+    if (!sz || !bmi_size(c, vsrc, dst)) return 0;
+    VexInsn v = {.op = c->def->op, .w = sz == 64, .vvvv = reg_code(vsrc->reg)};
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, src);
+}
 
-    bool rex_w = (sz == 64);
-    bool rex_b = (rm & 8) != 0;
-    bool rex_r = (reg & 8) != 0;
+// bextr, bzhi, sarx, shlx, shrx: the first AT&T operand goes in vvvv
+static size_t enc_bmi_rv(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || !is_gpr_operand(operand(c, 0)) || !is_gpr_operand(operand(c, 2)))
+        return bad_operands(c);
+    Operand *vsrc = operand(c, 0), *src = operand(c, 1), *dst = operand(c, 2);
+    int sz = bmi_size(c, vsrc, dst);
+    if (!sz || (src->kind == OP_REG && !bmi_size(c, src, dst))) return 0;
+    VexInsn v = {.op = c->def->op, .w = sz == 64, .vvvv = reg_code(vsrc->reg)};
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, src);
+}
 
+// blsi, blsmsk, blsr: src(r/m), dst(vvvv), /ext
+static size_t enc_bmi_grp(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_gpr_operand(operand(c, 1))) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    int sz = bmi_size(c, src->kind == OP_REG ? src : NULL, dst);
+    if (!sz) return 0;
+    VexInsn v = {.op = c->def->op, .w = sz == 64, .vvvv = reg_code(dst->reg)};
+    return encode_vex(out, &v, c->def->ext, NULL, src);
+}
 
+// rorx $imm8, src(r/m), dst
+static size_t enc_rorx(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || operand(c, 0)->kind != OP_IMM || !is_gpr_operand(operand(c, 2)))
+        return bad_operands(c);
+    Operand *src = operand(c, 1), *dst = operand(c, 2);
+    int sz = bmi_size(c, src->kind == OP_REG ? src : NULL, dst);
+    if (!sz) return 0;
+    VexInsn v = {.op = c->def->op, .w = sz == 64};
+    return encode_vex_imm(out, &v, reg_code(dst->reg), dst->reg, src, operand(c, 0));
+}
 
-    bool needs_rex = rex_w || rex_b || rex_r ||
-        !strcmp(dst->reg, "%sil") || !strcmp(dst->reg, "%dil") || !strcmp(dst->reg, "%bpl") || !strcmp(dst->reg, "%spl");
+// Opmask instructions are VEX-encoded. size is the mask width: 66 selects
+// b and d, W selects d and q.
+static VexInsn kmask_insn(InsnCtx *c) {
+    int sz = c->def->size;
+    return (VexInsn){.op = (sz == 8 || sz == 32 ? 0x660000 : 0) | c->def->op, .w = sz >= 32};
+}
 
+// kmovb/w/d/q between opmasks, memory and general registers
+static size_t enc_kmov(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2) return bad_operands(c);
+    Operand *src = operand(c, 0), *dst = operand(c, 1);
+    VexInsn v = kmask_insn(c);
+    if (is_mask(dst) && (is_mask(src) || src->kind == OP_MEM))
+        return encode_vex(out, &v, reg_code(dst->reg), dst->reg, src);
+    if (is_mask(src) && dst->kind == OP_MEM) {
+        v.op++;
+        return encode_vex(out, &v, reg_code(src->reg), src->reg, dst);
+    }
 
-    if (mem_sz == 32) {
-        *out++ = 0x67;
-        size++;
+    // general registers (32-bit, or 64-bit for kmovq): 92/93, with F2 for d
+    // and q, and W only for q
+    int sz = c->def->size, gsz = sz == 64 ? 64 : 32;
+    v = (VexInsn){.op = sz == 8 ? 0x660F92 : sz == 16 ? 0x0F92 : 0xF20F92, .w = sz == 64};
+    if (is_mask(dst) && is_gpr_operand(src) && reg_size(src->reg) == gsz)
+        return encode_vex(out, &v, reg_code(dst->reg), dst->reg, src);
+    if (is_mask(src) && is_gpr_operand(dst) && reg_size(dst->reg) == gsz) {
+        v.op++;
+        return encode_vex(out, &v, reg_code(dst->reg), dst->reg, src);
     }
+    return bad_operands(c);
+}
 
-    if (rm > 7) rm -= 8;
-    if (reg > 7) reg -= 8;
+// kand, kandn, kor, kxnor, kxor, kadd, kunpck: src2(rm), src1(vvvv), dst, with L set
+static size_t enc_kop(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || !is_mask(operand(c, 0)) || !is_mask(operand(c, 1)) || !is_mask(operand(c, 2)))
+        return bad_operands(c);
+    Operand *dst = operand(c, 2);
+    VexInsn v = kmask_insn(c);
+    v.l = 1;
+    v.vvvv = reg_code(operand(c, 1)->reg);
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, operand(c, 0));
+}
 
-    if (rm == 0b101) {
-        // modrm would give rip as base
-        switch (sz) {
-            case 8:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x2A;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-            case 16:
-                *out++ = 0x66;
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x2B;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 4;
-                break;
-            case 32:
-            case 64:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x2B;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-        }
-        return size;
-    }
+// knot, kortest, ktest: src(rm), dst
+static size_t enc_kop2(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 2 || !is_mask(operand(c, 0)) || !is_mask(operand(c, 1))) return bad_operands(c);
+    Operand *dst = operand(c, 1);
+    VexInsn v = kmask_insn(c);
+    return encode_vex(out, &v, reg_code(dst->reg), dst->reg, operand(c, 0));
+}
 
+// kshiftl/kshiftr $imm8, src(rm), dst: 66 0F 3A, op for b and w and op+1 for
+// d and q, with W for w and q
+static size_t enc_kshift(uint8_t *out, InsnCtx *c) {
+    if (c->inst->noperands != 3 || operand(c, 0)->kind != OP_IMM || !is_mask(operand(c, 1)) ||
+        !is_mask(operand(c, 2)))
+        return bad_operands(c);
+    Operand *dst = operand(c, 2);
+    int sz = c->def->size;
+    VexInsn v = {.op = c->def->op + (sz >= 32), .w = sz == 16 || sz == 64};
+    return encode_vex_imm(out, &v, reg_code(dst->reg), dst->reg, operand(c, 1), operand(c, 0));
+}
 
+static InsnDef insn_table[] = {
+    {"add",  enc_alu, 0x00, 0, 0, LOCK_MEM_DST, 0},
+    {"or",   enc_alu, 0x08, 1, 0, LOCK_MEM_DST, 0},
+    {"adc",  enc_alu, 0x10, 2, 0, LOCK_MEM_DST, 0},
+    {"sbb",  enc_alu, 0x18, 3, 0, LOCK_MEM_DST, 0},
+    {"and",  enc_alu, 0x20, 4, 0, LOCK_MEM_DST, 0},
+    {"sub",  enc_alu, 0x28, 5, 0, LOCK_MEM_DST, 0},
+    {"xor",  enc_alu, 0x30, 6, 0, LOCK_MEM_DST, 0},
+    {"cmp",  enc_alu, 0x38, 7, 0, 0, 0},
+    {"test", enc_test, 0, 0, 0, 0, 0},
+
+    {"mov",    enc_mov, 0, 0, 0, 0, 0},
+    {"movabs", enc_movabs, 0, 0, 0, 0, 0},
+    {"xchg",   enc_xchg, 0, 0, 0, LOCK_MEM_ANY, 0},
+    {"lea",    enc_lea, 0, 0, 0, 0, 0},
+
+    {"push",   enc_push, 0x50, 0, 0, 0, 0},
+    {"pop",    enc_push, 0x58, 0, 0, 0, 0},
+
+    // atomics and memory ordering
+    {"xadd",       enc_xadd, 0x0FC0, 0, 0, LOCK_MEM_DST, 0},
+    {"cmpxchg",    enc_xadd, 0x0FB0, 0, 0, LOCK_MEM_DST, 0},
+    {"cmpxchg8b",  enc_cmpxchgnb, 0, 0, 64, LOCK_MEM_DST, 0},
+    {"cmpxchg16b", enc_cmpxchgnb, 0, 0, 128, LOCK_MEM_DST, ISA_CX16},
+    {"mfence",     enc_fixed, 0x0FAEF0, 0, 0, 0, 0},
+    {"lfence",     enc_fixed, 0x0FAEE8, 0, 0, 0, 0},
+    {"sfence",     enc_fixed, 0x0FAEF8, 0, 0, 0, 0},
+    {"pause",      enc_fixed, 0xF390, 0, 0, 0, 0},
+
+    // cache control, non-temporal stores and timing
+    {"prefetchnta", enc_m, 0x0F18, 0, 0, 0, 0},
+    {"prefetcht0",  enc_m, 0x0F18, 1, 0, 0, 0},
+    {"prefetcht1",  enc_m, 0x0F18, 2, 0, 0, 0},
+    {"prefetcht2",  enc_m, 0x0F18, 3, 0, 0, 0},
+    {"prefetchw",   enc_m, 0x0F0D, 1, 0, 0, ISA_PRFCHW},
+    {"clflush",     enc_m, 0x0FAE, 7, 0, 0, 0},
+    {"clflushopt",  enc_m, 0x660FAE, 7, 0, 0, ISA_CLFLUSHOPT},
+    {"clwb",        enc_m, 0x660FAE, 6, 0, 0, ISA_CLWB},
+    {"movnti",      enc_movnti, 0, 0, 0, 0, 0},
+    {"rdtsc",       enc_fixed, 0x0F31, 0, 0, 0, 0},
+    {"rdtscp",      enc_fixed, 0x0F01F9, 0, 0, 0, ISA_RDTSCP},
+    {"rdpmc",       enc_fixed, 0x0F33, 0, 0, 0, 0},
+    {"cpuid",       enc_fixed, 0x0FA2, 0, 0, 0, 0},
+    {"serialize",   enc_fixed, 0x0F01E8, 0, 0, 0, ISA_SERIALIZE},
+
+    {"movzx",  enc_movx, 0x0FB6, 0, 0, 0, 0},
+    {"movzbw", enc_movx, 0x0FB6, 8, 16, 0, 0},
+    {"movzbl", enc_movx, 0x0FB6, 8, 32, 0, 0},
+    {"movzbq", enc_movx, 0x0FB6, 8, 64, 0, 0},
+    {"movzwl", enc_movx, 0x0FB6, 16, 32, 0, 0},
+    {"movzwq", enc_movx, 0x0FB6, 16, 64, 0, 0},
+    {"movsx",  enc_movx, 0x0FBE, 0, 0, 0, 0},
+    {"movsbw", enc_movx, 0x0FBE, 8, 16, 0, 0},
+    {"movsbl", enc_movx, 0x0FBE, 8, 32, 0, 0},
+    {"movsbq", enc_movx, 0x0FBE, 8, 64, 0, 0},
+    {"movswl", enc_movx, 0x0FBE, 16, 32, 0, 0},
+    {"movswq", enc_movx, 0x0FBE, 16, 64, 0, 0},
+    {"movsxd", enc_movsxd, 0x63, 0, 0, 0, 0},
+    {"movslq", enc_movsxd, 0x63, 0, 0, 0, 0},
+
+    {"inc",  enc_unary, 0xFE, 0, 0, LOCK_MEM_DST, 0},
+    {"dec",  enc_unary, 0xFE, 1, 0, LOCK_MEM_DST, 0},
+    {"not",  enc_unary, 0xF6, 2, 0, LOCK_MEM_DST, 0},
+    {"neg",  enc_unary, 0xF6, 3, 0, LOCK_MEM_DST, 0},
+    {"mul",  enc_unary, 0xF6, 4, 0, 0, 0},
+    {"imul", enc_imul,  0xF6, 5, 0, 0, 0},
+    {"div",  enc_unary, 0xF6, 6, 0, 0, 0},
+    {"idiv", enc_unary, 0xF6, 7, 0, 0, 0},
+
+    {"rol", enc_shift, 0, 0, 0, 0, 0},
+    {"ror", enc_shift, 0, 1, 0, 0, 0},
+    {"rcl", enc_shift, 0, 2, 0, 0, 0},
+    {"rcr", enc_shift, 0, 3, 0, 0, 0},
+    {"shl", enc_shift, 0, 4, 0, 0, 0},
+    {"sal", enc_shift, 0, 4, 0, 0, 0},
+    {"shr", enc_shift, 0, 5, 0, 0, 0},
+    {"sar", enc_shift, 0, 7, 0, 0, 0},
+
+    {"jmp",  enc_branch, 0xE9, 4, 0, 0, 0},
+    {"call", enc_branch, 0xE8, 2, 0, 0, 0},
+    {"ret",  enc_ret, 0, 0, 0, 0, 0},
+    {"int",  enc_int, 0, 0, 0, 0, 0},
+    {"bswap", enc_bswap, 0, 0, 0, 0, 0},
+
+    // bit manipulation
+    {"bsf",    enc_bitscan, 0x0FBC, 0, 0, 0, 0},
+    {"bsr",    enc_bitscan, 0x0FBD, 0, 0, 0, 0},
+    {"popcnt", enc_bitscan, 0xF30FB8, 0, 0, 0, ISA_POPCNT},
+    {"lzcnt",  enc_bitscan, 0xF30FBD, 0, 0, 0, ISA_LZCNT},
+    {"tzcnt",  enc_bitscan, 0xF30FBC, 0, 0, 0, ISA_BMI1},
+    {"bt",     enc_bt, 0x0FA3, 4, 0, 0, 0},
+    {"bts",    enc_bt, 0x0FAB, 5, 0, LOCK_MEM_DST, 0},
+    {"btr",    enc_bt, 0x0FB3, 6, 0, LOCK_MEM_DST, 0},
+    {"btc",    enc_bt, 0x0FBB, 7, 0, LOCK_MEM_DST, 0},
+    {"adcx",   enc_adcx, 0x660F38F6, 0, 0, 0, ISA_ADX},
+    {"adox",   enc_adcx, 0xF30F38F6, 0, 0, 0, ISA_ADX},
+    {"movbe",  enc_movbe, 0, 0, 0, 0, ISA_MOVBE},
+
+    // string instructions, optionally behind rep/repe/repne
+    {"movs", enc_string, 0xA4, 0, 0, 0, 0},
+    {"cmps", enc_string, 0xA6, 0, 0, 0, 0},
+    {"stos", enc_string, 0xAA, 0, 0, 0, 0},
+    {"lods", enc_string, 0xAC, 0, 0, 0, 0},
+    {"scas", enc_string, 0xAE, 0, 0, 0, 0},
+
+    {"syscall", enc_fixed, 0x0F05, 0, 0, 0, 0},
+    {"nop",     enc_fixed, 0x90, 0, 0, 0, 0},
+    {"hlt",     enc_fixed, 0xF4, 0, 0, 0, 0},
+    {"leave",   enc_fixed, 0xC9, 0, 0, 0, 0},
+    {"int3",    enc_fixed, 0xCC, 0, 0, 0, 0},
+    {"ud2",     enc_fixed, 0x0F0B, 0, 0, 0, 0},
+    {"clc",     enc_fixed, 0xF8, 0, 0, 0, 0},
+    {"stc",     enc_fixed, 0xF9, 0, 0, 0, 0},
+    {"cmc",     enc_fixed, 0xF5, 0, 0, 0, 0},
+    {"cld",     enc_fixed, 0xFC, 0, 0, 0, 0},
+    {"std",     enc_fixed, 0xFD, 0, 0, 0, 0},
+    // sign extension of the accumulator, AT&T and Intel spellings
+    {"cbtw", enc_fixed, 0x6698, 0, 0, 0, 0}, {"cbw",  enc_fixed, 0x6698, 0, 0, 0, 0},
+    {"cwtl", enc_fixed, 0x98, 0, 0, 0, 0},   {"cwde", enc_fixed, 0x98, 0, 0, 0, 0},
+    {"cltq", enc_fixed, 0x4898, 0, 0, 0, 0}, {"cdqe", enc_fixed, 0x4898, 0, 0, 0, 0},
+    {"cwtd", enc_fixed, 0x6699, 0, 0, 0, 0}, {"cwd",  enc_fixed, 0x6699, 0, 0, 0, 0},
+    {"cltd", enc_fixed, 0x99, 0, 0, 0, 0},   {"cdq",  enc_fixed, 0x99, 0, 0, 0, 0},
+    {"cqto", enc_fixed, 0x4899, 0, 0, 0, 0}, {"cqo",  enc_fixed, 0x4899, 0, 0, 0, 0},
+
+    // SSE/SSE2 floating point: ps none, pd 66, ss F3, sd F2
+    {"addps", enc_sse, 0x0F58, 0, 0, 0, 0}, {"addpd", enc_sse, 0x660F58, 0, 0, 0, 0},
+    {"addss", enc_sse, 0xF30F58, 0, 0, 0, 0}, {"addsd", enc_sse, 0xF20F58, 0, 0, 0, 0},
+    {"mulps", enc_sse, 0x0F59, 0, 0, 0, 0}, {"mulpd", enc_sse, 0x660F59, 0, 0, 0, 0},
+    {"mulss", enc_sse, 0xF30F59, 0, 0, 0, 0}, {"mulsd", enc_sse, 0xF20F59, 0, 0, 0, 0},
+    {"subps", enc_sse, 0x0F5C, 0, 0, 0, 0}, {"subpd", enc_sse, 0x660F5C, 0, 0, 0, 0},
+    {"subss", enc_sse, 0xF30F5C, 0, 0, 0, 0}, {"subsd", enc_sse, 0xF20F5C, 0, 0, 0, 0},
+    {"minps", enc_sse, 0x0F5D, 0, 0, 0, 0}, {"minpd", enc_sse, 0x660F5D, 0, 0, 0, 0},
+    {"minss", enc_sse, 0xF30F5D, 0, 0, 0, 0}, {"minsd", enc_sse, 0xF20F5D, 0, 0, 0, 0},
+    {"divps", enc_sse, 0x0F5E, 0, 0, 0, 0}, {"divpd", enc_sse, 0x660F5E, 0, 0, 0, 0},
+    {"divss", enc_sse, 0xF30F5E, 0, 0, 0, 0}, {"divsd", enc_sse, 0xF20F5E, 0, 0, 0, 0},
+    {"maxps", enc_sse, 0x0F5F, 0, 0, 0, 0}, {"maxpd", enc_sse, 0x660F5F, 0, 0, 0, 0},
+    {"maxss", enc_sse, 0xF30F5F, 0, 0, 0, 0}, {"maxsd", enc_sse, 0xF20F5F, 0, 0, 0, 0},
+    {"sqrtps", enc_sse, 0x0F51, 0, 0, 0, 0}, {"sqrtpd", enc_sse, 0x660F51, 0, 0, 0, 0},
+    {"sqrtss", enc_sse, 0xF30F51, 0, 0, 0, 0}, {"sqrtsd", enc_sse, 0xF20F51, 0, 0, 0, 0},
+    {"rsqrtps", enc_sse, 0x0F52, 0, 0, 0, 0}, {"rsqrtss", enc_sse, 0xF30F52, 0, 0, 0, 0},
+    {"rcpps", enc_sse, 0x0F53, 0, 0, 0, 0}, {"rcpss", enc_sse, 0xF30F53, 0, 0, 0, 0},
+    {"andps", enc_sse, 0x0F54, 0, 0, 0, 0}, {"andpd", enc_sse, 0x660F54, 0, 0, 0, 0},
+    {"andnps", enc_sse, 0x0F55, 0, 0, 0, 0}, {"andnpd", enc_sse, 0x660F55, 0, 0, 0, 0},
+    {"orps", enc_sse, 0x0F56, 0, 0, 0, 0}, {"orpd", enc_sse, 0x660F56, 0, 0, 0, 0},
+    {"xorps", enc_sse, 0x0F57, 0, 0, 0, 0}, {"xorpd", enc_sse, 0x660F57, 0, 0, 0, 0},
+    {"unpcklps", enc_sse, 0x0F14, 0, 0, 0, 0}, {"unpcklpd", enc_sse, 0x660F14, 0, 0, 0, 0},
+    {"unpckhps", enc_sse, 0x0F15, 0, 0, 0, 0}, {"unpckhpd", enc_sse, 0x660F15, 0, 0, 0, 0},
+    {"comiss", enc_sse, 0x0F2F, 0, 0, 0, 0}, {"comisd", enc_sse, 0x660F2F, 0, 0, 0, 0},
+    {"ucomiss", enc_sse, 0x0F2E, 0, 0, 0, 0}, {"ucomisd", enc_sse, 0x660F2E, 0, 0, 0, 0},
+    {"cmpps", enc_sse_imm, 0x0FC2, 0, 0, 0, 0}, {"cmppd", enc_sse_imm, 0x660FC2, 0, 0, 0, 0},
+    {"cmpss", enc_sse_imm, 0xF30FC2, 0, 0, 0, 0}, {"cmpsd", enc_sse_imm, 0xF20FC2, 0, 0, 0, 0},
+    {"cmpeqps", enc_sse_cmp, 0x0FC2, 0, 0, 0, 0}, {"cmpeqpd", enc_sse_cmp, 0x660FC2, 0, 0, 0, 0},
+    {"cmpeqss", enc_sse_cmp, 0xF30FC2, 0, 0, 0, 0}, {"cmpeqsd", enc_sse_cmp, 0xF20FC2, 0, 0, 0, 0},
+    {"cmpltps", enc_sse_cmp, 0x0FC2, 1, 0, 0, 0}, {"cmpltpd", enc_sse_cmp, 0x660FC2, 1, 0, 0, 0},
+    {"cmpltss", enc_sse_cmp, 0xF30FC2, 1, 0, 0, 0}, {"cmpltsd", enc_sse_cmp, 0xF20FC2, 1, 0, 0, 0},
+    {"cmpleps", enc_sse_cmp, 0x0FC2, 2, 0, 0, 0}, {"cmplepd", enc_sse_cmp, 0x660FC2, 2, 0, 0, 0},
+    {"cmpless", enc_sse_cmp, 0xF30FC2, 2, 0, 0, 0}, {"cmplesd", enc_sse_cmp, 0xF20FC2, 2, 0, 0, 0},
+    {"cmpunordps", enc_sse_cmp, 0x0FC2, 3, 0, 0, 0}, {"cmpunordpd", enc_sse_cmp, 0x660FC2, 3, 0, 0, 0},
+    {"cmpunordss", enc_sse_cmp, 0xF30FC2, 3, 0, 0, 0}, {"cmpunordsd", enc_sse_cmp, 0xF20FC2, 3, 0, 0, 0},
+    {"cmpneqps", enc_sse_cmp, 0x0FC2, 4, 0, 0, 0}, {"cmpneqpd", enc_sse_cmp, 0x660FC2, 4, 0, 0, 0},
+    {"cmpneqss", enc_sse_cmp, 0xF30FC2, 4, 0, 0, 0}, {"cmpneqsd", enc_sse_cmp, 0xF20FC2, 4, 0, 0, 0},
+    {"cmpnltps", enc_sse_cmp, 0x0FC2, 5, 0, 0, 0}, {"cmpnltpd", enc_sse_cmp, 0x660FC2, 5, 0, 0, 0},
+    {"cmpnltss", enc_sse_cmp, 0xF30FC2, 5, 0, 0, 0}, {"cmpnltsd", enc_sse_cmp, 0xF20FC2, 5, 0, 0, 0},
+    {"cmpnleps", enc_sse_cmp, 0x0FC2, 6, 0, 0, 0}, {"cmpnlepd", enc_sse_cmp, 0x660FC2, 6, 0, 0, 0},
+    {"cmpnless", enc_sse_cmp, 0xF30FC2, 6, 0, 0, 0}, {"cmpnlesd", enc_sse_cmp, 0xF20FC2, 6, 0, 0, 0},
+    {"cmpordps", enc_sse_cmp, 0x0FC2, 7, 0, 0, 0}, {"cmpordpd", enc_sse_cmp, 0x660FC2, 7, 0, 0, 0},
+    {"cmpordss", enc_sse_cmp, 0xF30FC2, 7, 0, 0, 0}, {"cmpordsd", enc_sse_cmp, 0xF20FC2, 7, 0, 0, 0},
+    {"shufps", enc_sse_imm, 0x0FC6, 0, 0, 0, 0}, {"shufpd", enc_sse_imm, 0x660FC6, 0, 0, 0, 0},
+
+    // SSE3
+    {"haddps", enc_sse, 0xF20F7C, 0, 0, 0, ISA_SSE3}, {"haddpd", enc_sse, 0x660F7C, 0, 0, 0, ISA_SSE3},
+    {"hsubps", enc_sse, 0xF20F7D, 0, 0, 0, ISA_SSE3}, {"hsubpd", enc_sse, 0x660F7D, 0, 0, 0, ISA_SSE3},
+    {"addsubps", enc_sse, 0xF20FD0, 0, 0, 0, ISA_SSE3}, {"addsubpd", enc_sse, 0x660FD0, 0, 0, 0, ISA_SSE3},
+    {"movddup", enc_sse, 0xF20F12, 0, 0, 0, ISA_SSE3}, {"movshdup", enc_sse, 0xF30F16, 0, 0, 0, ISA_SSE3},
+    {"movsldup", enc_sse, 0xF30F12, 0, 0, 0, ISA_SSE3}, {"lddqu", enc_sse_load, 0xF20FF0, 0, 0, 0, ISA_SSE3},
+
+    // conversions
+    {"cvtps2pd", enc_sse, 0x0F5A, 0, 0, 0, 0}, {"cvtpd2ps", enc_sse, 0x660F5A, 0, 0, 0, 0},
+    {"cvtss2sd", enc_sse, 0xF30F5A, 0, 0, 0, 0}, {"cvtsd2ss", enc_sse, 0xF20F5A, 0, 0, 0, 0},
+    {"cvtdq2ps", enc_sse, 0x0F5B, 0, 0, 0, 0}, {"cvtps2dq", enc_sse, 0x660F5B, 0, 0, 0, 0},
+    {"cvttps2dq", enc_sse, 0xF30F5B, 0, 0, 0, 0}, {"cvtdq2pd", enc_sse, 0xF30FE6, 0, 0, 0, 0},
+    {"cvtpd2dq", enc_sse, 0xF20FE6, 0, 0, 0, 0}, {"cvttpd2dq", enc_sse, 0x660FE6, 0, 0, 0, 0},
+    {"cvtsi2ss", enc_cvtsi2, 0xF30F2A, 0, 0, 0, 0}, {"cvtsi2sd", enc_cvtsi2, 0xF20F2A, 0, 0, 0, 0},
+    {"cvtss2si", enc_cvt2si, 0xF30F2D, 0, 0, 0, 0}, {"cvttss2si", enc_cvt2si, 0xF30F2C, 0, 0, 0, 0},
+    {"cvtsd2si", enc_cvt2si, 0xF20F2D, 0, 0, 0, 0}, {"cvttsd2si", enc_cvt2si, 0xF20F2C, 0, 0, 0, 0},
+
+    // moves: load opcode, last byte of the store opcode
+    {"movaps", enc_sse_mov, 0x0F28, 0x0029, 0, 0, 0}, {"movapd", enc_sse_mov, 0x660F28, 0x0029, 0, 0, 0},
+    {"movups", enc_sse_mov, 0x0F10, 0x0011, 0, 0, 0}, {"movupd", enc_sse_mov, 0x660F10, 0x0011, 0, 0, 0},
+    {"movss", enc_sse_mov, 0xF30F10, 0x0011, 0, 0, 0}, {"movsd", enc_sse_mov, 0xF20F10, 0x0011, 0, 0, 0},
+    {"movdqa", enc_sse_mov, 0x660F6F, 0x007F, 0, 0, 0}, {"movdqu", enc_sse_mov, 0xF30F6F, 0x007F, 0, 0, 0},
+    {"movlps", enc_sse_mov, 0x0F12, 0x0013, 0, 0, 0}, {"movhps", enc_sse_mov, 0x0F16, 0x0017, 0, 0, 0},
+    {"movlpd", enc_sse_mov, 0x660F12, 0x0013, 0, 0, 0}, {"movhpd", enc_sse_mov, 0x660F16, 0x0017, 0, 0, 0},
+    {"maskmovdqu", enc_maskmov, 0x660FF7, 0, 0, 0, 0},
+    {"movhlps", enc_sse, 0x0F12, 0, 0, 0, 0}, {"movlhps", enc_sse, 0x0F16, 0, 0, 0, 0},
+    {"movd", enc_movd, 0, 0, 32, 0, 0}, {"movq", enc_movd, 0, 0, 64, 0, 0},
+    {"pmovmskb", enc_movmsk, 0x660FD7, 0, 0, 0, 0}, {"movmskps", enc_movmsk, 0x0F50, 0, 0, 0, 0},
+    {"movmskpd", enc_movmsk, 0x660F50, 0, 0, 0, 0},
+    {"ldmxcsr", enc_m, 0x0FAE, 2, 0, 0, 0}, {"stmxcsr", enc_m, 0x0FAE, 3, 0, 0, 0},
+    {"movntps", enc_sse_store, 0x0F2B, 0, 0, 0, 0}, {"movntpd", enc_sse_store, 0x660F2B, 0, 0, 0, 0},
+    {"movntdq", enc_sse_store, 0x660FE7, 0, 0, 0, 0},
+
+    // SSE2 integer, 66 0F
+    {"paddb", enc_sse, 0x660FFC, 0, 0, 0, 0}, {"paddw", enc_sse, 0x660FFD, 0, 0, 0, 0},
+    {"paddd", enc_sse, 0x660FFE, 0, 0, 0, 0}, {"paddq", enc_sse, 0x660FD4, 0, 0, 0, 0},
+    {"paddsb", enc_sse, 0x660FEC, 0, 0, 0, 0}, {"paddsw", enc_sse, 0x660FED, 0, 0, 0, 0},
+    {"paddusb", enc_sse, 0x660FDC, 0, 0, 0, 0}, {"paddusw", enc_sse, 0x660FDD, 0, 0, 0, 0},
+    {"psubb", enc_sse, 0x660FF8, 0, 0, 0, 0}, {"psubw", enc_sse, 0x660FF9, 0, 0, 0, 0},
+    {"psubd", enc_sse, 0x660FFA, 0, 0, 0, 0}, {"psubq", enc_sse, 0x660FFB, 0, 0, 0, 0},
+    {"psubsb", enc_sse, 0x660FE8, 0, 0, 0, 0}, {"psubsw", enc_sse, 0x660FE9, 0, 0, 0, 0},
+    {"psubusb", enc_sse, 0x660FD8, 0, 0, 0, 0}, {"psubusw", enc_sse, 0x660FD9, 0, 0, 0, 0},
+    {"pmullw", enc_sse, 0x660FD5, 0, 0, 0, 0}, {"pmulhw", enc_sse, 0x660FE5, 0, 0, 0, 0},
+    {"pmulhuw", enc_sse, 0x660FE4, 0, 0, 0, 0}, {"pmuludq", enc_sse, 0x660FF4, 0, 0, 0, 0},
+    {"pmaddwd", enc_sse, 0x660FF5, 0, 0, 0, 0}, {"psadbw", enc_sse, 0x660FF6, 0, 0, 0, 0},
+    {"pavgb", enc_sse, 0x660FE0, 0, 0, 0, 0}, {"pavgw", enc_sse, 0x660FE3, 0, 0, 0, 0},
+    {"pminub", enc_sse, 0x660FDA, 0, 0, 0, 0}, {"pmaxub", enc_sse, 0x660FDE, 0, 0, 0, 0},
+    {"pminsw", enc_sse, 0x660FEA, 0, 0, 0, 0}, {"pmaxsw", enc_sse, 0x660FEE, 0, 0, 0, 0},
+    {"pand", enc_sse, 0x660FDB, 0, 0, 0, 0}, {"pandn", enc_sse, 0x660FDF, 0, 0, 0, 0},
+    {"por", enc_sse, 0x660FEB, 0, 0, 0, 0}, {"pxor", enc_sse, 0x660FEF, 0, 0, 0, 0},
+    {"pcmpeqb", enc_sse, 0x660F74, 0, 0, 0, 0}, {"pcmpeqw", enc_sse, 0x660F75, 0, 0, 0, 0},
+    {"pcmpeqd", enc_sse, 0x660F76, 0, 0, 0, 0}, {"pcmpgtb", enc_sse, 0x660F64, 0, 0, 0, 0},
+    {"pcmpgtw", enc_sse, 0x660F65, 0, 0, 0, 0}, {"pcmpgtd", enc_sse, 0x660F66, 0, 0, 0, 0},
+    {"packsswb", enc_sse, 0x660F63, 0, 0, 0, 0}, {"packssdw", enc_sse, 0x660F6B, 0, 0, 0, 0},
+    {"packuswb", enc_sse, 0x660F67, 0, 0, 0, 0}, {"punpcklbw", enc_sse, 0x660F60, 0, 0, 0, 0},
+    {"punpcklwd", enc_sse, 0x660F61, 0, 0, 0, 0}, {"punpckldq", enc_sse, 0x660F62, 0, 0, 0, 0},
+    {"punpcklqdq", enc_sse, 0x660F6C, 0, 0, 0, 0}, {"punpckhbw", enc_sse, 0x660F68, 0, 0, 0, 0},
+    {"punpckhwd", enc_sse, 0x660F69, 0, 0, 0, 0}, {"punpckhdq", enc_sse, 0x660F6A, 0, 0, 0, 0},
+    {"punpckhqdq", enc_sse, 0x660F6D, 0, 0, 0, 0},
+    {"pshufd", enc_sse_imm, 0x660F70, 0, 0, 0, 0}, {"pshufhw", enc_sse_imm, 0xF30F70, 0, 0, 0, 0},
+    {"pshuflw", enc_sse_imm, 0xF20F70, 0, 0, 0, 0},
+    {"psllw", enc_sse_shift, 0x660FF1, 6, 0, 0, 0}, {"pslld", enc_sse_shift, 0x660FF2, 6, 0, 0, 0},
+    {"psllq", enc_sse_shift, 0x660FF3, 6, 0, 0, 0}, {"psrlw", enc_sse_shift, 0x660FD1, 2, 0, 0, 0},
+    {"psrld", enc_sse_shift, 0x660FD2, 2, 0, 0, 0}, {"psrlq", enc_sse_shift, 0x660FD3, 2, 0, 0, 0},
+    {"psraw", enc_sse_shift, 0x660FE1, 4, 0, 0, 0}, {"psrad", enc_sse_shift, 0x660FE2, 4, 0, 0, 0},
+    {"pslldq", enc_sse_shift, 0x660F73, 7, 0, 0, 0}, {"psrldq", enc_sse_shift, 0x660F73, 3, 0, 0, 0},
+
+    // SSSE3, SSE4.1 and SSE4.2, 66 0F 38
+    {"pshufb", enc_sse, 0x660F3800, 0, 0, 0, ISA_SSSE3}, {"phaddw", enc_sse, 0x660F3801, 0, 0, 0, ISA_SSSE3},
+    {"phaddd", enc_sse, 0x660F3802, 0, 0, 0, ISA_SSSE3}, {"phaddsw", enc_sse, 0x660F3803, 0, 0, 0, ISA_SSSE3},
+    {"pmaddubsw", enc_sse, 0x660F3804, 0, 0, 0, ISA_SSSE3}, {"phsubw", enc_sse, 0x660F3805, 0, 0, 0, ISA_SSSE3},
+    {"phsubd", enc_sse, 0x660F3806, 0, 0, 0, ISA_SSSE3}, {"phsubsw", enc_sse, 0x660F3807, 0, 0, 0, ISA_SSSE3},
+    {"psignb", enc_sse, 0x660F3808, 0, 0, 0, ISA_SSSE3}, {"psignw", enc_sse, 0x660F3809, 0, 0, 0, ISA_SSSE3},
+    {"psignd", enc_sse, 0x660F380A, 0, 0, 0, ISA_SSSE3}, {"pmulhrsw", enc_sse, 0x660F380B, 0, 0, 0, ISA_SSSE3},
+    {"pabsb", enc_sse, 0x660F381C, 0, 0, 0, ISA_SSSE3}, {"pabsw", enc_sse, 0x660F381D, 0, 0, 0, ISA_SSSE3},
+    {"pabsd", enc_sse, 0x660F381E, 0, 0, 0, ISA_SSSE3}, {"ptest", enc_sse, 0x660F3817, 0, 0, 0, ISA_SSE41},
+    {"pmovsxbw", enc_sse, 0x660F3820, 0, 0, 0, ISA_SSE41}, {"pmovsxbd", enc_sse, 0x660F3821, 0, 0, 0, ISA_SSE41},
+    {"pmovsxbq", enc_sse, 0x660F3822, 0, 0, 0, ISA_SSE41}, {"pmovsxwd", enc_sse, 0x660F3823, 0, 0, 0, ISA_SSE41},
+    {"pmovsxwq", enc_sse, 0x660F3824, 0, 0, 0, ISA_SSE41}, {"pmovsxdq", enc_sse, 0x660F3825, 0, 0, 0, ISA_SSE41},
+    {"pmuldq", enc_sse, 0x660F3828, 0, 0, 0, ISA_SSE41}, {"pcmpeqq", enc_sse, 0x660F3829, 0, 0, 0, ISA_SSE41},
+    {"movntdqa", enc_sse_load, 0x660F382A, 0, 0, 0, ISA_SSE41}, {"packusdw", enc_sse, 0x660F382B, 0, 0, 0, ISA_SSE41},
+    {"pmovzxbw", enc_sse, 0x660F3830, 0, 0, 0, ISA_SSE41}, {"pmovzxbd", enc_sse, 0x660F3831, 0, 0, 0, ISA_SSE41},
+    {"pmovzxbq", enc_sse, 0x660F3832, 0, 0, 0, ISA_SSE41}, {"pmovzxwd", enc_sse, 0x660F3833, 0, 0, 0, ISA_SSE41},
+    {"pmovzxwq", enc_sse, 0x660F3834, 0, 0, 0, ISA_SSE41}, {"pmovzxdq", enc_sse, 0x660F3835, 0, 0, 0, ISA_SSE41},
+    {"pcmpgtq", enc_sse, 0x660F3837, 0, 0, 0, ISA_SSE42}, {"pminsb", enc_sse, 0x660F3838, 0, 0, 0, ISA_SSE41},
+    {"pminsd", enc_sse, 0x660F3839, 0, 0, 0, ISA_SSE41}, {"pminuw", enc_sse, 0x660F383A, 0, 0, 0, ISA_SSE41},
+    {"pminud", enc_sse, 0x660F383B, 0, 0, 0, ISA_SSE41}, {"pmaxsb", enc_sse, 0x660F383C, 0, 0, 0, ISA_SSE41},
+    {"pmaxsd", enc_sse, 0x660F383D, 0, 0, 0, ISA_SSE41}, {"pmaxuw", enc_sse, 0x660F383E, 0, 0, 0, ISA_SSE41},
+    {"pmaxud", enc_sse, 0x660F383F, 0, 0, 0, ISA_SSE41}, {"pmulld", enc_sse, 0x660F3840, 0, 0, 0, ISA_SSE41},
+    {"phminposuw", enc_sse, 0x660F3841, 0, 0, 0, ISA_SSE41},
+    {"pblendvb", enc_sse_blendv, 0x660F3810, 0, 0, 0, ISA_SSE41},
+    {"blendvps", enc_sse_blendv, 0x660F3814, 0, 0, 0, ISA_SSE41},
+    {"blendvpd", enc_sse_blendv, 0x660F3815, 0, 0, 0, ISA_SSE41},
+
+    // SSSE3, SSE4.1 and SSE4.2 with imm8, 66 0F 3A
+    {"palignr", enc_sse_imm, 0x660F3A0F, 0, 0, 0, ISA_SSSE3},
+    {"roundps", enc_sse_imm, 0x660F3A08, 0, 0, 0, ISA_SSE41},
+    {"roundpd", enc_sse_imm, 0x660F3A09, 0, 0, 0, ISA_SSE41},
+    {"roundss", enc_sse_imm, 0x660F3A0A, 0, 0, 0, ISA_SSE41},
+    {"roundsd", enc_sse_imm, 0x660F3A0B, 0, 0, 0, ISA_SSE41},
+    {"blendps", enc_sse_imm, 0x660F3A0C, 0, 0, 0, ISA_SSE41},
+    {"blendpd", enc_sse_imm, 0x660F3A0D, 0, 0, 0, ISA_SSE41},
+    {"pblendw", enc_sse_imm, 0x660F3A0E, 0, 0, 0, ISA_SSE41},
+    {"insertps", enc_sse_imm, 0x660F3A21, 0, 0, 0, ISA_SSE41}, {"dpps", enc_sse_imm, 0x660F3A40, 0, 0, 0, ISA_SSE41},
+    {"dppd", enc_sse_imm, 0x660F3A41, 0, 0, 0, ISA_SSE41}, {"mpsadbw", enc_sse_imm, 0x660F3A42, 0, 0, 0, ISA_SSE41},
+    {"pcmpestrm", enc_sse_imm, 0x660F3A60, 0, 0, 0, ISA_SSE42},
+    {"pcmpestri", enc_sse_imm, 0x660F3A61, 0, 0, 0, ISA_SSE42},
+    {"pcmpistrm", enc_sse_imm, 0x660F3A62, 0, 0, 0, ISA_SSE42},
+    {"pcmpistri", enc_sse_imm, 0x660F3A63, 0, 0, 0, ISA_SSE42},
+    {"pextrb", enc_pextr, 0x660F3A14, 0, 8, 0, ISA_SSE41}, {"pextrw", enc_pextr, 0x660F3A15, 0, 16, 0, 0},
+    {"pextrd", enc_pextr, 0x660F3A16, 0, 32, 0, ISA_SSE41}, {"pextrq", enc_pextr, 0x660F3A16, 0, 64, 0, ISA_SSE41},
+    {"extractps", enc_pextr, 0x660F3A17, 0, 32, 0, ISA_SSE41},
+    {"pinsrb", enc_pinsr, 0x660F3A20, 0, 8, 0, ISA_SSE41}, {"pinsrw", enc_pinsr, 0x660FC4, 0, 16, 0, 0},
+    {"pinsrd", enc_pinsr, 0x660F3A22, 0, 32, 0, ISA_SSE41}, {"pinsrq", enc_pinsr, 0x660F3A22, 0, 64, 0, ISA_SSE41},
+    {"crc32", enc_crc32, 0, 0, 0, 0, ISA_SSE42},
+
+    // AVX forms of the SSE instructions; W1 entries have size 64
+    {"vaddps", enc_vex, 0x0F58, 0, 0, 0, ISA_AVX}, {"vaddpd", enc_vex, 0x660F58, 0, 0, 0, ISA_AVX},
+    {"vaddss", enc_vex, 0xF30F58, 0, 0, 0, ISA_AVX}, {"vaddsd", enc_vex, 0xF20F58, 0, 0, 0, ISA_AVX},
+    {"vmulps", enc_vex, 0x0F59, 0, 0, 0, ISA_AVX}, {"vmulpd", enc_vex, 0x660F59, 0, 0, 0, ISA_AVX},
+    {"vmulss", enc_vex, 0xF30F59, 0, 0, 0, ISA_AVX}, {"vmulsd", enc_vex, 0xF20F59, 0, 0, 0, ISA_AVX},
+    {"vsubps", enc_vex, 0x0F5C, 0, 0, 0, ISA_AVX}, {"vsubpd", enc_vex, 0x660F5C, 0, 0, 0, ISA_AVX},
+    {"vsubss", enc_vex, 0xF30F5C, 0, 0, 0, ISA_AVX}, {"vsubsd", enc_vex, 0xF20F5C, 0, 0, 0, ISA_AVX},
+    {"vminps", enc_vex, 0x0F5D, 0, 0, 0, ISA_AVX}, {"vminpd", enc_vex, 0x660F5D, 0, 0, 0, ISA_AVX},
+    {"vminss", enc_vex, 0xF30F5D, 0, 0, 0, ISA_AVX}, {"vminsd", enc_vex, 0xF20F5D, 0, 0, 0, ISA_AVX},
+    {"vdivps", enc_vex, 0x0F5E, 0, 0, 0, ISA_AVX}, {"vdivpd", enc_vex, 0x660F5E, 0, 0, 0, ISA_AVX},
+    {"vdivss", enc_vex, 0xF30F5E, 0, 0, 0, ISA_AVX}, {"vdivsd", enc_vex, 0xF20F5E, 0, 0, 0, ISA_AVX},
+    {"vmaxps", enc_vex, 0x0F5F, 0, 0, 0, ISA_AVX}, {"vmaxpd", enc_vex, 0x660F5F, 0, 0, 0, ISA_AVX},
+    {"vmaxss", enc_vex, 0xF30F5F, 0, 0, 0, ISA_AVX}, {"vmaxsd", enc_vex, 0xF20F5F, 0, 0, 0, ISA_AVX},
+    {"vsqrtps", enc_vex_2op, 0x0F51, 0, 0, 0, ISA_AVX}, {"vsqrtpd", enc_vex_2op, 0x660F51, 0, 0, 0, ISA_AVX},
+    {"vsqrtss", enc_vex, 0xF30F51, 0, 0, 0, ISA_AVX}, {"vsqrtsd", enc_vex, 0xF20F51, 0, 0, 0, ISA_AVX},
+    {"vrsqrtps", enc_vex_2op, 0x0F52, 0, 0, 0, ISA_AVX}, {"vrsqrtss", enc_vex, 0xF30F52, 0, 0, 0, ISA_AVX},
+    {"vrcpps", enc_vex_2op, 0x0F53, 0, 0, 0, ISA_AVX}, {"vrcpss", enc_vex, 0xF30F53, 0, 0, 0, ISA_AVX},
+    {"vandps", enc_vex, 0x0F54, 0, 0, 0, ISA_AVX}, {"vandpd", enc_vex, 0x660F54, 0, 0, 0, ISA_AVX},
+    {"vandnps", enc_vex, 0x0F55, 0, 0, 0, ISA_AVX}, {"vandnpd", enc_vex, 0x660F55, 0, 0, 0, ISA_AVX},
+    {"vorps", enc_vex, 0x0F56, 0, 0, 0, ISA_AVX}, {"vorpd", enc_vex, 0x660F56, 0, 0, 0, ISA_AVX},
+    {"vxorps", enc_vex, 0x0F57, 0, 0, 0, ISA_AVX},
+    {"vxorpd", enc_vex, 0x660F57, 0, 0, 0, ISA_AVX}, {"vunpcklps", enc_vex, 0x0F14, 0, 0, 0, ISA_AVX},
+    {"vunpcklpd", enc_vex, 0x660F14, 0, 0, 0, ISA_AVX}, {"vunpckhps", enc_vex, 0x0F15, 0, 0, 0, ISA_AVX},
+    {"vunpckhpd", enc_vex, 0x660F15, 0, 0, 0, ISA_AVX}, {"vcomiss", enc_vex_2op, 0x0F2F, 0, 0, 0, ISA_AVX},
+    {"vcomisd", enc_vex_2op, 0x660F2F, 0, 0, 0, ISA_AVX}, {"vucomiss", enc_vex_2op, 0x0F2E, 0, 0, 0, ISA_AVX},
+    {"vucomisd", enc_vex_2op, 0x660F2E, 0, 0, 0, ISA_AVX}, {"vcmpps", enc_vex_imm, 0x0FC2, 0, 0, 0, ISA_AVX},
+    {"vcmppd", enc_vex_imm, 0x660FC2, 0, 0, 0, ISA_AVX}, {"vcmpss", enc_vex_imm, 0xF30FC2, 0, 0, 0, ISA_AVX},
+    {"vcmpsd", enc_vex_imm, 0xF20FC2, 0, 0, 0, ISA_AVX}, {"vshufps", enc_vex_imm, 0x0FC6, 0, 0, 0, ISA_AVX},
+    {"vshufpd", enc_vex_imm, 0x660FC6, 0, 0, 0, ISA_AVX}, {"vhaddps", enc_vex, 0xF20F7C, 0, 0, 0, ISA_AVX},
+    {"vhaddpd", enc_vex, 0x660F7C, 0, 0, 0, ISA_AVX}, {"vhsubps", enc_vex, 0xF20F7D, 0, 0, 0, ISA_AVX},
+    {"vhsubpd", enc_vex, 0x660F7D, 0, 0, 0, ISA_AVX}, {"vaddsubps", enc_vex, 0xF20FD0, 0, 0, 0, ISA_AVX},
+    {"vaddsubpd", enc_vex, 0x660FD0, 0, 0, 0, ISA_AVX}, {"vmovddup", enc_vex_2op, 0xF20F12, 0, 0, 0, ISA_AVX},
+    {"vmovshdup", enc_vex_2op, 0xF30F16, 0, 0, 0, ISA_AVX}, {"vmovsldup", enc_vex_2op, 0xF30F12, 0, 0, 0, ISA_AVX},
+    {"vlddqu", enc_vex_load, 0xF20FF0, 0, 0, 0, ISA_AVX}, {"vcvtps2pd", enc_vex_2op, 0x0F5A, 0, 0, 0, ISA_AVX},
+    {"vcvtpd2ps", enc_vex_2op, 0x660F5A, 0, 0, 0, ISA_AVX}, {"vcvtss2sd", enc_vex, 0xF30F5A, 0, 0, 0, ISA_AVX},
+    {"vcvtsd2ss", enc_vex, 0xF20F5A, 0, 0, 0, ISA_AVX}, {"vcvtdq2ps", enc_vex_2op, 0x0F5B, 0, 0, 0, ISA_AVX},
+    {"vcvtps2dq", enc_vex_2op, 0x660F5B, 0, 0, 0, ISA_AVX}, {"vcvttps2dq", enc_vex_2op, 0xF30F5B, 0, 0, 0, ISA_AVX},
+    {"vcvtdq2pd", enc_vex_2op, 0xF30FE6, 0, 0, 0, ISA_AVX}, {"vcvtpd2dq", enc_vex_2op, 0xF20FE6, 0, 0, 0, ISA_AVX},
+    {"vcvttpd2dq", enc_vex_2op, 0x660FE6, 0, 0, 0, ISA_AVX}, {"vmovaps", enc_vex_mov, 0x0F28, 0x29, 0, 0, ISA_AVX},
+    {"vmovapd", enc_vex_mov, 0x660F28, 0x29, 0, 0, ISA_AVX}, {"vmovups", enc_vex_mov, 0x0F10, 0x11, 0, 0, ISA_AVX},
+    {"vmovupd", enc_vex_mov, 0x660F10, 0x11, 0, 0, ISA_AVX}, {"vmovss", enc_vex_movs, 0xF30F10, 0x11, 0, 0, ISA_AVX},
+    {"vmovsd", enc_vex_movs, 0xF20F10, 0x11, 0, 0, ISA_AVX}, {"vmovdqa", enc_vex_mov, 0x660F6F, 0x7F, 0, 0, ISA_AVX},
+    {"vmovdqu", enc_vex_mov, 0xF30F6F, 0x7F, 0, 0, ISA_AVX}, {"vmovhlps", enc_vex, 0x0F12, 0, 0, 0, ISA_AVX},
+    {"vmovlhps", enc_vex, 0x0F16, 0, 0, 0, ISA_AVX}, {"vpmovmskb", enc_vex_movmsk, 0x660FD7, 0, 0, 0, ISA_AVX_INT},
+    {"vmovmskps", enc_vex_movmsk, 0x0F50, 0, 0, 0, ISA_AVX},
+    {"vmovd", enc_vex_movd, 0, 0, 32, 0, ISA_AVX}, {"vmovq", enc_vex_movd, 0, 0, 64, 0, ISA_AVX},
+    {"vcvtsi2ss", enc_vex_cvtsi2, 0xF30F2A, 0, 0, 0, ISA_AVX},
+    {"vcvtsi2sd", enc_vex_cvtsi2, 0xF20F2A, 0, 0, 0, ISA_AVX},
+    {"vcvtss2si", enc_vex_cvt2si, 0xF30F2D, 0, 0, 0, ISA_AVX},
+    {"vcvttss2si", enc_vex_cvt2si, 0xF30F2C, 0, 0, 0, ISA_AVX},
+    {"vcvtsd2si", enc_vex_cvt2si, 0xF20F2D, 0, 0, 0, ISA_AVX},
+    {"vcvttsd2si", enc_vex_cvt2si, 0xF20F2C, 0, 0, 0, ISA_AVX},
+    {"vmaskmovps", enc_vex_maskmov, 0x660F382C, 0, 0, 0, ISA_AVX},
+    {"vmaskmovpd", enc_vex_maskmov, 0x660F382D, 0, 0, 0, ISA_AVX},
+    {"vpmaskmovd", enc_vex_maskmov, 0x660F388C, 0, 0, 0, ISA_AVX2},
+    {"vpmaskmovq", enc_vex_maskmov, 0x660F388C, 0, 64, 0, ISA_AVX2},
+    {"vmovmskpd", enc_vex_movmsk, 0x660F50, 0, 0, 0, ISA_AVX},
+    {"vmovntps", enc_vex_store, 0x0F2B, 0, 0, 0, ISA_AVX}, {"vmovntpd", enc_vex_store, 0x660F2B, 0, 0, 0, ISA_AVX},
+    {"vmovntdq", enc_vex_store, 0x660FE7, 0, 0, 0, ISA_AVX},
+    {"vpaddb", enc_vex, 0x660FFC, 0, 0, 0, ISA_AVX_INT}, {"vpaddw", enc_vex, 0x660FFD, 0, 0, 0, ISA_AVX_INT},
+    {"vpaddd", enc_vex, 0x660FFE, 0, 0, 0, ISA_AVX_INT}, {"vpaddq", enc_vex, 0x660FD4, 0, 0, 0, ISA_AVX_INT},
+    {"vpaddsb", enc_vex, 0x660FEC, 0, 0, 0, ISA_AVX_INT}, {"vpaddsw", enc_vex, 0x660FED, 0, 0, 0, ISA_AVX_INT},
+    {"vpaddusb", enc_vex, 0x660FDC, 0, 0, 0, ISA_AVX_INT}, {"vpaddusw", enc_vex, 0x660FDD, 0, 0, 0, ISA_AVX_INT},
+    {"vpsubb", enc_vex, 0x660FF8, 0, 0, 0, ISA_AVX_INT}, {"vpsubw", enc_vex, 0x660FF9, 0, 0, 0, ISA_AVX_INT},
+    {"vpsubd", enc_vex, 0x660FFA, 0, 0, 0, ISA_AVX_INT}, {"vpsubq", enc_vex, 0x660FFB, 0, 0, 0, ISA_AVX_INT},
+    {"vpsubsb", enc_vex, 0x660FE8, 0, 0, 0, ISA_AVX_INT}, {"vpsubsw", enc_vex, 0x660FE9, 0, 0, 0, ISA_AVX_INT},
+    {"vpsubusb", enc_vex, 0x660FD8, 0, 0, 0, ISA_AVX_INT}, {"vpsubusw", enc_vex, 0x660FD9, 0, 0, 0, ISA_AVX_INT},
+    {"vpmullw", enc_vex, 0x660FD5, 0, 0, 0, ISA_AVX_INT}, {"vpmulhw", enc_vex, 0x660FE5, 0, 0, 0, ISA_AVX_INT},
+    {"vpmulhuw", enc_vex, 0x660FE4, 0, 0, 0, ISA_AVX_INT}, {"vpmuludq", enc_vex, 0x660FF4, 0, 0, 0, ISA_AVX_INT},
+    {"vpmaddwd", enc_vex, 0x660FF5, 0, 0, 0, ISA_AVX_INT}, {"vpsadbw", enc_vex, 0x660FF6, 0, 0, 0, ISA_AVX_INT},
+    {"vpavgb", enc_vex, 0x660FE0, 0, 0, 0, ISA_AVX_INT}, {"vpavgw", enc_vex, 0x660FE3, 0, 0, 0, ISA_AVX_INT},
+    {"vpminub", enc_vex, 0x660FDA, 0, 0, 0, ISA_AVX_INT}, {"vpmaxub", enc_vex, 0x660FDE, 0, 0, 0, ISA_AVX_INT},
+    {"vpminsw", enc_vex, 0x660FEA, 0, 0, 0, ISA_AVX_INT}, {"vpmaxsw", enc_vex, 0x660FEE, 0, 0, 0, ISA_AVX_INT},
+    {"vpand", enc_vex, 0x660FDB, 0, 0, 0, ISA_AVX_INT}, {"vpandn", enc_vex, 0x660FDF, 0, 0, 0, ISA_AVX_INT},
+    {"vpor", enc_vex, 0x660FEB, 0, 0, 0, ISA_AVX_INT}, {"vpxor", enc_vex, 0x660FEF, 0, 0, 0, ISA_AVX_INT},
+    {"vpcmpeqb", enc_vex, 0x660F74, 0, 0, 0, ISA_AVX_INT}, {"vpcmpeqw", enc_vex, 0x660F75, 0, 0, 0, ISA_AVX_INT},
+    {"vpcmpeqd", enc_vex, 0x660F76, 0, 0, 0, ISA_AVX_INT}, {"vpcmpgtb", enc_vex, 0x660F64, 0, 0, 0, ISA_AVX_INT},
+    {"vpcmpgtw", enc_vex, 0x660F65, 0, 0, 0, ISA_AVX_INT}, {"vpcmpgtd", enc_vex, 0x660F66, 0, 0, 0, ISA_AVX_INT},
+    {"vpacksswb", enc_vex, 0x660F63, 0, 0, 0, ISA_AVX_INT}, {"vpackssdw", enc_vex, 0x660F6B, 0, 0, 0, ISA_AVX_INT},
+    {"vpackuswb", enc_vex, 0x660F67, 0, 0, 0, ISA_AVX_INT}, {"vpunpcklbw", enc_vex, 0x660F60, 0, 0, 0, ISA_AVX_INT},
+    {"vpunpcklwd", enc_vex, 0x660F61, 0, 0, 0, ISA_AVX_INT}, {"vpunpckldq", enc_vex, 0x660F62, 0, 0, 0, ISA_AVX_INT},
+    {"vpunpcklqdq", enc_vex, 0x660F6C, 0, 0, 0, ISA_AVX_INT}, {"vpunpckhbw", enc_vex, 0x660F68, 0, 0, 0, ISA_AVX_INT},
+    {"vpunpckhwd", enc_vex, 0x660F69, 0, 0, 0, ISA_AVX_INT}, {"vpunpckhdq", enc_vex, 0x660F6A, 0, 0, 0, ISA_AVX_INT},
+    {"vpunpckhqdq", enc_vex, 0x660F6D, 0, 0, 0, ISA_AVX_INT},
+    {"vpshufd", enc_vex_2op_imm, 0x660F70, 0, 0, 0, ISA_AVX_INT},
+    {"vpshufhw", enc_vex_2op_imm, 0xF30F70, 0, 0, 0, ISA_AVX_INT},
+    {"vpshuflw", enc_vex_2op_imm, 0xF20F70, 0, 0, 0, ISA_AVX_INT},
+    {"vpsllw", enc_vex_shift, 0x660FF1, 6, 0, 0, ISA_AVX_INT},
+    {"vpslld", enc_vex_shift, 0x660FF2, 6, 0, 0, ISA_AVX_INT},
+    {"vpsllq", enc_vex_shift, 0x660FF3, 6, 0, 0, ISA_AVX_INT},
+    {"vpsrlw", enc_vex_shift, 0x660FD1, 2, 0, 0, ISA_AVX_INT},
+    {"vpsrld", enc_vex_shift, 0x660FD2, 2, 0, 0, ISA_AVX_INT},
+    {"vpsrlq", enc_vex_shift, 0x660FD3, 2, 0, 0, ISA_AVX_INT},
+    {"vpsraw", enc_vex_shift, 0x660FE1, 4, 0, 0, ISA_AVX_INT},
+    {"vpsrad", enc_vex_shift, 0x660FE2, 4, 0, 0, ISA_AVX_INT},
+    {"vpslldq", enc_vex_shift, 0x660F73, 7, 0, 0, ISA_AVX_INT},
+    {"vpsrldq", enc_vex_shift, 0x660F73, 3, 0, 0, ISA_AVX_INT},
+    {"vpshufb", enc_vex, 0x660F3800, 0, 0, 0, ISA_AVX_INT}, {"vphaddw", enc_vex, 0x660F3801, 0, 0, 0, ISA_AVX_INT},
+    {"vphaddd", enc_vex, 0x660F3802, 0, 0, 0, ISA_AVX_INT}, {"vphaddsw", enc_vex, 0x660F3803, 0, 0, 0, ISA_AVX_INT},
+    {"vpmaddubsw", enc_vex, 0x660F3804, 0, 0, 0, ISA_AVX_INT}, {"vphsubw", enc_vex, 0x660F3805, 0, 0, 0, ISA_AVX_INT},
+    {"vphsubd", enc_vex, 0x660F3806, 0, 0, 0, ISA_AVX_INT}, {"vphsubsw", enc_vex, 0x660F3807, 0, 0, 0, ISA_AVX_INT},
+    {"vpsignb", enc_vex, 0x660F3808, 0, 0, 0, ISA_AVX_INT}, {"vpsignw", enc_vex, 0x660F3809, 0, 0, 0, ISA_AVX_INT},
+    {"vpsignd", enc_vex, 0x660F380A, 0, 0, 0, ISA_AVX_INT}, {"vpmulhrsw", enc_vex, 0x660F380B, 0, 0, 0, ISA_AVX_INT},
+    {"vpabsb", enc_vex_2op, 0x660F381C, 0, 0, 0, ISA_AVX_INT},
+    {"vpabsw", enc_vex_2op, 0x660F381D, 0, 0, 0, ISA_AVX_INT},
+    {"vpabsd", enc_vex_2op, 0x660F381E, 0, 0, 0, ISA_AVX_INT}, {"vptest", enc_vex_2op, 0x660F3817, 0, 0, 0, ISA_AVX},
+    {"vpmovsxbw", enc_vex_2op, 0x660F3820, 0, 0, 0, ISA_AVX_INT},
+    {"vpmovsxbd", enc_vex_2op, 0x660F3821, 0, 0, 0, ISA_AVX_INT},
+    {"vpmovsxbq", enc_vex_2op, 0x660F3822, 0, 0, 0, ISA_AVX_INT},
+    {"vpmovsxwd", enc_vex_2op, 0x660F3823, 0, 0, 0, ISA_AVX_INT},
+    {"vpmovsxwq", enc_vex_2op, 0x660F3824, 0, 0, 0, ISA_AVX_INT},
+    {"vpmovsxdq", enc_vex_2op, 0x660F3825, 0, 0, 0, ISA_AVX_INT},
+    {"vpmuldq", enc_vex, 0x660F3828, 0, 0, 0, ISA_AVX_INT}, {"vpcmpeqq", enc_vex, 0x660F3829, 0, 0, 0, ISA_AVX_INT},
+    {"vmovntdqa", enc_vex_load, 0x660F382A, 0, 0, 0, ISA_AVX_INT},
+    {"vpackusdw", enc_vex, 0x660F382B, 0, 0, 0, ISA_AVX_INT},
+    {"vpmovzxbw", enc_vex_2op, 0x660F3830, 0, 0, 0, ISA_AVX_INT},
+    {"vpmovzxbd", enc_vex_2op, 0x660F3831, 0, 0, 0, ISA_AVX_INT},
+    {"vpmovzxbq", enc_vex_2op, 0x660F3832, 0, 0, 0, ISA_AVX_INT},
+    {"vpmovzxwd", enc_vex_2op, 0x660F3833, 0, 0, 0, ISA_AVX_INT},
+    {"vpmovzxwq", enc_vex_2op, 0x660F3834, 0, 0, 0, ISA_AVX_INT},
+    {"vpmovzxdq", enc_vex_2op, 0x660F3835, 0, 0, 0, ISA_AVX_INT},
+    {"vpcmpgtq", enc_vex, 0x660F3837, 0, 0, 0, ISA_AVX_INT}, {"vpminsb", enc_vex, 0x660F3838, 0, 0, 0, ISA_AVX_INT},
+    {"vpminsd", enc_vex, 0x660F3839, 0, 0, 0, ISA_AVX_INT}, {"vpminuw", enc_vex, 0x660F383A, 0, 0, 0, ISA_AVX_INT},
+    {"vpminud", enc_vex, 0x660F383B, 0, 0, 0, ISA_AVX_INT}, {"vpmaxsb", enc_vex, 0x660F383C, 0, 0, 0, ISA_AVX_INT},
+    {"vpmaxsd", enc_vex, 0x660F383D, 0, 0, 0, ISA_AVX_INT}, {"vpmaxuw", enc_vex, 0x660F383E, 0, 0, 0, ISA_AVX_INT},
+    {"vpmaxud", enc_vex, 0x660F383F, 0, 0, 0, ISA_AVX_INT}, {"vpmulld", enc_vex, 0x660F3840, 0, 0, 0, ISA_AVX_INT},
+    {"vphminposuw", enc_vex_2op, 0x660F3841, 0, 0, 0, ISA_AVX},
+    {"vpalignr", enc_vex_imm, 0x660F3A0F, 0, 0, 0, ISA_AVX_INT},
+    {"vroundps", enc_vex_2op_imm, 0x660F3A08, 0, 0, 0, ISA_AVX},
+    {"vroundpd", enc_vex_2op_imm, 0x660F3A09, 0, 0, 0, ISA_AVX},
+    {"vroundss", enc_vex_imm, 0x660F3A0A, 0, 0, 0, ISA_AVX}, {"vroundsd", enc_vex_imm, 0x660F3A0B, 0, 0, 0, ISA_AVX},
+    {"vblendps", enc_vex_imm, 0x660F3A0C, 0, 0, 0, ISA_AVX}, {"vblendpd", enc_vex_imm, 0x660F3A0D, 0, 0, 0, ISA_AVX},
+    {"vpblendw", enc_vex_imm, 0x660F3A0E, 0, 0, 0, ISA_AVX_INT},
+    {"vinsertps", enc_vex_imm, 0x660F3A21, 0, 0, 0, ISA_AVX},
+    {"vpextrb", enc_vex_pextr, 0x660F3A14, 0, 8, 0, ISA_AVX}, {"vpextrw", enc_vex_pextr, 0x660F3A15, 0, 16, 0, ISA_AVX},
+    {"vpextrd", enc_vex_pextr, 0x660F3A16, 0, 32, 0, ISA_AVX}, {"vpextrq", enc_vex_pextr, 0x660F3A16, 0, 64, 0, ISA_AVX},
+    {"vextractps", enc_vex_pextr, 0x660F3A17, 0, 32, 0, ISA_AVX},
+    {"vpinsrb", enc_vex_pinsr, 0x660F3A20, 0, 8, 0, ISA_AVX}, {"vpinsrw", enc_vex_pinsr, 0x660FC4, 0, 16, 0, ISA_AVX},
+    {"vpinsrd", enc_vex_pinsr, 0x660F3A22, 0, 32, 0, ISA_AVX}, {"vpinsrq", enc_vex_pinsr, 0x660F3A22, 0, 64, 0, ISA_AVX},
+    {"vdpps", enc_vex_imm, 0x660F3A40, 0, 0, 0, ISA_AVX}, {"vdppd", enc_vex_imm, 0x660F3A41, 0, 0, 0, ISA_AVX},
+    {"vmpsadbw", enc_vex_imm, 0x660F3A42, 0, 0, 0, ISA_AVX_INT},
+    {"vpcmpestrm", enc_vex_2op_imm, 0x660F3A60, 0, 0, 0, ISA_AVX},
+    {"vpcmpestri", enc_vex_2op_imm, 0x660F3A61, 0, 0, 0, ISA_AVX},
+    {"vpcmpistrm", enc_vex_2op_imm, 0x660F3A62, 0, 0, 0, ISA_AVX},
+    {"vpcmpistri", enc_vex_2op_imm, 0x660F3A63, 0, 0, 0, ISA_AVX},
+    {"vblendvps", enc_vex_blendv, 0x660F3A4A, 0, 0, 0, ISA_AVX},
+    {"vblendvpd", enc_vex_blendv, 0x660F3A4B, 0, 0, 0, ISA_AVX},
+    {"vpblendvb", enc_vex_blendv, 0x660F3A4C, 0, 0, 0, ISA_AVX_INT},
+
+    // AVX and AVX2
+    {"vbroadcastss", enc_vex_2op, 0x660F3818, 0, 0, 0, ISA_AVX},
+    {"vbroadcastsd", enc_vex_2op, 0x660F3819, 0, 0, 0, ISA_AVX},
+    {"vbroadcastf128", enc_vex_load, 0x660F381A, 0, 0, 0, ISA_AVX},
+    {"vbroadcasti128", enc_vex_load, 0x660F385A, 0, 0, 0, ISA_AVX2},
+    {"vpbroadcastb", enc_vex_bcst, 0x660F3878, 0x7A, 0, 0, ISA_AVX2},
+    {"vpbroadcastw", enc_vex_bcst, 0x660F3879, 0x7B, 0, 0, ISA_AVX2},
+    {"vpbroadcastd", enc_vex_bcst, 0x660F3858, 0x7C, 0, 0, ISA_AVX2},
+    {"vpbroadcastq", enc_vex_bcst, 0x660F3859, 0x7C, 0, 0, ISA_AVX2},
+    {"vinsertf128", enc_vex_imm, 0x660F3A18, 0, 0, 0, ISA_AVX},
+    {"vinserti128", enc_vex_imm, 0x660F3A38, 0, 0, 0, ISA_AVX2},
+    {"vextractf128", enc_vex_extract, 0x660F3A19, 0, 0, 0, ISA_AVX},
+    {"vextracti128", enc_vex_extract, 0x660F3A39, 0, 0, 0, ISA_AVX2},
+    {"vperm2f128", enc_vex_imm, 0x660F3A06, 0, 0, 0, ISA_AVX},
+    {"vperm2i128", enc_vex_imm, 0x660F3A46, 0, 0, 0, ISA_AVX2},
+    {"vpermd", enc_vex, 0x660F3836, 0, 0, 0, ISA_AVX2}, {"vpermps", enc_vex, 0x660F3816, 0, 0, 0, ISA_AVX2},
+    {"vpermq", enc_vex_2op_imm, 0x660F3A00, 0, 64, 0, ISA_AVX2},
+    {"vpermpd", enc_vex_2op_imm, 0x660F3A01, 0, 64, 0, ISA_AVX2},
+    {"vpermilps", enc_vex_permil, 0x660F380C, 0x04, 0, 0, ISA_AVX},
+    {"vpermilpd", enc_vex_permil, 0x660F380D, 0x05, 0, 0, ISA_AVX},
+    {"vpblendd", enc_vex_imm, 0x660F3A02, 0, 0, 0, ISA_AVX2}, {"vtestps", enc_vex_2op, 0x660F380E, 0, 0, 0, ISA_AVX},
+    {"vtestpd", enc_vex_2op, 0x660F380F, 0, 0, 0, ISA_AVX}, {"vpsllvd", enc_vex, 0x660F3847, 0, 0, 0, ISA_AVX2},
+    {"vpsllvq", enc_vex, 0x660F3847, 0, 64, 0, ISA_AVX2}, {"vpsrlvd", enc_vex, 0x660F3845, 0, 0, 0, ISA_AVX2},
+    {"vpsrlvq", enc_vex, 0x660F3845, 0, 64, 0, ISA_AVX2}, {"vpsravd", enc_vex, 0x660F3846, 0, 0, 0, ISA_AVX2},
+    {"vzeroupper", enc_vex_fixed, 0x0F77, 0, 0, 0, ISA_AVX}, {"vzeroall", enc_vex_fixed, 0x0F77, 1, 0, 0, ISA_AVX},
+
+    // AVX2 gathers: mask, VSIB memory operand, destination
+    {"vpgatherdd", enc_vex_gather, 0x660F3890, 0, 0, 0, ISA_AVX2},
+    {"vpgatherdq", enc_vex_gather, 0x660F3890, 0, 64, 0, ISA_AVX2},
+    {"vpgatherqd", enc_vex_gather, 0x660F3891, 0, 0, 0, ISA_AVX2},
+    {"vpgatherqq", enc_vex_gather, 0x660F3891, 0, 64, 0, ISA_AVX2},
+    {"vgatherdps", enc_vex_gather, 0x660F3892, 0, 0, 0, ISA_AVX2},
+    {"vgatherdpd", enc_vex_gather, 0x660F3892, 0, 64, 0, ISA_AVX2},
+    {"vgatherqps", enc_vex_gather, 0x660F3893, 0, 0, 0, ISA_AVX2},
+    {"vgatherqpd", enc_vex_gather, 0x660F3893, 0, 64, 0, ISA_AVX2},
+
+    // FMA3: 132, 213 and 231 operand orders; pd and sd are the W1 forms
+    {"vfmadd132ps", enc_vex, 0x660F3898, 0, 0, 0, ISA_FMA}, {"vfmadd132pd", enc_vex, 0x660F3898, 0, 64, 0, ISA_FMA},
+    {"vfmadd132ss", enc_vex, 0x660F3899, 0, 0, 0, ISA_FMA}, {"vfmadd132sd", enc_vex, 0x660F3899, 0, 64, 0, ISA_FMA},
+    {"vfmadd213ps", enc_vex, 0x660F38A8, 0, 0, 0, ISA_FMA}, {"vfmadd213pd", enc_vex, 0x660F38A8, 0, 64, 0, ISA_FMA},
+    {"vfmadd213ss", enc_vex, 0x660F38A9, 0, 0, 0, ISA_FMA}, {"vfmadd213sd", enc_vex, 0x660F38A9, 0, 64, 0, ISA_FMA},
+    {"vfmadd231ps", enc_vex, 0x660F38B8, 0, 0, 0, ISA_FMA}, {"vfmadd231pd", enc_vex, 0x660F38B8, 0, 64, 0, ISA_FMA},
+    {"vfmadd231ss", enc_vex, 0x660F38B9, 0, 0, 0, ISA_FMA}, {"vfmadd231sd", enc_vex, 0x660F38B9, 0, 64, 0, ISA_FMA},
+    {"vfmsub132ps", enc_vex, 0x660F389A, 0, 0, 0, ISA_FMA}, {"vfmsub132pd", enc_vex, 0x660F389A, 0, 64, 0, ISA_FMA},
+    {"vfmsub132ss", enc_vex, 0x660F389B, 0, 0, 0, ISA_FMA}, {"vfmsub132sd", enc_vex, 0x660F389B, 0, 64, 0, ISA_FMA},
+    {"vfmsub213ps", enc_vex, 0x660F38AA, 0, 0, 0, ISA_FMA}, {"vfmsub213pd", enc_vex, 0x660F38AA, 0, 64, 0, ISA_FMA},
+    {"vfmsub213ss", enc_vex, 0x660F38AB, 0, 0, 0, ISA_FMA}, {"vfmsub213sd", enc_vex, 0x660F38AB, 0, 64, 0, ISA_FMA},
+    {"vfmsub231ps", enc_vex, 0x660F38BA, 0, 0, 0, ISA_FMA}, {"vfmsub231pd", enc_vex, 0x660F38BA, 0, 64, 0, ISA_FMA},
+    {"vfmsub231ss", enc_vex, 0x660F38BB, 0, 0, 0, ISA_FMA}, {"vfmsub231sd", enc_vex, 0x660F38BB, 0, 64, 0, ISA_FMA},
+    {"vfnmadd132ps", enc_vex, 0x660F389C, 0, 0, 0, ISA_FMA}, {"vfnmadd132pd", enc_vex, 0x660F389C, 0, 64, 0, ISA_FMA},
+    {"vfnmadd132ss", enc_vex, 0x660F389D, 0, 0, 0, ISA_FMA}, {"vfnmadd132sd", enc_vex, 0x660F389D, 0, 64, 0, ISA_FMA},
+    {"vfnmadd213ps", enc_vex, 0x660F38AC, 0, 0, 0, ISA_FMA}, {"vfnmadd213pd", enc_vex, 0x660F38AC, 0, 64, 0, ISA_FMA},
+    {"vfnmadd213ss", enc_vex, 0x660F38AD, 0, 0, 0, ISA_FMA}, {"vfnmadd213sd", enc_vex, 0x660F38AD, 0, 64, 0, ISA_FMA},
+    {"vfnmadd231ps", enc_vex, 0x660F38BC, 0, 0, 0, ISA_FMA}, {"vfnmadd231pd", enc_vex, 0x660F38BC, 0, 64, 0, ISA_FMA},
+    {"vfnmadd231ss", enc_vex, 0x660F38BD, 0, 0, 0, ISA_FMA}, {"vfnmadd231sd", enc_vex, 0x660F38BD, 0, 64, 0, ISA_FMA},
+    {"vfnmsub132ps", enc_vex, 0x660F389E, 0, 0, 0, ISA_FMA}, {"vfnmsub132pd", enc_vex, 0x660F389E, 0, 64, 0, ISA_FMA},
+    {"vfnmsub132ss", enc_vex, 0x660F389F, 0, 0, 0, ISA_FMA}, {"vfnmsub132sd", enc_vex, 0x660F389F, 0, 64, 0, ISA_FMA},
+    {"vfnmsub213ps", enc_vex, 0x660F38AE, 0, 0, 0, ISA_FMA}, {"vfnmsub213pd", enc_vex, 0x660F38AE, 0, 64, 0, ISA_FMA},
+    {"vfnmsub213ss", enc_vex, 0x660F38AF, 0, 0, 0, ISA_FMA}, {"vfnmsub213sd", enc_vex, 0x660F38AF, 0, 64, 0, ISA_FMA},
+    {"vfnmsub231ps", enc_vex, 0x660F38BE, 0, 0, 0, ISA_FMA}, {"vfnmsub231pd", enc_vex, 0x660F38BE, 0, 64, 0, ISA_FMA},
+    {"vfnmsub231ss", enc_vex, 0x660F38BF, 0, 0, 0, ISA_FMA}, {"vfnmsub231sd", enc_vex, 0x660F38BF, 0, 64, 0, ISA_FMA},
+    {"vfmaddsub132ps", enc_vex, 0x660F3896, 0, 0, 0, ISA_FMA},
+    {"vfmaddsub132pd", enc_vex, 0x660F3896, 0, 64, 0, ISA_FMA},
+    {"vfmaddsub213ps", enc_vex, 0x660F38A6, 0, 0, 0, ISA_FMA},
+    {"vfmaddsub213pd", enc_vex, 0x660F38A6, 0, 64, 0, ISA_FMA},
+    {"vfmaddsub231ps", enc_vex, 0x660F38B6, 0, 0, 0, ISA_FMA},
+    {"vfmaddsub231pd", enc_vex, 0x660F38B6, 0, 64, 0, ISA_FMA},
+    {"vfmsubadd132ps", enc_vex, 0x660F3897, 0, 0, 0, ISA_FMA},
+    {"vfmsubadd132pd", enc_vex, 0x660F3897, 0, 64, 0, ISA_FMA},
+    {"vfmsubadd213ps", enc_vex, 0x660F38A7, 0, 0, 0, ISA_FMA},
+    {"vfmsubadd213pd", enc_vex, 0x660F38A7, 0, 64, 0, ISA_FMA},
+    {"vfmsubadd231ps", enc_vex, 0x660F38B7, 0, 0, 0, ISA_FMA},
+    {"vfmsubadd231pd", enc_vex, 0x660F38B7, 0, 64, 0, ISA_FMA},
+
+    // BMI1 and BMI2 (VEX-encoded, general registers)
+    {"andn", enc_bmi, 0x0F38F2, 0, 0, 0, ISA_BMI1}, {"bextr", enc_bmi_rv, 0x0F38F7, 0, 0, 0, ISA_BMI1},
+    {"blsi", enc_bmi_grp, 0x0F38F3, 3, 0, 0, ISA_BMI1}, {"blsmsk", enc_bmi_grp, 0x0F38F3, 2, 0, 0, ISA_BMI1},
+    {"blsr", enc_bmi_grp, 0x0F38F3, 1, 0, 0, ISA_BMI1}, {"bzhi", enc_bmi_rv, 0x0F38F5, 0, 0, 0, ISA_BMI2},
+    {"pdep", enc_bmi, 0xF20F38F5, 0, 0, 0, ISA_BMI2}, {"pext", enc_bmi, 0xF30F38F5, 0, 0, 0, ISA_BMI2},
+    {"mulx", enc_bmi, 0xF20F38F6, 0, 0, 0, ISA_BMI2}, {"rorx", enc_rorx, 0xF20F3AF0, 0, 0, 0, ISA_BMI2},
+    {"sarx", enc_bmi_rv, 0xF30F38F7, 0, 0, 0, ISA_BMI2}, {"shlx", enc_bmi_rv, 0x660F38F7, 0, 0, 0, ISA_BMI2},
+    {"shrx", enc_bmi_rv, 0xF20F38F7, 0, 0, 0, ISA_BMI2},
+
+    // AVX-512 instructions with no VEX form (EVEX.W is in evex_table)
+    {"vmovdqa32", enc_vex_mov, 0x660F6F, 0x7F, 0, 0, ISA_AVX512F},
+    {"vmovdqa64", enc_vex_mov, 0x660F6F, 0x7F, 0, 0, ISA_AVX512F},
+    {"vmovdqu8", enc_vex_mov, 0xF20F6F, 0x7F, 0, 0, ISA_AVX512F},
+    {"vmovdqu16", enc_vex_mov, 0xF20F6F, 0x7F, 0, 0, ISA_AVX512F},
+    {"vmovdqu32", enc_vex_mov, 0xF30F6F, 0x7F, 0, 0, ISA_AVX512F},
+    {"vmovdqu64", enc_vex_mov, 0xF30F6F, 0x7F, 0, 0, ISA_AVX512F},
+    {"vpandd", enc_vex, 0x660FDB, 0, 0, 0, ISA_AVX512F}, {"vpandq", enc_vex, 0x660FDB, 0, 0, 0, ISA_AVX512F},
+    {"vpandnd", enc_vex, 0x660FDF, 0, 0, 0, ISA_AVX512F}, {"vpandnq", enc_vex, 0x660FDF, 0, 0, 0, ISA_AVX512F},
+    {"vpord", enc_vex, 0x660FEB, 0, 0, 0, ISA_AVX512F}, {"vporq", enc_vex, 0x660FEB, 0, 0, 0, ISA_AVX512F},
+    {"vpxord", enc_vex, 0x660FEF, 0, 0, 0, ISA_AVX512F}, {"vpxorq", enc_vex, 0x660FEF, 0, 0, 0, ISA_AVX512F},
+    {"vpternlogd", enc_vex_imm, 0x660F3A25, 0, 0, 0, ISA_AVX512F},
+    {"vpternlogq", enc_vex_imm, 0x660F3A25, 0, 0, 0, ISA_AVX512F},
+    {"vpmullq", enc_vex, 0x660F3840, 0, 0, 0, ISA_AVX512F}, {"vpabsq", enc_vex_2op, 0x660F381F, 0, 0, 0, ISA_AVX512F},
+    {"vpminsq", enc_vex, 0x660F3839, 0, 0, 0, ISA_AVX512F}, {"vpminuq", enc_vex, 0x660F383B, 0, 0, 0, ISA_AVX512F},
+    {"vpmaxsq", enc_vex, 0x660F383D, 0, 0, 0, ISA_AVX512F}, {"vpmaxuq", enc_vex, 0x660F383F, 0, 0, 0, ISA_AVX512F},
+    {"vpsraq", enc_vex_shift, 0x660FE2, 4, 0, 0, ISA_AVX512F}, {"vpsravq", enc_vex, 0x660F3846, 0, 0, 0, ISA_AVX512F},
+    {"vprold", enc_vex_shift, 0x660F72, 1, 0, 0, ISA_AVX512F},
+    {"vprolq", enc_vex_shift, 0x660F72, 1, 0, 0, ISA_AVX512F},
+    {"vprord", enc_vex_shift, 0x660F72, 0, 0, 0, ISA_AVX512F},
+    {"vprorq", enc_vex_shift, 0x660F72, 0, 0, 0, ISA_AVX512F},
+    {"vprolvd", enc_vex, 0x660F3815, 0, 0, 0, ISA_AVX512F}, {"vprolvq", enc_vex, 0x660F3815, 0, 0, 0, ISA_AVX512F},
+    {"vprorvd", enc_vex, 0x660F3814, 0, 0, 0, ISA_AVX512F}, {"vprorvq", enc_vex, 0x660F3814, 0, 0, 0, ISA_AVX512F},
+    {"vpermt2d", enc_vex, 0x660F387E, 0, 0, 0, ISA_AVX512F}, {"vpermt2q", enc_vex, 0x660F387E, 0, 0, 0, ISA_AVX512F},
+    {"vpermt2ps", enc_vex, 0x660F387F, 0, 0, 0, ISA_AVX512F},
+    {"vpermt2pd", enc_vex, 0x660F387F, 0, 0, 0, ISA_AVX512F},
+    {"vpermi2d", enc_vex, 0x660F3876, 0, 0, 0, ISA_AVX512F}, {"vpermi2q", enc_vex, 0x660F3876, 0, 0, 0, ISA_AVX512F},
+    {"vpermi2ps", enc_vex, 0x660F3877, 0, 0, 0, ISA_AVX512F},
+    {"vpermi2pd", enc_vex, 0x660F3877, 0, 0, 0, ISA_AVX512F},
+    {"vpermw", enc_vex, 0x660F388D, 0, 0, 0, ISA_AVX512F},
+    {"vpcompressd", enc_evex_compress, 0x660F388B, 0, 0, 0, ISA_AVX512F},
+    {"vpcompressq", enc_evex_compress, 0x660F388B, 0, 0, 0, ISA_AVX512F},
+    {"vcompressps", enc_evex_compress, 0x660F388A, 0, 0, 0, ISA_AVX512F},
+    {"vcompresspd", enc_evex_compress, 0x660F388A, 0, 0, 0, ISA_AVX512F},
+    {"vpexpandd", enc_vex_2op, 0x660F3889, 0, 0, 0, ISA_AVX512F},
+    {"vpexpandq", enc_vex_2op, 0x660F3889, 0, 0, 0, ISA_AVX512F},
+    {"vexpandps", enc_vex_2op, 0x660F3888, 0, 0, 0, ISA_AVX512F},
+    {"vexpandpd", enc_vex_2op, 0x660F3888, 0, 0, 0, ISA_AVX512F},
+    {"vextracti32x4", enc_vex_extract, 0x660F3A39, 0, 0, 0, ISA_AVX512F},
+    {"vextracti64x4", enc_vex_extract, 0x660F3A3B, 0, 0, 0, ISA_AVX512F},
+    {"vextractf32x4", enc_vex_extract, 0x660F3A19, 0, 0, 0, ISA_AVX512F},
+    {"vextractf64x4", enc_vex_extract, 0x660F3A1B, 0, 0, 0, ISA_AVX512F},
+    {"vinserti32x4", enc_vex_imm, 0x660F3A38, 0, 0, 0, ISA_AVX512F},
+    {"vinserti64x4", enc_vex_imm, 0x660F3A3A, 0, 0, 0, ISA_AVX512F},
+    {"vinsertf32x4", enc_vex_imm, 0x660F3A18, 0, 0, 0, ISA_AVX512F},
+    {"vinsertf64x4", enc_vex_imm, 0x660F3A1A, 0, 0, 0, ISA_AVX512F},
+    {"vbroadcasti32x4", enc_vex_load, 0x660F385A, 0, 0, 0, ISA_AVX512F},
+    {"vbroadcasti64x4", enc_vex_load, 0x660F385B, 0, 0, 0, ISA_AVX512F},
+    {"vbroadcastf32x4", enc_vex_load, 0x660F381A, 0, 0, 0, ISA_AVX512F},
+    {"vbroadcastf64x4", enc_vex_load, 0x660F381B, 0, 0, 0, ISA_AVX512F},
+    {"vpcmpd", enc_vex_imm, 0x660F3A1F, 0, 0, 0, ISA_AVX512F},
+    {"vpcmpud", enc_vex_imm, 0x660F3A1E, 0, 0, 0, ISA_AVX512F},
+    {"vpcmpq", enc_vex_imm, 0x660F3A1F, 0, 0, 0, ISA_AVX512F},
+    {"vpcmpuq", enc_vex_imm, 0x660F3A1E, 0, 0, 0, ISA_AVX512F},
+    {"vpcmpb", enc_vex_imm, 0x660F3A3F, 0, 0, 0, ISA_AVX512F},
+    {"vpcmpub", enc_vex_imm, 0x660F3A3E, 0, 0, 0, ISA_AVX512F},
+    {"vpcmpw", enc_vex_imm, 0x660F3A3F, 0, 0, 0, ISA_AVX512F},
+    {"vpcmpuw", enc_vex_imm, 0x660F3A3E, 0, 0, 0, ISA_AVX512F},
+    {"vptestmd", enc_vex, 0x660F3827, 0, 0, 0, ISA_AVX512F},
+    {"vptestmq", enc_vex, 0x660F3827, 0, 0, 0, ISA_AVX512F}, {"vptestnmd", enc_vex, 0xF30F3827, 0, 0, 0, ISA_AVX512F},
+    {"vptestnmq", enc_vex, 0xF30F3827, 0, 0, 0, ISA_AVX512F}, {"vptestmb", enc_vex, 0x660F3826, 0, 0, 0, ISA_AVX512F},
+    {"vptestmw", enc_vex, 0x660F3826, 0, 0, 0, ISA_AVX512F}, {"vptestnmb", enc_vex, 0xF30F3826, 0, 0, 0, ISA_AVX512F},
+    {"vptestnmw", enc_vex, 0xF30F3826, 0, 0, 0, ISA_AVX512F},
+    {"vrndscaleps", enc_vex_2op_imm, 0x660F3A08, 0, 0, 0, ISA_AVX512F},
+    {"vrndscalepd", enc_vex_2op_imm, 0x660F3A09, 0, 0, 0, ISA_AVX512F},
+    {"vrcp14ps", enc_vex_2op, 0x660F384C, 0, 0, 0, ISA_AVX512F},
+    {"vrcp14pd", enc_vex_2op, 0x660F384C, 0, 0, 0, ISA_AVX512F},
+    {"vrsqrt14ps", enc_vex_2op, 0x660F384E, 0, 0, 0, ISA_AVX512F},
+    {"vrsqrt14pd", enc_vex_2op, 0x660F384E, 0, 0, 0, ISA_AVX512F},
+    {"vscalefps", enc_vex, 0x660F382C, 0, 0, 0, ISA_AVX512F},
+    {"vscalefpd", enc_vex, 0x660F382C, 0, 0, 0, ISA_AVX512F},
+    {"vpscatterdd", enc_evex_scatter, 0x660F38A0, 0, 0, 0, ISA_AVX512F},
+    {"vpscatterdq", enc_evex_scatter, 0x660F38A0, 0, 0, 0, ISA_AVX512F},
+    {"vpscatterqd", enc_evex_scatter, 0x660F38A1, 0, 0, 0, ISA_AVX512F},
+    {"vpscatterqq", enc_evex_scatter, 0x660F38A1, 0, 0, 0, ISA_AVX512F},
+    {"vscatterdps", enc_evex_scatter, 0x660F38A2, 0, 0, 0, ISA_AVX512F},
+    {"vscatterdpd", enc_evex_scatter, 0x660F38A2, 0, 0, 0, ISA_AVX512F},
+    {"vscatterqps", enc_evex_scatter, 0x660F38A3, 0, 0, 0, ISA_AVX512F},
+    {"vscatterqpd", enc_evex_scatter, 0x660F38A3, 0, 0, 0, ISA_AVX512F},
+    {"vpconflictd", enc_vex_2op, 0x660F38C4, 0, 0, 0, ISA_AVX512CD},
+    {"vpconflictq", enc_vex_2op, 0x660F38C4, 0, 0, 0, ISA_AVX512CD},
+    {"vplzcntd", enc_vex_2op, 0x660F3844, 0, 0, 0, ISA_AVX512CD},
+    {"vplzcntq", enc_vex_2op, 0x660F3844, 0, 0, 0, ISA_AVX512CD},
+    {"vpbroadcastmb2q", enc_evex_k2vec, 0xF30F382A, 0, 0, 0, ISA_AVX512CD},
+    {"vpbroadcastmw2d", enc_evex_k2vec, 0xF30F383A, 0, 0, 0, ISA_AVX512CD},
+    {"valignd", enc_vex_imm, 0x660F3A03, 0, 0, 0, ISA_AVX512F},
+    {"valignq", enc_vex_imm, 0x660F3A03, 0, 0, 0, ISA_AVX512F},
+    {"vshuff32x4", enc_vex_imm, 0x660F3A23, 0, 0, 0, ISA_AVX512F},
+    {"vshuff64x2", enc_vex_imm, 0x660F3A23, 0, 0, 0, ISA_AVX512F},
+    {"vshufi32x4", enc_vex_imm, 0x660F3A43, 0, 0, 0, ISA_AVX512F},
+    {"vshufi64x2", enc_vex_imm, 0x660F3A43, 0, 0, 0, ISA_AVX512F},
+    {"vpblendmd", enc_vex, 0x660F3864, 0, 0, 0, ISA_AVX512F}, {"vpblendmq", enc_vex, 0x660F3864, 0, 0, 0, ISA_AVX512F},
+    {"vpblendmb", enc_vex, 0x660F3866, 0, 0, 0, ISA_AVX512F}, {"vpblendmw", enc_vex, 0x660F3866, 0, 0, 0, ISA_AVX512F},
+    {"vblendmps", enc_vex, 0x660F3865, 0, 0, 0, ISA_AVX512F}, {"vblendmpd", enc_vex, 0x660F3865, 0, 0, 0, ISA_AVX512F},
+    {"vpmovwb", enc_evex_pmov, 0xF30F3830, 0, 0, 0, ISA_AVX512F},
+    {"vpmovswb", enc_evex_pmov, 0xF30F3820, 0, 0, 0, ISA_AVX512F},
+    {"vpmovuswb", enc_evex_pmov, 0xF30F3810, 0, 0, 0, ISA_AVX512F},
+    {"vpmovdb", enc_evex_pmov, 0xF30F3831, 0, 0, 0, ISA_AVX512F},
+    {"vpmovsdb", enc_evex_pmov, 0xF30F3821, 0, 0, 0, ISA_AVX512F},
+    {"vpmovusdb", enc_evex_pmov, 0xF30F3811, 0, 0, 0, ISA_AVX512F},
+    {"vpmovqb", enc_evex_pmov, 0xF30F3832, 0, 0, 0, ISA_AVX512F},
+    {"vpmovsqb", enc_evex_pmov, 0xF30F3822, 0, 0, 0, ISA_AVX512F},
+    {"vpmovusqb", enc_evex_pmov, 0xF30F3812, 0, 0, 0, ISA_AVX512F},
+    {"vpmovdw", enc_evex_pmov, 0xF30F3833, 0, 0, 0, ISA_AVX512F},
+    {"vpmovsdw", enc_evex_pmov, 0xF30F3823, 0, 0, 0, ISA_AVX512F},
+    {"vpmovusdw", enc_evex_pmov, 0xF30F3813, 0, 0, 0, ISA_AVX512F},
+    {"vpmovqw", enc_evex_pmov, 0xF30F3834, 0, 0, 0, ISA_AVX512F},
+    {"vpmovsqw", enc_evex_pmov, 0xF30F3824, 0, 0, 0, ISA_AVX512F},
+    {"vpmovusqw", enc_evex_pmov, 0xF30F3814, 0, 0, 0, ISA_AVX512F},
+    {"vpmovqd", enc_evex_pmov, 0xF30F3835, 0, 0, 0, ISA_AVX512F},
+    {"vpmovsqd", enc_evex_pmov, 0xF30F3825, 0, 0, 0, ISA_AVX512F},
+    {"vpmovusqd", enc_evex_pmov, 0xF30F3815, 0, 0, 0, ISA_AVX512F},
+    {"vpmovm2b", enc_evex_k2vec, 0xF30F3828, 0, 0, 0, ISA_AVX512F},
+    {"vpmovm2w", enc_evex_k2vec, 0xF30F3828, 0, 0, 0, ISA_AVX512F},
+    {"vpmovm2d", enc_evex_k2vec, 0xF30F3838, 0, 0, 0, ISA_AVX512F},
+    {"vpmovm2q", enc_evex_k2vec, 0xF30F3838, 0, 0, 0, ISA_AVX512F},
+    {"vpmovb2m", enc_evex_vec2k, 0xF30F3829, 0, 0, 0, ISA_AVX512F},
+    {"vpmovw2m", enc_evex_vec2k, 0xF30F3829, 0, 0, 0, ISA_AVX512F},
+    {"vpmovd2m", enc_evex_vec2k, 0xF30F3839, 0, 0, 0, ISA_AVX512F},
+    {"vpmovq2m", enc_evex_vec2k, 0xF30F3839, 0, 0, 0, ISA_AVX512F},
+    {"vcvtqq2pd", enc_vex_2op, 0xF30FE6, 0, 0, 0, ISA_AVX512F}, {"vcvtqq2ps", enc_vex_2op, 0x0F5B, 0, 0, 0, ISA_AVX512F},
+    {"vcvtuqq2pd", enc_vex_2op, 0xF30F7A, 0, 0, 0, ISA_AVX512F},
+    {"vcvtuqq2ps", enc_vex_2op, 0xF20F7A, 0, 0, 0, ISA_AVX512F},
+    {"vgetexpps", enc_vex_2op, 0x660F3842, 0, 0, 0, ISA_AVX512F},
+    {"vgetexppd", enc_vex_2op, 0x660F3842, 0, 0, 0, ISA_AVX512F},
+    {"vgetexpss", enc_vex, 0x660F3843, 0, 0, 0, ISA_AVX512F}, {"vgetexpsd", enc_vex, 0x660F3843, 0, 0, 0, ISA_AVX512F},
+    {"vfixupimmps", enc_vex_imm, 0x660F3A54, 0, 0, 0, ISA_AVX512F},
+    {"vfixupimmpd", enc_vex_imm, 0x660F3A54, 0, 0, 0, ISA_AVX512F},
+    {"vfixupimmss", enc_vex_imm, 0x660F3A55, 0, 0, 0, ISA_AVX512F},
+    {"vfixupimmsd", enc_vex_imm, 0x660F3A55, 0, 0, 0, ISA_AVX512F},
+
+    // AVX-512 opmask instructions; size is the mask width
+    {"kmovb", enc_kmov, 0x0F90, 0, 8, 0, ISA_AVX512DQ}, {"kmovw", enc_kmov, 0x0F90, 0, 16, 0, ISA_AVX512F},
+    {"kmovd", enc_kmov, 0x0F90, 0, 32, 0, ISA_AVX512BW}, {"kmovq", enc_kmov, 0x0F90, 0, 64, 0, ISA_AVX512BW},
+    {"kandb", enc_kop, 0x0F41, 0, 8, 0, ISA_AVX512DQ},
+    {"kandw", enc_kop, 0x0F41, 0, 16, 0, ISA_AVX512F}, {"kandd", enc_kop, 0x0F41, 0, 32, 0, ISA_AVX512BW},
+    {"kandq", enc_kop, 0x0F41, 0, 64, 0, ISA_AVX512BW},
+    {"kandnb", enc_kop, 0x0F42, 0, 8, 0, ISA_AVX512DQ}, {"kandnw", enc_kop, 0x0F42, 0, 16, 0, ISA_AVX512F},
+    {"kandnd", enc_kop, 0x0F42, 0, 32, 0, ISA_AVX512BW}, {"kandnq", enc_kop, 0x0F42, 0, 64, 0, ISA_AVX512BW},
+    {"korb", enc_kop, 0x0F45, 0, 8, 0, ISA_AVX512DQ},
+    {"korw", enc_kop, 0x0F45, 0, 16, 0, ISA_AVX512F}, {"kord", enc_kop, 0x0F45, 0, 32, 0, ISA_AVX512BW},
+    {"korq", enc_kop, 0x0F45, 0, 64, 0, ISA_AVX512BW},
+    {"kxnorb", enc_kop, 0x0F46, 0, 8, 0, ISA_AVX512DQ}, {"kxnorw", enc_kop, 0x0F46, 0, 16, 0, ISA_AVX512F},
+    {"kxnord", enc_kop, 0x0F46, 0, 32, 0, ISA_AVX512BW}, {"kxnorq", enc_kop, 0x0F46, 0, 64, 0, ISA_AVX512BW},
+    {"kxorb", enc_kop, 0x0F47, 0, 8, 0, ISA_AVX512DQ},
+    {"kxorw", enc_kop, 0x0F47, 0, 16, 0, ISA_AVX512F}, {"kxord", enc_kop, 0x0F47, 0, 32, 0, ISA_AVX512BW},
+    {"kxorq", enc_kop, 0x0F47, 0, 64, 0, ISA_AVX512BW},
+    {"kaddb", enc_kop, 0x0F4A, 0, 8, 0, ISA_AVX512DQ}, {"kaddw", enc_kop, 0x0F4A, 0, 16, 0, ISA_AVX512DQ},
+    {"kaddd", enc_kop, 0x0F4A, 0, 32, 0, ISA_AVX512BW},
+    {"kaddq", enc_kop, 0x0F4A, 0, 64, 0, ISA_AVX512BW}, {"knotb", enc_kop2, 0x0F44, 0, 8, 0, ISA_AVX512DQ},
+    {"knotw", enc_kop2, 0x0F44, 0, 16, 0, ISA_AVX512F},
+    {"knotd", enc_kop2, 0x0F44, 0, 32, 0, ISA_AVX512BW}, {"knotq", enc_kop2, 0x0F44, 0, 64, 0, ISA_AVX512BW},
+    {"kortestb", enc_kop2, 0x0F98, 0, 8, 0, ISA_AVX512DQ}, {"kortestw", enc_kop2, 0x0F98, 0, 16, 0, ISA_AVX512F},
+    {"kortestd", enc_kop2, 0x0F98, 0, 32, 0, ISA_AVX512BW}, {"kortestq", enc_kop2, 0x0F98, 0, 64, 0, ISA_AVX512BW},
+    {"ktestb", enc_kop2, 0x0F99, 0, 8, 0, ISA_AVX512DQ}, {"ktestw", enc_kop2, 0x0F99, 0, 16, 0, ISA_AVX512DQ},
+    {"ktestd", enc_kop2, 0x0F99, 0, 32, 0, ISA_AVX512BW}, {"ktestq", enc_kop2, 0x0F99, 0, 64, 0, ISA_AVX512BW},
+    {"kunpckbw", enc_kop, 0x0F4B, 0, 8, 0, ISA_AVX512F}, {"kunpckwd", enc_kop, 0x0F4B, 0, 16, 0, ISA_AVX512BW},
+    {"kunpckdq", enc_kop, 0x0F4B, 0, 64, 0, ISA_AVX512BW},
+    {"kshiftrb", enc_kshift, 0x660F3A30, 0, 8, 0, ISA_AVX512DQ},
+    {"kshiftrw", enc_kshift, 0x660F3A30, 0, 16, 0, ISA_AVX512F},
+    {"kshiftrd", enc_kshift, 0x660F3A30, 0, 32, 0, ISA_AVX512BW},
+    {"kshiftrq", enc_kshift, 0x660F3A30, 0, 64, 0, ISA_AVX512BW},
+    {"kshiftlb", enc_kshift, 0x660F3A32, 0, 8, 0, ISA_AVX512DQ},
+    {"kshiftlw", enc_kshift, 0x660F3A32, 0, 16, 0, ISA_AVX512F},
+    {"kshiftld", enc_kshift, 0x660F3A32, 0, 32, 0, ISA_AVX512BW},
+    {"kshiftlq", enc_kshift, 0x660F3A32, 0, 64, 0, ISA_AVX512BW},
+};
 
-    switch (sz) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x2A;
-            *out++ = (reg << 3) | rm;
-            size += 2;
-            break;
-        case 16:
-            *out++ = 0x66;
-            /* FALLTHRU */
-        case 32:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x2B;
-            *out++ = (reg << 3) | rm;
-            size += 3;
-            break;
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x2B;
-            *out++ = (reg << 3) | rm;
-            size += 3;
-            break;
-    }
-    
-    if (needs_sib) {
-        emit_sib(&out, 0, 0b100, reg_code(src->mem.base));
-        size++;
-    }
+#define NINSN (sizeof(insn_table) / sizeof(insn_table[0]))
 
-    return size;
+static int cmp_insn(const void *a, const void *b) {
+    return strcmp(((const InsnDef *)a)->name, ((const InsnDef *)b)->name);
 }
 
+static const InsnDef *find_insn(const char *name) {
+    static bool sorted;
+    if (!sorted) {
+        qsort(insn_table, NINSN, sizeof(InsnDef), cmp_insn);
+        sorted = true;
+    }
+    InsnDef key = {.name = name};
+    return bsearch(&key, insn_table, NINSN, sizeof(InsnDef), cmp_insn);
+}
 
-// -------------------- CMP --------------------
+// EVEX forms: those of VEX instructions first, then the EVEX-only ones
+static EvexDef evex_table[] = {
+    {"vaddps", TUPLE_FV, 4, 0, EVEX_ER, 0}, {"vaddpd", TUPLE_FV, 8, 1, EVEX_ER, 0},
+    {"vaddss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vaddsd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vsubps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vsubpd", TUPLE_FV, 8, 1, EVEX_ER, 0},
+    {"vsubss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0}, {"vsubsd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0},
+    {"vmulps", TUPLE_FV, 4, 0, EVEX_ER, 0}, {"vmulpd", TUPLE_FV, 8, 1, EVEX_ER, 0},
+    {"vmulss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vmulsd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vdivps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vdivpd", TUPLE_FV, 8, 1, EVEX_ER, 0},
+    {"vdivss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0}, {"vdivsd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0},
+    {"vminps", TUPLE_FV, 4, 0, EVEX_SAE, 0}, {"vminpd", TUPLE_FV, 8, 1, EVEX_SAE, 0},
+    {"vminss", TUPLE_FIXED, 4, 0, EVEX_SAE | EVEX_LIG, 0}, {"vminsd", TUPLE_FIXED, 8, 1, EVEX_SAE | EVEX_LIG, 0},
+    {"vmaxps", TUPLE_FV, 4, 0, EVEX_SAE, 0}, {"vmaxpd", TUPLE_FV, 8, 1, EVEX_SAE, 0},
+    {"vmaxss", TUPLE_FIXED, 4, 0, EVEX_SAE | EVEX_LIG, 0}, {"vmaxsd", TUPLE_FIXED, 8, 1, EVEX_SAE | EVEX_LIG, 0},
+    {"vsqrtps", TUPLE_FV, 4, 0, EVEX_ER, 0}, {"vsqrtpd", TUPLE_FV, 8, 1, EVEX_ER, 0},
+    {"vsqrtss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0}, {"vsqrtsd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0},
+    {"vandps", TUPLE_FV, 4, 0, 0, ISA_AVX512DQ},
+    {"vandpd", TUPLE_FV, 8, 1, 0, ISA_AVX512DQ}, {"vandnps", TUPLE_FV, 4, 0, 0, ISA_AVX512DQ},
+    {"vandnpd", TUPLE_FV, 8, 1, 0, ISA_AVX512DQ},
+    {"vorps", TUPLE_FV, 4, 0, 0, ISA_AVX512DQ}, {"vorpd", TUPLE_FV, 8, 1, 0, ISA_AVX512DQ},
+    {"vxorps", TUPLE_FV, 4, 0, 0, ISA_AVX512DQ},
+    {"vxorpd", TUPLE_FV, 8, 1, 0, ISA_AVX512DQ}, {"vunpcklps", TUPLE_FV, 4, 0, 0, 0},
+    {"vunpcklpd", TUPLE_FV, 8, 1, 0, 0},
+    {"vunpckhps", TUPLE_FV, 4, 0, 0, 0}, {"vunpckhpd", TUPLE_FV, 8, 1, 0, 0}, {"vshufps", TUPLE_FV, 4, 0, 0, 0},
+    {"vshufpd", TUPLE_FV, 8, 1, 0, 0}, {"vcmpps", TUPLE_FV, 4, 0, EVEX_KDST | EVEX_SAE, 0},
+    {"vcmppd", TUPLE_FV, 8, 1, EVEX_KDST | EVEX_SAE, 0},
+    {"vcmpss", TUPLE_FIXED, 4, 0, EVEX_KDST | EVEX_SAE | EVEX_LIG, 0},
+    {"vcmpsd", TUPLE_FIXED, 8, 1, EVEX_KDST | EVEX_SAE | EVEX_LIG, 0}, {"vpaddb", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpaddw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vpaddsb", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpaddsw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpaddusb", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vpaddusw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpsubb", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpsubw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vpsubsb", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpsubsw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpsubusb", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vpsubusw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpmullw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpmulhw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vpmulhuw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpmaddwd", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpsadbw", TUPLE_FVM, 0, 0, EVEX_NOMASK, ISA_AVX512BW}, {"vpavgb", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpavgw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpminub", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vpmaxub", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpminsw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpmaxsw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vpacksswb", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpackuswb", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpunpcklbw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vpunpcklwd", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpunpckhbw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpunpckhwd", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vpshufb", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpmaddubsw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpmulhrsw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vpminsb", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpminuw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpmaxsb", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vpmaxuw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpabsb", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpabsw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vpalignr", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpshufhw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpshuflw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vpslldq", TUPLE_FVM, 0, 0, EVEX_NOMASK, ISA_AVX512BW},
+    {"vpsrldq", TUPLE_FVM, 0, 0, EVEX_NOMASK, ISA_AVX512BW}, {"vpsllw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpsrlw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpsraw", TUPLE_FVM, 0, 0, 0, ISA_AVX512BW}, {"vmovshdup", TUPLE_FVM, 0, 0, 0, 0},
+    {"vmovsldup", TUPLE_FVM, 0, 0, 0, 0},
+    {"vpcmpeqb", TUPLE_FVM, 0, 0, EVEX_KDST, ISA_AVX512BW}, {"vpcmpeqw", TUPLE_FVM, 0, 0, EVEX_KDST, ISA_AVX512BW},
+    {"vpcmpgtb", TUPLE_FVM, 0, 0, EVEX_KDST, ISA_AVX512BW}, {"vpcmpgtw", TUPLE_FVM, 0, 0, EVEX_KDST, ISA_AVX512BW},
+    {"vpaddd", TUPLE_FV, 4, 0, 0, 0},
+    {"vpsubd", TUPLE_FV, 4, 0, 0, 0}, {"vpmulld", TUPLE_FV, 4, 0, 0, 0}, {"vpminsd", TUPLE_FV, 4, 0, 0, 0},
+    {"vpminud", TUPLE_FV, 4, 0, 0, 0}, {"vpmaxsd", TUPLE_FV, 4, 0, 0, 0}, {"vpmaxud", TUPLE_FV, 4, 0, 0, 0},
+    {"vpackssdw", TUPLE_FV, 4, 0, 0, ISA_AVX512BW}, {"vpackusdw", TUPLE_FV, 4, 0, 0, ISA_AVX512BW},
+    {"vpunpckldq", TUPLE_FV, 4, 0, 0, 0},
+    {"vpunpckhdq", TUPLE_FV, 4, 0, 0, 0}, {"vpabsd", TUPLE_FV, 4, 0, 0, 0}, {"vpshufd", TUPLE_FV, 4, 0, 0, 0},
+    {"vpslld", TUPLE_FV, 4, 0, 0, 0}, {"vpsrld", TUPLE_FV, 4, 0, 0, 0}, {"vpsrad", TUPLE_FV, 4, 0, 0, 0},
+    {"vpsllvd", TUPLE_FV, 4, 0, 0, 0}, {"vpsrlvd", TUPLE_FV, 4, 0, 0, 0}, {"vpsravd", TUPLE_FV, 4, 0, 0, 0},
+    {"vpermd", TUPLE_FV, 4, 0, 0, 0}, {"vpermps", TUPLE_FV, 4, 0, 0, 0}, {"vpermilps", TUPLE_FV, 4, 0, 0, 0},
+    {"vcvtdq2ps", TUPLE_FV, 4, 0, 0, 0}, {"vpcmpeqd", TUPLE_FV, 4, 0, EVEX_KDST, 0},
+    {"vpcmpgtd", TUPLE_FV, 4, 0, EVEX_KDST, 0}, {"vcvtps2dq", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vcvttps2dq", TUPLE_FV, 4, 0, EVEX_SAE, 0}, {"vpaddq", TUPLE_FV, 8, 1, 0, 0}, {"vpsubq", TUPLE_FV, 8, 1, 0, 0},
+    {"vpmuludq", TUPLE_FV, 8, 1, 0, 0}, {"vpmuldq", TUPLE_FV, 8, 1, 0, 0}, {"vpunpcklqdq", TUPLE_FV, 8, 1, 0, 0},
+    {"vpunpckhqdq", TUPLE_FV, 8, 1, 0, 0}, {"vpsllq", TUPLE_FV, 8, 1, 0, 0}, {"vpsrlq", TUPLE_FV, 8, 1, 0, 0},
+    {"vpsllvq", TUPLE_FV, 8, 1, 0, 0}, {"vpsrlvq", TUPLE_FV, 8, 1, 0, 0}, {"vpermq", TUPLE_FV, 8, 1, 0, 0},
+    {"vpermpd", TUPLE_FV, 8, 1, 0, 0}, {"vpermilpd", TUPLE_FV, 8, 1, 0, 0},
+    {"vpcmpeqq", TUPLE_FV, 8, 1, EVEX_KDST, 0},
+    {"vpcmpgtq", TUPLE_FV, 8, 1, EVEX_KDST, 0}, {"vcvtpd2ps", TUPLE_FV, 8, 1, EVEX_ER | EVEX_NARROW, 0},
+    {"vcvtpd2dq", TUPLE_FV, 8, 1, EVEX_ER | EVEX_NARROW, 0},
+    {"vcvttpd2dq", TUPLE_FV, 8, 1, EVEX_SAE | EVEX_NARROW, 0},
+    {"vcvtps2pd", TUPLE_HV, 4, 0, EVEX_SAE, 0}, {"vcvtdq2pd", TUPLE_HV, 4, 0, 0, 0},
+    {"vpmovsxbw", TUPLE_HVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpmovsxbd", TUPLE_QVM, 0, 0, 0, 0}, {"vpmovsxbq", TUPLE_OVM, 0, 0, 0, 0}, {"vpmovsxwd", TUPLE_HVM, 0, 0, 0, 0},
+    {"vpmovsxwq", TUPLE_QVM, 0, 0, 0, 0}, {"vpmovsxdq", TUPLE_HVM, 0, 0, 0, 0},
+    {"vpmovzxbw", TUPLE_HVM, 0, 0, 0, ISA_AVX512BW},
+    {"vpmovzxbd", TUPLE_QVM, 0, 0, 0, 0}, {"vpmovzxbq", TUPLE_OVM, 0, 0, 0, 0}, {"vpmovzxwd", TUPLE_HVM, 0, 0, 0, 0},
+    {"vpmovzxwq", TUPLE_QVM, 0, 0, 0, 0}, {"vpmovzxdq", TUPLE_HVM, 0, 0, 0, 0},
+    {"vfmadd132ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfmadd132pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfmadd132ss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vfmadd132sd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vfmadd213ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfmadd213pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfmadd213ss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vfmadd213sd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vfmadd231ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfmadd231pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfmadd231ss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vfmadd231sd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vfmsub132ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfmsub132pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfmsub132ss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vfmsub132sd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vfmsub213ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfmsub213pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfmsub213ss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vfmsub213sd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vfmsub231ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfmsub231pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfmsub231ss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vfmsub231sd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vfnmadd132ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfnmadd132pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfnmadd132ss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vfnmadd132sd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vfnmadd213ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfnmadd213pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfnmadd213ss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vfnmadd213sd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vfnmadd231ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfnmadd231pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfnmadd231ss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vfnmadd231sd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vfnmsub132ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfnmsub132pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfnmsub132ss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vfnmsub132sd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vfnmsub213ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfnmsub213pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfnmsub213ss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vfnmsub213sd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vfnmsub231ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfnmsub231pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfnmsub231ss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_LIG, 0},
+    {"vfnmsub231sd", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vfmaddsub132ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfmaddsub132pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfmaddsub213ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfmaddsub213pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfmaddsub231ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfmaddsub231pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfmsubadd132ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfmsubadd132pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfmsubadd213ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfmsubadd213pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vfmsubadd231ps", TUPLE_FV, 4, 0, EVEX_ER, 0},
+    {"vfmsubadd231pd", TUPLE_FV, 8, 1, EVEX_ER, 0}, {"vmovaps", TUPLE_FVM, 0, 0, 0, 0},
+    {"vmovups", TUPLE_FVM, 0, 0, 0, 0},
+    {"vmovapd", TUPLE_FVM, 0, 1, 0, 0}, {"vmovupd", TUPLE_FVM, 0, 1, 0, 0},
+    {"vmovss", TUPLE_FIXED, 4, 0, EVEX_LIG, 0},
+    {"vmovsd", TUPLE_FIXED, 8, 1, EVEX_LIG, 0}, {"vmovntdqa", TUPLE_FVM, 0, 0, EVEX_NOMASK, 0},
+    {"vmovntps", TUPLE_FVM, 0, 0, EVEX_NOMASK, 0}, {"vmovntpd", TUPLE_FVM, 0, 1, EVEX_NOMASK, 0},
+    {"vmovntdq", TUPLE_FVM, 0, 0, EVEX_NOMASK, 0}, {"vbroadcastss", TUPLE_FIXED, 4, 0, 0, 0},
+    {"vbroadcastsd", TUPLE_FIXED, 8, 1, 0, 0}, {"vpbroadcastb", TUPLE_FIXED, 1, 0, 0, ISA_AVX512BW},
+    {"vpbroadcastw", TUPLE_FIXED, 2, 0, 0, ISA_AVX512BW}, {"vpbroadcastd", TUPLE_FIXED, 4, 0, 0, 0},
+    {"vpbroadcastq", TUPLE_FIXED, 8, 1, 0, 0}, {"vcomiss", TUPLE_FIXED, 4, 0, EVEX_SAE | EVEX_NOMASK | EVEX_LIG, 0},
+    {"vucomiss", TUPLE_FIXED, 4, 0, EVEX_SAE | EVEX_NOMASK | EVEX_LIG, 0},
+    {"vcomisd", TUPLE_FIXED, 8, 1, EVEX_SAE | EVEX_NOMASK | EVEX_LIG, 0},
+    {"vucomisd", TUPLE_FIXED, 8, 1, EVEX_SAE | EVEX_NOMASK | EVEX_LIG, 0},
+    {"vcvtss2sd", TUPLE_FIXED, 4, 0, EVEX_SAE | EVEX_LIG, 0},
+    {"vcvtsd2ss", TUPLE_FIXED, 8, 1, EVEX_ER | EVEX_LIG, 0}, {"vinsertps", TUPLE_FIXED, 4, 0, EVEX_LIG, 0},
+    {"vmovhlps", TUPLE_FIXED, 8, 0, EVEX_NOMASK | EVEX_LIG, 0},
+    {"vmovlhps", TUPLE_FIXED, 8, 0, EVEX_NOMASK | EVEX_LIG, 0},
+    {"vmovd", TUPLE_FIXED, 4, 0, EVEX_NOMASK | EVEX_LIG, 0}, {"vmovq", TUPLE_FIXED, 8, 1, EVEX_NOMASK | EVEX_LIG, 0},
+    {"vpextrb", TUPLE_FIXED, 1, 0, EVEX_NOMASK | EVEX_LIG, ISA_AVX512BW},
+    {"vpextrw", TUPLE_FIXED, 2, 0, EVEX_NOMASK | EVEX_LIG, ISA_AVX512BW},
+    {"vpextrd", TUPLE_FIXED, 4, 0, EVEX_NOMASK | EVEX_LIG, ISA_AVX512DQ},
+    {"vpextrq", TUPLE_FIXED, 8, 1, EVEX_NOMASK | EVEX_LIG, ISA_AVX512DQ},
+    {"vextractps", TUPLE_FIXED, 4, 0, EVEX_NOMASK | EVEX_LIG, 0},
+    {"vpinsrb", TUPLE_FIXED, 1, 0, EVEX_NOMASK | EVEX_LIG, ISA_AVX512BW},
+    {"vpinsrw", TUPLE_FIXED, 2, 0, EVEX_NOMASK | EVEX_LIG, ISA_AVX512BW},
+    {"vpinsrd", TUPLE_FIXED, 4, 0, EVEX_NOMASK | EVEX_LIG, ISA_AVX512DQ},
+    {"vpinsrq", TUPLE_FIXED, 8, 1, EVEX_NOMASK | EVEX_LIG, ISA_AVX512DQ},
+    {"vcvtsi2ss", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_NOMASK | EVEX_LIG, 0},
+    {"vcvtsi2sd", TUPLE_FIXED, 8, 0, EVEX_ER | EVEX_NOMASK | EVEX_LIG, 0},
+    {"vcvtss2si", TUPLE_FIXED, 4, 0, EVEX_ER | EVEX_NOMASK | EVEX_LIG, 0},
+    {"vcvttss2si", TUPLE_FIXED, 4, 0, EVEX_SAE | EVEX_NOMASK | EVEX_LIG, 0},
+    {"vcvtsd2si", TUPLE_FIXED, 8, 0, EVEX_ER | EVEX_NOMASK | EVEX_LIG, 0},
+    {"vcvttsd2si", TUPLE_FIXED, 8, 0, EVEX_SAE | EVEX_NOMASK | EVEX_LIG, 0},
+    {"vpgatherdd", TUPLE_FIXED, 4, 0, 0, 0}, {"vpgatherdq", TUPLE_FIXED, 8, 1, 0, 0},
+    {"vpgatherqd", TUPLE_FIXED, 4, 0, 0, 0},
+    {"vpgatherqq", TUPLE_FIXED, 8, 1, 0, 0}, {"vgatherdps", TUPLE_FIXED, 4, 0, 0, 0},
+    {"vgatherdpd", TUPLE_FIXED, 8, 1, 0, 0},
+    {"vgatherqps", TUPLE_FIXED, 4, 0, 0, 0}, {"vgatherqpd", TUPLE_FIXED, 8, 1, 0, 0},
+    {"vmovdqa32", TUPLE_FVM, 0, 0, EVEX_ONLY, 0}, {"vmovdqa64", TUPLE_FVM, 0, 1, EVEX_ONLY, 0},
+    {"vmovdqu8", TUPLE_FVM, 0, 0, EVEX_ONLY, ISA_AVX512BW}, {"vmovdqu16", TUPLE_FVM, 0, 1, EVEX_ONLY, ISA_AVX512BW},
+    {"vmovdqu32", TUPLE_FVM, 0, 0, EVEX_ONLY, 0}, {"vmovdqu64", TUPLE_FVM, 0, 1, EVEX_ONLY, 0},
+    {"vpandd", TUPLE_FV, 4, 0, EVEX_ONLY, 0}, {"vpandq", TUPLE_FV, 8, 1, EVEX_ONLY, 0},
+    {"vpandnd", TUPLE_FV, 4, 0, EVEX_ONLY, 0}, {"vpandnq", TUPLE_FV, 8, 1, EVEX_ONLY, 0},
+    {"vpord", TUPLE_FV, 4, 0, EVEX_ONLY, 0}, {"vporq", TUPLE_FV, 8, 1, EVEX_ONLY, 0},
+    {"vpxord", TUPLE_FV, 4, 0, EVEX_ONLY, 0},
+    {"vpxorq", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vpternlogd", TUPLE_FV, 4, 0, EVEX_ONLY, 0},
+    {"vpternlogq", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vpmullq", TUPLE_FV, 8, 1, EVEX_ONLY, ISA_AVX512DQ},
+    {"vpabsq", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vpminsq", TUPLE_FV, 8, 1, EVEX_ONLY, 0},
+    {"vpminuq", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vpmaxsq", TUPLE_FV, 8, 1, EVEX_ONLY, 0},
+    {"vpmaxuq", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vpsraq", TUPLE_FV, 8, 1, EVEX_ONLY, 0},
+    {"vpsravq", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vprold", TUPLE_FV, 4, 0, EVEX_ONLY, 0},
+    {"vprolq", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vprord", TUPLE_FV, 4, 0, EVEX_ONLY, 0},
+    {"vprorq", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vprolvd", TUPLE_FV, 4, 0, EVEX_ONLY, 0},
+    {"vprolvq", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vprorvd", TUPLE_FV, 4, 0, EVEX_ONLY, 0},
+    {"vprorvq", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vpermt2d", TUPLE_FV, 4, 0, EVEX_ONLY, 0},
+    {"vpermt2q", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vpermt2ps", TUPLE_FV, 4, 0, EVEX_ONLY, 0},
+    {"vpermt2pd", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vpermi2d", TUPLE_FV, 4, 0, EVEX_ONLY, 0},
+    {"vpermi2q", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vpermi2ps", TUPLE_FV, 4, 0, EVEX_ONLY, 0},
+    {"vpermi2pd", TUPLE_FV, 8, 1, EVEX_ONLY, 0}, {"vpermw", TUPLE_FVM, 0, 1, EVEX_ONLY, ISA_AVX512BW},
+    {"vpcompressd", TUPLE_FIXED, 4, 0, EVEX_ONLY, 0}, {"vpcompressq", TUPLE_FIXED, 8, 1, EVEX_ONLY, 0},
+    {"vcompressps", TUPLE_FIXED, 4, 0, EVEX_ONLY, 0}, {"vcompresspd", TUPLE_FIXED, 8, 1, EVEX_ONLY, 0},
+    {"vpexpandd", TUPLE_FIXED, 4, 0, EVEX_ONLY, 0}, {"vpexpandq", TUPLE_FIXED, 8, 1, EVEX_ONLY, 0},
+    {"vexpandps", TUPLE_FIXED, 4, 0, EVEX_ONLY, 0}, {"vexpandpd", TUPLE_FIXED, 8, 1, EVEX_ONLY, 0},
+    {"vextracti32x4", TUPLE_FIXED, 16, 0, EVEX_ONLY, 0}, {"vextracti64x4", TUPLE_FIXED, 32, 1, EVEX_ONLY, 0},
+    {"vextractf32x4", TUPLE_FIXED, 16, 0, EVEX_ONLY, 0}, {"vextractf64x4", TUPLE_FIXED, 32, 1, EVEX_ONLY, 0},
+    {"vinserti32x4", TUPLE_FIXED, 16, 0, EVEX_ONLY, 0}, {"vinserti64x4", TUPLE_FIXED, 32, 1, EVEX_ONLY, 0},
+    {"vinsertf32x4", TUPLE_FIXED, 16, 0, EVEX_ONLY, 0}, {"vinsertf64x4", TUPLE_FIXED, 32, 1, EVEX_ONLY, 0},
+    {"vbroadcasti32x4", TUPLE_FIXED, 16, 0, EVEX_ONLY, 0}, {"vbroadcasti64x4", TUPLE_FIXED, 32, 1, EVEX_ONLY, 0},
+    {"vbroadcastf32x4", TUPLE_FIXED, 16, 0, EVEX_ONLY, 0}, {"vbroadcastf64x4", TUPLE_FIXED, 32, 1, EVEX_ONLY, 0},
+    {"vpcmpd", TUPLE_FV, 4, 0, EVEX_ONLY | EVEX_KDST, 0}, {"vpcmpud", TUPLE_FV, 4, 0, EVEX_ONLY | EVEX_KDST, 0},
+    {"vpcmpq", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_KDST, 0}, {"vpcmpuq", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_KDST, 0},
+    {"vpcmpb", TUPLE_FVM, 0, 0, EVEX_ONLY | EVEX_KDST, ISA_AVX512BW},
+    {"vpcmpub", TUPLE_FVM, 0, 0, EVEX_ONLY | EVEX_KDST, ISA_AVX512BW},
+    {"vpcmpw", TUPLE_FVM, 0, 1, EVEX_ONLY | EVEX_KDST, ISA_AVX512BW},
+    {"vpcmpuw", TUPLE_FVM, 0, 1, EVEX_ONLY | EVEX_KDST, ISA_AVX512BW},
+    {"vptestmd", TUPLE_FV, 4, 0, EVEX_ONLY | EVEX_KDST, 0}, {"vptestmq", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_KDST, 0},
+    {"vptestnmd", TUPLE_FV, 4, 0, EVEX_ONLY | EVEX_KDST, 0}, {"vptestnmq", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_KDST, 0},
+    {"vptestmb", TUPLE_FVM, 0, 0, EVEX_ONLY | EVEX_KDST, ISA_AVX512BW},
+    {"vptestmw", TUPLE_FVM, 0, 1, EVEX_ONLY | EVEX_KDST, ISA_AVX512BW},
+    {"vptestnmb", TUPLE_FVM, 0, 0, EVEX_ONLY | EVEX_KDST, ISA_AVX512BW},
+    {"vptestnmw", TUPLE_FVM, 0, 1, EVEX_ONLY | EVEX_KDST, ISA_AVX512BW},
+    {"vrndscaleps", TUPLE_FV, 4, 0, EVEX_ONLY | EVEX_SAE, 0},
+    {"vrndscalepd", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_SAE, 0},
+    {"vrcp14ps", TUPLE_FV, 4, 0, EVEX_ONLY, 0}, {"vrcp14pd", TUPLE_FV, 8, 1, EVEX_ONLY, 0},
+    {"vrsqrt14ps", TUPLE_FV, 4, 0, EVEX_ONLY, 0}, {"vrsqrt14pd", TUPLE_FV, 8, 1, EVEX_ONLY, 0},
+    {"vscalefps", TUPLE_FV, 4, 0, EVEX_ONLY | EVEX_ER, 0}, {"vscalefpd", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_ER, 0},
+    {"vpscatterdd", TUPLE_FIXED, 4, 0, EVEX_ONLY, 0}, {"vpscatterdq", TUPLE_FIXED, 8, 1, EVEX_ONLY, 0},
+    {"vpscatterqd", TUPLE_FIXED, 4, 0, EVEX_ONLY, 0}, {"vpscatterqq", TUPLE_FIXED, 8, 1, EVEX_ONLY, 0},
+    {"vscatterdps", TUPLE_FIXED, 4, 0, EVEX_ONLY, 0}, {"vscatterdpd", TUPLE_FIXED, 8, 1, EVEX_ONLY, 0},
+    {"vscatterqps", TUPLE_FIXED, 4, 0, EVEX_ONLY, 0}, {"vscatterqpd", TUPLE_FIXED, 8, 1, EVEX_ONLY, 0},
+    {"vpconflictd", TUPLE_FV, 4, 0, EVEX_ONLY, ISA_AVX512CD},
+    {"vpconflictq", TUPLE_FV, 8, 1, EVEX_ONLY, ISA_AVX512CD},
+    {"vplzcntd", TUPLE_FV, 4, 0, EVEX_ONLY, ISA_AVX512CD}, {"vplzcntq", TUPLE_FV, 8, 1, EVEX_ONLY, ISA_AVX512CD},
+    {"vpbroadcastmb2q", TUPLE_FIXED, 8, 1, EVEX_ONLY | EVEX_NOMASK, ISA_AVX512CD},
+    {"vpbroadcastmw2d", TUPLE_FIXED, 4, 0, EVEX_ONLY | EVEX_NOMASK, ISA_AVX512CD},
+    {"valignd", TUPLE_FV, 4, 0, EVEX_ONLY, 0}, {"valignq", TUPLE_FV, 8, 1, EVEX_ONLY, 0},
+    {"vshuff32x4", TUPLE_FV, 4, 0, EVEX_ONLY | EVEX_NO128, 0},
+    {"vshuff64x2", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_NO128, 0},
+    {"vshufi32x4", TUPLE_FV, 4, 0, EVEX_ONLY | EVEX_NO128, 0},
+    {"vshufi64x2", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_NO128, 0},
+    {"vpblendmd", TUPLE_FV, 4, 0, EVEX_ONLY, 0}, {"vpblendmq", TUPLE_FV, 8, 1, EVEX_ONLY, 0},
+    {"vpblendmb", TUPLE_FVM, 0, 0, EVEX_ONLY, ISA_AVX512BW}, {"vpblendmw", TUPLE_FVM, 0, 1, EVEX_ONLY, ISA_AVX512BW},
+    {"vblendmps", TUPLE_FV, 4, 0, EVEX_ONLY, 0}, {"vblendmpd", TUPLE_FV, 8, 1, EVEX_ONLY, 0},
+    {"vpmovwb", TUPLE_HVM, 0, 0, EVEX_ONLY, ISA_AVX512BW}, {"vpmovswb", TUPLE_HVM, 0, 0, EVEX_ONLY, ISA_AVX512BW},
+    {"vpmovuswb", TUPLE_HVM, 0, 0, EVEX_ONLY, ISA_AVX512BW},
+    {"vpmovdb", TUPLE_QVM, 0, 0, EVEX_ONLY, 0}, {"vpmovsdb", TUPLE_QVM, 0, 0, EVEX_ONLY, 0},
+    {"vpmovusdb", TUPLE_QVM, 0, 0, EVEX_ONLY, 0},
+    {"vpmovqb", TUPLE_OVM, 0, 0, EVEX_ONLY, 0}, {"vpmovsqb", TUPLE_OVM, 0, 0, EVEX_ONLY, 0},
+    {"vpmovusqb", TUPLE_OVM, 0, 0, EVEX_ONLY, 0},
+    {"vpmovdw", TUPLE_HVM, 0, 0, EVEX_ONLY, 0}, {"vpmovsdw", TUPLE_HVM, 0, 0, EVEX_ONLY, 0},
+    {"vpmovusdw", TUPLE_HVM, 0, 0, EVEX_ONLY, 0},
+    {"vpmovqw", TUPLE_QVM, 0, 0, EVEX_ONLY, 0}, {"vpmovsqw", TUPLE_QVM, 0, 0, EVEX_ONLY, 0},
+    {"vpmovusqw", TUPLE_QVM, 0, 0, EVEX_ONLY, 0},
+    {"vpmovqd", TUPLE_HVM, 0, 0, EVEX_ONLY, 0}, {"vpmovsqd", TUPLE_HVM, 0, 0, EVEX_ONLY, 0},
+    {"vpmovusqd", TUPLE_HVM, 0, 0, EVEX_ONLY, 0},
+    {"vpmovm2b", TUPLE_FIXED, 0, 0, EVEX_ONLY | EVEX_NOMASK, ISA_AVX512BW},
+    {"vpmovm2w", TUPLE_FIXED, 0, 1, EVEX_ONLY | EVEX_NOMASK, ISA_AVX512BW},
+    {"vpmovm2d", TUPLE_FIXED, 0, 0, EVEX_ONLY | EVEX_NOMASK, ISA_AVX512DQ},
+    {"vpmovm2q", TUPLE_FIXED, 0, 1, EVEX_ONLY | EVEX_NOMASK, ISA_AVX512DQ},
+    {"vpmovb2m", TUPLE_FIXED, 0, 0, EVEX_ONLY | EVEX_KDST | EVEX_NOMASK, ISA_AVX512BW},
+    {"vpmovw2m", TUPLE_FIXED, 0, 1, EVEX_ONLY | EVEX_KDST | EVEX_NOMASK, ISA_AVX512BW},
+    {"vpmovd2m", TUPLE_FIXED, 0, 0, EVEX_ONLY | EVEX_KDST | EVEX_NOMASK, ISA_AVX512DQ},
+    {"vpmovq2m", TUPLE_FIXED, 0, 1, EVEX_ONLY | EVEX_KDST | EVEX_NOMASK, ISA_AVX512DQ},
+    {"vcvtqq2pd", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_ER, ISA_AVX512DQ},
+    {"vcvtqq2ps", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_ER | EVEX_NARROW, ISA_AVX512DQ},
+    {"vcvtuqq2pd", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_ER, ISA_AVX512DQ},
+    {"vcvtuqq2ps", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_ER | EVEX_NARROW, ISA_AVX512DQ},
+    {"vgetexpps", TUPLE_FV, 4, 0, EVEX_ONLY | EVEX_SAE, 0}, {"vgetexppd", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_SAE, 0},
+    {"vgetexpss", TUPLE_FIXED, 4, 0, EVEX_ONLY | EVEX_SAE | EVEX_LIG, 0},
+    {"vgetexpsd", TUPLE_FIXED, 8, 1, EVEX_ONLY | EVEX_SAE | EVEX_LIG, 0},
+    {"vfixupimmps", TUPLE_FV, 4, 0, EVEX_ONLY | EVEX_SAE, 0},
+    {"vfixupimmpd", TUPLE_FV, 8, 1, EVEX_ONLY | EVEX_SAE, 0},
+    {"vfixupimmss", TUPLE_FIXED, 4, 0, EVEX_ONLY | EVEX_SAE | EVEX_LIG, 0},
+    {"vfixupimmsd", TUPLE_FIXED, 8, 1, EVEX_ONLY | EVEX_SAE | EVEX_LIG, 0},
+};
 
-size_t encode_cmp_reg_reg(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
-    int sz = reg_size(dst->reg);
-    if (sz != reg_size(src->reg)) {
-        fprintf(stderr, "Size mismatch: %s vs %s\n", dst->reg, src->reg);
-        return 0;
-    }
+#define NEVEX (sizeof(evex_table) / sizeof(evex_table[0]))
 
-    int reg = reg_code(src->reg);
-    int rm = reg_code(dst->reg);
+static int cmp_evex(const void *a, const void *b) {
+    return strcmp(((const EvexDef *)a)->name, ((const EvexDef *)b)->name);
+}
 
-    bool rex_w = (sz == 64);
-    bool rex_r = (reg & 8) != 0;
-    bool rex_b = (rm & 8) != 0;
+static const EvexDef *find_evex(const char *name) {
+    static bool sorted;
+    if (!sorted) {
+        qsort(evex_table, NEVEX, sizeof(EvexDef), cmp_evex);
+        sorted = true;
+    }
+    EvexDef key = {.name = name};
+    return bsearch(&key, evex_table, NEVEX, sizeof(EvexDef), cmp_evex);
+}
 
-    if (reg > 7) reg -= 8;
-    if (rm > 7) rm -= 8;
+// {%k}, {z}, {1toN} or a rounding mode on the instruction
+static bool has_evex_decorations(Instruction *in) {
+    if (in->opmask || in->zeroing || in->rounding) return true;
+    for (size_t i = 0; i < in->noperands; i++)
+        if (in->operands[i]->kind == OP_MEM && in->operands[i]->mem.bcst) return true;
+    return false;
+}
 
-    // force REX for new 8-bit registers
-    bool needs_rex = rex_w || rex_r || rex_b ||
-        !strcmp(dst->reg, "%sil") || !strcmp(dst->reg, "%dil") || !strcmp(dst->reg, "%bpl") || !strcmp(dst->reg, "%spl");
+static bool lock_allowed(InsnCtx *c) {
+    size_t n = c->inst->noperands;
+    if (c->def->lock == LOCK_MEM_DST)
+        return n && operand(c, n - 1)->kind == OP_MEM;
+    if (c->def->lock == LOCK_MEM_ANY)
+        for (size_t i = 0; i < n; i++)
+            if (operand(c, i)->kind == OP_MEM) return true;
+    return false;
+}
 
+// rep/repe/repne: the string instructions, and rep ret (AMD's two-byte return)
+static bool rep_allowed(InsnCtx *c) {
+    if (c->inst->prefixes & PREFIX_LOCK) return false;
+    if (c->def->encode == enc_ret) return !(c->inst->prefixes & PREFIX_REPNE);
+    return c->def->encode == enc_string;
+}
 
-    bool high = (src->reg[strlen(src->reg)-1] == 'h') || (dst->reg[strlen(dst->reg)-1] == 'h');
+static int suffix_size(char c) {
+    return c == 'b' ? 8 : c == 'w' ? 16 : c == 'l' ? 32 : c == 'q' ? 64 : 0;
+}
 
+// -------------------- Condition codes --------------------
+// jcc, setcc and cmovcc carry the condition in the low nibble of the opcode.
+// Every alias gas accepts maps to one of the 16 codes.
+static const struct {
+    const char *name;
+    uint8_t cc;
+} cond_codes[] = {
+    {"o", 0x0}, {"no", 0x1},
+    {"b", 0x2}, {"c", 0x2}, {"nae", 0x2},
+    {"ae", 0x3}, {"nb", 0x3}, {"nc", 0x3},
+    {"e", 0x4}, {"z", 0x4}, {"ne", 0x5}, {"nz", 0x5},
+    {"be", 0x6}, {"na", 0x6}, {"a", 0x7}, {"nbe", 0x7},
+    {"s", 0x8}, {"ns", 0x9},
+    {"p", 0xA}, {"pe", 0xA}, {"np", 0xB}, {"po", 0xB},
+    {"l", 0xC}, {"nge", 0xC}, {"ge", 0xD}, {"nl", 0xD},
+    {"le", 0xE}, {"ng", 0xE}, {"g", 0xF}, {"nle", 0xF},
+};
 
-    if (high && needs_rex) {
-        fprintf(stderr, "High register not supported with REX prefix\n");
-        exit(1);
-    }
+int cond_code(const char *name) {
+    for (size_t i = 0; i < sizeof(cond_codes) / sizeof(cond_codes[0]); i++)
+        if (!strcmp(cond_codes[i].name, name)) return cond_codes[i].cc;
+    return -1;
+}
 
-    switch (sz) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0);}
-            *out++ = 0x38;
-            *out++ = (0b11 << 6) | ((reg & 7) << 3) | (rm & 7);
-            size += needs_rex ? 3 : 2;
-            break;
-        case 16:
-            *out++ = 0x66; // operand-size prefix
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x39;
-            *out++ = (0b11 << 6) | ((reg & 7) << 3) | (rm & 7);
-            size += 3;
-            break;
-        case 64:
-        case 32:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x39;
-            *out++ = (0b11 << 6) | ((reg & 7) << 3) | (rm & 7);
-            size += 2;
-            break;
+// The families, looked up by prefix once the exact name isn't in insn_table
+static const InsnDef cond_insns[] = {
+    {"j",    enc_jcc, 0x0F80, 0, 0, 0, 0},
+    {"set",  enc_setcc, 0x0F90, 0, 0, 0, 0},
+    {"cmov", enc_cmov, 0x0F40, 0, 0, 0, 0},
+};
+
+// setcc and cmovcc also take a size suffix (cmovnel); the bare condition
+// wins, so setb and cmovl keep their gas meaning
+static const InsnDef *lookup_cond(const char *opcode, int *suffix, int *cc) {
+    for (size_t i = 0; i < sizeof(cond_insns) / sizeof(cond_insns[0]); i++) {
+        const InsnDef *def = &cond_insns[i];
+        size_t n = strlen(def->name);
+        if (strncmp(opcode, def->name, n) != 0) continue;
+
+        const char *cond = opcode + n;
+        if ((*cc = cond_code(cond)) >= 0) return def;
+
+        size_t len = strlen(cond);
+        char base[4];
+        if (def->encode == enc_jcc || len < 2 || len > sizeof(base) || !suffix_size(cond[len - 1])) return NULL;
+        memcpy(base, cond, len - 1);
+        base[len - 1] = '\0';
+        if ((*cc = cond_code(base)) < 0) return NULL;
+        *suffix = suffix_size(cond[len - 1]);
+        return def;
     }
+    return NULL;
+}
 
-    return size;
+// The mnemonic as written, a condition-code family, or without an AT&T
+// b/w/l/q size suffix. Exact names win, so sub, shl or cltq are never taken
+// apart.
+static const InsnDef *lookup_insn(const char *opcode, int *suffix, int *cc) {
+    *suffix = 0;
+    *cc = 0;
+    const InsnDef *def = find_insn(opcode);
+    if (def) return def;
+    if ((def = lookup_cond(opcode, suffix, cc))) return def;
+
+    size_t len = strlen(opcode);
+    char base[32];
+    if (len < 2 || len >= sizeof(base) || !suffix_size(opcode[len - 1])) return NULL;
+    memcpy(base, opcode, len - 1);
+    base[len - 1] = '\0';
+    def = find_insn(base);
+    if (def) *suffix = suffix_size(opcode[len - 1]);
+    return def;
 }
 
-size_t encode_cmp_imm_reg(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
 
-    int sz = reg_size(dst->reg);
+// -------------------- RIP-relative operands --------------------
+// The displacement counts from the end of the instruction, so it is filled in
+// after encoding, when the length (including any immediate) is known. Targets
+// in other sections of an object file become PC32 relocations.
+
+// sym@GOTPCREL: like gas's -mrelax-relocations=yes, the loads the linker can
+// rewrite into lea or a direct call/jmp when sym turns out to be local get
+// the relaxable GOTPCRELX types (REX_ for REX-prefixed mov/test/ALU).
+static uint32_t gotpcrel_type(void) {
+    if (rip_opcode == 0xFF && (rip_reg == 2 || rip_reg == 4))
+        return R_X86_64_GOTPCRELX;
+    // mov, test, and the add/or/adc/sbb/and/sub/xor/cmp load forms
+    if (rip_opcode == 0x8B || rip_opcode == 0x85 || (rip_opcode <= 0xFF && (rip_opcode & 0xC7) == 0x03))
+        return rip_rex ? R_X86_64_REX_GOTPCRELX : R_X86_64_GOTPCRELX;
+    return R_X86_64_GOTPCREL;
+}
 
-    int rm = reg_code(dst->reg);
+static bool resolve_rip(uint8_t *out, size_t pos, size_t len, LabelTable *label_table) {
+    MemOperand *m = &rip_ref;
+    Label *l = lookup_label(label_table, m->sym);
+    if (!l) {
+        fprintf(stderr, "Label not found: %s\n", m->sym);
+        return false;
+    }
 
-    bool rex_w = (sz == 64);
-    bool rex_b = (rm & 8) != 0;
+    size_t field = rip_disp - out;
+    int64_t addend = m->disp - (int64_t)(len - field);
 
-    if (rm > 7) rm -= 8;
-    
-    // force REX for new 8-bit registers
-    bool needs_rex = rex_w || rex_b ||
-    !strcmp(dst->reg, "%sil") || !strcmp(dst->reg, "%dil") || !strcmp(dst->reg, "%bpl") || !strcmp(dst->reg, "%spl");
-    
-    if (rm == 0) {
-        switch(sz) {
-            case 8:
-                *out++ = 0x3c;
-                *out++ = src->imm;
-                size += 2;
-                break;
-            case 16:
-                *out++ = 0x66;
-                *out++ = 0x3d;
-                *((uint16_t*)out) = (uint16_t)src->imm;
-                out += 2;
-                size += 4;
-                break;
-            case 64:
-                if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-                // FALLTHRU
-            case 32:
-                *out++ = 0x3d;
-                *((uint32_t*)out) = (uint32_t)src->imm;
-                out += 4;
-                size += 6;
-                break;
+    if (m->symmod == SYM_GOTPCREL) {
+        if (args->outformat != OF_ELF) {
+            fprintf(stderr, "%s@GOTPCREL needs ELF output\n", m->sym);
+            return false;
         }
-        return size;
+        emit_imm(rip_disp, 0, 4);
+        if (stage == STAGE2)
+            emit_reloc(&G_relocs, l, pos + field, cur_section, gotpcrel_type(), addend);
+        return true;
     }
 
-    switch (sz) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x80;
-            *out++ = (0b11 << 6) | (7 << 3) | (rm & 7);
-            *out++ = src->imm;
-            size += 3;
-            break;
-        case 16:
-            *out++ = 0x66;
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x81;
-            *out++ = (0b11 << 6) | (7 << 3) | (rm & 7);
-            *((uint16_t*)out) = (uint16_t)src->imm;
-            out += 2;
-            size += 5;
-            break;
-        case 32:
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-            *out++ = 0x81;
-            *out++ = (0b11 << 6) | (7 << 3) | (rm & 7);
-            *((uint32_t*)out) = (uint32_t)src->imm;
-            out += 4;
-            size += 7;
-            break;
-
+    if (args->outformat == OF_ELF && l->section != cur_section) {
+        emit_imm(rip_disp, 0, 4);
+        if (stage == STAGE2)
+            emit_reloc(&G_relocs, l, pos + field, cur_section, R_X86_64_PC32, addend);
+        return true;
     }
 
-    return size;
+    int64_t disp = (int64_t)l->address + m->disp - (int64_t)(pos + len);
+    if (disp < INT32_MIN || disp > INT32_MAX) {
+        fprintf(stderr, "%s out of range of %%rip\n", m->sym);
+        return false;
+    }
+    emit_imm(rip_disp, disp, 4);
+    return true;
 }
 
-size_t encode_cmp_imm_mem(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
+static size_t encode_insn(uint8_t *out, Instruction *inst, size_t pos, LabelTable *label_table);
 
-    
-    int mem_reg_sz = reg_size(dst->mem.base);
-    
-    int mem_size = dst->mem.size;
-
-    if (!mem_size) {
-        fprintf(stderr, "Invalid memory size: %d\n", mem_size);
-        return 0;
-    }
-    
-    int rm = reg_code(dst->mem.base);
-    
-    bool rex_w = (mem_size == 64);
-    bool rex_b = (rm & 8) != 0;
-    
-    if (rm > 7) rm -= 8;
-    
-    // force REX for new 8-bit registers
-    bool needs_rex = rex_w || rex_b;
-    if (mem_reg_sz == 32) {
-        *out++ = 0x67;
-        size++;
-    }
-    
-    switch (mem_size) {
-        case 8:
-        if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-        *out++ = 0x80;
-        *out++ = (7 << 3) | (rm & 7);
-        *out++ = src->imm;
-        size += 3;
-        break;
-        case 16:
-        *out++ = 0x66;
-        if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-        *out++ = 0x81;
-        *out++ = (7 << 3) | (rm & 7);
-        *((uint16_t*)out) = (uint16_t)src->imm;
-        out += 2;
-        size += 5;
-        break;
-        case 32:
-        case 64:
-        if (needs_rex) {emit_rex(&out, rex_w, 0, rex_b, 0); size++;}
-        *out++ = 0x81;
-        *out++ = (7 << 3) | (rm & 7);
-        *((uint32_t*)out) = (uint32_t)src->imm;
-        out += 4;
-        size += 7;
-        break;
+// -------------------- Encode instruction --------------------
+// Segment override of the memory operand. Like gas, an override naming the
+// default segment (%ss with a %rbp/%rsp base, %ds otherwise) is left out.
+static uint8_t segment_prefix(Instruction *inst) {
+    static const struct { const char *name; uint8_t prefix; } segs[] = {
+        {"%es", 0x26}, {"%cs", 0x2E}, {"%ss", 0x36}, {"%ds", 0x3E}, {"%fs", 0x64}, {"%gs", 0x65},
+    };
+    for (size_t i = 0; i < inst->noperands; i++) {
+        MemOperand *m = &inst->operands[i]->mem;
+        if (inst->operands[i]->kind != OP_MEM || !m->seg) continue;
+        int base = m->base && !is_rip(m) ? reg_code(m->base) : -1;
+        uint8_t dflt = base == 4 || base == 5 ? 0x36 : 0x3E;
+        for (size_t j = 0; j < sizeof(segs) / sizeof(segs[0]); j++)
+            if (!strcmp(segs[j].name, m->seg)) return segs[j].prefix == dflt ? 0 : segs[j].prefix;
     }
-    
-    return size;
+    return 0;
 }
 
-static size_t encode_cmp_reg_mem(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
+size_t encode_instruction(uint8_t *out, Instruction *inst, __attribute__((unused)) Program *prog, size_t pos, LabelTable *label_table) {
+    if (!inst) return 0;
 
-    int mem_reg_sz = reg_size(dst->mem.base);
+    // the segment override goes in front of every other prefix, even VEX/EVEX
+    uint8_t seg = segment_prefix(inst);
+    if (seg) {
+        *out++ = seg;
+        pos++;
+    }
 
-    int mem_size = reg_size(src->reg);
+    rip_disp = NULL;
+    size_t len = encode_insn(out, inst, pos, label_table);
+    if (len && rip_disp && label_table && !resolve_rip(out, pos, len, label_table))
+        return 0;
+    return len ? len + (seg != 0) : 0;
+}
 
-    if (mem_reg_sz == 32) {
-        *out++ = 0x67;
-        size++;
+static size_t encode_insn(uint8_t *out, Instruction *inst, size_t pos, LabelTable *label_table) {
+    int suffix, cc;
+    const InsnDef *def = lookup_insn(inst->opcode, &suffix, &cc);
+    // without operands movsd and cmpsd are the string instructions movsl and cmpsl
+    if (def && !inst->noperands && (!strcmp(inst->opcode, "movsd") || !strcmp(inst->opcode, "cmpsd"))) {
+        def = find_insn(inst->opcode[0] == 'm' ? "movs" : "cmps");
+        suffix = 32;
     }
+    if (def) {
+        InsnCtx c = {inst, def, suffix, pos, label_table, cc};
+        insn_isa = def->isa;
+        if (has_evex_decorations(inst) && !find_evex(def->name)) {
+            fprintf(stderr, "%s does not take AVX-512 masking, broadcast or rounding\n", inst->opcode);
+            return 0;
+        }
+        if (!inst->prefixes) return def->encode(out, &c);
 
-    int mod = reg_code(src->reg);
-    int rm = reg_code(dst->mem.base);
-
-    bool rex_w = (mem_size == 64);
-    bool rex_b = (rm & 8) != 0;
-    bool rex_r = (mod & 8) != 0;
+        if ((inst->prefixes & PREFIX_LOCK) && !lock_allowed(&c)) {
+            fprintf(stderr, "lock not allowed on %s%s\n", inst->opcode, def->lock ? " without a memory destination" : "");
+            return 0;
+        }
+        if ((inst->prefixes & (PREFIX_REP | PREFIX_REPNE)) && !rep_allowed(&c)) {
+            fprintf(stderr, "%s not allowed on %s\n", inst->prefixes & PREFIX_REP ? "rep" : "repne", inst->opcode);
+            return 0;
+        }
+        size_t len = def->encode(out + 1, &c);
+        if (!len) return 0;
 
-    bool high = (src->reg[strlen(src->reg)-1] == 'h');
+        // lock and rep go after the 67/66 prefixes, where gas puts them
+        size_t i = 1;
+        for (; out[i] == 0x67 || out[i] == 0x66; i++) out[i - 1] = out[i];
+        out[i - 1] = inst->prefixes & PREFIX_LOCK ? 0xF0 : inst->prefixes & PREFIX_REP ? 0xF3 : 0xF2;
+        return len + 1;
+    }
 
+    fprintf(stderr, "Unsupported: %s\n", inst->opcode);
+    return 0;
+}
 
-    bool needs_sib = check_need_sib(rm);
+size_t calculate_instruction_size(Instruction *inst) {
+    if (!inst) return 0;
 
+    uint8_t out[32] = {0};
+    size_t len = encode_instruction(out, inst, NULL, 0, NULL);
 
-    bool needs_rex = rex_w || rex_b || rex_r ||
-        !strcmp(src->reg, "%sil") || !strcmp(src->reg, "%dil") || !strcmp(src->reg, "%bpl") || !strcmp(src->reg, "%spl");
+    return len;
+}
 
-    if (high && needs_rex) {
-        fprintf(stderr, "High register not supported with REX prefix\n");
-        exit(1);
+// -------------------- Padding --------------------
+
+// Longer NOPs need more than three prefixes, which several decoders handle
+// slowly, so bigger gaps are filled with a run of NOPs of at most this size.
+#define NOP_MAX_LEN 11
+
+// One NOP of exactly len bytes (1..15): the recommended 0F 1F /0 forms,
+// lengthened with 66 prefixes and a CS override beyond 9 bytes.
+static void emit_nop(uint8_t *out, size_t len) {
+    static const uint8_t nops[9][9] = {
+        {0x90},
+        {0x66, 0x90},
+        {0x0F, 0x1F, 0x00},
+        {0x0F, 0x1F, 0x40, 0x00},
+        {0x0F, 0x1F, 0x44, 0x00, 0x00},
+        {0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00},
+        {0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00},
+        {0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+    };
+
+    if (len <= 9) {
+        memcpy(out, nops[len - 1], len);
+        return;
     }
+    memset(out, 0x66, len - 9);
+    out += len - 9;
+    *out++ = 0x2E;
+    memcpy(out, nops[7], 8);
+}
 
-    if (mod > 7) mod -= 8;
-    if (rm > 7) rm -= 8;
-
-
-    if (rm == 0b101) {
-        // modrm would give rip as base
-        switch (mem_size) {
-            case 8:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x38;
-                *out++ = (0b01 << 6) | (mod << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-            case 16:
-                *out++ = 0x66;
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x39;
-                *out++ = (0b01 << 6) | (mod << 3) | 5;
-                *out++ = 0x00;
-                size += 4;
-                break;
-            case 32:
-            case 64:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x39;
-                *out++ = (0b01 << 6) | (mod << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-        }
-        return size;
+// fill < 0 means "default": NOPs in code, zeros in data
+static void emit_padding(uint8_t *out, size_t len, bool code, int fill) {
+    if (fill >= 0 || !code) {
+        memset(out, fill < 0 ? 0 : fill, len);
+        return;
+    }
+    while (len) {
+        size_t n = len < NOP_MAX_LEN ? len : NOP_MAX_LEN;
+        emit_nop(out, n);
+        out += n;
+        len -= n;
     }
+}
 
+// -------------------- Directives --------------------
 
+static const char *dir_arg(Directive *d, size_t i) {
+    if (i >= d->nargs || !d->args[i] || !d->args[i][0]) return NULL;
+    return d->args[i];
+}
 
-    switch (mem_size) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x38;
-            *out++ = (mod << 3) | rm;
-            size += 2;
-            break;
-        case 16:
-            *out++ = 0x66;
-            size++;
-            // FALLTHRU
-        case 32:
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x39;
-            *out++ = (mod << 3) | rm;
-            // if (needs_sib) {emit_sib(&out, 0, 0b100, reg_code(dst->mem.base)); size++;}
-            size += 2;
-            break;
+static bool is_align_directive(const char *name) {
+    return !strcmp(name, ".align") || !strcmp(name, ".balign") || !strcmp(name, ".p2align");
+}
 
+// .align/.balign N[, fill[, max]] and .p2align P[, fill[, max]]
+static bool parse_align(Directive *d, uint32_t *align, int *fill, uint32_t *max) {
+    const char *a = dir_arg(d, 0);
+    if (!a) {
+        fprintf(stderr, "%s: missing alignment\n", d->name);
+        return false;
     }
-
-
-    if (needs_sib) {
-        emit_sib(&out, 0, 0b100, reg_code(dst->mem.base));
-        size++;
+    unsigned long v = strtoul(a, NULL, 0);
+    if (!strcmp(d->name, ".p2align")) {
+        if (v > 31) {
+            fprintf(stderr, "%s: alignment too large: %lu\n", d->name, v);
+            return false;
+        }
+        v = 1ul << v;
+    }
+    if (v == 0) v = 1;
+    if (v & (v - 1)) {
+        fprintf(stderr, "%s: alignment not a power of 2: %lu\n", d->name, v);
+        return false;
     }
+    *align = v;
+    *fill = dir_arg(d, 1) ? (int)(strtol(dir_arg(d, 1), NULL, 0) & 0xFF) : -1;
+    *max = dir_arg(d, 2) ? strtoul(dir_arg(d, 2), NULL, 0) : 0;
+    return true;
+}
 
+// Padding a directive inserts in front of itself when it lands at off.
+static uint32_t directive_pad(Directive *d, uint32_t off) {
+    if (is_align_directive(d->name)) {
+        uint32_t align, max;
+        int fill;
+        if (!parse_align(d, &align, &fill, &max)) return 0;
+        uint32_t pad = (align - off % align) % align;
+        if (max && pad > max) pad = 0;
+        return pad;
+    }
+    if (!strcmp(d->name, ".org")) {
+        if (!dir_arg(d, 0)) return 0;
+        uint32_t addr = strtoul(dir_arg(d, 0), NULL, 0);
+        if (addr < off) {
+            fprintf(stderr, ".org: cannot move location counter backwards (%#x < %#x)\n", addr, off);
+            return 0;
+        }
+        return addr - off;
+    }
+    return 0;
+}
 
-    return size;
+static int directive_fill(Directive *d) {
+    if (is_align_directive(d->name)) {
+        uint32_t align, max;
+        int fill;
+        if (parse_align(d, &align, &fill, &max)) return fill;
+    }
+    if (!strcmp(d->name, ".org"))
+        return dir_arg(d, 1) ? (int)(strtol(dir_arg(d, 1), NULL, 0) & 0xFF) : 0;
+    return -1;
 }
 
-size_t encode_cmp_mem_reg(uint8_t *out, Operand* dst, Operand* src) {
-    size_t size = 0;
-    int sz = reg_size(dst->reg);
+static uint64_t dir_num(Directive *d, size_t i, uint64_t def) {
+    const char *a = dir_arg(d, i);
+    return a ? strtoull(a, NULL, 0) : def;
+}
 
+// .zero N, .skip/.space N[, FILL], .fill REPEAT[, SIZE[, VALUE]]
+static bool is_fill_directive(const char *name) {
+    return !strcmp(name, ".zero") || !strcmp(name, ".skip") || !strcmp(name, ".space") || !strcmp(name, ".fill");
+}
 
-    int mem_sz = reg_size(src->mem.base);
+// The fill is recorded as a count and a pattern; zero fills are never
+// written since section buffers start zeroed.
+static size_t fill_directive(uint8_t *out, Directive *d, bool *zero) {
+    uint64_t count, size = 1, value;
+    if (!strcmp(d->name, ".fill")) {
+        count = dir_num(d, 0, 0);
+        size = dir_num(d, 1, 1);
+        value = dir_num(d, 2, 0);
+        if (size > 8) {
+            fprintf(stderr, ".fill: size %lu truncated to 8\n", (unsigned long)size);
+            size = 8;
+        }
+    } else {
+        count = dir_num(d, 0, 0);
+        value = strcmp(d->name, ".zero") ? dir_num(d, 1, 0) & 0xFF : 0;
+    }
+    if (zero) *zero = value == 0;
+
+    if (out && value) {
+        if (size == 1) {
+            memset(out, (int)value, count);
+        } else {
+            for (uint64_t i = 0; i < count; i++)
+                for (uint64_t b = 0; b < size; b++) out[i * size + b] = b < 4 ? (uint8_t)(value >> (8 * b)) : 0;
+        }
+    }
+    return count * size;
+}
 
-    
-    int rm = reg_code(src->mem.base);
-    int reg = reg_code(dst->reg);
+// -------------------- Data directives --------------------
 
-    bool needs_sib = check_need_sib(rm);
+typedef enum { DATA_INT, DATA_STRING, DATA_ULEB, DATA_SLEB } DataKind;
 
-    bool rex_w = (sz == 64);
-    bool rex_b = (rm & 8) != 0;
-    bool rex_r = (reg & 8) != 0;
+static const struct {
+    const char *name;
+    DataKind kind;
+    uint8_t size;       // integer width, or 1 for a NUL-terminated string
+} data_directives[] = {
+    {".byte", DATA_INT, 1},
+    {".word", DATA_INT, 2}, {".short", DATA_INT, 2}, {".hword", DATA_INT, 2}, {".value", DATA_INT, 2},
+    {".long", DATA_INT, 4}, {".int", DATA_INT, 4},
+    {".quad", DATA_INT, 8},
+    {".octa", DATA_INT, 16},
+    {".ascii", DATA_STRING, 0}, {".asciz", DATA_STRING, 1}, {".string", DATA_STRING, 1},
+    {".uleb128", DATA_ULEB, 0}, {".sleb128", DATA_SLEB, 0},
+};
 
+static int data_directive(const char *name) {
+    for (size_t i = 0; i < sizeof(data_directives) / sizeof(data_directives[0]); i++)
+        if (!strcmp(name, data_directives[i].name)) return i;
+    return -1;
+}
 
+bool is_data_directive(const char *name) {
+    return data_directive(name) >= 0;
+}
 
-    bool needs_rex = rex_w || rex_b || rex_r ||
-        !strcmp(dst->reg, "%sil") || !strcmp(dst->reg, "%dil") || !strcmp(dst->reg, "%bpl") || !strcmp(dst->reg, "%spl");
+// Next comma-separated operand of raw directive text, trimmed; strings
+// keep their quotes. Returns false at the end.
+static bool next_operand(const char **p, const char **start, size_t *len) {
+    const char *s = *p;
+    if (!s) return false;
+    while (isspace((unsigned char)*s)) s++;
+
+    const char *b = s;
+    bool quoted = false;
+    for (; *s && (quoted || *s != ','); s++) {
+        if (quoted && *s == '\\' && s[1]) s++;
+        else if (*s == '"') quoted = !quoted;
+    }
+    const char *e = s;
+    while (e > b && isspace((unsigned char)e[-1])) e--;
 
+    *start = b;
+    *len = e - b;
+    *p = *s ? s + 1 : NULL;
+    return true;
+}
 
-    if (mem_sz == 32) {
-        *out++ = 0x67;
-        size++;
+typedef unsigned __int128 u128;
+
+// Integer literal: decimal, 0x hex, 0b binary, 0 octal or 'c', with an
+// optional sign. Returns false for anything else (a symbol).
+static bool parse_int(const char *s, u128 *out) {
+    bool neg = false;
+    for (; *s == '-' || *s == '+'; s++) neg ^= *s == '-';
+
+    u128 v = 0;
+    if (s[0] == '\'' && s[1]) {
+        v = (unsigned char)s[1];
+    } else {
+        unsigned base = 10;
+        if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) { base = 16; s += 2; }
+        else if (s[0] == '0' && (s[1] == 'b' || s[1] == 'B')) { base = 2; s += 2; }
+        else if (s[0] == '0' && s[1]) { base = 8; s++; }
+        if (!*s) return false;
+
+        for (; *s; s++) {
+            unsigned d;
+            if (isdigit((unsigned char)*s)) d = *s - '0';
+            else if (isxdigit((unsigned char)*s)) d = tolower((unsigned char)*s) - 'a' + 10;
+            else return false;
+            if (d >= base) return false;
+            v = v * base + d;
+        }
     }
+    *out = neg ? -v : v;
+    return true;
+}
 
-    if (rm > 7) rm -= 8;
-    if (reg > 7) reg -= 8;
+// SYM, SYM+N or SYM-N
+static bool parse_symref(const char *s, char **name, int64_t *addend) {
+    if (!isalpha((unsigned char)*s) && *s != '_' && *s != '.') return false;
+    const char *end = s;
+    while (isalnum((unsigned char)*end) || *end == '_' || *end == '.' || *end == '$') end++;
+
+    const char *p = end;
+    while (isspace((unsigned char)*p)) p++;
+    *addend = 0;
+    if (*p == '+' || *p == '-') {
+        bool neg = *p++ == '-';
+        while (isspace((unsigned char)*p)) p++;
+        u128 v;
+        if (!parse_int(p, &v)) return false;
+        *addend = neg ? -(int64_t)v : (int64_t)v;
+    } else if (*p) {
+        return false;
+    }
+    *name = strndup(s, end - s);
+    return true;
+}
 
-    if (rm == 0b101) {
-        // modrm would give rip as base
-        switch (sz) {
-            case 8:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x3A;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
-                break;
-            case 16:
-                *out++ = 0x66;
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x3B;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 4;
+// Decode a quoted string literal into out; returns the length or -1.
+static long decode_string(const char *s, uint8_t *out) {
+    if (*s++ != '"') return -1;
+    long n = 0;
+    while (*s && *s != '"') {
+        if (*s != '\\') { out[n++] = *s++; continue; }
+        s++;
+        switch (*s) {
+            case 'n': out[n++] = '\n'; s++; break;
+            case 't': out[n++] = '\t'; s++; break;
+            case 'r': out[n++] = '\r'; s++; break;
+            case 'b': out[n++] = '\b'; s++; break;
+            case 'f': out[n++] = '\f'; s++; break;
+            case 'v': out[n++] = '\v'; s++; break;
+            case 'x': {
+                unsigned v = 0;
+                for (s++; isxdigit((unsigned char)*s); s++)
+                    v = v * 16 + (isdigit((unsigned char)*s) ? *s - '0' : tolower((unsigned char)*s) - 'a' + 10);
+                out[n++] = v;
                 break;
-            case 32:
-            case 64:
-                if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-                *out++ = 0x3B;
-                *out++ = (0b01 << 6) | (reg << 3) | 5;
-                *out++ = 0x00;
-                size += 3;
+            }
+            default:
+                if (*s >= '0' && *s <= '7') {
+                    unsigned v = 0;
+                    for (int k = 0; k < 3 && *s >= '0' && *s <= '7'; k++, s++) v = v * 8 + (*s - '0');
+                    out[n++] = v;
+                } else if (*s) {
+                    out[n++] = *s++;
+                }
                 break;
         }
-        return size;
     }
+    return *s == '"' ? n : -1;
+}
 
+static void add_fixup(Directive *d, size_t offset, uint8_t size, char *label, int64_t addend) {
+    d->fixups = realloc(d->fixups, (d->nfixups + 1) * sizeof(DataFixup));
+    if (!d->fixups) { perror("realloc"); exit(1); }
+    d->fixups[d->nfixups++] = (DataFixup){offset, size, label, addend};
+}
 
+// Parse the operand text of a data directive straight into little-endian
+// bytes. The buffer is sized up front from the operand count, so even
+// multi-megabyte tables are one pass with no per-element allocation.
+static void build_data(Directive *d) {
+    int k = data_directive(d->name);
+    DataKind kind = data_directives[k].kind;
+    uint8_t size = data_directives[k].size;
+    const char *raw = d->raw ? d->raw : "";
+
+    size_t count = 0, rawlen = strlen(raw);
+    const char *p = *raw ? raw : NULL, *start;
+    size_t alen;
+    for (const char *q = p; next_operand(&q, &start, &alen);) count++;
+
+    size_t cap;
+    if (kind == DATA_INT) cap = count * size;
+    else if (kind == DATA_STRING) cap = rawlen + count * size;
+    else cap = count * 19;      // a 128-bit LEB128 is at most 19 bytes
+
+    uint8_t *out = malloc(cap ? cap : 1);
+    if (!out) { perror("malloc"); exit(1); }
+    size_t len = 0;
+
+    while (next_operand(&p, &start, &alen)) {
+        char a[256];
+        if (kind != DATA_STRING) {
+            if (alen >= sizeof(a)) alen = sizeof(a) - 1;
+            memcpy(a, start, alen);
+            a[alen] = '\0';
+        }
 
-    switch (sz) {
-        case 8:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x3A;
-            *out++ = (reg << 3) | rm;
-            size += 2;
-            break;
-        case 16:
-            *out++ = 0x66;
-            /* FALLTHRU */
-        case 32:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x3B;
-            *out++ = (reg << 3) | rm;
-            size += 3;
-            break;
-        case 64:
-            if (needs_rex) {emit_rex(&out, rex_w, rex_r, rex_b, 0); size++;}
-            *out++ = 0x3B;
-            *out++ = (reg << 3) | rm;
-            size += 2;
-            break;
-    }
-    
-    if (needs_sib) {
-        emit_sib(&out, 0, 0b100, reg_code(src->mem.base));
-        size++;
+        if (kind == DATA_STRING) {
+            long n = decode_string(start, out + len);
+            if (n < 0) {
+                fprintf(stderr, "%s: expected string, got %.*s\n", d->name, (int)alen, start);
+                exit(1);
+            }
+            len += n;
+            if (size) out[len++] = 0;
+            continue;
+        }
+
+        u128 v;
+        if (!parse_int(a, &v)) {
+            char *label;
+            int64_t addend;
+            if (kind != DATA_INT || (size != 1 && size != 2 && size != 4 && size != 8) || !parse_symref(a, &label, &addend)) {
+                fprintf(stderr, "%s: bad operand %s\n", d->name, a);
+                exit(1);
+            }
+            add_fixup(d, len, size, label, addend);
+            v = 0;
+        }
+
+        if (kind == DATA_INT) {
+            if (size < 16) {
+                __int128 sv = (__int128)v;
+                __int128 max = ((__int128)1 << (8 * size)) - 1, min = -((__int128)1 << (8 * size - 1));
+                if (sv > max || sv < min)
+                    fprintf(stderr, "%s: value %s truncated to %u byte%s\n", d->name, a, size, size == 1 ? "" : "s");
+            }
+            memcpy(out + len, &v, size);    // host and target are both little-endian
+            len += size;
+        } else if (kind == DATA_ULEB) {
+            do {
+                uint8_t b = v & 0x7F;
+                v >>= 7;
+                out[len++] = b | (v ? 0x80 : 0);
+            } while (v);
+        } else {
+            __int128 sv = (__int128)v;
+            bool more = true;
+            while (more) {
+                uint8_t b = sv & 0x7F;
+                sv >>= 7;
+                more = !((sv == 0 && !(b & 0x40)) || (sv == -1 && (b & 0x40)));
+                out[len++] = b | (more ? 0x80 : 0);
+            }
+        }
     }
 
-    return size;
+    d->data = out;
+    d->len = len;
+    d->built = true;
 }
 
+// Patch or relocate the symbol references of a placed data directive.
+static void resolve_data_fixups(Directive *d, uint8_t *out, size_t pos, LabelTable *label_table, int line) {
+    for (size_t i = 0; i < d->nfixups; i++) {
+        DataFixup *f = &d->fixups[i];
+        Label *l = lookup_label(label_table, f->label);
+        if (!l) {
+            fprintf(stderr, "line %d: undefined symbol %s\n", line, f->label);
+            exit(1);
+        }
 
-// jmp
-
-static size_t encode_rel_jmps(uint8_t *out, Operand* dst, size_t pos, LabelTable *label_table, uint8_t opcode, bool opcode16) {
-    // im only supporting 32 bit rel jmps
+        if (args->outformat == OF_ELF) {
+            uint32_t type = f->size == 8 ? R_X86_64_64 : f->size == 4 ? R_X86_64_32 : f->size == 2 ? R_X86_64_16 : R_X86_64_8;
+            emit_reloc(&G_relocs, l, pos + f->offset, cur_section, type, f->addend);
+        } else {
+            uint64_t v = l->address + f->addend;
+            memcpy(out + f->offset, &v, f->size);
+        }
+    }
+}
 
-    size_t size = 0;
+// .incbin "FILE"[, SKIP[, COUNT]]: only the size is taken here; the file
+// stays open and the writers copy the payload straight into the output.
+static size_t incbin_directive(Directive *d) {
+    if (d->built) return d->len;
 
-    if (!label_table) {
-        return 5;
+    const char *arg = dir_arg(d, 0);
+    char path[4096];
+    long n = arg && strlen(arg) < sizeof(path) ? decode_string(arg, (uint8_t *)path) : -1;
+    if (n < 0) {
+        fprintf(stderr, ".incbin: expected a quoted file name\n");
+        exit(1);
     }
-    
-    Label* l = NULL;
-    
-    
-
-    for (l = label_table->entries; l < label_table->entries + label_table->count; l++) {
-        if (strcmp(l->name, dst->labelref) == 0)
-            break;
+    path[n] = '\0';
+
+    // relative names are tried from the current directory, then next to the source
+    int fd = open(path, O_RDONLY);
+    const char *slash = strrchr(args->inname, '/');
+    if (fd < 0 && path[0] != '/' && slash) {
+        char alt[8192];
+        snprintf(alt, sizeof(alt), "%.*s/%s", (int)(slash - args->inname), args->inname, path);
+        fd = open(alt, O_RDONLY);
     }
-
-    
-    if (!l) {
-        fprintf(stderr, "Label not found: %s\n", dst->labelref);
-        return 0;
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        perror(path);
+        exit(1);
     }
-    
 
+    uint64_t skip = dir_num(d, 1, 0);
+    if (skip > (uint64_t)st.st_size) {
+        fprintf(stderr, ".incbin %s: skip %lu is past the end of the file\n", path, (unsigned long)skip);
+        exit(1);
+    }
+    uint64_t count = dir_num(d, 2, st.st_size - skip);
+    if (count > st.st_size - skip) {
+        fprintf(stderr, ".incbin %s: count truncated to %lu\n", path, (unsigned long)(st.st_size - skip));
+        count = st.st_size - skip;
+    }
 
-    int32_t offset = l->address - pos - (opcode16 ? 6 : 5);
+    d->fd = fd;
+    d->file_off = skip;
+    d->len = count;
+    d->built = true;
+    return count;
+}
 
+// .comm SYM, SIZE[, ALIGN] and .lcomm SYM, SIZE[, ALIGN] reserve storage in .bss
+static bool is_common_directive(const char *name) {
+    return !strcmp(name, ".comm") || !strcmp(name, ".lcomm");
+}
 
-    if (opcode16) {
-        *out++ = 0x0F;
-        size++;
+// Directives that only reserve zeroed storage, and so are valid in @nobits sections.
+static bool is_zero_directive(Directive *d) {
+    bool zero = false;
+    if (is_fill_directive(d->name)) fill_directive(NULL, d, &zero);
+    if (data_directive(d->name) >= 0) {
+        if (!d->built) build_data(d);
+        zero = !d->nfixups;
+        for (size_t i = 0; zero && i < d->len; i++) zero = !d->data[i];
+        return zero;
     }
-    *out++ = opcode & 0xFF;
-
-    *((int32_t*)out) = (int32_t)offset;
-    out += 4;
-    size += 5;
-
-    return size;
+    return zero || is_align_directive(d->name) || is_common_directive(d->name) || d->nargs == 0;
 }
 
-static size_t encode_abs_jmp_reg(uint8_t *out, Operand* dst) {
-    size_t size = 0;
+// Returns the encoded size; with out == NULL only the size is computed.
+size_t encode_directive(uint8_t* out, Directive* directive) {
+    if (!directive) return 0;
 
-    int reg = reg_code(dst->reg);
+    char* name = directive->name;
 
-    bool rex_b = (reg & 8);
+    if (is_fill_directive(name)) return fill_directive(out, directive, NULL);
+    if (!strcmp(name, ".incbin")) return incbin_directive(directive);
 
-    
-    // force REX for new 8-bit registers
-    bool needs_rex = rex_b;
-    
-    if (reg > 7) reg -= 8;
-    if (needs_rex) {
-        emit_rex(&out, 0, 0, rex_b, 0);
-        size++;
+    if (data_directive(name) >= 0) {
+        if (!directive->built) build_data(directive);
+        if (out) memcpy(out, directive->data, directive->len);
+        return directive->len;
     }
 
-    *out++ = 0xFF;
-    *out++ = (0b11 << 6) | (4 << 3) |  (reg);
-
-    size += 2;
-
-    return size;
+    return 0;
 }
 
-static size_t encode_abs_jmp_mem(uint8_t *out, Operand* dst) {
-    size_t size = 0;
+// -------------------- Compute instruction offsets --------------------
 
-    int mem_reg_sz = reg_size(dst->mem.base);
+static uint32_t *section_size;      // indexed by Section, after layout
 
-    int rm = reg_code(dst->mem.base);
+// flat binaries have a single location counter shared by code and data
+static Section counter_of(Section s) {
+    // @nobits sections are not part of the image; they follow it (see layout_pass)
+    return args->outformat == OF_BINARY && !is_nobits_section(s) ? SECTION_CODE : s;
+}
 
-    bool rex_r = (rm & 8);
+static bool is_rel_branch(Instruction *inst) {
+    return inst->opcode[0] == 'j' && inst->noperands == 1 && inst->operands[0]->kind == OP_LABELREF;
+}
 
-    bool needs_rex = rex_r;
+// -------------------- JCC erratum mitigation --------------------
 
-    bool needs_sib = check_need_sib(rm);
+// On Skylake-derived cores a jump, or a macro-fused cmp/test+jcc pair, that
+// crosses or ends on a 32-byte boundary is not cached in the decoded icache.
+// Like gas's -mbranches-within-32B-boundaries this covers jcc, fused pairs
+// and jmp; the padding is NOPs in front of the jump or the fused pair.
+#define BRANCH_BOUNDARY 32
 
+static uint32_t branch_align_moved;
+static uint32_t branch_align_bytes;
 
-    if (mem_reg_sz == 32) {
-        *out++ = 0x67;
-        size++;
-    }
+static bool is_jcc(Instruction *inst) {
+    return inst->opcode[0] == 'j' && cond_code(inst->opcode + 1) >= 0 && inst->noperands == 1;
+}
 
-    if (rm > 7) rm -= 8;
-    if (needs_rex) {
-        emit_rex(&out, 0, 0, rex_r, 0);
-        size++;
-    }
+static bool is_jmp(Instruction *inst) {
+    return !strcmp(inst->opcode, "jmp") || !strcmp(inst->opcode, "jmpq");
+}
 
-    *out++ = 0xFF;
-    if (rm == 0b101) {
-        *out++ = (0b01 << 6) | (4 << 3) | 5;
-        *out++ = 0x00;
-        size += 3;
-        return size;
+// First half of a macro-fusible pair. Forms with both a memory operand and
+// an immediate never fuse.
+static bool is_fusible(Instruction *inst) {
+    char opc[32] = {0};
+    if (strlen(inst->opcode) >= sizeof(opc)) return false;
+    if (inst->prefixes) return false;
+    base_opcode(inst->opcode, opc);
+    if (strcmp(opc, "cmp") && strcmp(opc, "test") && strcmp(opc, "add") && strcmp(opc, "sub") &&
+        strcmp(opc, "and") && strcmp(opc, "inc") && strcmp(opc, "dec"))
+        return false;
+
+    bool mem = false, imm = false;
+    for (size_t i = 0; i < inst->noperands; i++) {
+        mem |= inst->operands[i]->kind == OP_MEM;
+        imm |= inst->operands[i]->kind == OP_IMM;
     }
-    *out++ = (4 << 3) |  (rm);
-
-    size += 2;
+    return !(mem && imm);
+}
 
-    if (needs_sib) {
-        emit_sib(&out, 0, 0b100, rm);
-        size++;
+static Instruction *next_instruction(Program *prog, size_t i) {
+    for (i++; i < prog->nnodes; i++) {
+        Node *n = prog->nodes[i];
+        if (n->kind == NODE_INSTRUCTION) return &n->u.instruction;
+        if (n->kind != NODE_LABEL) return NULL;
     }
-
-    return size;
+    return NULL;
 }
 
-// int
+static Instruction *prev_instruction(Program *prog, size_t i) {
+    while (i-- > 0) {
+        Node *n = prog->nodes[i];
+        if (n->kind == NODE_INSTRUCTION) return &n->u.instruction;
+        if (n->kind != NODE_LABEL) return NULL;
+    }
+    return NULL;
+}
 
-static size_t encode_int(uint8_t *out, Operand* dst) {
-    int imm = dst->imm;
+// Bytes that must stay within one 32-byte window starting at node i, or 0.
+static uint32_t branch_span(Program *prog, size_t i, uint32_t size) {
+    Instruction *inst = &prog->nodes[i]->u.instruction;
 
-    if (imm == 3) {
-        *out++ = 0xCC;
-        return 1;
-    }
-    
-    if (imm == 1) {
-        *out++ = 0xF1;
-        return 1;
+    if (is_jcc(inst)) {
+        // the fused pair was already placed as a whole
+        Instruction *prev = prev_instruction(prog, i);
+        return prev && is_fusible(prev) ? 0 : size;
     }
+    if (is_jmp(inst)) return size;
 
-    if (imm <= 0xFF) {
-        *out++ = 0xCD;
-        *out++ = imm;
-        return 2;
+    if (is_fusible(inst)) {
+        Instruction *next = next_instruction(prog, i);
+        if (next && is_jcc(next)) return size + calculate_instruction_size(next);
     }
     return 0;
 }
 
-// -------------------- Strip suffix --------------------
-static void base_opcode(const char *opc,char *buf){
-    size_t len=strlen(opc);
-    strcpy(buf,opc);
-    if (!strcmp(opc, "sub") || !strcmp(opc, "syscall"))
-        return;
-    if(len>1){
-        char last=opc[len-1];
-        if(last=='b'||last=='w'||last=='l'||last=='q') buf[len-1]=0;
-    }
+static uint32_t branch_pad(uint32_t start, uint32_t span) {
+    uint32_t end = start + span;
+    bool crosses = start / BRANCH_BOUNDARY != (end - 1) / BRANCH_BOUNDARY;
+    bool ends_on = end % BRANCH_BOUNDARY == 0;
+    if (!crosses && !ends_on) return 0;
+    return BRANCH_BOUNDARY - start % BRANCH_BOUNDARY;
 }
 
+// -------------------- Sections and subsections --------------------
 
-// -------------------- Encode instruction --------------------
-size_t encode_instruction(uint8_t *out, Instruction *inst, __attribute__((unused)) Program *prog, size_t pos, LabelTable *label_table) {
-    if (!inst) return 0;
-    char opc[32] = {0}; base_opcode(inst->opcode, opc);
+typedef struct {
+    Node *node;
+    Section counter;
+    int sub;
+    size_t index;
+} SubsectionKey;
+
+static int cmp_subsection(const void *a, const void *b) {
+    const SubsectionKey *x = a, *y = b;
+    if (x->counter != y->counter) return x->counter < y->counter ? -1 : 1;
+    if (x->sub != y->sub) return x->sub < y->sub ? -1 : 1;
+    return x->index < y->index ? -1 : x->index > y->index;
+}
 
-    if (inst->noperands == 2) {
-        Operand *dst = inst->operands[1];
-        Operand *src = inst->operands[0];
+// Resolve the section directives once, giving every node its section and
+// subsection. Subsections are then laid out in numeric order within their
+// section, which only needs a stable sort since each section has its own
+// location counter.
+static void assign_sections(Program *prog) {
+    SectionState st;
+    section_state_init(&st);
+    bool subsections = false;
 
+    // --function-sections: .text and .data content after a global label
+    // goes to .text.<label> / .data.<label> until the next global label
+    Section remap[2] = {SECTION_CODE, SECTION_DATA};
 
-        if (strcmp(opc, "mov") == 0) {
-            printf("mov\n");
-            if (src->kind == OP_REG && dst->kind == OP_REG) return encode_mov_reg_reg(out, dst, src);
-            if (src->kind == OP_IMM && dst->kind == OP_REG) return encode_mov_imm_reg(out, dst, src);
-            if (dst->kind == OP_MEM && src->kind == OP_REG) return encode_mov_reg_mem(out, dst, src);
-            if (dst->kind == OP_REG && src->kind == OP_MEM) return encode_mov_mem_reg(out, dst, src);
-            if (dst->kind == OP_MEM && src->kind == OP_IMM) return encode_mov_mem_imm(out, dst, src, NULL);
-            if (dst->kind == OP_REG && src->kind == OP_LABELREF) return encode_mov_reg_label(out, dst, src, label_table);
-        }
-        if (strcmp(opc, "add") == 0) {
-            printf("add\n");
-            if (src->kind == OP_REG && dst->kind == OP_REG) return encode_add_reg_reg(out, dst, src);
-            if (src->kind == OP_IMM && dst->kind == OP_REG) return encode_add_imm_reg(out, dst, src);
-            if (src->kind == OP_IMM && dst->kind == OP_MEM) return encode_add_imm_mem(out, dst, src);
-            if (src->kind == OP_REG && dst->kind == OP_MEM) return encode_add_reg_mem(out, dst, src);
-            if (src->kind == OP_MEM && dst->kind == OP_REG) return encode_add_mem_reg(out, dst, src);
-        }
-        if (strcmp(opc, "sub") == 0) {
-            printf("sub\n");
-            if (src->kind == OP_REG && dst->kind == OP_REG) return encode_sub_reg_reg(out, dst, src);
-            if (src->kind == OP_IMM && dst->kind == OP_REG) return encode_sub_imm_reg(out, dst, src);
-            if (src->kind == OP_IMM && dst->kind == OP_MEM) return encode_sub_imm_mem(out, dst, src);
-            if (src->kind == OP_REG && dst->kind == OP_MEM) return encode_sub_reg_mem(out, dst, src);
-            if (src->kind == OP_MEM && dst->kind == OP_REG) return encode_sub_mem_reg(out, dst, src);
-        }
-        if (strcmp(opc, "cmp") == 0) {
-            printf("cmp\n");
-            if (src->kind == OP_REG && dst->kind == OP_REG) return encode_cmp_reg_reg(out, dst, src);
-            if (src->kind == OP_IMM && dst->kind == OP_REG) return encode_cmp_imm_reg(out, dst, src);
-            if (src->kind == OP_IMM && dst->kind == OP_MEM) return encode_cmp_imm_mem(out, dst, src);
-            if (src->kind == OP_REG && dst->kind == OP_MEM) return encode_cmp_reg_mem(out, dst, src);
-            if (src->kind == OP_MEM && dst->kind == OP_REG) return encode_cmp_mem_reg(out, dst, src);
+    for (size_t i = 0; i < prog->nnodes; i++) {
+        Node *n = prog->nodes[i];
+        if (n->kind == NODE_DIRECTIVE) section_directive(&n->u.directive, &st);
+
+        Section sec = st.cur.sec;
+        if (args->function_sections && (sec == SECTION_CODE || sec == SECTION_DATA)) {
+            if (n->kind == NODE_LABEL && strncmp(n->u.label, ".L", 2)) {
+                char name[256];
+                snprintf(name, sizeof(name), "%s.%s", sec == SECTION_CODE ? ".text" : ".data", n->u.label);
+                Section fs = section_lookup(name);
+
+                // alignment just before the label belongs to the new section
+                for (size_t k = i; k-- > 0;) {
+                    Node *p = prog->nodes[k];
+                    if (p->kind != NODE_DIRECTIVE || !is_align_directive(p->u.directive.name) ||
+                        p->section != remap[sec]) break;
+                    p->section = fs;
+                }
+                remap[sec] = fs;
+            }
+            sec = remap[sec];
         }
+
+        n->section = sec;
+        n->subsection = st.cur.sub;
+        subsections |= st.cur.sub != 0;
     }
+    if (st.depth)
+        fprintf(stderr, "warning: %zu .pushsection%s without .popsection\n", st.depth, st.depth == 1 ? "" : "s");
+    if (!subsections) return;
 
-    if (inst->noperands == 1) {
-        Operand* op = inst->operands[0];
-        if (strncmp(opc, "jmp", 3) == 0 && inst->noperands == 1) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0xE9, false);
-            if (op->kind == OP_REG) return encode_abs_jmp_reg(out, op);
-            if (op->kind == OP_MEM) return encode_abs_jmp_mem(out, op);
-        }
-        if (!strcmp(opc, "ja") || !strcmp(opc, "jnbe")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x87, true);
-        }
-        if (!strcmp(opc, "jae") || !strcmp(opc, "jnb") || !strcmp(opc, "jnc")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x83, true);
-        }
-        if (!strcmp(opc, "jb") || !strcmp(opc, "jc") || !strcmp(opc, "jnae")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x82, true);
-        }
-        if (!strcmp(opc, "jbe") || !strcmp(opc, "jna")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x86, true);
-        }
-        if (!strcmp(opc, "je") || !strcmp(opc, "jz")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x84, true);
-        }
-        if (!strcmp(opc, "jg") || !strcmp(opc, "jnle")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x8F, true);
-        }
-        if (!strcmp(opc, "jge") || !strcmp(opc, "jnl")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x8D, true);
-        }
-        if (!strcmp(opc, "jl") || !strcmp(opc, "jnge")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x8C, true);
-        }
-        if (!strcmp(opc, "jle") || !strcmp(opc, "jng")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x8E, true);
-        }
-        if (!strcmp(opc, "jno")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x81, true);
-        }
-        if (!strcmp(opc, "jnp") || !strcmp(opc, "jpo")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x8B, true);
-        }
-        if (!strcmp(opc, "jns")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x89, true);
-        }
-        if (!strcmp(opc, "jnz") || !strcmp(opc, "jne")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x85, true);
-        }
-        if (!strcmp(opc, "jo")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x80, true);
-        }
-        if (!strcmp(opc, "jp") || !strcmp(opc, "jpe")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x8A, true);
-        }
-        if (!strcmp(opc, "js")) {
-            if (op->kind == OP_LABELREF) return encode_rel_jmps(out, op, pos, label_table, 0x88, true);
-        }
-        if (!strcmp(opc, "int")) {
-            if (op->kind == OP_IMM) return encode_int(out, op);
-        }
+    SubsectionKey *keys = malloc(prog->nnodes * sizeof(SubsectionKey));
+    if (!keys) { perror("malloc"); exit(1); }
+    for (size_t i = 0; i < prog->nnodes; i++) {
+        Node *n = prog->nodes[i];
+        keys[i] = (SubsectionKey){n, counter_of(n->section), n->subsection, i};
     }
+    qsort(keys, prog->nnodes, sizeof(SubsectionKey), cmp_subsection);
+    for (size_t i = 0; i < prog->nnodes; i++) prog->nodes[i] = keys[i].node;
+    free(keys);
+}
+
+// Offsets and sizes within a section are 32-bit; a .zero, .fill or .incbin
+// that would take the section past 4 GiB is an error, not a silent wrap.
+static void check_section_end(Node *n, Section sec, uint64_t end) {
+    if (end <= UINT32_MAX) return;
+    fprintf(stderr, "line %d: section %s grows past 4 GiB (%llu bytes)\n", n->line,
+        G_sections.entries[sec].name, (unsigned long long)end);
+    exit(1);
+}
+
+// One layout pass with the current branch forms: assigns every node its
+// offset, padding and size, and every label its address.
+static void layout_pass(Program *prog, LabelTable *label_table) {
+    uint32_t *off = calloc(G_sections.count, sizeof(uint32_t));
+    if (!off) { perror("calloc"); exit(1); }
+    size_t li = 0;
 
-    if (inst->noperands == 0) {
-        if (!strcmp(opc, "syscall")) {
-            *out++ = 0x0f;
-            *out++ = 0x05;
-            return 2;
+    branch_align_moved = branch_align_bytes = 0;
+
+    for (size_t i = 0; i < prog->nnodes; i++) {
+        Node *n = prog->nodes[i];
+        Section sec = n->section;
+        Section c = counter_of(sec);
+        n->offset = off[c];
+        n->pad = n->align ? (n->align - off[c] % n->align) % n->align : 0;
+        n->size = 0;
+
+        if (n->kind == NODE_INSTRUCTION) {
+            n->size = calculate_instruction_size(&n->u.instruction);
+
+            uint32_t span = args->branch_align && is_code_section(sec) ? branch_span(prog, i, n->size) : 0;
+            uint32_t pad = span ? branch_pad(off[c] + n->pad, span) : 0;
+            if (pad) {
+                n->pad += pad;
+                branch_align_moved++;
+                branch_align_bytes += pad;
+            }
+        } else if (n->kind == NODE_LABEL) {
+            Label *l = label_table->entries + li++;
+            l->address = n->offset + n->pad;
+            l->section = sec;
+        } else if (n->kind == NODE_DIRECTIVE && is_common_directive(n->u.directive.name)) {
+            Directive *d = &n->u.directive;
+            Label *l = label_table->entries + li++;
+            uint64_t size = dir_num(d, 1, 0);
+            uint32_t align = dir_num(d, 2, 1);
+            Section bc = counter_of(l->section);
+            if (!align || (align & (align - 1))) align = 1;
+
+            off[bc] = (off[bc] + align - 1) & ~(align - 1);
+            check_section_end(n, l->section, (uint64_t)off[bc] + size);
+            l->address = off[bc];
+            off[bc] += size;
+            if (align > G_sections.entries[l->section].align) G_sections.entries[l->section].align = align;
+        } else if (n->kind == NODE_DIRECTIVE) {
+            Directive *d = &n->u.directive;
+            n->pad += directive_pad(d, off[c] + n->pad);
+            size_t size = encode_directive(NULL, d);
+            check_section_end(n, sec, (uint64_t)off[c] + n->pad + size);
+            n->size = size;
+
+            uint32_t align, max;
+            int fill;
+            if (is_align_directive(d->name) && parse_align(d, &align, &fill, &max) && align > G_sections.entries[sec].align)
+                G_sections.entries[sec].align = align;
         }
+        check_section_end(n, sec, (uint64_t)off[c] + n->pad + n->size);
+        off[c] += n->pad + n->size;
     }
 
+    // A flat binary has no @nobits sections; place them after the image
+    // so their labels get the addresses a loader would give them.
+    if (args->outformat == OF_BINARY) {
+        uint32_t end = off[SECTION_CODE];
+        for (Section s = 0; s < (Section)G_sections.count; s++) {
+            if (!is_nobits_section(s)) continue;
+            uint32_t align = G_sections.entries[s].align;
+            uint32_t base = (end + align - 1) & ~(align - 1);
+            for (size_t k = 0; k < label_table->count; k++)
+                if (label_table->entries[k].section == s) label_table->entries[k].address += base;
+            end = base + off[s];
+        }
+    }
 
-    fprintf(stderr, "Unsupported: %s\n", opc);
-    return 0;
+    free(section_size);
+    section_size = off;
 }
 
-size_t calculate_instruction_size(Instruction *inst) {
-    if (!inst) return 0;
+// -------------------- Loop alignment --------------------
 
-    uint8_t out[32] = {0};
-    size_t len = encode_instruction(out, inst, NULL, 0, NULL);
+// Bodies larger than this many alignment windows gain too little from
+// aligning their head to be worth the NOPs executed on loop entry.
+#define LOOP_ALIGN_MAX_WINDOWS 4
 
-    return len;
-}
+typedef struct {
+    size_t head;        // label node at the top of the loop
+    size_t branch;      // last backward branch to it
+} Loop;
 
-size_t encode_directive(uint8_t* out, Directive* directive) {
-    if (!directive) return 0;
+static size_t find_label_node(Program *prog, const char *name) {
+    for (size_t i = 0; i < prog->nnodes; i++) {
+        Node *n = prog->nodes[i];
+        if (n->kind == NODE_LABEL && !strcmp(n->u.label, name)) return i;
+    }
+    return prog->nnodes;
+}
 
-    char* name = directive->name;
+// Labels targeted by a backward jmp/jcc in the same section.
+static Loop *find_loops(Program *prog, size_t *nloops) {
+    Loop *loops = NULL;
+    size_t count = 0;
 
+    for (size_t i = 0; i < prog->nnodes; i++) {
+        Node *n = prog->nodes[i];
+        if (n->kind != NODE_INSTRUCTION || !is_rel_branch(&n->u.instruction)) continue;
 
-    if (!strcmp(name, ".string")) {
-        if (!directive->args[0]) return 0;
-        size_t len = strlen(directive->args[0]);
+        size_t head = find_label_node(prog, n->u.instruction.operands[0]->labelref);
+        if (head >= i || prog->nodes[head]->section != n->section) continue;
 
-        snprintf((char*)out, len+1, directive->args[0]);
-        return len + 1;
-    } if (!strcmp(name, ".data")) {
-        cur_section = SECTION_DATA;
-        return 0;
-    } if (!strcmp(name, ".code")) {
-        cur_section = SECTION_CODE;
-        return 0;
+        size_t k;
+        for (k = 0; k < count && loops[k].head != head; k++);
+        if (k == count) {
+            loops = realloc(loops, (count + 1) * sizeof(Loop));
+            if (!loops) { perror("realloc"); exit(1); }
+            loops[count++].head = head;
+        }
+        loops[k].branch = i;
     }
 
-    return 0;
+    *nloops = count;
+    return loops;
 }
 
+static uint32_t windows_spanned(uint32_t start, uint32_t len, uint32_t window) {
+    return (start % window + len + window - 1) / window;
+}
 
+// Align a loop head once its body is small and the current placement makes
+// it span one more window than it has to. Only the first such loop is taken
+// per pass, since its padding moves everything after it; decisions are
+// sticky so that the layout loop still terminates.
+static bool align_loops(Program *prog, Loop *loops, size_t nloops, uint32_t boundary) {
+    Loop *first = NULL;
+
+    for (size_t k = 0; k < nloops; k++) {
+        Node *head = prog->nodes[loops[k].head];
+        Node *br = prog->nodes[loops[k].branch];
+        if (head->align) continue;
+        if (first && first->head < loops[k].head) continue;
+
+        uint32_t start = head->offset + head->pad;
+        uint32_t body = br->offset + br->pad + br->size - start;
+        if (body > LOOP_ALIGN_MAX_WINDOWS * boundary) continue;
+        if (windows_spanned(start, body, boundary) <= windows_spanned(0, body, boundary)) continue;
+
+        first = &loops[k];
+    }
 
-// -------------------- Compute instruction offsets --------------------
-static LabelTable* compute_offsets(Program *prog) {
-    LabelTable* const label_table = malloc(sizeof(LabelTable));
-    label_table->entries = NULL;
-    label_table->count = 0;
-    label_table->capacity = 0;
+    if (!first) return false;
+    prog->nodes[first->head]->align = boundary;
+    return true;
+}
 
-    size_t code_off = 0;
-    size_t data_off = 0;
+static Label *new_label(LabelTable *label_table, const char *name, Section sec, bool local) {
+    if (label_table->count >= label_table->capacity) {
+        label_table->capacity = label_table->capacity ? label_table->capacity * 2 : 128;
+        label_table->entries = realloc(label_table->entries, label_table->capacity * sizeof(Label));
+        if (!label_table->entries) { perror("realloc"); exit(1); }
+    }
+    Label *l = label_table->entries + label_table->count++;
+    l->name = strdup(name);
+    l->address = 0;
+    l->section = sec;
+    l->local = local;
+    return l;
+}
 
+static void add_reference(LabelTable *label_table, const char *name, size_t *count) {
+    if (!name || lookup_label(label_table, name)) return;
+    new_label(label_table, name, SECTION_UNDEF, false);
+    (*count)++;
+}
 
+// Symbols an object file references without defining are external: they go
+// into the symbol table as undefined and every use becomes a relocation.
+static void add_undefined(Program *prog, LabelTable *label_table) {
+    size_t count = 0;
+    for (size_t i = 0; i < prog->nnodes; i++) {
+        Node *n = prog->nodes[i];
+        if (n->kind == NODE_INSTRUCTION) {
+            Instruction *inst = &n->u.instruction;
+            for (size_t k = 0; k < inst->noperands; k++) {
+                Operand *op = inst->operands[k];
+                if (op->kind == OP_LABELREF) add_reference(label_table, op->labelref, &count);
+                else if (op->kind == OP_MEM) add_reference(label_table, op->mem.sym, &count);
+            }
+        } else if (n->kind == NODE_DIRECTIVE && is_data_directive(n->u.directive.name)) {
+            Directive *d = &n->u.directive;
+            if (!d->built) build_data(d);
+            for (size_t k = 0; k < d->nfixups; k++) add_reference(label_table, d->fixups[k].label, &count);
+        }
+    }
+    if (count && args->verbose)
+        printf("extern: %zu undefined symbol%s\n", count, count == 1 ? "" : "s");
+}
 
+static LabelTable* compute_offsets(Program *prog) {
     if (!prog) return NULL;
 
+    assign_sections(prog);
+    merge_sections(prog);
+
+    LabelTable* const label_table = malloc(sizeof(LabelTable));
+    label_table->entries = NULL;
+    label_table->count = 0;
+    label_table->capacity = 0;
 
-    size_t off = 0;
     for (size_t i = 0; i < prog->nnodes; i++) {
         Node *n = prog->nodes[i];
-        if (n->kind == NODE_INSTRUCTION) {
-            off += calculate_instruction_size(&n->u.instruction);
-            if (cur_section == SECTION_CODE) code_off += off;
-            if (cur_section == SECTION_DATA) data_off += off;
-        } else if (n->kind == NODE_LABEL) {
-            if (label_table->count >= label_table->capacity) {
-                label_table->capacity = label_table->capacity ? label_table->capacity * 2 : 128;
-                label_table->entries = realloc(label_table->entries, label_table->capacity * sizeof(Label));
-                if (!label_table->entries) { perror("realloc"); exit(1); }
+        if (n->kind == NODE_LABEL) {
+            new_label(label_table, n->u.label, SECTION_CODE, strncmp(n->u.label, ".L", 2) == 0);
+        } else if (n->kind == NODE_DIRECTIVE && is_common_directive(n->u.directive.name)) {
+            Directive *d = &n->u.directive;
+            if (!dir_arg(d, 0) || !dir_arg(d, 1)) {
+                fprintf(stderr, "line %d: %s: expected symbol and size\n", n->line, d->name);
+                exit(1);
             }
-            Label *l = label_table->entries + label_table->count++;
-            l->name = strdup(n->u.label);
-            if (cur_section == SECTION_CODE) l->address = code_off;
-            if (cur_section == SECTION_DATA) l->address = data_off;
-            l->section = cur_section;
-        } else if (n->kind == NODE_DIRECTIVE) {
-            printf("Directive: %s\n", n->u.directive.name);
-            if (strcmp(n->u.directive.name, ".data") == 0) {
-                cur_section = SECTION_DATA;
-            } else if (strcmp(n->u.directive.name, ".code") == 0) {
-                cur_section = SECTION_CODE;
-            } else if (!strcmp(n->u.directive.name, ".org")) {
-                if (!n->u.directive.args[0]) continue;
-                uint32_t addr = strtoul(n->u.directive.args[0], NULL, 0);
-                off = addr;
-            } else {
-                uint8_t buf[32] = {0};
-                size_t len = encode_directive(buf, &n->u.directive);
-                printf("string len = %lu\n", len);
-                if (cur_section == SECTION_CODE) code_off += len;
-                if (cur_section == SECTION_DATA) data_off += len;
+            // .comm is allocated like -fno-common: a global definition in .bss
+            new_label(label_table, dir_arg(d, 0), section_lookup(".bss"), !strcmp(d->name, ".lcomm"));
+        } else if (n->kind == NODE_INSTRUCTION) {
+            // start every branch short and only ever grow it, so the loop terminates
+            n->u.instruction.rel8 = is_rel_branch(&n->u.instruction);
+        }
+    }
+
+    if (args->outformat == OF_ELF)
+        add_undefined(prog, label_table);
+
+    Loop *loops = NULL;
+    size_t nloops = 0;
+    if (args->align_loops) {
+        layout_pass(prog, label_table);
+        loops = find_loops(prog, &nloops);
+    }
+
+    // Relax branches to a fixpoint. Padding depends on offsets, so a branch
+    // growing can move alignment points and push other branches out of range.
+    int passes = 0;
+    bool changed;
+    do {
+        layout_pass(prog, label_table);
+        passes++;
+        changed = align_loops(prog, loops, nloops, args->align_loops);
+
+        for (size_t i = 0; i < prog->nnodes; i++) {
+            Node *n = prog->nodes[i];
+            if (n->kind != NODE_INSTRUCTION || !n->u.instruction.rel8) continue;
+
+            Label *l = lookup_label(label_table, n->u.instruction.operands[0]->labelref);
+            int64_t disp = l ? (int64_t)l->address - (int64_t)(n->offset + n->pad + n->size) : 0;
+            if (!l || l->section == SECTION_UNDEF || counter_of(l->section) != counter_of(n->section) || disp < INT8_MIN || disp > INT8_MAX) {
+                n->u.instruction.rel8 = false;
+                changed = true;
             }
         }
+    } while (changed);
+
+    if (args->verbose)
+        printf("layout: %d pass%s\n", passes, passes == 1 ? "" : "es");
+
+    if (args->branch_align)
+        printf("branch-align: %u branch%s moved off 32-byte boundaries, %u bytes of padding\n",
+            branch_align_moved, branch_align_moved == 1 ? "" : "es", branch_align_bytes);
+
+    if (args->align_loops) {
+        size_t aligned = 0;
+        uint32_t cost = 0;
+        for (size_t k = 0; k < nloops; k++) {
+            Node *head = prog->nodes[loops[k].head];
+            if (!head->align) continue;
+            aligned++;
+            cost += head->pad;
+        }
+        printf("align-loops: %zu of %zu loop%s aligned to %u bytes, %u bytes of padding\n",
+            aligned, nloops, nloops == 1 ? "" : "s", args->align_loops, cost);
+        free(loops);
     }
     for (size_t i = 0; i < label_table->count; i++) {
         Label *l = label_table->entries + i;
@@ -2042,6 +4305,26 @@ LabelTable* G_labels = NULL;
 
 
 // -------------------- Assemble program --------------------
+
+// Zero fills at least this large are left as holes rather than written.
+#define ZERO_SPAN_MIN 4096
+
+// Check the instruction just encoded against -march, naming every missing
+// feature
+static bool isa_supported(Node *n) {
+    uint32_t missing = insn_isa & ~args->isa;
+    if (!missing) return true;
+    fprintf(stderr, "line %d: %s needs", n->line, n->u.instruction.opcode);
+    const char *sep = " ";
+    for (size_t i = 0; i < sizeof(isa_names) / sizeof(isa_names[0]); i++) {
+        if (!(missing & isa_names[i].bit)) continue;
+        fprintf(stderr, "%s%s", sep, isa_names[i].name);
+        sep = ", ";
+    }
+    fprintf(stderr, ", not in -march=%s\n", args->march);
+    return false;
+}
+
 struct asm_ret* assemble_program(Program *prog) {
     struct asm_ret* ret = malloc(sizeof(struct asm_ret));
 
@@ -2050,48 +4333,92 @@ struct asm_ret* assemble_program(Program *prog) {
 
     init_reloc_table(&G_relocs);
 
-
-    // FILE* f = fopen("test", "wb");
-    // if (!f) { perror("fopen"); exit(1); }
-
-    uint8_t buf[32] = {0};
     code_pos = malloc(sizeof(size_t));
+    *code_pos = 0;
+
+    ret->nsec = G_sections.count;
+    ret->spans = NULL;
+    ret->nspans = 0;
+    ret->sec = calloc(ret->nsec, sizeof(uint8_t *));
+    ret->sec_size = calloc(ret->nsec, sizeof(size_t));
+    ret->sec_align = calloc(ret->nsec, sizeof(uint32_t));
+    if (!ret->sec || !ret->sec_size || !ret->sec_align) { perror("calloc"); exit(1); }
+
+    for (Section s = 0; s < (Section)ret->nsec; s++) {
+        ret->sec_align[s] = G_sections.entries[s].align;
+        // a flat binary is one image in the code buffer
+        if (counter_of(s) != s) continue;
+        ret->sec_size[s] = section_size[s];
+        if (is_nobits_section(s)) continue;
+        ret->sec[s] = calloc(1, section_size[s] ? section_size[s] : 1);
+        if (!ret->sec[s]) { perror("calloc"); exit(1); }
+        ret->sec_size[s] = section_size[s];
+    }
 
-    size_t* data_pos;
-    data_pos = (args->outformat == OF_BINARY) ? code_pos : malloc(sizeof(size_t));
+    size_t isa_errors = 0, errors = 0;
+    for(size_t i=0;i<prog->nnodes;i++){
+        Node *n=prog->nodes[i];
+        uint8_t *base = ret->sec[counter_of(n->section)];
 
-    *code_pos = *data_pos = 0;
+        cur_section = n->section;
+        *code_pos = n->offset + n->pad;
 
+        if (is_nobits_section(n->section)) {
+            if (n->kind == NODE_INSTRUCTION) {
+                fprintf(stderr, "line %d: instruction in @nobits section %s\n", n->line, G_sections.entries[n->section].name);
+                exit(1);
+            }
+            if (n->kind == NODE_DIRECTIVE && !is_zero_directive(&n->u.directive))
+                fprintf(stderr, "line %d: ignoring %s in @nobits section %s\n", n->line,
+                    n->u.directive.name, G_sections.entries[n->section].name);
+            continue;
+        }
 
-    uint8_t* code = malloc(prog->nnodes * 32);
-    uint8_t* data;
-    data = (args->outformat == OF_BINARY) ? code : malloc(prog->nnodes * 32);
-    ret->code = code;
-    ret->data = data;
+        if (n->pad) {
+            int fill = n->kind == NODE_DIRECTIVE ? directive_fill(&n->u.directive) : -1;
+            emit_padding(base + n->offset, n->pad, is_code_section(n->section), fill);
+        }
 
-    
-    for(size_t i=0;i<prog->nnodes;i++){
-        Node *n=prog->nodes[i];
         if(n->kind == NODE_INSTRUCTION) {
+            uint8_t buf[32] = {0};
             size_t len=encode_instruction(buf,&n->u.instruction,prog,*code_pos,label_table);
-            if(len==0){ fprintf(stderr,"Skipping unsupported: %s\n",n->u.instruction.opcode); continue;}
-            // fwrite(buf, 1, len, f);
-            memcpy(code + *code_pos, buf, len);
-            *code_pos += len;
+            if (len == 0) {
+                fprintf(stderr, "line %d: cannot assemble %s\n", n->line, n->u.instruction.opcode);
+                errors++;
+                continue;
+            }
+            if (args->march && !isa_supported(n)) isa_errors++;
+            if (len != n->size) {
+                // every label after it would be off, so the output is useless
+                fprintf(stderr, "line %d: %s encoded to %zu bytes, layout reserved %u\n",
+                    n->line, n->u.instruction.opcode, len, n->size);
+                exit(1);
+            }
+            memcpy(base + *code_pos, buf, len);
         } else if (n->kind == NODE_DIRECTIVE) {
-            uint8_t buf[32] = {0};
-            size_t len = encode_directive(buf, &n->u.directive);
-            printf("dirlen: %lu\n", len);
-            printf("data_pos: %lu\n", *data_pos);
-
-            memcpy(data + *data_pos, buf, len);
-            *data_pos += len;
-        } 
+            Directive *d = &n->u.directive;
+            encode_directive(base + *code_pos, d);
+            resolve_data_fixups(d, base + *code_pos, *code_pos, label_table, n->line);
+
+            // large zero fills stay holes in the output file, and .incbin
+            // payloads are copied from their file by the writer
+            bool incbin = !strcmp(d->name, ".incbin");
+            if (incbin || (n->size >= ZERO_SPAN_MIN && is_fill_directive(d->name) && is_zero_directive(d))) {
+                ret->spans = realloc(ret->spans, (ret->nspans + 1) * sizeof(OutSpan));
+                if (!ret->spans) { perror("realloc"); exit(1); }
+                ret->spans[ret->nspans++] = (OutSpan){counter_of(n->section), *code_pos, n->size,
+                    incbin ? d->fd : -1, incbin ? d->file_off : 0};
+            }
+        }
+    }
+    if (errors) {
+        fprintf(stderr, "%zu instruction%s could not be assembled\n", errors, errors == 1 ? "" : "s");
+        exit(1);
+    }
+    if (isa_errors) {
+        fprintf(stderr, "%zu instruction%s not in -march=%s\n", isa_errors, isa_errors == 1 ? "" : "s", args->march);
+        exit(1);
     }
 
-    // fclose(f);
-
-    ret->code_size = (*code_pos);
-    ret->data_size = (*data_pos);
     return ret;
-}
\ No newline at end of file
+}
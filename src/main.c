@@ -1,3 +1,5 @@
+#define _XOPEN_SOURCE 500
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -10,7 +12,7 @@
 
 void parse_args(int argc, char* argv[], args_t* args) {
     if (argc < 3) {
-        printf("Usage: %s <input> -o <output> [-f <binary|elf>]\n", argv[0]);
+        printf("Usage: %s <input> -o <output> [-f <binary|elf>] [-v] [-O] [--align-loops=32|64] [-mbranches-within-32B-boundaries] [-mvzeroupper] [--profile=FILE] [--function-sections] [-march=x86-64|x86-64-v2|v3|v4[+feat|-feat]...]\n", argv[0]);
         exit(1);
     }
 
@@ -28,8 +30,30 @@ void parse_args(int argc, char* argv[], args_t* args) {
             }
             continue;
         } else if (strcmp(argv[i], "-h") == 0) {
-            printf("Usage: %s <input> -o <output> [-f <binary|elf>]\n", argv[0]);
+            printf("Usage: %s <input> -o <output> [-f <binary|elf>] [-v] [-O] [--align-loops=32|64] [-mbranches-within-32B-boundaries] [-mvzeroupper] [--profile=FILE] [--function-sections] [-march=x86-64|x86-64-v2|v3|v4[+feat|-feat]...]\n", argv[0]);
             exit(1);
+        } else if (strcmp(argv[i], "-v") == 0) {
+            args->verbose = true;
+        } else if (strcmp(argv[i], "-O") == 0) {
+            args->optimize = true;
+        } else if (strcmp(argv[i], "-mbranches-within-32B-boundaries") == 0) {
+            args->branch_align = true;
+        } else if (strcmp(argv[i], "-mvzeroupper") == 0) {
+            args->vzeroupper = true;
+        } else if (strncmp(argv[i], "--align-loops=", 14) == 0) {
+            args->align_loops = strtoul(argv[i] + 14, NULL, 10);
+            if (args->align_loops != 32 && args->align_loops != 64) {
+                printf("Invalid loop alignment: %s (expected 32 or 64)\n", argv[i] + 14);
+                exit(1);
+            }
+        } else if (strcmp(argv[i], "--function-sections") == 0) {
+            args->function_sections = true;
+        } else if (strncmp(argv[i], "-march=", 7) == 0) {
+            args->march = argv[i] + 7;
+            if (!parse_march(args->march, &args->isa))
+                exit(1);
+        } else if (strncmp(argv[i], "--profile=", 10) == 0) {
+            args->profile = argv[i] + 10;
         } else if (strcmp(argv[i], "-o") == 0) {
             args->outname = argv[i + 1];
             i++;
@@ -45,7 +69,7 @@ FILE* infile = NULL;
 args_t* args;
 
 int main(int argc, char *argv[]) {
-    args = malloc(sizeof(args_t));
+    args = calloc(1, sizeof(args_t));
     parse_args(argc, argv, args);
 
     infile = fopen(args->inname, "r");
@@ -55,6 +79,12 @@ int main(int argc, char *argv[]) {
     dump_program(prog);
     fclose(infile);
 
+    if (args->optimize)
+        peephole_program(prog);
+    if (args->profile)
+        apply_profile(prog, args->profile);
+    vzeroupper_program(prog, args->vzeroupper);
+
 
     struct asm_ret* code = assemble_program(prog);
 
@@ -66,7 +96,10 @@ int main(int argc, char *argv[]) {
             perror("open");
             exit(1);
         }
-        write(fd, code->code, code->code_size);
+        if (write_section(fd, code, SECTION_CODE, 0) < 0 || ftruncate(fd, code->sec_size[SECTION_CODE]) < 0) {
+            perror("write");
+            exit(1);
+        }
         close(fd);
         return 0;
     }
@@ -0,0 +1,302 @@
+#define _XOPEN_SOURCE 500
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <elf.h>
+#include "jasm.h"
+
+/*
+ * Deduplication in mergeable sections (SHF_MERGE), e.g. .rodata.str1.1 and
+ * .rodata.cst8.
+ *
+ * An item is a run of labels followed by a run of data directives. Items
+ * with identical bytes are merged: the later item's data is dropped and its
+ * labels move in front of the first one. In string sections a string that
+ * is the tail of another (like "world" in "hello world") shares that tail;
+ * the longer string is split so the label can sit at the right offset.
+ */
+
+typedef struct {
+    size_t label, data, end;    // labels [label, data), data directives [data, end)
+    Section sec;
+    const uint8_t *bytes;
+    size_t len;
+    uint64_t hash;
+    long owner;                 // item holding the bytes, -1 for itself
+    size_t offset;              // position within the owner
+} Item;
+
+typedef struct {
+    size_t offset;
+    Node *label;
+} Share;
+
+static uint64_t fnv1a(const uint8_t *p, size_t n, Section sec) {
+    uint64_t h = 1469598103934665603ULL ^ (uint64_t)sec;
+    for (size_t i = 0; i < n; i++) h = (h ^ p[i]) * 1099511628211ULL;
+    return h;
+}
+
+static bool is_merge_section(Section sec) {
+    return G_sections.entries[sec].flags & SHF_MERGE;
+}
+
+static bool is_strings_section(Section sec) {
+    return G_sections.entries[sec].flags & SHF_STRINGS;
+}
+
+static bool is_data_node(Node *n, Section sec) {
+    return n->kind == NODE_DIRECTIVE && n->section == sec && is_data_directive(n->u.directive.name);
+}
+
+// Concatenated bytes of the item's data directives, or NULL if they hold
+// symbol references or don't form one entry of the section.
+static const uint8_t *item_bytes(Program *prog, Item *it) {
+    size_t len = 0;
+    for (size_t i = it->data; i < it->end; i++) {
+        Directive *d = &prog->nodes[i]->u.directive;
+        len += encode_directive(NULL, d);
+        if (d->nfixups) return NULL;
+    }
+
+    uint32_t entsize = G_sections.entries[it->sec].entsize;
+    if (!len || len % entsize) return NULL;
+
+    const uint8_t *bytes;
+    if (it->end - it->data == 1) {
+        bytes = prog->nodes[it->data]->u.directive.data;
+    } else {
+        uint8_t *buf = malloc(len);
+        if (!buf) { perror("malloc"); exit(1); }
+        size_t off = 0;
+        for (size_t i = it->data; i < it->end; i++) {
+            Directive *d = &prog->nodes[i]->u.directive;
+            memcpy(buf + off, d->data, d->len);
+            off += d->len;
+        }
+        bytes = buf;
+    }
+
+    if (is_strings_section(it->sec)) {
+        // must end in a NUL character
+        for (size_t k = len - entsize; k < len; k++)
+            if (bytes[k]) return NULL;
+    } else if (len != entsize) {
+        return NULL;
+    }
+    it->len = len;
+    return bytes;
+}
+
+static Item *find_items(Program *prog, size_t *nitems) {
+    Item *items = NULL;
+    size_t count = 0;
+
+    for (size_t i = 0; i < prog->nnodes;) {
+        Node *n = prog->nodes[i];
+        if (n->kind != NODE_LABEL || !is_merge_section(n->section)) { i++; continue; }
+
+        Item it = {.label = i, .sec = n->section, .owner = -1};
+        while (i < prog->nnodes && prog->nodes[i]->kind == NODE_LABEL && prog->nodes[i]->section == it.sec) i++;
+        it.data = i;
+        while (i < prog->nnodes && is_data_node(prog->nodes[i], it.sec)) i++;
+        it.end = i;
+
+        if (it.end == it.data || !(it.bytes = item_bytes(prog, &it))) continue;
+        it.hash = fnv1a(it.bytes, it.len, it.sec);
+
+        items = realloc(items, (count + 1) * sizeof(Item));
+        if (!items) { perror("realloc"); exit(1); }
+        items[count++] = it;
+    }
+
+    *nitems = count;
+    return items;
+}
+
+// Identical items: a hash table of first occurrences.
+static size_t merge_duplicates(Item *items, size_t n) {
+    size_t cap = 16;
+    while (cap < n * 2) cap *= 2;
+    long *table = malloc(cap * sizeof(long));
+    if (!table) { perror("malloc"); exit(1); }
+    for (size_t i = 0; i < cap; i++) table[i] = -1;
+
+    size_t dups = 0;
+    for (size_t i = 0; i < n; i++) {
+        Item *it = &items[i];
+        size_t h = it->hash & (cap - 1);
+        for (; table[h] >= 0; h = (h + 1) & (cap - 1)) {
+            Item *o = &items[table[h]];
+            if (o->hash == it->hash && o->sec == it->sec && o->len == it->len && !memcmp(o->bytes, it->bytes, it->len))
+                break;
+        }
+        if (table[h] >= 0) {
+            it->owner = table[h];
+            dups++;
+        } else {
+            table[h] = i;
+        }
+    }
+    free(table);
+    return dups;
+}
+
+static const Item *sort_items;
+
+// Order by section, then by the bytes read backwards, so a string sorts
+// right before the strings it is a tail of.
+static int cmp_reversed(const void *a, const void *b) {
+    const Item *x = &sort_items[*(const size_t *)a], *y = &sort_items[*(const size_t *)b];
+    if (x->sec != y->sec) return x->sec < y->sec ? -1 : 1;
+    for (size_t i = 1; i <= x->len && i <= y->len; i++) {
+        uint8_t cx = x->bytes[x->len - i], cy = y->bytes[y->len - i];
+        if (cx != cy) return cx < cy ? -1 : 1;
+    }
+    return x->len < y->len ? -1 : x->len > y->len;
+}
+
+static bool is_tail_of(const Item *s, const Item *t) {
+    return s->sec == t->sec && s->len < t->len && !memcmp(s->bytes, t->bytes + t->len - s->len, s->len);
+}
+
+// Tail sharing among the remaining strings of byte-string sections.
+static size_t merge_tails(Item *items, size_t n) {
+    size_t *order = malloc(n * sizeof(size_t)), m = 0;
+    if (!order && n) { perror("malloc"); exit(1); }
+    for (size_t i = 0; i < n; i++)
+        if (items[i].owner < 0 && is_strings_section(items[i].sec) && G_sections.entries[items[i].sec].entsize == 1)
+            order[m++] = i;
+
+    sort_items = items;
+    qsort(order, m, sizeof(size_t), cmp_reversed);
+
+    size_t tails = 0;
+    for (size_t k = m - (m > 0); k-- > 0;) {
+        Item *s = &items[order[k]], *t = &items[order[k + 1]];
+        if (!is_tail_of(s, t)) continue;
+        // strings of .rodata.str1.M keep their M-byte alignment
+        size_t offset = t->offset + t->len - s->len;
+        if (offset % G_sections.entries[s->sec].align) continue;
+        // t may itself be a tail by now; point at its owner directly
+        s->owner = t->owner >= 0 ? t->owner : (long)order[k + 1];
+        s->offset = offset;
+        tails++;
+    }
+    free(order);
+    return tails;
+}
+
+static Node *piece_node(Node *owner, const uint8_t *bytes, size_t len) {
+    Node *n = calloc(1, sizeof(Node));
+    if (!n) { perror("calloc"); exit(1); }
+    n->kind = NODE_DIRECTIVE;
+    n->line = owner->line;
+    n->section = owner->section;
+    n->subsection = owner->subsection;
+    n->u.directive.name = strdup(".ascii");
+    n->u.directive.built = true;
+    n->u.directive.data = (uint8_t *)bytes;
+    n->u.directive.len = len;
+    return n;
+}
+
+static int cmp_share(const void *a, const void *b) {
+    const Share *x = a, *y = b;
+    return x->offset < y->offset ? -1 : x->offset > y->offset;
+}
+
+void merge_sections(Program *prog) {
+    size_t nitems;
+    Item *items = find_items(prog, &nitems);
+    if (!nitems) return;
+
+    size_t dups = merge_duplicates(items, nitems);
+    size_t tails = merge_tails(items, nitems);
+    if (!dups && !tails) {
+        free(items);
+        return;
+    }
+
+    // labels of merged items, grouped by the owner they move to
+    Share **shares = calloc(nitems, sizeof(Share *));
+    size_t *nshares = calloc(nitems, sizeof(size_t));
+    bool *drop = calloc(prog->nnodes, sizeof(bool));
+    if (!shares || !nshares || !drop) { perror("calloc"); exit(1); }
+
+    size_t saved = 0;
+    for (size_t i = 0; i < nitems; i++) {
+        Item *it = &items[i];
+        if (it->owner < 0) continue;
+        // exact duplicates of a tail follow it to its owner
+        size_t offset = it->offset;
+        long o = it->owner;
+        if (items[o].owner >= 0) {
+            offset += items[o].offset;
+            o = items[o].owner;
+        }
+
+        for (size_t k = it->label; k < it->data; k++) {
+            shares[o] = realloc(shares[o], (nshares[o] + 1) * sizeof(Share));
+            if (!shares[o]) { perror("realloc"); exit(1); }
+            shares[o][nshares[o]++] = (Share){offset, prog->nodes[k]};
+        }
+        for (size_t k = it->label; k < it->end; k++) drop[k] = true;
+        saved += it->len;
+    }
+
+    // rebuild the node list, splitting owners where a tail is shared; an
+    // owner splits into at most one piece per tail plus one
+    Node **nodes = malloc((prog->nnodes + 2 * nitems) * sizeof(Node *));
+    if (!nodes) { perror("malloc"); exit(1); }
+    size_t n = 0, next_item = 0;
+
+    for (size_t i = 0; i < prog->nnodes; i++) {
+        if (drop[i]) continue;
+        while (next_item < nitems && items[next_item].label < i) next_item++;
+        Item *it = next_item < nitems && items[next_item].label == i ? &items[next_item] : NULL;
+        if (!it || !nshares[next_item]) {
+            nodes[n++] = prog->nodes[i];
+            continue;
+        }
+
+        Share *sh = shares[next_item];
+        size_t ns = nshares[next_item];
+        qsort(sh, ns, sizeof(Share), cmp_share);
+
+        for (size_t k = it->label; k < it->data; k++) nodes[n++] = prog->nodes[k];
+        size_t s = 0;
+        for (; s < ns && sh[s].offset == 0; s++) nodes[n++] = sh[s].label;
+
+        if (s == ns) {
+            for (size_t k = it->data; k < it->end; k++) nodes[n++] = prog->nodes[k];
+        } else {
+            Node *first = prog->nodes[it->data];
+            size_t pos = 0;
+            while (pos < it->len) {
+                size_t cut = s < ns ? sh[s].offset : it->len;
+                if (cut > pos) {
+                    nodes[n++] = piece_node(first, it->bytes + pos, cut - pos);
+                    pos = cut;
+                }
+                for (; s < ns && sh[s].offset == pos; s++) nodes[n++] = sh[s].label;
+            }
+        }
+        i = it->end - 1;
+    }
+
+    free(prog->nodes);
+    prog->nodes = nodes;
+    prog->nnodes = n;
+
+    if (args->verbose)
+        printf("merge: %zu duplicate%s and %zu shared tail%s in mergeable sections, %zu bytes saved\n",
+            dups, dups == 1 ? "" : "s", tails, tails == 1 ? "" : "s", saved);
+
+    for (size_t i = 0; i < nitems; i++) free(shares[i]);
+    free(shares);
+    free(nshares);
+    free(drop);
+    free(items);
+}
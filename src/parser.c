@@ -28,12 +28,14 @@ static void *xmalloc(size_t n) {
 
 typedef enum {
     T_EOF, T_IDENT, T_DIRECTIVE, T_REGISTER, T_NUMBER, T_IMM_PREFIX,
-    T_LPAREN, T_RPAREN, T_COMMA, T_COLON, T_NEWLINE, T_COMMENT, T_OTHER, T_STRING
+    T_LPAREN, T_RPAREN, T_COMMA, T_COLON, T_NEWLINE, T_COMMENT, T_OTHER, T_STRING,
+    T_RAW       /* directive operands, split into arguments by the parser */
 } TokenType;
 
 typedef struct {
     TokenType type;
     char *text;
+    int line;
 } Token;
 
 typedef struct {
@@ -41,6 +43,8 @@ typedef struct {
     size_t len, cap, i;
 } TokenStream;
 
+static int cur_line = 1;
+
 static void add_tok(TokenStream *ts, TokenType type, const char *s, size_t n) {
     if (ts->len == ts->cap) {
         ts->cap = ts->cap ? ts->cap * 2 : 128;
@@ -49,16 +53,40 @@ static void add_tok(TokenStream *ts, TokenType type, const char *s, size_t n) {
     }
     ts->toks[ts->len].type = type;
     ts->toks[ts->len].text = strndup(s, n);
+    ts->toks[ts->len].line = cur_line;
     ts->len++;
 }
 
+static bool is_comment_start(const char *p) {
+    return *p == '#' || *p == ';' || (p[0] == '/' && p[1] == '/');
+}
+
+/* End of a directive's operand text: the first comment outside a string. */
+static size_t operands_end(const char *line, size_t i) {
+    bool quoted = false;
+    for (; line[i] && line[i] != '\n'; i++) {
+        if (quoted) {
+            if (line[i] == '\\' && line[i + 1]) i++;
+            else if (line[i] == '"') quoted = false;
+        } else if (line[i] == '"') {
+            quoted = true;
+        } else if (is_comment_start(line + i)) {
+            break;
+        }
+    }
+    return i;
+}
+
 static void lex_file(TokenStream *ts, FILE *f) {
-    char line[1024];
-    while (fgets(line, sizeof(line), f)) {
+    char *line = NULL;
+    size_t cap = 0;
+    cur_line = 0;
+    while (getline(&line, &cap, f) != -1) {
         size_t i = 0;
+        cur_line++;
         while (line[i]) {
             char c = line[i];
-            if (c == '#' || c == ';' || (c == '/' && line[i+1] == '/')) {
+            if (is_comment_start(line + i)) {
                 add_tok(ts, T_COMMENT, line + i, strlen(line + i));
                 break;
             } else if (isspace((unsigned char)c)) {
@@ -71,10 +99,27 @@ static void lex_file(TokenStream *ts, FILE *f) {
             } else if (c == '$') {
                 add_tok(ts, T_IMM_PREFIX, &c, 1);
                 i++;
+            } else if (c == '.' && line[i+1] == 'L') {
+                /* .L names are local labels, not directives */
+                size_t start = i++;
+                while (isalnum((unsigned char)line[i]) || line[i]=='_' || line[i]=='$' || line[i]=='.') i++;
+                add_tok(ts, T_IDENT, line + start, i - start);
+                if (line[i] == ':') {
+                    add_tok(ts, T_COLON, ":", 1);
+                    i++;
+                }
             } else if (c == '.') {
                 size_t start = i++;
                 while (isalnum((unsigned char)line[i]) || line[i] == '_') i++;
                 add_tok(ts, T_DIRECTIVE, line + start, i - start);
+
+                /* operands are kept as one raw token; data tables can be long */
+                while (line[i] == ' ' || line[i] == '\t') i++;
+                size_t end = operands_end(line, i);
+                size_t len = end;
+                while (len > i && isspace((unsigned char)line[len - 1])) len--;
+                if (len > i) add_tok(ts, T_RAW, line + i, len - i);
+                i = end;
             } else if (isdigit((unsigned char)c)) {
                 size_t start = i++;
                 while (isalnum((unsigned char)line[i]) || line[i]=='x' || line[i]=='X') i++;
@@ -119,6 +164,7 @@ static void lex_file(TokenStream *ts, FILE *f) {
             else { add_tok(ts, T_OTHER, &c, 1); i++; }
         }
     }
+    free(line);
     add_tok(ts, T_EOF, "", 0);
 }
 
@@ -146,6 +192,18 @@ static long parse_number(const char *s) {
 /* Operand parsing */
 static Operand *parse_operand(TokenStream *ts, int insn_size);
 
+/* foo@PLT, foo@GOTPCREL */
+static SymModifier parse_modifier(TokenStream *ts) {
+    if (peek(ts)->type != T_OTHER || peek(ts)->text[0] != '@' || ts->toks[ts->i + 1].type != T_IDENT)
+        return SYM_PLAIN;
+    next(ts);
+    Token *m = next(ts);
+    if (!strcmp(m->text, "PLT")) return SYM_PLT;
+    if (!strcmp(m->text, "GOTPCREL")) return SYM_GOTPCREL;
+    fprintf(stderr, "line %d: unsupported symbol modifier @%s\n", m->line, m->text);
+    return SYM_PLAIN;
+}
+
 static Operand *parse_mem(TokenStream *ts, long disp, bool has_disp, int size) {
     Operand *op = xmalloc(sizeof(Operand));
     memset(op, 0, sizeof(Operand));
@@ -176,6 +234,18 @@ static Operand *parse_mem(TokenStream *ts, long disp, bool has_disp, int size) {
     return op;
 }
 
+/* a number without $ is an absolute address: 0x1000, %fs:0x28 */
+static Operand *absolute_mem(long disp, int size) {
+    Operand *op = xmalloc(sizeof(Operand));
+    memset(op, 0, sizeof(Operand));
+    op->kind = OP_MEM;
+    op->mem.scale = 1;
+    op->mem.disp = disp;
+    op->mem.has_disp = true;
+    op->mem.size = size;
+    return op;
+}
+
 static Operand *parse_operand(TokenStream *ts, int insn_size) {
     Token *t = peek(ts);
     Operand *op = xmalloc(sizeof(Operand));
@@ -183,9 +253,43 @@ static Operand *parse_operand(TokenStream *ts, int insn_size) {
 
     if (t->type == T_IMM_PREFIX) {
         next(ts);
+        bool neg = peek(ts)->type == T_OTHER && peek(ts)->text[0] == '-';
+        if (neg) next(ts);
         Token *n = next(ts);
         op->kind = OP_IMM;
-        op->imm = parse_number(n->text);
+        op->imm = neg ? -parse_number(n->text) : parse_number(n->text);
+        return op;
+    }
+    if (t->type == T_OTHER && t->text[0] == '*') {
+        /* jmp *%rax, jmp *8(%rax) */
+        next(ts);
+        free(op);
+        op = parse_operand(ts, insn_size);
+        op->indirect = true;
+        return op;
+    }
+    if (t->type == T_OTHER && t->text[0] == '-' && ts->toks[ts->i + 1].type == T_NUMBER) {
+        next(ts);
+        long disp = -parse_number(next(ts)->text);
+        free(op);
+        if (peek(ts)->type == T_LPAREN)
+            return parse_mem(ts, disp, true, insn_size);
+        return absolute_mem(disp, insn_size);
+    }
+    if (t->type == T_REGISTER && ts->toks[ts->i + 1].type == T_OTHER && ts->toks[ts->i + 1].text[0] == ':') {
+        /* %fs:8(%rax), %fs:0x28 */
+        static const char *segs[] = {"%es", "%cs", "%ss", "%ds", "%fs", "%gs"};
+        size_t s = 0;
+        while (s < sizeof(segs) / sizeof(segs[0]) && strcmp(segs[s], t->text)) s++;
+        if (s == sizeof(segs) / sizeof(segs[0]))
+            fprintf(stderr, "line %d: %s is not a segment register\n", t->line, t->text);
+        ts->i += 2;
+        free(op);
+        op = parse_operand(ts, insn_size);
+        if (op->kind != OP_MEM)
+            fprintf(stderr, "line %d: %s: override needs a memory operand\n", t->line, t->text);
+        else if (s < sizeof(segs) / sizeof(segs[0]))
+            op->mem.seg = strdup_safe(t->text);
         return op;
     }
     if (t->type == T_REGISTER) {
@@ -197,18 +301,38 @@ static Operand *parse_operand(TokenStream *ts, int insn_size) {
     if (t->type == T_NUMBER) {
         long disp = parse_number(t->text);
         next(ts);
+        free(op);
         if (peek(ts)->type == T_LPAREN)
             return parse_mem(ts, disp, true, insn_size);
-        op->kind = OP_IMM;
-        op->imm = disp;
-        return op;
+        return absolute_mem(disp, insn_size);
     }
     if (t->type == T_LPAREN)
         return parse_mem(ts, 0, false, insn_size);
     if (t->type == T_IDENT) {
-        op->kind = OP_LABELREF;
-        op->labelref = strdup_safe(t->text);
+        char *name = strdup_safe(t->text);
         next(ts);
+        SymModifier mod = parse_modifier(ts);
+
+        /* sym(%rip), sym+8(%rip) */
+        long addend = 0;
+        Token *sign = peek(ts);
+        if (sign->type == T_OTHER && (sign->text[0] == '+' || sign->text[0] == '-') &&
+            ts->toks[ts->i + 1].type == T_NUMBER && ts->toks[ts->i + 2].type == T_LPAREN) {
+            next(ts);
+            addend = parse_number(next(ts)->text);
+            if (sign->text[0] == '-') addend = -addend;
+        }
+        if (peek(ts)->type == T_LPAREN) {
+            free(op);
+            op = parse_mem(ts, addend, true, insn_size);
+            op->mem.sym = name;
+            op->mem.symmod = mod;
+            return op;
+        }
+
+        op->kind = OP_LABELREF;
+        op->labelref = name;
+        op->labelmod = mod;
         return op;
     }
     next(ts);
@@ -229,6 +353,60 @@ static int get_op_size_bits(const char* opcode) {
     } 
 }
 
+static bool is_char(Token *t, char c) {
+    return t->type == T_OTHER && t->text[0] == c;
+}
+
+/* AVX-512 decorators after an operand: {%k1}-{%k7} and {z} (masking, on the
+   destination) and {1toN} (broadcast, on a memory operand). Returns whether
+   the operand carried a mask. */
+static bool parse_decorators(TokenStream *ts, Instruction *in, Operand *op) {
+    bool mask = false;
+    while (is_char(peek(ts), '{')) {
+        next(ts);
+        Token *t = next(ts);
+        if (t->type == T_REGISTER && !strncmp(t->text, "%k", 2) && t->text[2] >= '1' && t->text[2] <= '7' && !t->text[3]) {
+            in->opmask = t->text[2] - '0';
+            mask = true;
+        } else if (t->type == T_IDENT && !strcmp(t->text, "z")) {
+            in->zeroing = true;
+            mask = true;
+        } else if (t->type == T_NUMBER && op->kind == OP_MEM && !strncmp(t->text, "1to", 3)) {
+            op->mem.bcst = atoi(t->text + 3);
+        } else {
+            fprintf(stderr, "line %d: unknown decorator {%s}\n", t->line, t->text);
+        }
+        if (!is_char(peek(ts), '}')) {
+            fprintf(stderr, "line %d: expected } after {%s\n", t->line, t->text);
+            return mask;
+        }
+        next(ts);
+    }
+    return mask;
+}
+
+static const char *rounding_names[] = {
+    [ROUND_RN] = "rn-sae", [ROUND_RD] = "rd-sae", [ROUND_RU] = "ru-sae",
+    [ROUND_RZ] = "rz-sae", [ROUND_SAE] = "sae",
+};
+
+/* {rn-sae}, {rd-sae}, {ru-sae}, {rz-sae} or {sae}, written as an operand of
+   its own: first, or after the immediate */
+static void parse_rounding(TokenStream *ts, Instruction *in) {
+    int line = next(ts)->line;
+    char buf[16] = "";
+    while (!is_char(peek(ts), '}') && peek(ts)->type != T_NEWLINE && peek(ts)->type != T_EOF)
+        strncat(buf, next(ts)->text, sizeof(buf) - strlen(buf) - 1);
+    accept(ts, T_OTHER);
+    for (int r = ROUND_RN; r <= ROUND_SAE; r++) {
+        if (!strcmp(buf, rounding_names[r])) {
+            in->rounding = r;
+            return;
+        }
+    }
+    fprintf(stderr, "line %d: unknown rounding mode {%s}\n", line, buf);
+}
+
 /* Instruction, directive, label parsing */
 
 static Node *parse_instruction(TokenStream *ts, const char *opcode) {
@@ -241,19 +419,37 @@ static Node *parse_instruction(TokenStream *ts, const char *opcode) {
     n->u.instruction.noperands = 0;
 
     int insn_size = get_op_size_bits(opcode);
+    Instruction *in = &n->u.instruction;
+    size_t masked = 0;      /* 1 + index of the operand carrying {%k}{z} */
 
     while (!accept(ts, T_NEWLINE) && peek(ts)->type != T_COMMENT && peek(ts)->type != T_EOF) {
+        if (is_char(peek(ts), '{')) {
+            parse_rounding(ts, in);
+            accept(ts, T_COMMA);
+            continue;
+        }
         Operand *op = parse_operand(ts, insn_size);
-        n->u.instruction.operands = realloc(
-            n->u.instruction.operands,
-            (n->u.instruction.noperands + 1) * sizeof(Operand *)
-        );
-        n->u.instruction.operands[n->u.instruction.noperands++] = op;
+        if (parse_decorators(ts, in, op)) masked = in->noperands + 1;
+        in->operands = realloc(in->operands, (in->noperands + 1) * sizeof(Operand *));
+        in->operands[in->noperands++] = op;
         accept(ts, T_COMMA);
     }
+    if (masked && masked != in->noperands)
+        fprintf(stderr, "line %d: {%%k}/{z} masking goes on the destination operand\n", ts->toks[ts->i - 1].line);
     return n;
 }
 
+static void add_dir_arg(Directive *d, char *arg) {
+    /* grow by doubling: data directives can carry millions of arguments */
+    if ((d->nargs & (d->nargs - 1)) == 0) {
+        d->args = realloc(d->args, (d->nargs ? d->nargs * 2 : 1) * sizeof(char *));
+        if (!d->args) { perror("realloc"); exit(1); }
+    }
+    d->args[d->nargs++] = arg;
+}
+
+/* Arguments are comma separated and positional, so `.p2align 4,,10` keeps an
+ * empty second argument. Arguments are trimmed; strings keep their quotes. */
 static Node *parse_directive(TokenStream *ts, const char *name) {
     Node *n = xmalloc(sizeof(Node));
     memset(n, 0, sizeof(Node));
@@ -262,16 +458,29 @@ static Node *parse_directive(TokenStream *ts, const char *name) {
     n->u.directive.args = NULL;
     n->u.directive.nargs = 0;
 
-    while (!accept(ts, T_NEWLINE) && peek(ts)->type != T_COMMENT && peek(ts)->type != T_EOF) {
-        if (peek(ts)->type == T_STRING || peek(ts)->type == T_IDENT || peek(ts)->type == T_NUMBER) {
-            n->u.directive.args = realloc(
-                n->u.directive.args,
-                (n->u.directive.nargs + 1) * sizeof(char *)
-            );
-            n->u.directive.args[n->u.directive.nargs++] = strdup_safe(peek(ts)->text);
-            next(ts);
-        } else next(ts);
+    next(ts);
+    if (peek(ts)->type == T_RAW && is_data_directive(name)) {
+        /* data is parsed straight from the text into bytes at assembly time */
+        n->u.directive.raw = strdup_safe(next(ts)->text);
+    } else if (peek(ts)->type == T_RAW) {
+        /* split at commas outside strings; strings keep their quotes */
+        const char *p = next(ts)->text;
+        for (;;) {
+            while (isspace((unsigned char)*p)) p++;
+            const char *start = p;
+            bool quoted = false;
+            for (; *p && (quoted || *p != ','); p++) {
+                if (quoted && *p == '\\' && p[1]) p++;
+                else if (*p == '"') quoted = !quoted;
+            }
+            const char *end = p;
+            while (end > start && isspace((unsigned char)end[-1])) end--;
+            add_dir_arg(&n->u.directive, strndup(start, end - start));
+            if (!*p) break;
+            p++;
+        }
     }
+    while (!accept(ts, T_NEWLINE) && peek(ts)->type != T_COMMENT && peek(ts)->type != T_EOF) next(ts);
     return n;
 }
 
@@ -283,6 +492,13 @@ static Node *parse_label(const char *name) {
     return n;
 }
 
+static uint8_t prefix_of(const char *name) {
+    if (!strcmp(name, "lock")) return PREFIX_LOCK;
+    if (!strcmp(name, "rep") || !strcmp(name, "repe") || !strcmp(name, "repz")) return PREFIX_REP;
+    if (!strcmp(name, "repne") || !strcmp(name, "repnz")) return PREFIX_REPNE;
+    return 0;
+}
+
 /* Main program parse */
 Program *parse_program(FILE *f) {
     TokenStream ts = {0};
@@ -292,11 +508,35 @@ Program *parse_program(FILE *f) {
     prog->nodes = NULL;
     prog->nnodes = 0;
 
+    /* prefixes apply to the next instruction, on the same line or the next */
+    uint8_t prefixes = 0;
+    int prefix_line = 0;
+    size_t errors = 0;
+
     while (peek(&ts)->type != T_EOF) {
         Token *t = peek(&ts);
         if (t->type == T_COMMENT || t->type == T_NEWLINE) { next(&ts); continue; }
 
         Node *node = NULL;
+        int line = t->line;
+        if (t->type == T_IDENT && ts.toks[ts.i+1].type != T_COLON && prefix_of(t->text)) {
+            // lock is one prefix group, rep and repne another, as for gas
+            uint8_t p = prefix_of(t->text);
+            uint8_t group = p == PREFIX_LOCK ? PREFIX_LOCK : PREFIX_REP | PREFIX_REPNE;
+            if (prefixes & group) {
+                fprintf(stderr, "line %d: %s: same type of prefix used twice\n", line, t->text);
+                errors++;
+            }
+            prefixes |= p;
+            prefix_line = line;
+            next(&ts);
+            continue;
+        }
+        if (prefixes && (t->type != T_IDENT || ts.toks[ts.i+1].type == T_COLON)) {
+            fprintf(stderr, "line %d: prefix without an instruction\n", prefix_line);
+            prefixes = 0;
+        }
+
         if (t->type == T_IDENT && ts.toks[ts.i+1].type == T_COLON) {
             node = parse_label(t->text);
             ts.i += 2; // skip ident + colon
@@ -305,17 +545,54 @@ Program *parse_program(FILE *f) {
         } else if (t->type == T_IDENT) {
             next(&ts);
             node = parse_instruction(&ts, t->text);
+            node->u.instruction.prefixes = prefixes;
+            prefixes = 0;
         } else { next(&ts); }
 
         if (node) {
+            node->line = line;
             prog->nodes = realloc(prog->nodes, (prog->nnodes + 1) * sizeof(Node *));
             prog->nodes[prog->nnodes++] = node;
         }
     }
+    if (prefixes) fprintf(stderr, "line %d: prefix without an instruction\n", prefix_line);
+    if (errors) exit(1);
     return prog;
 }
 
 /* ---------- Pretty printer ---------- */
+static const char *modifier_name(SymModifier mod) {
+    return mod == SYM_PLT ? "@PLT" : mod == SYM_GOTPCREL ? "@GOTPCREL" : "";
+}
+
+size_t format_instruction(char *buf, size_t n, const Instruction *inst) {
+    size_t len = snprintf(buf, n, "%s%s%s%s", inst->prefixes & PREFIX_LOCK ? "lock " : "",
+        inst->prefixes & PREFIX_REP ? "rep " : "", inst->prefixes & PREFIX_REPNE ? "repne " : "", inst->opcode);
+    if (inst->rounding && len < n) len += snprintf(buf + len, n - len, " {%s}", rounding_names[inst->rounding]);
+    for (size_t j = 0; j < inst->noperands && len < n; j++) {
+        const Operand *o = inst->operands[j];
+        const char *sep = j || inst->rounding ? ", " : " ";
+        switch (o->kind) {
+        case OP_REG: len += snprintf(buf + len, n - len, "%s%s", sep, o->reg); break;
+        case OP_IMM: len += snprintf(buf + len, n - len, "%s$%ld", sep, o->imm); break;
+        case OP_LABELREF: len += snprintf(buf + len, n - len, "%s%s%s", sep, o->labelref, modifier_name(o->labelmod)); break;
+        case OP_MEM:
+            len += snprintf(buf + len, n - len, "%s%s%s%s%s%s%ld(%s,%s,%d)", sep,
+                o->mem.seg ? o->mem.seg : "", o->mem.seg ? ":" : "",
+                o->mem.sym ? o->mem.sym : "", modifier_name(o->mem.symmod),
+                o->mem.sym && o->mem.disp >= 0 ? "+" : "", o->mem.disp,
+                o->mem.base ? o->mem.base : "",
+                o->mem.index ? o->mem.index : "",
+                o->mem.scale);
+            if (o->mem.bcst && len < n) len += snprintf(buf + len, n - len, "{1to%d}", o->mem.bcst);
+            break;
+        }
+    }
+    if (inst->opmask && len < n) len += snprintf(buf + len, n - len, "{%%k%d}", inst->opmask);
+    if (inst->zeroing && len < n) len += snprintf(buf + len, n - len, "{z}");
+    return len;
+}
+
 void dump_program(Program *p) {
     for (size_t i = 0; i < p->nnodes; i++) {
         Node *n = p->nodes[i];
@@ -325,33 +602,21 @@ void dump_program(Program *p) {
             break;
         case NODE_DIRECTIVE:
             printf("Directive: %s\n", n->u.directive.name);
-            for (size_t j = 0; j < n->u.directive.nargs; j++) {
+            for (size_t j = 0; j < n->u.directive.nargs && j < 8; j++) {
                 const char *arg = n->u.directive.args[j];
-                printf("%s", arg);
+                printf("%s%s", j ? ", " : "", arg);
             }
+            if (n->u.directive.nargs > 8) printf(", ... (%zu args)", n->u.directive.nargs);
+            if (n->u.directive.raw) printf("%.60s%s", n->u.directive.raw, strlen(n->u.directive.raw) > 60 ? " ..." : "");
             printf("\n");
             break;
-        case NODE_INSTRUCTION:
-            printf("Instr: %s", n->u.instruction.opcode);
-            for (size_t j = 0; j < n->u.instruction.noperands; j++) {
-                Operand *o = n->u.instruction.operands[j];
-                printf(" ");
-                switch (o->kind) {
-                case OP_REG: printf("%s", o->reg); break;
-                case OP_IMM: printf("$%ld", o->imm); break;
-                case OP_LABELREF: printf("%s", o->labelref); break;
-                case OP_MEM:
-                    printf("%ld(%s,%s,%d)", o->mem.disp,
-                        o->mem.base ? o->mem.base : "",
-                        o->mem.index ? o->mem.index : "",
-                        o->mem.scale);
-                    break;
-                }
-                if (j + 1 < n->u.instruction.noperands) printf(",");
-            }
-            printf("\n");
+        case NODE_INSTRUCTION: {
+            char buf[256];
+            format_instruction(buf, sizeof(buf), &n->u.instruction);
+            printf("Instr: %s\n", buf);
             break;
         }
+        }
     }
 }
 
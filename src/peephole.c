@@ -0,0 +1,399 @@
+#define _XOPEN_SOURCE 500
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "jasm.h"
+
+/*
+ * Peephole optimizer (-O).
+ *
+ * Runs on the parsed instruction list before layout, so every rewrite only
+ * has to preserve architectural semantics, not addresses. Rewrites that
+ * change flag behaviour are gated on a forward flags-liveness scan.
+ */
+
+// -------------------- Flag effects --------------------
+enum {
+    FL_CF = 1 << 0,
+    FL_PF = 1 << 1,
+    FL_AF = 1 << 2,
+    FL_ZF = 1 << 3,
+    FL_SF = 1 << 4,
+    FL_OF = 1 << 5,
+    FL_ALL = 0x3f,
+};
+
+typedef enum {
+    FX_NORMAL,   // falls through to the next instruction
+    FX_BRANCH,   // may continue somewhere we don't follow
+    FX_END,      // flags are dead afterwards (ret, call)
+} FlowKind;
+
+typedef struct {
+    const char *name;
+    uint8_t reads;
+    uint8_t writes;
+    FlowKind flow;
+} FlagInfo;
+
+static const FlagInfo flag_table[] = {
+    {"mov",  0, 0, FX_NORMAL},
+    {"lea",  0, 0, FX_NORMAL},
+    {"push", 0, 0, FX_NORMAL},
+    {"pop",  0, 0, FX_NORMAL},
+    {"add",  0, FL_ALL, FX_NORMAL},
+    {"sub",  0, FL_ALL, FX_NORMAL},
+    {"cmp",  0, FL_ALL, FX_NORMAL},
+    {"and",  0, FL_ALL, FX_NORMAL},
+    {"or",   0, FL_ALL, FX_NORMAL},
+    {"xor",  0, FL_ALL, FX_NORMAL},
+    {"test", 0, FL_ALL, FX_NORMAL},
+    {"neg",  0, FL_ALL, FX_NORMAL},
+    {"inc",  0, FL_ALL & ~FL_CF, FX_NORMAL},
+    {"dec",  0, FL_ALL & ~FL_CF, FX_NORMAL},
+    {"adc",  FL_CF, FL_ALL, FX_NORMAL},
+    {"sbb",  FL_CF, FL_ALL, FX_NORMAL},
+    {"jmp",  0, 0, FX_BRANCH},
+    {"call", 0, FL_ALL, FX_END},
+    {"ret",  0, FL_ALL, FX_END},
+    // the kernel saves rflags across these, so treat them as readers
+    {"syscall", FL_ALL, 0, FX_NORMAL},
+    {"int",     FL_ALL, 0, FX_NORMAL},
+    {NULL, 0, 0, FX_NORMAL}
+};
+
+// flags read by each pair of condition codes (cc >> 1), see cond_code
+static const uint8_t cond_reads[8] = {
+    FL_OF, FL_CF, FL_ZF, FL_CF | FL_ZF, FL_SF, FL_PF, FL_SF | FL_OF, FL_ZF | FL_SF | FL_OF,
+};
+
+// opcode is `base` or `base` plus an AT&T size suffix
+static bool is_op(const char *opcode, const char *base) {
+    size_t n = strlen(base);
+    if (strncmp(opcode, base, n) != 0) return false;
+    if (opcode[n] == '\0') return true;
+    return opcode[n + 1] == '\0' &&
+        (opcode[n] == 'b' || opcode[n] == 'w' || opcode[n] == 'l' || opcode[n] == 'q');
+}
+
+// condition of a jcc, setcc or cmovcc (with or without a size suffix), or -1
+static int cond_of(const char *opcode, const char *family) {
+    size_t n = strlen(family);
+    if (strncmp(opcode, family, n) != 0) return -1;
+    int cc = cond_code(opcode + n);
+    if (cc >= 0 || family[0] == 'j') return cc;
+
+    char base[8];
+    size_t len = strlen(opcode + n);
+    if (len < 2 || len >= sizeof(base)) return -1;
+    memcpy(base, opcode + n, len - 1);
+    base[len - 1] = '\0';
+    return is_op(opcode + n, base) ? cond_code(base) : -1;
+}
+
+static bool lookup_flags(const char *opcode, FlagInfo *fi) {
+    int cc;
+    if ((cc = cond_of(opcode, "j")) >= 0) {
+        *fi = (FlagInfo){opcode, cond_reads[cc >> 1], 0, FX_BRANCH};
+        return true;
+    }
+    if ((cc = cond_of(opcode, "set")) >= 0 || (cc = cond_of(opcode, "cmov")) >= 0) {
+        *fi = (FlagInfo){opcode, cond_reads[cc >> 1], 0, FX_NORMAL};
+        return true;
+    }
+    for (const FlagInfo *f = flag_table; f->name; f++) {
+        if (is_op(opcode, f->name)) {
+            *fi = *f;
+            return true;
+        }
+    }
+    return false;
+}
+
+static size_t find_label(Program *prog, const char *name) {
+    for (size_t i = 0; i < prog->nnodes; i++) {
+        Node *n = prog->nodes[i];
+        if (n && n->kind == NODE_LABEL && !strcmp(n->u.label, name)) return i;
+    }
+    return prog->nnodes;
+}
+
+// Flags in `want` that may be read starting at node j, following jumps to
+// known labels. visited[] holds the flags already followed from each node:
+// every result reaches the caller, so a later visit only follows the rest.
+static uint8_t live_from(Program *prog, size_t j, uint8_t want, uint8_t *visited) {
+    uint8_t live = 0;
+
+    for (; j < prog->nnodes && want; j++) {
+        Node *n = prog->nodes[j];
+        if (!n) continue;
+        want &= ~visited[j];
+        if (!want) return live;
+        visited[j] |= want;
+        if (n->kind == NODE_LABEL) continue;
+        if (n->kind == NODE_DIRECTIVE) return live | want;
+
+        Instruction *in = &n->u.instruction;
+        FlagInfo fi;
+        if (!lookup_flags(in->opcode, &fi))
+            return live | want;
+
+        live |= fi.reads & want;
+        if (fi.flow == FX_END) return live;
+        if (fi.flow == FX_BRANCH) {
+            if (in->noperands != 1 || in->operands[0]->kind != OP_LABELREF)
+                return live | want;
+            size_t t = find_label(prog, in->operands[0]->labelref);
+            if (t == prog->nnodes) return live | want;
+            live |= live_from(prog, t, want, visited);
+            if (!strcmp(in->opcode, "jmp")) return live;
+        }
+        want &= ~fi.writes;
+    }
+    return live;
+}
+
+// Flags that may be read after node i before being overwritten.
+static uint8_t flags_live_after(Program *prog, size_t i) {
+    uint8_t *visited = calloc(prog->nnodes, sizeof(uint8_t));
+    if (!visited) { perror("calloc"); exit(1); }
+    uint8_t live = live_from(prog, i + 1, FL_ALL, visited);
+    free(visited);
+    return live;
+}
+
+// -------------------- Helpers --------------------
+static Instruction *insn_at(Program *prog, size_t i) {
+    if (i >= prog->nnodes || !prog->nodes[i] || prog->nodes[i]->kind != NODE_INSTRUCTION)
+        return NULL;
+    return &prog->nodes[i]->u.instruction;
+}
+
+// next live node after i, skipping nothing but already-removed slots
+static size_t next_node(Program *prog, size_t i) {
+    for (i++; i < prog->nnodes; i++)
+        if (prog->nodes[i]) return i;
+    return prog->nnodes;
+}
+
+// directly preceding instruction, or NULL if a label (a join point) sits in between
+static Instruction *prev_insn(Program *prog, size_t i) {
+    while (i-- > 0)
+        if (prog->nodes[i]) return insn_at(prog, i);
+    return NULL;
+}
+
+// general-purpose registers only: moves between xmm registers aren't no-ops
+static bool is_reg(const Operand *o) { return o->kind == OP_REG && reg_code(o->reg) >= 0 && reg_size(o->reg) <= 64; }
+
+static bool same_operand(const Operand *a, const Operand *b) {
+    if (a->kind != b->kind) return false;
+    switch (a->kind) {
+    case OP_REG: return !strcmp(a->reg, b->reg);
+    case OP_IMM: return a->imm == b->imm;
+    case OP_LABELREF: return !strcmp(a->labelref, b->labelref) && a->labelmod == b->labelmod;
+    case OP_MEM:
+        return a->mem.disp == b->mem.disp && a->mem.scale == b->mem.scale &&
+            !strcmp(a->mem.sym ? a->mem.sym : "", b->mem.sym ? b->mem.sym : "") && a->mem.symmod == b->mem.symmod &&
+            !strcmp(a->mem.seg ? a->mem.seg : "", b->mem.seg ? b->mem.seg : "") &&
+            !strcmp(a->mem.base ? a->mem.base : "", b->mem.base ? b->mem.base : "") &&
+            !strcmp(a->mem.index ? a->mem.index : "", b->mem.index ? b->mem.index : "");
+    }
+    return false;
+}
+
+static char suffix_of(const char *opcode, const char *base) {
+    return opcode[strlen(base)];
+}
+
+static char *make_opcode(const char *base, char suffix) {
+    char *s = malloc(strlen(base) + 2);
+    if (!s) { perror("malloc"); exit(1); }
+    strcpy(s, base);
+    if (suffix) { s[strlen(base)] = suffix; s[strlen(base) + 1] = '\0'; }
+    return s;
+}
+
+static void report(int line, const char *before, Instruction *after) {
+    if (after) {
+        char buf[256];
+        format_instruction(buf, sizeof(buf), after);
+        printf("peephole: line %d: %s -> %s\n", line, before, buf);
+    } else {
+        printf("peephole: line %d: %s -> (removed)\n", line, before);
+    }
+}
+
+static void remove_node(Program *prog, size_t i, const char *before) {
+    report(prog->nodes[i]->line, before, NULL);
+    prog->nodes[i] = NULL;
+}
+
+// -------------------- Rewrites --------------------
+
+// mov $0, %reg -> xor %r32, %r32 (shorter, and a recognised zeroing idiom)
+static bool rw_mov_zero(Program *prog, size_t i, Instruction *in, const char *before) {
+    if (!is_op(in->opcode, "mov") || in->noperands != 2) return false;
+    Operand *src = in->operands[0], *dst = in->operands[1];
+    if (src->kind != OP_IMM || src->imm != 0 || !is_reg(dst)) return false;
+
+    int sz = reg_size(dst->reg);
+    if (sz != 32 && sz != 64) return false;
+    if (flags_live_after(prog, i)) return false;
+
+    const char *r32 = reg_name(reg_code(dst->reg), 32);
+    if (!r32) return false;
+
+    in->opcode = make_opcode("xor", 0);
+    src->kind = OP_REG;
+    src->reg = strdup(r32);
+    dst->reg = strdup(r32);
+    report(prog->nodes[i]->line, before, in);
+    return true;
+}
+
+// mov %a, %a is a no-op except for the 32-bit zero-extending form
+static bool rw_self_mov(Program *prog, size_t i, Instruction *in, const char *before) {
+    if (!is_op(in->opcode, "mov") || in->noperands != 2) return false;
+    Operand *src = in->operands[0], *dst = in->operands[1];
+    if (!is_reg(src) || !is_reg(dst) || strcmp(src->reg, dst->reg) != 0) return false;
+    if (reg_size(dst->reg) == 32) return false;
+
+    remove_node(prog, i, before);
+    return true;
+}
+
+// mov %a, %b ; mov %b, %a -> drop the second move
+static bool rw_mov_back(Program *prog, size_t i, Instruction *in, const char *before) {
+    if (!is_op(in->opcode, "mov") || in->noperands != 2) return false;
+    Instruction *prev = prev_insn(prog, i);
+    if (!prev || !is_op(prev->opcode, "mov") || prev->noperands != 2) return false;
+
+    Operand *a = in->operands[0], *b = in->operands[1];
+    Operand *pa = prev->operands[0], *pb = prev->operands[1];
+    if (!is_reg(a) || !is_reg(b) || !is_reg(pa) || !is_reg(pb)) return false;
+    if (strcmp(a->reg, pb->reg) != 0 || strcmp(b->reg, pa->reg) != 0) return false;
+    // a 32-bit move zero-extends, so the reverse move isn't a no-op on the upper half
+    if (reg_size(a->reg) == 32) return false;
+
+    remove_node(prog, i, before);
+    return true;
+}
+
+// cmp $0, %reg -> test %reg, %reg (same flags bar AF, fuses with jcc)
+static bool rw_cmp_zero(Program *prog, size_t i, Instruction *in, const char *before) {
+    if (!is_op(in->opcode, "cmp") || in->noperands != 2) return false;
+    Operand *src = in->operands[0], *dst = in->operands[1];
+    if (src->kind != OP_IMM || src->imm != 0 || !is_reg(dst)) return false;
+    if (flags_live_after(prog, i) & FL_AF) return false;
+
+    in->opcode = make_opcode("test", 0);
+    src->kind = OP_REG;
+    src->reg = dst->reg;
+    report(prog->nodes[i]->line, before, in);
+    return true;
+}
+
+// inc/dec -> add/sub $1: avoids the partial-flags merge on CF, only legal if CF is dead
+static bool rw_incdec(Program *prog, size_t i, Instruction *in, const char *before) {
+    const char *base = is_op(in->opcode, "inc") ? "inc" : is_op(in->opcode, "dec") ? "dec" : NULL;
+    if (!base || in->noperands != 1) return false;
+    if (in->operands[0]->kind != OP_REG && in->operands[0]->kind != OP_MEM) return false;
+    if (flags_live_after(prog, i) & FL_CF) return false;
+
+    Operand *one = calloc(1, sizeof(Operand));
+    if (!one) { perror("calloc"); exit(1); }
+    one->kind = OP_IMM;
+    one->imm = 1;
+
+    Operand **ops = malloc(2 * sizeof(Operand *));
+    if (!ops) { perror("malloc"); exit(1); }
+    ops[0] = one;
+    ops[1] = in->operands[0];
+
+    in->opcode = make_opcode(base[0] == 'i' ? "add" : "sub", suffix_of(in->opcode, base));
+    in->operands = ops;
+    in->noperands = 2;
+    report(prog->nodes[i]->line, before, in);
+    return true;
+}
+
+// cmp X, Y ; sub X, Y -> sub X, Y (sub sets exactly the flags cmp did)
+static bool rw_cmp_sub(Program *prog, size_t i, Instruction *in, const char *before) {
+    if (!is_op(in->opcode, "cmp") || in->noperands != 2) return false;
+    Instruction *next = insn_at(prog, next_node(prog, i));
+    if (!next || !is_op(next->opcode, "sub") || next->noperands != 2) return false;
+    if (!same_operand(in->operands[0], next->operands[0]) ||
+        !same_operand(in->operands[1], next->operands[1])) return false;
+
+    remove_node(prog, i, before);
+    return true;
+}
+
+// op ..., %r ; test %r, %r (or cmp $0, %r) -> drop the compare
+static bool rw_redundant_test(Program *prog, size_t i, Instruction *in, const char *before) {
+    if (in->noperands != 2) return false;
+    Operand *src = in->operands[0], *dst = in->operands[1];
+    bool is_test = is_op(in->opcode, "test") && is_reg(src) && is_reg(dst) && !strcmp(src->reg, dst->reg);
+    bool is_cmp0 = is_op(in->opcode, "cmp") && src->kind == OP_IMM && src->imm == 0 && is_reg(dst);
+    if (!is_test && !is_cmp0) return false;
+
+    Instruction *prev = prev_insn(prog, i);
+    if (!prev || prev->noperands != 2) return false;
+    Operand *pdst = prev->operands[1];
+    if (!is_reg(pdst) || strcmp(pdst->reg, dst->reg) != 0) return false;
+
+    uint8_t live = flags_live_after(prog, i);
+    if (is_op(prev->opcode, "and") || is_op(prev->opcode, "or") || is_op(prev->opcode, "xor")) {
+        // logic ops leave CF = OF = 0 just like test
+        if (live & FL_AF) return false;
+    } else if (is_op(prev->opcode, "add") || is_op(prev->opcode, "sub")) {
+        if (live & (FL_CF | FL_OF | FL_AF)) return false;
+    } else {
+        return false;
+    }
+
+    remove_node(prog, i, before);
+    return true;
+}
+
+typedef bool (*Rewrite)(Program *, size_t, Instruction *, const char *);
+
+static const Rewrite rewrites[] = {
+    rw_self_mov,
+    rw_mov_back,
+    rw_cmp_sub,
+    rw_redundant_test,
+    rw_mov_zero,
+    rw_cmp_zero,
+    rw_incdec,
+    NULL
+};
+
+void peephole_program(Program *prog) {
+    size_t count = 0;
+
+    for (size_t i = 0; i < prog->nnodes; i++) {
+        Instruction *in = insn_at(prog, i);
+        if (!in) continue;
+
+        char before[256];
+        format_instruction(before, sizeof(before), in);
+
+        for (const Rewrite *rw = rewrites; *rw; rw++) {
+            if ((*rw)(prog, i, in, before)) {
+                count++;
+                break;
+            }
+        }
+    }
+
+    // compact out removed nodes
+    size_t n = 0;
+    for (size_t i = 0; i < prog->nnodes; i++)
+        if (prog->nodes[i]) prog->nodes[n++] = prog->nodes[i];
+    prog->nnodes = n;
+
+    printf("peephole: %zu rewrite%s\n", count, count == 1 ? "" : "s");
+}
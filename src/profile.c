@@ -0,0 +1,363 @@
+#define _XOPEN_SOURCE 500
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "jasm.h"
+
+/*
+ * Profile-guided code layout (--profile=FILE).
+ *
+ * The profile is a text file with one sample count per line:
+ *
+ *     name COUNT        samples attributed to a label
+ *     line:N COUNT      samples attributed to source line N
+ *
+ * Code is cut into functions (non-.L labels) and blocks (.L labels inside a
+ * function). Hot functions are sorted by sample count at the front of
+ * .text; functions without samples and blocks without samples inside hot
+ * functions move to .text.unlikely. Fallthroughs that no longer reach their
+ * successor get an explicit jmp, and layout relaxes the jumps afterwards.
+ */
+
+#define PAGE_SIZE 4096
+#define LINE_SIZE 64
+
+typedef struct {
+    char *name;
+    unsigned long count;
+} ProfileEntry;
+
+typedef struct {
+    ProfileEntry *labels;
+    size_t nlabels;
+    unsigned long *lines;   // indexed by source line
+    size_t nlines;
+} Profile;
+
+typedef struct {
+    size_t begin, end;      // node range [begin, end)
+    unsigned long count;
+    bool func;              // starts a function rather than a block
+    bool cold;
+} Chunk;
+
+static void *xrealloc(void *p, size_t n) {
+    p = realloc(p, n);
+    if (!p) { perror("realloc"); exit(1); }
+    return p;
+}
+
+// Line samples must name a line of the source, 1 to `maxline`.
+static bool load_profile(const char *path, Profile *prof, int maxline) {
+    FILE *f = fopen(path, "r");
+    if (!f) { perror(path); return false; }
+
+    char buf[1024];
+    int lineno = 0;
+    while (fgets(buf, sizeof(buf), f)) {
+        lineno++;
+        char *p = buf;
+        while (isspace((unsigned char)*p)) p++;
+        if (!*p || *p == '#') continue;
+
+        char name[512];
+        unsigned long count;
+        if (sscanf(p, "%511s %lu", name, &count) != 2) {
+            fprintf(stderr, "%s:%d: expected `name count` or `line:N count`\n", path, lineno);
+            continue;
+        }
+
+        if (!strncmp(name, "line:", 5)) {
+            char *end;
+            size_t line = strtoul(name + 5, &end, 10);
+            if (*end || line < 1 || line > (size_t)maxline) {
+                fprintf(stderr, "%s:%d: %s is not a source line (1-%d)\n", path, lineno, name, maxline);
+                continue;
+            }
+            if (line >= prof->nlines) {
+                size_t n = line + 1;
+                prof->lines = xrealloc(prof->lines, n * sizeof(unsigned long));
+                memset(prof->lines + prof->nlines, 0, (n - prof->nlines) * sizeof(unsigned long));
+                prof->nlines = n;
+            }
+            prof->lines[line] += count;
+        } else {
+            prof->labels = xrealloc(prof->labels, (prof->nlabels + 1) * sizeof(ProfileEntry));
+            prof->labels[prof->nlabels].name = strdup(name);
+            prof->labels[prof->nlabels].count = count;
+            prof->nlabels++;
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+static bool label_count(Profile *prof, const char *name, unsigned long *count) {
+    for (size_t i = 0; i < prof->nlabels; i++) {
+        if (!strcmp(prof->labels[i].name, name)) {
+            *count = prof->labels[i].count;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_local(const char *label) {
+    return strncmp(label, ".L", 2) == 0;
+}
+
+// An explicit label count wins; otherwise sum the per-line samples.
+static unsigned long chunk_count(Program *prog, Profile *prof, Chunk *c) {
+    Node *first = prog->nodes[c->begin];
+    unsigned long count = 0;
+    if (first->kind == NODE_LABEL && label_count(prof, first->u.label, &count))
+        return count;
+
+    for (size_t i = c->begin; i < c->end; i++) {
+        int line = prog->nodes[i]->line;
+        if (line > 0 && (size_t)line < prof->nlines) count += prof->lines[line];
+    }
+    return count;
+}
+
+static bool falls_through(Program *prog, Chunk *c) {
+    for (size_t i = c->end; i-- > c->begin;) {
+        Node *n = prog->nodes[i];
+        if (n->kind != NODE_INSTRUCTION) continue;
+        const char *op = n->u.instruction.opcode;
+        return strcmp(op, "jmp") && strcmp(op, "jmpq") && strcmp(op, "ret") && strcmp(op, "retq");
+    }
+    // a bare label still falls into its successor; a directive-only prefix has no code to continue
+    return prog->nodes[c->begin]->kind == NODE_LABEL;
+}
+
+static Node *make_jmp(const char *target, int line) {
+    Node *n = calloc(1, sizeof(Node));
+    Operand *op = calloc(1, sizeof(Operand));
+    Operand **ops = malloc(sizeof(Operand *));
+    if (!n || !op || !ops) { perror("calloc"); exit(1); }
+
+    op->kind = OP_LABELREF;
+    op->text = strdup(target);
+    op->labelref = strdup(target);
+    ops[0] = op;
+
+    n->kind = NODE_INSTRUCTION;
+    n->line = line;
+    n->u.instruction.opcode = strdup("jmp");
+    n->u.instruction.operands = ops;
+    n->u.instruction.noperands = 1;
+    return n;
+}
+
+static Node *make_section(const char *name) {
+    Node *n = calloc(1, sizeof(Node));
+    char **args = malloc(sizeof(char *));
+    if (!n || !args) { perror("calloc"); exit(1); }
+
+    args[0] = strdup(name);
+    n->kind = NODE_DIRECTIVE;
+    n->u.directive.name = strdup(".section");
+    n->u.directive.args = args;
+    n->u.directive.nargs = 1;
+    return n;
+}
+
+// -------------------- Footprint estimate --------------------
+
+static uint32_t node_size(Node *n) {
+    if (n->kind == NODE_INSTRUCTION) return calculate_instruction_size(&n->u.instruction);
+    if (n->kind == NODE_DIRECTIVE) return encode_directive(NULL, &n->u.directive);
+    return 0;
+}
+
+typedef struct {
+    uint32_t hot_bytes;
+    uint32_t pages;
+    uint32_t lines;
+} Footprint;
+
+// Pages and cache lines touched by hot chunks laid out in the given order.
+// A chunk is hot when it has samples and was not classified cold, so both
+// layouts are measured over the same bytes.
+static Footprint footprint(Program *prog, Chunk **order, size_t n) {
+    Footprint fp = {0};
+    uint32_t off = 0;
+    long last_page = -1, last_line = -1;
+
+    for (size_t k = 0; k < n; k++) {
+        Chunk *c = order[k];
+        uint32_t size = 0;
+        for (size_t i = c->begin; i < c->end; i++) size += node_size(prog->nodes[i]);
+
+        if (c->count && !c->cold && size) {
+            fp.hot_bytes += size;
+            for (long p = off / PAGE_SIZE; p <= (long)((off + size - 1) / PAGE_SIZE); p++)
+                if (p != last_page) { fp.pages++; last_page = p; }
+            for (long l = off / LINE_SIZE; l <= (long)((off + size - 1) / LINE_SIZE); l++)
+                if (l != last_line) { fp.lines++; last_line = l; }
+        }
+        off += size;
+    }
+    return fp;
+}
+
+// -------------------- Reordering --------------------
+
+static int cmp_hotness(const void *a, const void *b) {
+    const Chunk *x = *(Chunk * const *)a, *y = *(Chunk * const *)b;
+    if (x->count != y->count) return x->count < y->count ? 1 : -1;
+    return x->begin < y->begin ? -1 : x->begin > y->begin;
+}
+
+static void push_node(Node ***nodes, size_t *n, size_t *cap, Node *node) {
+    if (*n == *cap) {
+        *cap = *cap ? *cap * 2 : 128;
+        *nodes = xrealloc(*nodes, *cap * sizeof(Node *));
+    }
+    (*nodes)[(*n)++] = node;
+}
+
+void apply_profile(Program *prog, const char *path) {
+    Profile prof = {0};
+    int maxline = 0;
+    for (size_t i = 0; i < prog->nnodes; i++)
+        if (prog->nodes[i]->line > maxline) maxline = prog->nodes[i]->line;
+    if (!load_profile(path, &prof, maxline)) exit(1);
+
+    // Assign sections the way layout will, to find the code runs.
+    Section *secs = malloc(prog->nnodes * sizeof(Section) + 1);
+    bool *switches = calloc(prog->nnodes + 1, sizeof(bool));
+    SectionState st;
+    section_state_init(&st);
+    for (size_t i = 0; i < prog->nnodes; i++) {
+        Node *n = prog->nodes[i];
+        if (n->kind == NODE_DIRECTIVE) switches[i] = section_directive(&n->u.directive, &st);
+        secs[i] = st.cur.sec;
+    }
+
+    // Cut code into chunks. A chunk starts at every label in .text and at
+    // every section switch; nodes before the first function of a run form a
+    // pinned prefix chunk.
+    Chunk *chunks = NULL;
+    size_t nchunks = 0;
+    for (size_t i = 0; i < prog->nnodes; i++) {
+        Node *n = prog->nodes[i];
+        bool label = n->kind == NODE_LABEL && secs[i] == SECTION_CODE;
+        if (i == 0 || label || switches[i]) {
+            chunks = xrealloc(chunks, (nchunks + 1) * sizeof(Chunk));
+            Chunk *c = &chunks[nchunks++];
+            memset(c, 0, sizeof(*c));
+            c->begin = i;
+            c->func = label && !is_local(n->u.label);
+        }
+        chunks[nchunks - 1].end = i + 1;
+    }
+
+    Chunk **order = malloc(nchunks * sizeof(Chunk *));
+    Chunk **hot = malloc(nchunks * sizeof(Chunk *));
+    size_t nfuncs = 0, nhot = 0, ncold_funcs = 0, ncold_blocks = 0;
+
+    for (size_t k = 0; k < nchunks; k++) {
+        chunks[k].count = chunk_count(prog, &prof, &chunks[k]);
+        order[k] = &chunks[k];
+    }
+
+    // A function's hotness is its own count, or the sum over its blocks.
+    for (size_t k = 0; k < nchunks; k++) {
+        Chunk *f = &chunks[k];
+        if (!f->func) continue;
+        nfuncs++;
+
+        unsigned long sum = f->count;
+        size_t e;
+        for (e = k + 1; e < nchunks; e++) {
+            Node *first = prog->nodes[chunks[e].begin];
+            if (chunks[e].func || first->kind != NODE_LABEL || secs[chunks[e].begin] != SECTION_CODE) break;
+            sum += chunks[e].count;
+        }
+        unsigned long fcount = f->count;
+        if (!label_count(&prof, prog->nodes[f->begin]->u.label, &fcount)) fcount = sum;
+
+        if (!fcount) {
+            for (size_t b = k; b < e; b++) chunks[b].cold = true;
+            ncold_funcs++;
+            continue;
+        }
+        f->count = fcount;
+        for (size_t b = k + 1; b < e; b++) {
+            if (!chunks[b].count) {
+                chunks[b].cold = true;
+                ncold_blocks++;
+            }
+        }
+    }
+
+    Footprint before = footprint(prog, order, nchunks);
+
+    // New order: within each run of functions, hot functions sorted by
+    // count (their blocks follow in source order); cold chunks go last.
+    size_t norder = 0;
+    for (size_t k = 0; k < nchunks;) {
+        if (!chunks[k].func) {
+            if (!chunks[k].cold) order[norder++] = &chunks[k];
+            k++;
+            continue;
+        }
+        nhot = 0;
+        while (k < nchunks && (chunks[k].func || (prog->nodes[chunks[k].begin]->kind == NODE_LABEL &&
+                secs[chunks[k].begin] == SECTION_CODE))) {
+            if (chunks[k].func && !chunks[k].cold) hot[nhot++] = &chunks[k];
+            k++;
+        }
+        qsort(hot, nhot, sizeof(Chunk *), cmp_hotness);
+        for (size_t h = 0; h < nhot; h++) {
+            order[norder++] = hot[h];
+            for (size_t b = hot[h] - chunks + 1; b < k && !chunks[b].func; b++)
+                if (!chunks[b].cold) order[norder++] = &chunks[b];
+        }
+    }
+    size_t nwarm = norder;
+    for (size_t k = 0; k < nchunks; k++)
+        if (chunks[k].cold) order[norder++] = &chunks[k];
+
+    Footprint after = footprint(prog, order, nwarm);
+
+    // Rebuild the node list, adding jumps where a fallthrough was broken.
+    Node **nodes = NULL;
+    size_t n = 0, cap = 0;
+    for (size_t k = 0; k < norder; k++) {
+        Chunk *c = order[k];
+        if (k == nwarm) push_node(&nodes, &n, &cap, make_section(".text.unlikely"));
+
+        for (size_t i = c->begin; i < c->end; i++) push_node(&nodes, &n, &cap, prog->nodes[i]);
+
+        size_t orig_next = c - chunks + 1;
+        Chunk *next = k + 1 < norder ? order[k + 1] : NULL;
+        if (orig_next >= nchunks || next == &chunks[orig_next]) continue;
+        Node *target = prog->nodes[chunks[orig_next].begin];
+        if (target->kind != NODE_LABEL || !falls_through(prog, c)) continue;
+        push_node(&nodes, &n, &cap, make_jmp(target->u.label, prog->nodes[c->end - 1]->line));
+    }
+
+    printf("profile: %zu function%s, %zu moved to .text.unlikely, %zu cold block%s split out\n",
+        nfuncs, nfuncs == 1 ? "" : "s", ncold_funcs, ncold_blocks, ncold_blocks == 1 ? "" : "s");
+    printf("profile: %u hot bytes: %u page%s / %u lines before, %u page%s / %u lines after\n",
+        before.hot_bytes, before.pages, before.pages == 1 ? "" : "s", before.lines,
+        after.pages, after.pages == 1 ? "" : "s", after.lines);
+    printf("profile: hot bytes per page %u -> %u\n",
+        before.pages ? before.hot_bytes / before.pages : 0,
+        after.pages ? after.hot_bytes / after.pages : 0);
+
+    free(prog->nodes);
+    prog->nodes = nodes;
+    prog->nnodes = n;
+
+    free(order);
+    free(hot);
+    free(chunks);
+    free(switches);
+    free(secs);
+}
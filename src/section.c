@@ -0,0 +1,262 @@
+#define _XOPEN_SOURCE 500
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <elf.h>
+#include "jasm.h"
+
+/*
+ * Section table and the section-switching directives:
+ *
+ *     .text [N]  .data [N]  .bss [N]  .code
+ *     .section NAME[, "FLAGS"[, @TYPE[, ENTSIZE]]]
+ *     .pushsection NAME[, N][, "FLAGS"[, @TYPE[, ENTSIZE]]]
+ *     .popsection  .previous  .subsection N
+ *
+ * Sections are created on first use, with the attributes gas gives the
+ * well-known names unless .section spells them out.
+ */
+
+SectionTable G_sections;
+
+typedef struct {
+    const char *prefix;     // matches NAME and NAME.*
+    uint64_t flags;
+    uint32_t type;
+    uint32_t align;
+} SectionDefaults;
+
+static const SectionDefaults section_defaults[] = {
+    {".text",          SHF_ALLOC | SHF_EXECINSTR,     SHT_PROGBITS,      16},
+    {".data",          SHF_ALLOC | SHF_WRITE,         SHT_PROGBITS,      8},
+    {".rodata",        SHF_ALLOC,                     SHT_PROGBITS,      1},
+    {".bss",           SHF_ALLOC | SHF_WRITE,         SHT_NOBITS,        1},
+    {".tdata",         SHF_ALLOC | SHF_WRITE | SHF_TLS, SHT_PROGBITS,    1},
+    {".tbss",          SHF_ALLOC | SHF_WRITE | SHF_TLS, SHT_NOBITS,      1},
+    {".init_array",    SHF_ALLOC | SHF_WRITE,         SHT_INIT_ARRAY,    8},
+    {".fini_array",    SHF_ALLOC | SHF_WRITE,         SHT_FINI_ARRAY,    8},
+    {".preinit_array", SHF_ALLOC | SHF_WRITE,         SHT_PREINIT_ARRAY, 8},
+    {".note",          0,                             SHT_NOTE,          1},
+};
+
+static const SectionDefaults *defaults_for(const char *name) {
+    for (size_t i = 0; i < sizeof(section_defaults) / sizeof(section_defaults[0]); i++) {
+        size_t n = strlen(section_defaults[i].prefix);
+        if (!strncmp(name, section_defaults[i].prefix, n) && (name[n] == '\0' || name[n] == '.'))
+            return &section_defaults[i];
+    }
+    return NULL;
+}
+
+static Section add_section(const char *name) {
+    if (G_sections.count == G_sections.capacity) {
+        G_sections.capacity = G_sections.capacity ? G_sections.capacity * 2 : 8;
+        G_sections.entries = realloc(G_sections.entries, G_sections.capacity * sizeof(SectionDef));
+        if (!G_sections.entries) { perror("realloc"); exit(1); }
+    }
+
+    const SectionDefaults *def = defaults_for(name);
+    SectionDef *s = &G_sections.entries[G_sections.count];
+    memset(s, 0, sizeof(*s));
+    s->name = strdup(name);
+    s->flags = def ? def->flags : 0;
+    s->type = def ? def->type : SHT_PROGBITS;
+    s->align = def ? def->align : 1;
+
+    // .rodata.strN.M holds NUL-terminated strings of N-byte characters
+    // aligned to M, and .rodata.cstN N-byte constants; both are mergeable
+    unsigned a, b;
+    char end;
+    if (sscanf(name, ".rodata.str%u.%u%c", &a, &b, &end) == 2 && a) {
+        s->flags |= SHF_MERGE | SHF_STRINGS;
+        s->entsize = a;
+        s->align = b ? b : 1;
+    } else if (sscanf(name, ".rodata.cst%u%c", &a, &end) == 1 && a) {
+        s->flags |= SHF_MERGE;
+        s->entsize = a;
+        s->align = a;
+    }
+    return G_sections.count++;
+}
+
+static void init_sections(void) {
+    if (G_sections.count) return;
+    add_section(".text");   // SECTION_CODE
+    add_section(".data");   // SECTION_DATA
+}
+
+Section section_lookup(const char *name) {
+    init_sections();
+    for (size_t i = 0; i < G_sections.count; i++)
+        if (!strcmp(G_sections.entries[i].name, name)) return i;
+    return add_section(name);
+}
+
+bool is_code_section(Section sec) {
+    return G_sections.entries[sec].flags & SHF_EXECINSTR;
+}
+
+bool is_nobits_section(Section sec) {
+    return G_sections.entries[sec].type == SHT_NOBITS;
+}
+
+void section_state_init(SectionState *st) {
+    init_sections();
+    memset(st, 0, sizeof(*st));
+    st->cur.sec = st->prev.sec = SECTION_CODE;
+}
+
+static const char *arg_at(Directive *d, size_t i) {
+    return i < d->nargs && d->args[i] ? d->args[i] : NULL;
+}
+
+static bool is_number(const char *s) {
+    if (!s || !*s) return false;
+    if (*s == '-') s++;
+    return isdigit((unsigned char)*s);
+}
+
+static bool parse_flags(const char *s, uint64_t *flags) {
+    *flags = 0;
+    if (*s == '"') s++;
+    for (; *s && *s != '"'; s++) {
+        switch (*s) {
+            case 'a': *flags |= SHF_ALLOC; break;
+            case 'w': *flags |= SHF_WRITE; break;
+            case 'x': *flags |= SHF_EXECINSTR; break;
+            case 'M': *flags |= SHF_MERGE; break;
+            case 'S': *flags |= SHF_STRINGS; break;
+            case 'T': *flags |= SHF_TLS; break;
+            default:
+                fprintf(stderr, ".section: unsupported flag '%c'\n", *s);
+                return false;
+        }
+    }
+    return true;
+}
+
+static bool parse_type(const char *s, uint32_t *type) {
+    static const struct { const char *name; uint32_t type; } types[] = {
+        {"progbits", SHT_PROGBITS},
+        {"nobits", SHT_NOBITS},
+        {"note", SHT_NOTE},
+        {"init_array", SHT_INIT_ARRAY},
+        {"fini_array", SHT_FINI_ARRAY},
+        {"preinit_array", SHT_PREINIT_ARRAY},
+    };
+
+    if (*s == '@' || *s == '%') s++;
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
+        if (!strcmp(s, types[i].name)) {
+            *type = types[i].type;
+            return true;
+        }
+    }
+    fprintf(stderr, ".section: unknown section type %s\n", s);
+    return false;
+}
+
+// Apply "FLAGS", @TYPE, ENTSIZE starting at argument i.
+static void section_attributes(Directive *d, size_t i, Section sec) {
+    const char *flags_arg = arg_at(d, i);
+    if (!flags_arg) return;
+
+    SectionDef *s = &G_sections.entries[sec];
+    uint64_t flags;
+    uint32_t type = s->type;
+    uint32_t entsize = 0;
+    if (!parse_flags(flags_arg, &flags)) return;
+    if (arg_at(d, i + 1) && !parse_type(arg_at(d, i + 1), &type)) return;
+    if (flags & SHF_MERGE) {
+        entsize = arg_at(d, i + 2) ? strtoul(arg_at(d, i + 2), NULL, 0) : 0;
+        if (!entsize) {
+            fprintf(stderr, ".section %s: entity size expected for mergeable section\n", s->name);
+            flags &= ~(uint64_t)SHF_MERGE;
+        }
+    }
+
+    if (s->declared && (s->flags != flags || s->type != type || s->entsize != entsize)) {
+        fprintf(stderr, ".section %s: changed section attributes\n", s->name);
+        return;
+    }
+    s->flags = flags;
+    s->type = type;
+    s->entsize = entsize;
+    s->declared = true;
+}
+
+static void switch_to(SectionState *st, Section sec, int sub) {
+    st->prev = st->cur;
+    st->cur.sec = sec;
+    st->cur.sub = sub;
+}
+
+// Updates st for a section directive; returns false for anything else.
+bool section_directive(Directive *d, SectionState *st) {
+    const char *name = d->name;
+
+    if (!strcmp(name, ".text") || !strcmp(name, ".code") || !strcmp(name, ".data") || !strcmp(name, ".bss")) {
+        int sub = arg_at(d, 0) ? (int)strtol(arg_at(d, 0), NULL, 0) : 0;
+        Section sec = name[1] == 'd' ? SECTION_DATA : name[1] == 'b' ? section_lookup(".bss") : SECTION_CODE;
+        switch_to(st, sec, sub);
+        return true;
+    }
+
+    if (!strcmp(name, ".section") || !strcmp(name, ".pushsection")) {
+        const char *sname = arg_at(d, 0);
+        if (!sname || !*sname) {
+            fprintf(stderr, "%s: missing section name\n", name);
+            return false;
+        }
+
+        bool push = name[1] == 'p';
+        size_t attr = 1;
+        int sub = 0;
+        if (push && is_number(arg_at(d, 1))) {
+            sub = (int)strtol(arg_at(d, 1), NULL, 0);
+            attr = 2;
+        }
+        if (push) {
+            if (st->depth == SECTION_STACK_MAX) {
+                fprintf(stderr, ".pushsection: section stack overflow\n");
+                return false;
+            }
+            st->stack[st->depth].cur = st->cur;
+            st->stack[st->depth].prev = st->prev;
+            st->depth++;
+        }
+
+        Section sec = section_lookup(sname);
+        section_attributes(d, attr, sec);
+        switch_to(st, sec, sub);
+        return true;
+    }
+
+    if (!strcmp(name, ".popsection")) {
+        if (!st->depth) {
+            fprintf(stderr, ".popsection without .pushsection\n");
+            return false;
+        }
+        st->depth--;
+        st->cur = st->stack[st->depth].cur;
+        st->prev = st->stack[st->depth].prev;
+        return true;
+    }
+
+    if (!strcmp(name, ".previous")) {
+        SectionRef tmp = st->cur;
+        st->cur = st->prev;
+        st->prev = tmp;
+        return true;
+    }
+
+    if (!strcmp(name, ".subsection")) {
+        int sub = arg_at(d, 0) ? (int)strtol(arg_at(d, 0), NULL, 0) : 0;
+        switch_to(st, st->cur.sec, sub);
+        return true;
+    }
+
+    return false;
+}
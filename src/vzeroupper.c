@@ -0,0 +1,183 @@
+#define _XOPEN_SOURCE 500
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "jasm.h"
+
+/*
+ * SSE/AVX transition check, and -mvzeroupper.
+ *
+ * Once a 256- or 512-bit instruction has run, the upper halves of the vector
+ * registers are dirty until vzeroupper or vzeroall. A legacy (non-VEX) SSE
+ * instruction in that state costs a state transition or a false dependency
+ * on the upper halves, and so does calling or returning to code that uses
+ * SSE. The pass tracks "maybe dirty" forward through the code: fallthrough,
+ * jumps to labels in the file, and ret or jmp ending a path. Code after a
+ * ret or jmp is entered clean, as the ABI requires of function entries,
+ * unless a jump within the file or a fallthrough brings dirty state to it.
+ *
+ * Each legacy SSE instruction reached dirty gets a warning, and so does each
+ * call, ret or tail jmp out of the file. With -mvzeroupper a vzeroupper is
+ * inserted before those instead. That is wrong for functions taking or
+ * returning __m256 values in %ymm registers, so it is off by default.
+ */
+
+typedef struct {
+    const char *name;
+    size_t node;
+} LabelIndex;
+
+static int cmp_label(const void *a, const void *b) {
+    return strcmp(((const LabelIndex *)a)->name, ((const LabelIndex *)b)->name);
+}
+
+static bool is_op(const char *opcode, const char *base) {
+    size_t n = strlen(base);
+    return !strncmp(opcode, base, n) && (!opcode[n] || (opcode[n] == 'q' && !opcode[n + 1]));
+}
+
+static bool is_jcc(const Instruction *in) {
+    return in->opcode[0] == 'j' && cond_code(in->opcode + 1) >= 0;
+}
+
+static bool has_vector_reg(const Instruction *in, int min_size) {
+    for (size_t i = 0; i < in->noperands; i++) {
+        const Operand *o = in->operands[i];
+        if (o->kind == OP_REG && o->reg && (!strncmp(o->reg, "%xmm", 4) || !strncmp(o->reg, "%ymm", 4) ||
+                                            !strncmp(o->reg, "%zmm", 4)) && reg_size(o->reg) >= min_size)
+            return true;
+    }
+    return false;
+}
+
+// legacy-encoded SSE: an %xmm operand on a mnemonic without the v prefix
+static bool is_legacy_sse(const Instruction *in) {
+    return in->opcode[0] != 'v' && has_vector_reg(in, 128);
+}
+
+typedef struct {
+    Program *prog;
+    LabelIndex *labels;
+    size_t nlabels;
+    bool *jump_in;          // per label node: reached dirty by some jump
+    bool insert;
+} Flow;
+
+// node of the label a direct jump targets, or prog->nnodes
+static size_t jump_target(Flow *f, const Instruction *in) {
+    if (in->noperands != 1 || in->operands[0]->kind != OP_LABELREF) return f->prog->nnodes;
+    LabelIndex key = {in->operands[0]->labelref, 0};
+    LabelIndex *l = bsearch(&key, f->labels, f->nlabels, sizeof(LabelIndex), cmp_label);
+    return l ? l->node : f->prog->nnodes;
+}
+
+// One forward sweep. Propagates dirty state into jump targets and returns
+// whether any changed; with `report`, warns or marks vzeroupper sites.
+static bool sweep(Flow *f, bool report, bool *insert_before, size_t *nwarn) {
+    Program *prog = f->prog;
+    bool changed = false;
+    bool dirty = false;
+    bool warned = false;    // one SSE warning per dirty stretch
+
+    for (size_t i = 0; i < prog->nnodes; i++) {
+        Node *n = prog->nodes[i];
+        if (n->kind == NODE_LABEL) {
+            // after ret or jmp dirty is already clear, so a function entry
+            // starts clean; a label fallen into keeps the state it arrives with
+            dirty |= f->jump_in[i];
+            warned = false;
+            continue;
+        }
+        if (n->kind != NODE_INSTRUCTION) continue;
+
+        Instruction *in = &n->u.instruction;
+        if (!strcmp(in->opcode, "vzeroupper") || !strcmp(in->opcode, "vzeroall")) {
+            dirty = false;
+            continue;
+        }
+        if (has_vector_reg(in, 256)) {
+            dirty = true;
+            warned = false;
+            continue;
+        }
+
+        bool jmp = is_op(in->opcode, "jmp");
+        bool ret = is_op(in->opcode, "ret");
+        size_t t = jmp || is_jcc(in) ? jump_target(f, in) : prog->nnodes;
+        if (t < prog->nnodes) {
+            if (dirty && !f->jump_in[t]) f->jump_in[t] = changed = true;
+        } else if (dirty && report && (ret || is_op(in->opcode, "call") || (jmp && in->operands[0]->kind == OP_LABELREF))) {
+            // leaving the code we can see: the other side may run SSE
+            if (f->insert) {
+                insert_before[i] = true;
+                if (!ret) dirty = false;
+            } else {
+                fprintf(stderr, "line %d: %s with dirty upper vector state, add vzeroupper (SSE/AVX transition)\n",
+                    n->line, in->opcode);
+                (*nwarn)++;
+            }
+        } else if (dirty && report && !warned && is_legacy_sse(in)) {
+            fprintf(stderr, "line %d: legacy SSE %s after 256-bit AVX without vzeroupper (SSE/AVX transition)\n",
+                n->line, in->opcode);
+            (*nwarn)++;
+            warned = true;
+        }
+        if (jmp || ret) dirty = false;
+    }
+    return changed;
+}
+
+static Node *make_vzeroupper(int line) {
+    Node *n = calloc(1, sizeof(Node));
+    if (!n) { perror("calloc"); exit(1); }
+
+    n->kind = NODE_INSTRUCTION;
+    n->line = line;
+    n->u.instruction.opcode = strdup("vzeroupper");
+    return n;
+}
+
+void vzeroupper_program(Program *prog, bool insert) {
+    Flow f = {prog, NULL, 0, calloc(prog->nnodes + 1, sizeof(bool)), insert};
+    bool *insert_before = calloc(prog->nnodes + 1, sizeof(bool));
+    f.labels = malloc((prog->nnodes + 1) * sizeof(LabelIndex));
+    if (!f.jump_in || !insert_before || !f.labels) { perror("calloc"); exit(1); }
+
+    for (size_t i = 0; i < prog->nnodes; i++)
+        if (prog->nodes[i]->kind == NODE_LABEL)
+            f.labels[f.nlabels++] = (LabelIndex){prog->nodes[i]->u.label, i};
+    qsort(f.labels, f.nlabels, sizeof(LabelIndex), cmp_label);
+
+    // jump_in only ever turns on, so this settles within one sweep per label
+    size_t nwarn = 0;
+    while (sweep(&f, false, NULL, NULL))
+        ;
+    sweep(&f, true, insert_before, &nwarn);
+
+    size_t count = 0;
+    for (size_t i = 0; i < prog->nnodes; i++) count += insert_before[i];
+    if (count) {
+        Node **nodes = malloc((prog->nnodes + count) * sizeof(Node *));
+        if (!nodes) { perror("malloc"); exit(1); }
+        size_t n = 0;
+        for (size_t i = 0; i < prog->nnodes; i++) {
+            if (insert_before[i]) {
+                nodes[n++] = make_vzeroupper(prog->nodes[i]->line);
+                printf("vzeroupper: line %d: inserted before %s\n", prog->nodes[i]->line,
+                    prog->nodes[i]->u.instruction.opcode);
+            }
+            nodes[n++] = prog->nodes[i];
+        }
+        free(prog->nodes);
+        prog->nodes = nodes;
+        prog->nnodes = n;
+    }
+    if (nwarn)
+        fprintf(stderr, "%zu SSE/AVX transition%s%s\n", nwarn, nwarn == 1 ? "" : "s",
+            insert ? "" : "; -mvzeroupper inserts vzeroupper before call and ret");
+
+    free(f.labels);
+    free(f.jump_in);
+    free(insert_before);
+}
@@ -0,0 +1,2167 @@
+# AVX, AVX2 and FMA3 in VEX encoding
+.text
+    vaddps %xmm1,%xmm2,%xmm3
+    vaddps %xmm9,%xmm12,%xmm15
+    vaddps %ymm1,%ymm10,%ymm3
+    vaddps %ymm13,%ymm2,%ymm14
+    vaddps (%rax),%xmm2,%xmm3
+    vaddps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vaddps -8(%rsp),%ymm10,%ymm3
+    vaddps 0x1000(%r9),%ymm2,%ymm14
+    vaddpd %xmm1,%xmm2,%xmm3
+    vaddpd %xmm9,%xmm12,%xmm15
+    vaddpd %ymm1,%ymm10,%ymm3
+    vaddpd %ymm13,%ymm2,%ymm14
+    vaddpd (%rax),%xmm2,%xmm3
+    vaddpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vaddpd -8(%rsp),%ymm10,%ymm3
+    vaddpd 0x1000(%r9),%ymm2,%ymm14
+    vaddss %xmm1,%xmm2,%xmm3
+    vaddss %xmm9,%xmm12,%xmm15
+    vaddss (%rax),%xmm2,%xmm3
+    vaddss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vaddsd %xmm1,%xmm2,%xmm3
+    vaddsd %xmm9,%xmm12,%xmm15
+    vaddsd (%rax),%xmm2,%xmm3
+    vaddsd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vmulps %xmm1,%xmm2,%xmm3
+    vmulps %xmm9,%xmm12,%xmm15
+    vmulps %ymm1,%ymm10,%ymm3
+    vmulps %ymm13,%ymm2,%ymm14
+    vmulps (%rax),%xmm2,%xmm3
+    vmulps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vmulps -8(%rsp),%ymm10,%ymm3
+    vmulps 0x1000(%r9),%ymm2,%ymm14
+    vmulpd %xmm1,%xmm2,%xmm3
+    vmulpd %xmm9,%xmm12,%xmm15
+    vmulpd %ymm1,%ymm10,%ymm3
+    vmulpd %ymm13,%ymm2,%ymm14
+    vmulpd (%rax),%xmm2,%xmm3
+    vmulpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vmulpd -8(%rsp),%ymm10,%ymm3
+    vmulpd 0x1000(%r9),%ymm2,%ymm14
+    vmulss %xmm1,%xmm2,%xmm3
+    vmulss %xmm9,%xmm12,%xmm15
+    vmulss (%rax),%xmm2,%xmm3
+    vmulss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vmulsd %xmm1,%xmm2,%xmm3
+    vmulsd %xmm9,%xmm12,%xmm15
+    vmulsd (%rax),%xmm2,%xmm3
+    vmulsd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vsubps %xmm1,%xmm2,%xmm3
+    vsubps %xmm9,%xmm12,%xmm15
+    vsubps %ymm1,%ymm10,%ymm3
+    vsubps %ymm13,%ymm2,%ymm14
+    vsubps (%rax),%xmm2,%xmm3
+    vsubps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vsubps -8(%rsp),%ymm10,%ymm3
+    vsubps 0x1000(%r9),%ymm2,%ymm14
+    vsubpd %xmm1,%xmm2,%xmm3
+    vsubpd %xmm9,%xmm12,%xmm15
+    vsubpd %ymm1,%ymm10,%ymm3
+    vsubpd %ymm13,%ymm2,%ymm14
+    vsubpd (%rax),%xmm2,%xmm3
+    vsubpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vsubpd -8(%rsp),%ymm10,%ymm3
+    vsubpd 0x1000(%r9),%ymm2,%ymm14
+    vsubss %xmm1,%xmm2,%xmm3
+    vsubss %xmm9,%xmm12,%xmm15
+    vsubss (%rax),%xmm2,%xmm3
+    vsubss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vsubsd %xmm1,%xmm2,%xmm3
+    vsubsd %xmm9,%xmm12,%xmm15
+    vsubsd (%rax),%xmm2,%xmm3
+    vsubsd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vminps %xmm1,%xmm2,%xmm3
+    vminps %xmm9,%xmm12,%xmm15
+    vminps %ymm1,%ymm10,%ymm3
+    vminps %ymm13,%ymm2,%ymm14
+    vminps (%rax),%xmm2,%xmm3
+    vminps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vminps -8(%rsp),%ymm10,%ymm3
+    vminps 0x1000(%r9),%ymm2,%ymm14
+    vminpd %xmm1,%xmm2,%xmm3
+    vminpd %xmm9,%xmm12,%xmm15
+    vminpd %ymm1,%ymm10,%ymm3
+    vminpd %ymm13,%ymm2,%ymm14
+    vminpd (%rax),%xmm2,%xmm3
+    vminpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vminpd -8(%rsp),%ymm10,%ymm3
+    vminpd 0x1000(%r9),%ymm2,%ymm14
+    vminss %xmm1,%xmm2,%xmm3
+    vminss %xmm9,%xmm12,%xmm15
+    vminss (%rax),%xmm2,%xmm3
+    vminss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vminsd %xmm1,%xmm2,%xmm3
+    vminsd %xmm9,%xmm12,%xmm15
+    vminsd (%rax),%xmm2,%xmm3
+    vminsd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vdivps %xmm1,%xmm2,%xmm3
+    vdivps %xmm9,%xmm12,%xmm15
+    vdivps %ymm1,%ymm10,%ymm3
+    vdivps %ymm13,%ymm2,%ymm14
+    vdivps (%rax),%xmm2,%xmm3
+    vdivps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vdivps -8(%rsp),%ymm10,%ymm3
+    vdivps 0x1000(%r9),%ymm2,%ymm14
+    vdivpd %xmm1,%xmm2,%xmm3
+    vdivpd %xmm9,%xmm12,%xmm15
+    vdivpd %ymm1,%ymm10,%ymm3
+    vdivpd %ymm13,%ymm2,%ymm14
+    vdivpd (%rax),%xmm2,%xmm3
+    vdivpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vdivpd -8(%rsp),%ymm10,%ymm3
+    vdivpd 0x1000(%r9),%ymm2,%ymm14
+    vdivss %xmm1,%xmm2,%xmm3
+    vdivss %xmm9,%xmm12,%xmm15
+    vdivss (%rax),%xmm2,%xmm3
+    vdivss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vdivsd %xmm1,%xmm2,%xmm3
+    vdivsd %xmm9,%xmm12,%xmm15
+    vdivsd (%rax),%xmm2,%xmm3
+    vdivsd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vmaxps %xmm1,%xmm2,%xmm3
+    vmaxps %xmm9,%xmm12,%xmm15
+    vmaxps %ymm1,%ymm10,%ymm3
+    vmaxps %ymm13,%ymm2,%ymm14
+    vmaxps (%rax),%xmm2,%xmm3
+    vmaxps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vmaxps -8(%rsp),%ymm10,%ymm3
+    vmaxps 0x1000(%r9),%ymm2,%ymm14
+    vmaxpd %xmm1,%xmm2,%xmm3
+    vmaxpd %xmm9,%xmm12,%xmm15
+    vmaxpd %ymm1,%ymm10,%ymm3
+    vmaxpd %ymm13,%ymm2,%ymm14
+    vmaxpd (%rax),%xmm2,%xmm3
+    vmaxpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vmaxpd -8(%rsp),%ymm10,%ymm3
+    vmaxpd 0x1000(%r9),%ymm2,%ymm14
+    vmaxss %xmm1,%xmm2,%xmm3
+    vmaxss %xmm9,%xmm12,%xmm15
+    vmaxss (%rax),%xmm2,%xmm3
+    vmaxss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vmaxsd %xmm1,%xmm2,%xmm3
+    vmaxsd %xmm9,%xmm12,%xmm15
+    vmaxsd (%rax),%xmm2,%xmm3
+    vmaxsd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vsqrtps %xmm1,%xmm3
+    vsqrtps %xmm9,%xmm15
+    vsqrtps %ymm1,%ymm3
+    vsqrtps %ymm13,%ymm14
+    vsqrtps (%rax),%xmm3
+    vsqrtps 0x40(%r13,%rcx,4),%xmm15
+    vsqrtps -8(%rsp),%ymm3
+    vsqrtps 0x1000(%r9),%ymm14
+    vsqrtpd %xmm1,%xmm3
+    vsqrtpd %xmm9,%xmm15
+    vsqrtpd %ymm1,%ymm3
+    vsqrtpd %ymm13,%ymm14
+    vsqrtpd (%rax),%xmm3
+    vsqrtpd 0x40(%r13,%rcx,4),%xmm15
+    vsqrtpd -8(%rsp),%ymm3
+    vsqrtpd 0x1000(%r9),%ymm14
+    vsqrtss %xmm1,%xmm2,%xmm3
+    vsqrtss %xmm9,%xmm12,%xmm15
+    vsqrtss (%rax),%xmm2,%xmm3
+    vsqrtss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vsqrtsd %xmm1,%xmm2,%xmm3
+    vsqrtsd %xmm9,%xmm12,%xmm15
+    vsqrtsd (%rax),%xmm2,%xmm3
+    vsqrtsd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vrsqrtps %xmm1,%xmm3
+    vrsqrtps %xmm9,%xmm15
+    vrsqrtps %ymm1,%ymm3
+    vrsqrtps %ymm13,%ymm14
+    vrsqrtps (%rax),%xmm3
+    vrsqrtps 0x40(%r13,%rcx,4),%xmm15
+    vrsqrtps -8(%rsp),%ymm3
+    vrsqrtps 0x1000(%r9),%ymm14
+    vrsqrtss %xmm1,%xmm2,%xmm3
+    vrsqrtss %xmm9,%xmm12,%xmm15
+    vrsqrtss (%rax),%xmm2,%xmm3
+    vrsqrtss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vrcpps %xmm1,%xmm3
+    vrcpps %xmm9,%xmm15
+    vrcpps %ymm1,%ymm3
+    vrcpps %ymm13,%ymm14
+    vrcpps (%rax),%xmm3
+    vrcpps 0x40(%r13,%rcx,4),%xmm15
+    vrcpps -8(%rsp),%ymm3
+    vrcpps 0x1000(%r9),%ymm14
+    vrcpss %xmm1,%xmm2,%xmm3
+    vrcpss %xmm9,%xmm12,%xmm15
+    vrcpss (%rax),%xmm2,%xmm3
+    vrcpss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vandps %xmm1,%xmm2,%xmm3
+    vandps %xmm9,%xmm12,%xmm15
+    vandps %ymm1,%ymm10,%ymm3
+    vandps %ymm13,%ymm2,%ymm14
+    vandps (%rax),%xmm2,%xmm3
+    vandps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vandps -8(%rsp),%ymm10,%ymm3
+    vandps 0x1000(%r9),%ymm2,%ymm14
+    vandpd %xmm1,%xmm2,%xmm3
+    vandpd %xmm9,%xmm12,%xmm15
+    vandpd %ymm1,%ymm10,%ymm3
+    vandpd %ymm13,%ymm2,%ymm14
+    vandpd (%rax),%xmm2,%xmm3
+    vandpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vandpd -8(%rsp),%ymm10,%ymm3
+    vandpd 0x1000(%r9),%ymm2,%ymm14
+    vandnps %xmm1,%xmm2,%xmm3
+    vandnps %xmm9,%xmm12,%xmm15
+    vandnps %ymm1,%ymm10,%ymm3
+    vandnps %ymm13,%ymm2,%ymm14
+    vandnps (%rax),%xmm2,%xmm3
+    vandnps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vandnps -8(%rsp),%ymm10,%ymm3
+    vandnps 0x1000(%r9),%ymm2,%ymm14
+    vandnpd %xmm1,%xmm2,%xmm3
+    vandnpd %xmm9,%xmm12,%xmm15
+    vandnpd %ymm1,%ymm10,%ymm3
+    vandnpd %ymm13,%ymm2,%ymm14
+    vandnpd (%rax),%xmm2,%xmm3
+    vandnpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vandnpd -8(%rsp),%ymm10,%ymm3
+    vandnpd 0x1000(%r9),%ymm2,%ymm14
+    vorps %xmm1,%xmm2,%xmm3
+    vorps %xmm9,%xmm12,%xmm15
+    vorps %ymm1,%ymm10,%ymm3
+    vorps %ymm13,%ymm2,%ymm14
+    vorps (%rax),%xmm2,%xmm3
+    vorps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vorps -8(%rsp),%ymm10,%ymm3
+    vorps 0x1000(%r9),%ymm2,%ymm14
+    vorpd %xmm1,%xmm2,%xmm3
+    vorpd %xmm9,%xmm12,%xmm15
+    vorpd %ymm1,%ymm10,%ymm3
+    vorpd %ymm13,%ymm2,%ymm14
+    vorpd (%rax),%xmm2,%xmm3
+    vorpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vorpd -8(%rsp),%ymm10,%ymm3
+    vorpd 0x1000(%r9),%ymm2,%ymm14
+    vxorps %xmm1,%xmm2,%xmm3
+    vxorps %xmm9,%xmm12,%xmm15
+    vxorps %ymm1,%ymm10,%ymm3
+    vxorps %ymm13,%ymm2,%ymm14
+    vxorps (%rax),%xmm2,%xmm3
+    vxorps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vxorps -8(%rsp),%ymm10,%ymm3
+    vxorps 0x1000(%r9),%ymm2,%ymm14
+    vxorpd %xmm1,%xmm2,%xmm3
+    vxorpd %xmm9,%xmm12,%xmm15
+    vxorpd %ymm1,%ymm10,%ymm3
+    vxorpd %ymm13,%ymm2,%ymm14
+    vxorpd (%rax),%xmm2,%xmm3
+    vxorpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vxorpd -8(%rsp),%ymm10,%ymm3
+    vxorpd 0x1000(%r9),%ymm2,%ymm14
+    vunpcklps %xmm1,%xmm2,%xmm3
+    vunpcklps %xmm9,%xmm12,%xmm15
+    vunpcklps %ymm1,%ymm10,%ymm3
+    vunpcklps %ymm13,%ymm2,%ymm14
+    vunpcklps (%rax),%xmm2,%xmm3
+    vunpcklps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vunpcklps -8(%rsp),%ymm10,%ymm3
+    vunpcklps 0x1000(%r9),%ymm2,%ymm14
+    vunpcklpd %xmm1,%xmm2,%xmm3
+    vunpcklpd %xmm9,%xmm12,%xmm15
+    vunpcklpd %ymm1,%ymm10,%ymm3
+    vunpcklpd %ymm13,%ymm2,%ymm14
+    vunpcklpd (%rax),%xmm2,%xmm3
+    vunpcklpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vunpcklpd -8(%rsp),%ymm10,%ymm3
+    vunpcklpd 0x1000(%r9),%ymm2,%ymm14
+    vunpckhps %xmm1,%xmm2,%xmm3
+    vunpckhps %xmm9,%xmm12,%xmm15
+    vunpckhps %ymm1,%ymm10,%ymm3
+    vunpckhps %ymm13,%ymm2,%ymm14
+    vunpckhps (%rax),%xmm2,%xmm3
+    vunpckhps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vunpckhps -8(%rsp),%ymm10,%ymm3
+    vunpckhps 0x1000(%r9),%ymm2,%ymm14
+    vunpckhpd %xmm1,%xmm2,%xmm3
+    vunpckhpd %xmm9,%xmm12,%xmm15
+    vunpckhpd %ymm1,%ymm10,%ymm3
+    vunpckhpd %ymm13,%ymm2,%ymm14
+    vunpckhpd (%rax),%xmm2,%xmm3
+    vunpckhpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vunpckhpd -8(%rsp),%ymm10,%ymm3
+    vunpckhpd 0x1000(%r9),%ymm2,%ymm14
+    vcomiss %xmm1,%xmm3
+    vcomiss %xmm9,%xmm15
+    vcomiss (%rax),%xmm3
+    vcomiss 0x40(%r13,%rcx,4),%xmm15
+    vcomisd %xmm1,%xmm3
+    vcomisd %xmm9,%xmm15
+    vcomisd (%rax),%xmm3
+    vcomisd 0x40(%r13,%rcx,4),%xmm15
+    vucomiss %xmm1,%xmm3
+    vucomiss %xmm9,%xmm15
+    vucomiss (%rax),%xmm3
+    vucomiss 0x40(%r13,%rcx,4),%xmm15
+    vucomisd %xmm1,%xmm3
+    vucomisd %xmm9,%xmm15
+    vucomisd (%rax),%xmm3
+    vucomisd 0x40(%r13,%rcx,4),%xmm15
+    vcmpps $5,%xmm1,%xmm2,%xmm3
+    vcmpps $5,%xmm9,%xmm12,%xmm15
+    vcmpps $5,%ymm1,%ymm10,%ymm3
+    vcmpps $5,%ymm13,%ymm2,%ymm14
+    vcmpps $0x7f,(%rax),%xmm2,%xmm3
+    vcmpps $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vcmpps $0x7f,-8(%rsp),%ymm10,%ymm3
+    vcmpps $0x7f,0x1000(%r9),%ymm2,%ymm14
+    vcmppd $5,%xmm1,%xmm2,%xmm3
+    vcmppd $5,%xmm9,%xmm12,%xmm15
+    vcmppd $5,%ymm1,%ymm10,%ymm3
+    vcmppd $5,%ymm13,%ymm2,%ymm14
+    vcmppd $0x7f,(%rax),%xmm2,%xmm3
+    vcmppd $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vcmppd $0x7f,-8(%rsp),%ymm10,%ymm3
+    vcmppd $0x7f,0x1000(%r9),%ymm2,%ymm14
+    vcmpss $5,%xmm1,%xmm2,%xmm3
+    vcmpss $5,%xmm9,%xmm12,%xmm15
+    vcmpss $0x7f,(%rax),%xmm2,%xmm3
+    vcmpss $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vcmpsd $5,%xmm1,%xmm2,%xmm3
+    vcmpsd $5,%xmm9,%xmm12,%xmm15
+    vcmpsd $0x7f,(%rax),%xmm2,%xmm3
+    vcmpsd $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vshufps $5,%xmm1,%xmm2,%xmm3
+    vshufps $5,%xmm9,%xmm12,%xmm15
+    vshufps $5,%ymm1,%ymm10,%ymm3
+    vshufps $5,%ymm13,%ymm2,%ymm14
+    vshufps $0x7f,(%rax),%xmm2,%xmm3
+    vshufps $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vshufps $0x7f,-8(%rsp),%ymm10,%ymm3
+    vshufps $0x7f,0x1000(%r9),%ymm2,%ymm14
+    vshufpd $5,%xmm1,%xmm2,%xmm3
+    vshufpd $5,%xmm9,%xmm12,%xmm15
+    vshufpd $5,%ymm1,%ymm10,%ymm3
+    vshufpd $5,%ymm13,%ymm2,%ymm14
+    vshufpd $0x7f,(%rax),%xmm2,%xmm3
+    vshufpd $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vshufpd $0x7f,-8(%rsp),%ymm10,%ymm3
+    vshufpd $0x7f,0x1000(%r9),%ymm2,%ymm14
+    vhaddps %xmm1,%xmm2,%xmm3
+    vhaddps %xmm9,%xmm12,%xmm15
+    vhaddps %ymm1,%ymm10,%ymm3
+    vhaddps %ymm13,%ymm2,%ymm14
+    vhaddps (%rax),%xmm2,%xmm3
+    vhaddps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vhaddps -8(%rsp),%ymm10,%ymm3
+    vhaddps 0x1000(%r9),%ymm2,%ymm14
+    vhaddpd %xmm1,%xmm2,%xmm3
+    vhaddpd %xmm9,%xmm12,%xmm15
+    vhaddpd %ymm1,%ymm10,%ymm3
+    vhaddpd %ymm13,%ymm2,%ymm14
+    vhaddpd (%rax),%xmm2,%xmm3
+    vhaddpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vhaddpd -8(%rsp),%ymm10,%ymm3
+    vhaddpd 0x1000(%r9),%ymm2,%ymm14
+    vhsubps %xmm1,%xmm2,%xmm3
+    vhsubps %xmm9,%xmm12,%xmm15
+    vhsubps %ymm1,%ymm10,%ymm3
+    vhsubps %ymm13,%ymm2,%ymm14
+    vhsubps (%rax),%xmm2,%xmm3
+    vhsubps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vhsubps -8(%rsp),%ymm10,%ymm3
+    vhsubps 0x1000(%r9),%ymm2,%ymm14
+    vhsubpd %xmm1,%xmm2,%xmm3
+    vhsubpd %xmm9,%xmm12,%xmm15
+    vhsubpd %ymm1,%ymm10,%ymm3
+    vhsubpd %ymm13,%ymm2,%ymm14
+    vhsubpd (%rax),%xmm2,%xmm3
+    vhsubpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vhsubpd -8(%rsp),%ymm10,%ymm3
+    vhsubpd 0x1000(%r9),%ymm2,%ymm14
+    vaddsubps %xmm1,%xmm2,%xmm3
+    vaddsubps %xmm9,%xmm12,%xmm15
+    vaddsubps %ymm1,%ymm10,%ymm3
+    vaddsubps %ymm13,%ymm2,%ymm14
+    vaddsubps (%rax),%xmm2,%xmm3
+    vaddsubps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vaddsubps -8(%rsp),%ymm10,%ymm3
+    vaddsubps 0x1000(%r9),%ymm2,%ymm14
+    vaddsubpd %xmm1,%xmm2,%xmm3
+    vaddsubpd %xmm9,%xmm12,%xmm15
+    vaddsubpd %ymm1,%ymm10,%ymm3
+    vaddsubpd %ymm13,%ymm2,%ymm14
+    vaddsubpd (%rax),%xmm2,%xmm3
+    vaddsubpd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vaddsubpd -8(%rsp),%ymm10,%ymm3
+    vaddsubpd 0x1000(%r9),%ymm2,%ymm14
+    vmovddup %xmm1,%xmm3
+    vmovddup %xmm9,%xmm15
+    vmovddup %ymm1,%ymm3
+    vmovddup %ymm13,%ymm14
+    vmovddup (%rax),%xmm3
+    vmovddup 0x40(%r13,%rcx,4),%xmm15
+    vmovddup -8(%rsp),%ymm3
+    vmovddup 0x1000(%r9),%ymm14
+    vmovshdup %xmm1,%xmm3
+    vmovshdup %xmm9,%xmm15
+    vmovshdup %ymm1,%ymm3
+    vmovshdup %ymm13,%ymm14
+    vmovshdup (%rax),%xmm3
+    vmovshdup 0x40(%r13,%rcx,4),%xmm15
+    vmovshdup -8(%rsp),%ymm3
+    vmovshdup 0x1000(%r9),%ymm14
+    vmovsldup %xmm1,%xmm3
+    vmovsldup %xmm9,%xmm15
+    vmovsldup %ymm1,%ymm3
+    vmovsldup %ymm13,%ymm14
+    vmovsldup (%rax),%xmm3
+    vmovsldup 0x40(%r13,%rcx,4),%xmm15
+    vmovsldup -8(%rsp),%ymm3
+    vmovsldup 0x1000(%r9),%ymm14
+    vlddqu (%rax),%xmm5
+    vlddqu 0x40(%r13,%rcx,4),%xmm5
+    vlddqu -8(%rsp),%xmm5
+    vlddqu 0x1000(%r9),%xmm5
+    vlddqu (%rdx),%ymm12
+    vcvtps2pd (%rax),%xmm5
+    vcvtps2pd (%rax),%ymm11
+    vcvtps2pd 0x40(%r13,%rcx,4),%xmm5
+    vcvtps2pd 0x40(%r13,%rcx,4),%ymm11
+    vcvtpd2ps (%rax),%ymm11
+    vcvtpd2ps 0x40(%r13,%rcx,4),%ymm11
+    vcvtss2sd %xmm1,%xmm2,%xmm3
+    vcvtss2sd %xmm9,%xmm12,%xmm15
+    vcvtss2sd (%rax),%xmm2,%xmm3
+    vcvtss2sd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vcvtsd2ss %xmm1,%xmm2,%xmm3
+    vcvtsd2ss %xmm9,%xmm12,%xmm15
+    vcvtsd2ss (%rax),%xmm2,%xmm3
+    vcvtsd2ss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vcvtdq2ps %xmm1,%xmm3
+    vcvtdq2ps %xmm9,%xmm15
+    vcvtdq2ps %ymm1,%ymm3
+    vcvtdq2ps %ymm13,%ymm14
+    vcvtdq2ps (%rax),%xmm3
+    vcvtdq2ps 0x40(%r13,%rcx,4),%xmm15
+    vcvtdq2ps -8(%rsp),%ymm3
+    vcvtdq2ps 0x1000(%r9),%ymm14
+    vcvtps2dq %xmm1,%xmm3
+    vcvtps2dq %xmm9,%xmm15
+    vcvtps2dq %ymm1,%ymm3
+    vcvtps2dq %ymm13,%ymm14
+    vcvtps2dq (%rax),%xmm3
+    vcvtps2dq 0x40(%r13,%rcx,4),%xmm15
+    vcvtps2dq -8(%rsp),%ymm3
+    vcvtps2dq 0x1000(%r9),%ymm14
+    vcvttps2dq %xmm1,%xmm3
+    vcvttps2dq %xmm9,%xmm15
+    vcvttps2dq %ymm1,%ymm3
+    vcvttps2dq %ymm13,%ymm14
+    vcvttps2dq (%rax),%xmm3
+    vcvttps2dq 0x40(%r13,%rcx,4),%xmm15
+    vcvttps2dq -8(%rsp),%ymm3
+    vcvttps2dq 0x1000(%r9),%ymm14
+    vcvtdq2pd (%rax),%xmm5
+    vcvtdq2pd (%rax),%ymm11
+    vcvtdq2pd 0x40(%r13,%rcx,4),%xmm5
+    vcvtdq2pd 0x40(%r13,%rcx,4),%ymm11
+    vcvtpd2dq (%rax),%ymm11
+    vcvtpd2dq 0x40(%r13,%rcx,4),%ymm11
+    vcvttpd2dq (%rax),%ymm11
+    vcvttpd2dq 0x40(%r13,%rcx,4),%ymm11
+    vmovaps %xmm1,%xmm3
+    vmovaps %xmm9,%xmm15
+    vmovaps %ymm1,%ymm3
+    vmovaps %ymm13,%ymm14
+    vmovaps (%rax),%xmm3
+    vmovaps %xmm3,(%rax)
+    vmovaps 0x40(%r13,%rcx,4),%xmm15
+    vmovaps %xmm15,0x40(%r13,%rcx,4)
+    vmovaps -8(%rsp),%ymm3
+    vmovaps %ymm3,-8(%rsp)
+    vmovaps 0x1000(%r9),%ymm14
+    vmovaps %ymm14,0x1000(%r9)
+    vmovapd %xmm1,%xmm3
+    vmovapd %xmm9,%xmm15
+    vmovapd %ymm1,%ymm3
+    vmovapd %ymm13,%ymm14
+    vmovapd (%rax),%xmm3
+    vmovapd %xmm3,(%rax)
+    vmovapd 0x40(%r13,%rcx,4),%xmm15
+    vmovapd %xmm15,0x40(%r13,%rcx,4)
+    vmovapd -8(%rsp),%ymm3
+    vmovapd %ymm3,-8(%rsp)
+    vmovapd 0x1000(%r9),%ymm14
+    vmovapd %ymm14,0x1000(%r9)
+    vmovups %xmm1,%xmm3
+    vmovups %xmm9,%xmm15
+    vmovups %ymm1,%ymm3
+    vmovups %ymm13,%ymm14
+    vmovups (%rax),%xmm3
+    vmovups %xmm3,(%rax)
+    vmovups 0x40(%r13,%rcx,4),%xmm15
+    vmovups %xmm15,0x40(%r13,%rcx,4)
+    vmovups -8(%rsp),%ymm3
+    vmovups %ymm3,-8(%rsp)
+    vmovups 0x1000(%r9),%ymm14
+    vmovups %ymm14,0x1000(%r9)
+    vmovupd %xmm1,%xmm3
+    vmovupd %xmm9,%xmm15
+    vmovupd %ymm1,%ymm3
+    vmovupd %ymm13,%ymm14
+    vmovupd (%rax),%xmm3
+    vmovupd %xmm3,(%rax)
+    vmovupd 0x40(%r13,%rcx,4),%xmm15
+    vmovupd %xmm15,0x40(%r13,%rcx,4)
+    vmovupd -8(%rsp),%ymm3
+    vmovupd %ymm3,-8(%rsp)
+    vmovupd 0x1000(%r9),%ymm14
+    vmovupd %ymm14,0x1000(%r9)
+    vmovss %xmm1,%xmm2,%xmm3
+    vmovss %xmm9,%xmm12,%xmm15
+    vmovss (%rax),%xmm3
+    vmovss %xmm3,(%rax)
+    vmovss 0x40(%r13,%rcx,4),%xmm15
+    vmovss %xmm15,0x40(%r13,%rcx,4)
+    vmovsd %xmm1,%xmm2,%xmm3
+    vmovsd %xmm9,%xmm12,%xmm15
+    vmovsd (%rax),%xmm3
+    vmovsd %xmm3,(%rax)
+    vmovsd 0x40(%r13,%rcx,4),%xmm15
+    vmovsd %xmm15,0x40(%r13,%rcx,4)
+    vmovdqa %xmm1,%xmm3
+    vmovdqa %xmm9,%xmm15
+    vmovdqa %ymm1,%ymm3
+    vmovdqa %ymm13,%ymm14
+    vmovdqa (%rax),%xmm3
+    vmovdqa %xmm3,(%rax)
+    vmovdqa 0x40(%r13,%rcx,4),%xmm15
+    vmovdqa %xmm15,0x40(%r13,%rcx,4)
+    vmovdqa -8(%rsp),%ymm3
+    vmovdqa %ymm3,-8(%rsp)
+    vmovdqa 0x1000(%r9),%ymm14
+    vmovdqa %ymm14,0x1000(%r9)
+    vmovdqu %xmm1,%xmm3
+    vmovdqu %xmm9,%xmm15
+    vmovdqu %ymm1,%ymm3
+    vmovdqu %ymm13,%ymm14
+    vmovdqu (%rax),%xmm3
+    vmovdqu %xmm3,(%rax)
+    vmovdqu 0x40(%r13,%rcx,4),%xmm15
+    vmovdqu %xmm15,0x40(%r13,%rcx,4)
+    vmovdqu -8(%rsp),%ymm3
+    vmovdqu %ymm3,-8(%rsp)
+    vmovdqu 0x1000(%r9),%ymm14
+    vmovdqu %ymm14,0x1000(%r9)
+    vmovhlps %xmm1,%xmm2,%xmm3
+    vmovhlps %xmm9,%xmm12,%xmm15
+    vmovlhps %xmm1,%xmm2,%xmm3
+    vmovlhps %xmm9,%xmm12,%xmm15
+    vpmovmskb %xmm3,%eax
+    vpmovmskb %ymm11,%r9d
+    vpmovmskb %xmm3,%rax
+    vpmovmskb %ymm13,%r10
+    vmovmskps %xmm3,%eax
+    vmovmskps %ymm11,%r9d
+    vmovmskps %xmm3,%rax
+    vmovmskps %ymm13,%r10
+    vmovmskpd %xmm3,%eax
+    vmovmskpd %ymm11,%r9d
+    vmovmskpd %xmm3,%rax
+    vmovmskpd %ymm13,%r10
+    vpaddb %xmm1,%xmm2,%xmm3
+    vpaddb %xmm9,%xmm12,%xmm15
+    vpaddb %ymm1,%ymm10,%ymm3
+    vpaddb %ymm13,%ymm2,%ymm14
+    vpaddb (%rax),%xmm2,%xmm3
+    vpaddb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpaddb -8(%rsp),%ymm10,%ymm3
+    vpaddb 0x1000(%r9),%ymm2,%ymm14
+    vpaddw %xmm1,%xmm2,%xmm3
+    vpaddw %xmm9,%xmm12,%xmm15
+    vpaddw %ymm1,%ymm10,%ymm3
+    vpaddw %ymm13,%ymm2,%ymm14
+    vpaddw (%rax),%xmm2,%xmm3
+    vpaddw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpaddw -8(%rsp),%ymm10,%ymm3
+    vpaddw 0x1000(%r9),%ymm2,%ymm14
+    vpaddd %xmm1,%xmm2,%xmm3
+    vpaddd %xmm9,%xmm12,%xmm15
+    vpaddd %ymm1,%ymm10,%ymm3
+    vpaddd %ymm13,%ymm2,%ymm14
+    vpaddd (%rax),%xmm2,%xmm3
+    vpaddd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpaddd -8(%rsp),%ymm10,%ymm3
+    vpaddd 0x1000(%r9),%ymm2,%ymm14
+    vpaddq %xmm1,%xmm2,%xmm3
+    vpaddq %xmm9,%xmm12,%xmm15
+    vpaddq %ymm1,%ymm10,%ymm3
+    vpaddq %ymm13,%ymm2,%ymm14
+    vpaddq (%rax),%xmm2,%xmm3
+    vpaddq 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpaddq -8(%rsp),%ymm10,%ymm3
+    vpaddq 0x1000(%r9),%ymm2,%ymm14
+    vpaddsb %xmm1,%xmm2,%xmm3
+    vpaddsb %xmm9,%xmm12,%xmm15
+    vpaddsb %ymm1,%ymm10,%ymm3
+    vpaddsb %ymm13,%ymm2,%ymm14
+    vpaddsb (%rax),%xmm2,%xmm3
+    vpaddsb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpaddsb -8(%rsp),%ymm10,%ymm3
+    vpaddsb 0x1000(%r9),%ymm2,%ymm14
+    vpaddsw %xmm1,%xmm2,%xmm3
+    vpaddsw %xmm9,%xmm12,%xmm15
+    vpaddsw %ymm1,%ymm10,%ymm3
+    vpaddsw %ymm13,%ymm2,%ymm14
+    vpaddsw (%rax),%xmm2,%xmm3
+    vpaddsw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpaddsw -8(%rsp),%ymm10,%ymm3
+    vpaddsw 0x1000(%r9),%ymm2,%ymm14
+    vpaddusb %xmm1,%xmm2,%xmm3
+    vpaddusb %xmm9,%xmm12,%xmm15
+    vpaddusb %ymm1,%ymm10,%ymm3
+    vpaddusb %ymm13,%ymm2,%ymm14
+    vpaddusb (%rax),%xmm2,%xmm3
+    vpaddusb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpaddusb -8(%rsp),%ymm10,%ymm3
+    vpaddusb 0x1000(%r9),%ymm2,%ymm14
+    vpaddusw %xmm1,%xmm2,%xmm3
+    vpaddusw %xmm9,%xmm12,%xmm15
+    vpaddusw %ymm1,%ymm10,%ymm3
+    vpaddusw %ymm13,%ymm2,%ymm14
+    vpaddusw (%rax),%xmm2,%xmm3
+    vpaddusw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpaddusw -8(%rsp),%ymm10,%ymm3
+    vpaddusw 0x1000(%r9),%ymm2,%ymm14
+    vpsubb %xmm1,%xmm2,%xmm3
+    vpsubb %xmm9,%xmm12,%xmm15
+    vpsubb %ymm1,%ymm10,%ymm3
+    vpsubb %ymm13,%ymm2,%ymm14
+    vpsubb (%rax),%xmm2,%xmm3
+    vpsubb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsubb -8(%rsp),%ymm10,%ymm3
+    vpsubb 0x1000(%r9),%ymm2,%ymm14
+    vpsubw %xmm1,%xmm2,%xmm3
+    vpsubw %xmm9,%xmm12,%xmm15
+    vpsubw %ymm1,%ymm10,%ymm3
+    vpsubw %ymm13,%ymm2,%ymm14
+    vpsubw (%rax),%xmm2,%xmm3
+    vpsubw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsubw -8(%rsp),%ymm10,%ymm3
+    vpsubw 0x1000(%r9),%ymm2,%ymm14
+    vpsubd %xmm1,%xmm2,%xmm3
+    vpsubd %xmm9,%xmm12,%xmm15
+    vpsubd %ymm1,%ymm10,%ymm3
+    vpsubd %ymm13,%ymm2,%ymm14
+    vpsubd (%rax),%xmm2,%xmm3
+    vpsubd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsubd -8(%rsp),%ymm10,%ymm3
+    vpsubd 0x1000(%r9),%ymm2,%ymm14
+    vpsubq %xmm1,%xmm2,%xmm3
+    vpsubq %xmm9,%xmm12,%xmm15
+    vpsubq %ymm1,%ymm10,%ymm3
+    vpsubq %ymm13,%ymm2,%ymm14
+    vpsubq (%rax),%xmm2,%xmm3
+    vpsubq 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsubq -8(%rsp),%ymm10,%ymm3
+    vpsubq 0x1000(%r9),%ymm2,%ymm14
+    vpsubsb %xmm1,%xmm2,%xmm3
+    vpsubsb %xmm9,%xmm12,%xmm15
+    vpsubsb %ymm1,%ymm10,%ymm3
+    vpsubsb %ymm13,%ymm2,%ymm14
+    vpsubsb (%rax),%xmm2,%xmm3
+    vpsubsb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsubsb -8(%rsp),%ymm10,%ymm3
+    vpsubsb 0x1000(%r9),%ymm2,%ymm14
+    vpsubsw %xmm1,%xmm2,%xmm3
+    vpsubsw %xmm9,%xmm12,%xmm15
+    vpsubsw %ymm1,%ymm10,%ymm3
+    vpsubsw %ymm13,%ymm2,%ymm14
+    vpsubsw (%rax),%xmm2,%xmm3
+    vpsubsw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsubsw -8(%rsp),%ymm10,%ymm3
+    vpsubsw 0x1000(%r9),%ymm2,%ymm14
+    vpsubusb %xmm1,%xmm2,%xmm3
+    vpsubusb %xmm9,%xmm12,%xmm15
+    vpsubusb %ymm1,%ymm10,%ymm3
+    vpsubusb %ymm13,%ymm2,%ymm14
+    vpsubusb (%rax),%xmm2,%xmm3
+    vpsubusb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsubusb -8(%rsp),%ymm10,%ymm3
+    vpsubusb 0x1000(%r9),%ymm2,%ymm14
+    vpsubusw %xmm1,%xmm2,%xmm3
+    vpsubusw %xmm9,%xmm12,%xmm15
+    vpsubusw %ymm1,%ymm10,%ymm3
+    vpsubusw %ymm13,%ymm2,%ymm14
+    vpsubusw (%rax),%xmm2,%xmm3
+    vpsubusw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsubusw -8(%rsp),%ymm10,%ymm3
+    vpsubusw 0x1000(%r9),%ymm2,%ymm14
+    vpmullw %xmm1,%xmm2,%xmm3
+    vpmullw %xmm9,%xmm12,%xmm15
+    vpmullw %ymm1,%ymm10,%ymm3
+    vpmullw %ymm13,%ymm2,%ymm14
+    vpmullw (%rax),%xmm2,%xmm3
+    vpmullw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmullw -8(%rsp),%ymm10,%ymm3
+    vpmullw 0x1000(%r9),%ymm2,%ymm14
+    vpmulhw %xmm1,%xmm2,%xmm3
+    vpmulhw %xmm9,%xmm12,%xmm15
+    vpmulhw %ymm1,%ymm10,%ymm3
+    vpmulhw %ymm13,%ymm2,%ymm14
+    vpmulhw (%rax),%xmm2,%xmm3
+    vpmulhw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmulhw -8(%rsp),%ymm10,%ymm3
+    vpmulhw 0x1000(%r9),%ymm2,%ymm14
+    vpmulhuw %xmm1,%xmm2,%xmm3
+    vpmulhuw %xmm9,%xmm12,%xmm15
+    vpmulhuw %ymm1,%ymm10,%ymm3
+    vpmulhuw %ymm13,%ymm2,%ymm14
+    vpmulhuw (%rax),%xmm2,%xmm3
+    vpmulhuw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmulhuw -8(%rsp),%ymm10,%ymm3
+    vpmulhuw 0x1000(%r9),%ymm2,%ymm14
+    vpmuludq %xmm1,%xmm2,%xmm3
+    vpmuludq %xmm9,%xmm12,%xmm15
+    vpmuludq %ymm1,%ymm10,%ymm3
+    vpmuludq %ymm13,%ymm2,%ymm14
+    vpmuludq (%rax),%xmm2,%xmm3
+    vpmuludq 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmuludq -8(%rsp),%ymm10,%ymm3
+    vpmuludq 0x1000(%r9),%ymm2,%ymm14
+    vpmaddwd %xmm1,%xmm2,%xmm3
+    vpmaddwd %xmm9,%xmm12,%xmm15
+    vpmaddwd %ymm1,%ymm10,%ymm3
+    vpmaddwd %ymm13,%ymm2,%ymm14
+    vpmaddwd (%rax),%xmm2,%xmm3
+    vpmaddwd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmaddwd -8(%rsp),%ymm10,%ymm3
+    vpmaddwd 0x1000(%r9),%ymm2,%ymm14
+    vpsadbw %xmm1,%xmm2,%xmm3
+    vpsadbw %xmm9,%xmm12,%xmm15
+    vpsadbw %ymm1,%ymm10,%ymm3
+    vpsadbw %ymm13,%ymm2,%ymm14
+    vpsadbw (%rax),%xmm2,%xmm3
+    vpsadbw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsadbw -8(%rsp),%ymm10,%ymm3
+    vpsadbw 0x1000(%r9),%ymm2,%ymm14
+    vpavgb %xmm1,%xmm2,%xmm3
+    vpavgb %xmm9,%xmm12,%xmm15
+    vpavgb %ymm1,%ymm10,%ymm3
+    vpavgb %ymm13,%ymm2,%ymm14
+    vpavgb (%rax),%xmm2,%xmm3
+    vpavgb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpavgb -8(%rsp),%ymm10,%ymm3
+    vpavgb 0x1000(%r9),%ymm2,%ymm14
+    vpavgw %xmm1,%xmm2,%xmm3
+    vpavgw %xmm9,%xmm12,%xmm15
+    vpavgw %ymm1,%ymm10,%ymm3
+    vpavgw %ymm13,%ymm2,%ymm14
+    vpavgw (%rax),%xmm2,%xmm3
+    vpavgw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpavgw -8(%rsp),%ymm10,%ymm3
+    vpavgw 0x1000(%r9),%ymm2,%ymm14
+    vpminub %xmm1,%xmm2,%xmm3
+    vpminub %xmm9,%xmm12,%xmm15
+    vpminub %ymm1,%ymm10,%ymm3
+    vpminub %ymm13,%ymm2,%ymm14
+    vpminub (%rax),%xmm2,%xmm3
+    vpminub 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpminub -8(%rsp),%ymm10,%ymm3
+    vpminub 0x1000(%r9),%ymm2,%ymm14
+    vpmaxub %xmm1,%xmm2,%xmm3
+    vpmaxub %xmm9,%xmm12,%xmm15
+    vpmaxub %ymm1,%ymm10,%ymm3
+    vpmaxub %ymm13,%ymm2,%ymm14
+    vpmaxub (%rax),%xmm2,%xmm3
+    vpmaxub 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmaxub -8(%rsp),%ymm10,%ymm3
+    vpmaxub 0x1000(%r9),%ymm2,%ymm14
+    vpminsw %xmm1,%xmm2,%xmm3
+    vpminsw %xmm9,%xmm12,%xmm15
+    vpminsw %ymm1,%ymm10,%ymm3
+    vpminsw %ymm13,%ymm2,%ymm14
+    vpminsw (%rax),%xmm2,%xmm3
+    vpminsw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpminsw -8(%rsp),%ymm10,%ymm3
+    vpminsw 0x1000(%r9),%ymm2,%ymm14
+    vpmaxsw %xmm1,%xmm2,%xmm3
+    vpmaxsw %xmm9,%xmm12,%xmm15
+    vpmaxsw %ymm1,%ymm10,%ymm3
+    vpmaxsw %ymm13,%ymm2,%ymm14
+    vpmaxsw (%rax),%xmm2,%xmm3
+    vpmaxsw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmaxsw -8(%rsp),%ymm10,%ymm3
+    vpmaxsw 0x1000(%r9),%ymm2,%ymm14
+    vpand %xmm1,%xmm2,%xmm3
+    vpand %xmm9,%xmm12,%xmm15
+    vpand %ymm1,%ymm10,%ymm3
+    vpand %ymm13,%ymm2,%ymm14
+    vpand (%rax),%xmm2,%xmm3
+    vpand 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpand -8(%rsp),%ymm10,%ymm3
+    vpand 0x1000(%r9),%ymm2,%ymm14
+    vpandn %xmm1,%xmm2,%xmm3
+    vpandn %xmm9,%xmm12,%xmm15
+    vpandn %ymm1,%ymm10,%ymm3
+    vpandn %ymm13,%ymm2,%ymm14
+    vpandn (%rax),%xmm2,%xmm3
+    vpandn 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpandn -8(%rsp),%ymm10,%ymm3
+    vpandn 0x1000(%r9),%ymm2,%ymm14
+    vpor %xmm1,%xmm2,%xmm3
+    vpor %xmm9,%xmm12,%xmm15
+    vpor %ymm1,%ymm10,%ymm3
+    vpor %ymm13,%ymm2,%ymm14
+    vpor (%rax),%xmm2,%xmm3
+    vpor 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpor -8(%rsp),%ymm10,%ymm3
+    vpor 0x1000(%r9),%ymm2,%ymm14
+    vpxor %xmm1,%xmm2,%xmm3
+    vpxor %xmm9,%xmm12,%xmm15
+    vpxor %ymm1,%ymm10,%ymm3
+    vpxor %ymm13,%ymm2,%ymm14
+    vpxor (%rax),%xmm2,%xmm3
+    vpxor 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpxor -8(%rsp),%ymm10,%ymm3
+    vpxor 0x1000(%r9),%ymm2,%ymm14
+    vpcmpeqb %xmm1,%xmm2,%xmm3
+    vpcmpeqb %xmm9,%xmm12,%xmm15
+    vpcmpeqb %ymm1,%ymm10,%ymm3
+    vpcmpeqb %ymm13,%ymm2,%ymm14
+    vpcmpeqb (%rax),%xmm2,%xmm3
+    vpcmpeqb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpcmpeqb -8(%rsp),%ymm10,%ymm3
+    vpcmpeqb 0x1000(%r9),%ymm2,%ymm14
+    vpcmpeqw %xmm1,%xmm2,%xmm3
+    vpcmpeqw %xmm9,%xmm12,%xmm15
+    vpcmpeqw %ymm1,%ymm10,%ymm3
+    vpcmpeqw %ymm13,%ymm2,%ymm14
+    vpcmpeqw (%rax),%xmm2,%xmm3
+    vpcmpeqw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpcmpeqw -8(%rsp),%ymm10,%ymm3
+    vpcmpeqw 0x1000(%r9),%ymm2,%ymm14
+    vpcmpeqd %xmm1,%xmm2,%xmm3
+    vpcmpeqd %xmm9,%xmm12,%xmm15
+    vpcmpeqd %ymm1,%ymm10,%ymm3
+    vpcmpeqd %ymm13,%ymm2,%ymm14
+    vpcmpeqd (%rax),%xmm2,%xmm3
+    vpcmpeqd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpcmpeqd -8(%rsp),%ymm10,%ymm3
+    vpcmpeqd 0x1000(%r9),%ymm2,%ymm14
+    vpcmpgtb %xmm1,%xmm2,%xmm3
+    vpcmpgtb %xmm9,%xmm12,%xmm15
+    vpcmpgtb %ymm1,%ymm10,%ymm3
+    vpcmpgtb %ymm13,%ymm2,%ymm14
+    vpcmpgtb (%rax),%xmm2,%xmm3
+    vpcmpgtb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpcmpgtb -8(%rsp),%ymm10,%ymm3
+    vpcmpgtb 0x1000(%r9),%ymm2,%ymm14
+    vpcmpgtw %xmm1,%xmm2,%xmm3
+    vpcmpgtw %xmm9,%xmm12,%xmm15
+    vpcmpgtw %ymm1,%ymm10,%ymm3
+    vpcmpgtw %ymm13,%ymm2,%ymm14
+    vpcmpgtw (%rax),%xmm2,%xmm3
+    vpcmpgtw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpcmpgtw -8(%rsp),%ymm10,%ymm3
+    vpcmpgtw 0x1000(%r9),%ymm2,%ymm14
+    vpcmpgtd %xmm1,%xmm2,%xmm3
+    vpcmpgtd %xmm9,%xmm12,%xmm15
+    vpcmpgtd %ymm1,%ymm10,%ymm3
+    vpcmpgtd %ymm13,%ymm2,%ymm14
+    vpcmpgtd (%rax),%xmm2,%xmm3
+    vpcmpgtd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpcmpgtd -8(%rsp),%ymm10,%ymm3
+    vpcmpgtd 0x1000(%r9),%ymm2,%ymm14
+    vpacksswb %xmm1,%xmm2,%xmm3
+    vpacksswb %xmm9,%xmm12,%xmm15
+    vpacksswb %ymm1,%ymm10,%ymm3
+    vpacksswb %ymm13,%ymm2,%ymm14
+    vpacksswb (%rax),%xmm2,%xmm3
+    vpacksswb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpacksswb -8(%rsp),%ymm10,%ymm3
+    vpacksswb 0x1000(%r9),%ymm2,%ymm14
+    vpackssdw %xmm1,%xmm2,%xmm3
+    vpackssdw %xmm9,%xmm12,%xmm15
+    vpackssdw %ymm1,%ymm10,%ymm3
+    vpackssdw %ymm13,%ymm2,%ymm14
+    vpackssdw (%rax),%xmm2,%xmm3
+    vpackssdw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpackssdw -8(%rsp),%ymm10,%ymm3
+    vpackssdw 0x1000(%r9),%ymm2,%ymm14
+    vpackuswb %xmm1,%xmm2,%xmm3
+    vpackuswb %xmm9,%xmm12,%xmm15
+    vpackuswb %ymm1,%ymm10,%ymm3
+    vpackuswb %ymm13,%ymm2,%ymm14
+    vpackuswb (%rax),%xmm2,%xmm3
+    vpackuswb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpackuswb -8(%rsp),%ymm10,%ymm3
+    vpackuswb 0x1000(%r9),%ymm2,%ymm14
+    vpunpcklbw %xmm1,%xmm2,%xmm3
+    vpunpcklbw %xmm9,%xmm12,%xmm15
+    vpunpcklbw %ymm1,%ymm10,%ymm3
+    vpunpcklbw %ymm13,%ymm2,%ymm14
+    vpunpcklbw (%rax),%xmm2,%xmm3
+    vpunpcklbw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpunpcklbw -8(%rsp),%ymm10,%ymm3
+    vpunpcklbw 0x1000(%r9),%ymm2,%ymm14
+    vpunpcklwd %xmm1,%xmm2,%xmm3
+    vpunpcklwd %xmm9,%xmm12,%xmm15
+    vpunpcklwd %ymm1,%ymm10,%ymm3
+    vpunpcklwd %ymm13,%ymm2,%ymm14
+    vpunpcklwd (%rax),%xmm2,%xmm3
+    vpunpcklwd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpunpcklwd -8(%rsp),%ymm10,%ymm3
+    vpunpcklwd 0x1000(%r9),%ymm2,%ymm14
+    vpunpckldq %xmm1,%xmm2,%xmm3
+    vpunpckldq %xmm9,%xmm12,%xmm15
+    vpunpckldq %ymm1,%ymm10,%ymm3
+    vpunpckldq %ymm13,%ymm2,%ymm14
+    vpunpckldq (%rax),%xmm2,%xmm3
+    vpunpckldq 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpunpckldq -8(%rsp),%ymm10,%ymm3
+    vpunpckldq 0x1000(%r9),%ymm2,%ymm14
+    vpunpcklqdq %xmm1,%xmm2,%xmm3
+    vpunpcklqdq %xmm9,%xmm12,%xmm15
+    vpunpcklqdq %ymm1,%ymm10,%ymm3
+    vpunpcklqdq %ymm13,%ymm2,%ymm14
+    vpunpcklqdq (%rax),%xmm2,%xmm3
+    vpunpcklqdq 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpunpcklqdq -8(%rsp),%ymm10,%ymm3
+    vpunpcklqdq 0x1000(%r9),%ymm2,%ymm14
+    vpunpckhbw %xmm1,%xmm2,%xmm3
+    vpunpckhbw %xmm9,%xmm12,%xmm15
+    vpunpckhbw %ymm1,%ymm10,%ymm3
+    vpunpckhbw %ymm13,%ymm2,%ymm14
+    vpunpckhbw (%rax),%xmm2,%xmm3
+    vpunpckhbw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpunpckhbw -8(%rsp),%ymm10,%ymm3
+    vpunpckhbw 0x1000(%r9),%ymm2,%ymm14
+    vpunpckhwd %xmm1,%xmm2,%xmm3
+    vpunpckhwd %xmm9,%xmm12,%xmm15
+    vpunpckhwd %ymm1,%ymm10,%ymm3
+    vpunpckhwd %ymm13,%ymm2,%ymm14
+    vpunpckhwd (%rax),%xmm2,%xmm3
+    vpunpckhwd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpunpckhwd -8(%rsp),%ymm10,%ymm3
+    vpunpckhwd 0x1000(%r9),%ymm2,%ymm14
+    vpunpckhdq %xmm1,%xmm2,%xmm3
+    vpunpckhdq %xmm9,%xmm12,%xmm15
+    vpunpckhdq %ymm1,%ymm10,%ymm3
+    vpunpckhdq %ymm13,%ymm2,%ymm14
+    vpunpckhdq (%rax),%xmm2,%xmm3
+    vpunpckhdq 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpunpckhdq -8(%rsp),%ymm10,%ymm3
+    vpunpckhdq 0x1000(%r9),%ymm2,%ymm14
+    vpunpckhqdq %xmm1,%xmm2,%xmm3
+    vpunpckhqdq %xmm9,%xmm12,%xmm15
+    vpunpckhqdq %ymm1,%ymm10,%ymm3
+    vpunpckhqdq %ymm13,%ymm2,%ymm14
+    vpunpckhqdq (%rax),%xmm2,%xmm3
+    vpunpckhqdq 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpunpckhqdq -8(%rsp),%ymm10,%ymm3
+    vpunpckhqdq 0x1000(%r9),%ymm2,%ymm14
+    vpshufd $3,%xmm1,%xmm3
+    vpshufd $3,%xmm9,%xmm15
+    vpshufd $3,%ymm1,%ymm3
+    vpshufd $3,%ymm13,%ymm14
+    vpshufd $0x1b,(%rax),%xmm3
+    vpshufd $0x1b,0x40(%r13,%rcx,4),%xmm15
+    vpshufd $0x1b,-8(%rsp),%ymm3
+    vpshufd $0x1b,0x1000(%r9),%ymm14
+    vpshufhw $3,%xmm1,%xmm3
+    vpshufhw $3,%xmm9,%xmm15
+    vpshufhw $3,%ymm1,%ymm3
+    vpshufhw $3,%ymm13,%ymm14
+    vpshufhw $0x1b,(%rax),%xmm3
+    vpshufhw $0x1b,0x40(%r13,%rcx,4),%xmm15
+    vpshufhw $0x1b,-8(%rsp),%ymm3
+    vpshufhw $0x1b,0x1000(%r9),%ymm14
+    vpshuflw $3,%xmm1,%xmm3
+    vpshuflw $3,%xmm9,%xmm15
+    vpshuflw $3,%ymm1,%ymm3
+    vpshuflw $3,%ymm13,%ymm14
+    vpshuflw $0x1b,(%rax),%xmm3
+    vpshuflw $0x1b,0x40(%r13,%rcx,4),%xmm15
+    vpshuflw $0x1b,-8(%rsp),%ymm3
+    vpshuflw $0x1b,0x1000(%r9),%ymm14
+    vpsllw $3,%xmm2,%xmm3
+    vpsllw %xmm4,%xmm2,%xmm3
+    vpsllw (%rax),%xmm2,%xmm3
+    vpsllw $3,%xmm12,%xmm15
+    vpsllw %xmm4,%xmm12,%xmm15
+    vpsllw (%rax),%xmm12,%xmm15
+    vpsllw $3,%ymm10,%ymm3
+    vpsllw %xmm4,%ymm10,%ymm3
+    vpsllw (%rax),%ymm10,%ymm3
+    vpsllw $3,%ymm2,%ymm14
+    vpsllw %xmm4,%ymm2,%ymm14
+    vpsllw (%rax),%ymm2,%ymm14
+    vpslld $3,%xmm2,%xmm3
+    vpslld %xmm4,%xmm2,%xmm3
+    vpslld (%rax),%xmm2,%xmm3
+    vpslld $3,%xmm12,%xmm15
+    vpslld %xmm4,%xmm12,%xmm15
+    vpslld (%rax),%xmm12,%xmm15
+    vpslld $3,%ymm10,%ymm3
+    vpslld %xmm4,%ymm10,%ymm3
+    vpslld (%rax),%ymm10,%ymm3
+    vpslld $3,%ymm2,%ymm14
+    vpslld %xmm4,%ymm2,%ymm14
+    vpslld (%rax),%ymm2,%ymm14
+    vpsllq $3,%xmm2,%xmm3
+    vpsllq %xmm4,%xmm2,%xmm3
+    vpsllq (%rax),%xmm2,%xmm3
+    vpsllq $3,%xmm12,%xmm15
+    vpsllq %xmm4,%xmm12,%xmm15
+    vpsllq (%rax),%xmm12,%xmm15
+    vpsllq $3,%ymm10,%ymm3
+    vpsllq %xmm4,%ymm10,%ymm3
+    vpsllq (%rax),%ymm10,%ymm3
+    vpsllq $3,%ymm2,%ymm14
+    vpsllq %xmm4,%ymm2,%ymm14
+    vpsllq (%rax),%ymm2,%ymm14
+    vpsrlw $3,%xmm2,%xmm3
+    vpsrlw %xmm4,%xmm2,%xmm3
+    vpsrlw (%rax),%xmm2,%xmm3
+    vpsrlw $3,%xmm12,%xmm15
+    vpsrlw %xmm4,%xmm12,%xmm15
+    vpsrlw (%rax),%xmm12,%xmm15
+    vpsrlw $3,%ymm10,%ymm3
+    vpsrlw %xmm4,%ymm10,%ymm3
+    vpsrlw (%rax),%ymm10,%ymm3
+    vpsrlw $3,%ymm2,%ymm14
+    vpsrlw %xmm4,%ymm2,%ymm14
+    vpsrlw (%rax),%ymm2,%ymm14
+    vpsrld $3,%xmm2,%xmm3
+    vpsrld %xmm4,%xmm2,%xmm3
+    vpsrld (%rax),%xmm2,%xmm3
+    vpsrld $3,%xmm12,%xmm15
+    vpsrld %xmm4,%xmm12,%xmm15
+    vpsrld (%rax),%xmm12,%xmm15
+    vpsrld $3,%ymm10,%ymm3
+    vpsrld %xmm4,%ymm10,%ymm3
+    vpsrld (%rax),%ymm10,%ymm3
+    vpsrld $3,%ymm2,%ymm14
+    vpsrld %xmm4,%ymm2,%ymm14
+    vpsrld (%rax),%ymm2,%ymm14
+    vpsrlq $3,%xmm2,%xmm3
+    vpsrlq %xmm4,%xmm2,%xmm3
+    vpsrlq (%rax),%xmm2,%xmm3
+    vpsrlq $3,%xmm12,%xmm15
+    vpsrlq %xmm4,%xmm12,%xmm15
+    vpsrlq (%rax),%xmm12,%xmm15
+    vpsrlq $3,%ymm10,%ymm3
+    vpsrlq %xmm4,%ymm10,%ymm3
+    vpsrlq (%rax),%ymm10,%ymm3
+    vpsrlq $3,%ymm2,%ymm14
+    vpsrlq %xmm4,%ymm2,%ymm14
+    vpsrlq (%rax),%ymm2,%ymm14
+    vpsraw $3,%xmm2,%xmm3
+    vpsraw %xmm4,%xmm2,%xmm3
+    vpsraw (%rax),%xmm2,%xmm3
+    vpsraw $3,%xmm12,%xmm15
+    vpsraw %xmm4,%xmm12,%xmm15
+    vpsraw (%rax),%xmm12,%xmm15
+    vpsraw $3,%ymm10,%ymm3
+    vpsraw %xmm4,%ymm10,%ymm3
+    vpsraw (%rax),%ymm10,%ymm3
+    vpsraw $3,%ymm2,%ymm14
+    vpsraw %xmm4,%ymm2,%ymm14
+    vpsraw (%rax),%ymm2,%ymm14
+    vpsrad $3,%xmm2,%xmm3
+    vpsrad %xmm4,%xmm2,%xmm3
+    vpsrad (%rax),%xmm2,%xmm3
+    vpsrad $3,%xmm12,%xmm15
+    vpsrad %xmm4,%xmm12,%xmm15
+    vpsrad (%rax),%xmm12,%xmm15
+    vpsrad $3,%ymm10,%ymm3
+    vpsrad %xmm4,%ymm10,%ymm3
+    vpsrad (%rax),%ymm10,%ymm3
+    vpsrad $3,%ymm2,%ymm14
+    vpsrad %xmm4,%ymm2,%ymm14
+    vpsrad (%rax),%ymm2,%ymm14
+    vpslldq $3,%xmm2,%xmm3
+    vpslldq $3,%xmm12,%xmm15
+    vpslldq $3,%ymm10,%ymm3
+    vpslldq $3,%ymm2,%ymm14
+    vpsrldq $3,%xmm2,%xmm3
+    vpsrldq $3,%xmm12,%xmm15
+    vpsrldq $3,%ymm10,%ymm3
+    vpsrldq $3,%ymm2,%ymm14
+    vpshufb %xmm1,%xmm2,%xmm3
+    vpshufb %xmm9,%xmm12,%xmm15
+    vpshufb %ymm1,%ymm10,%ymm3
+    vpshufb %ymm13,%ymm2,%ymm14
+    vpshufb (%rax),%xmm2,%xmm3
+    vpshufb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpshufb -8(%rsp),%ymm10,%ymm3
+    vpshufb 0x1000(%r9),%ymm2,%ymm14
+    vphaddw %xmm1,%xmm2,%xmm3
+    vphaddw %xmm9,%xmm12,%xmm15
+    vphaddw %ymm1,%ymm10,%ymm3
+    vphaddw %ymm13,%ymm2,%ymm14
+    vphaddw (%rax),%xmm2,%xmm3
+    vphaddw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vphaddw -8(%rsp),%ymm10,%ymm3
+    vphaddw 0x1000(%r9),%ymm2,%ymm14
+    vphaddd %xmm1,%xmm2,%xmm3
+    vphaddd %xmm9,%xmm12,%xmm15
+    vphaddd %ymm1,%ymm10,%ymm3
+    vphaddd %ymm13,%ymm2,%ymm14
+    vphaddd (%rax),%xmm2,%xmm3
+    vphaddd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vphaddd -8(%rsp),%ymm10,%ymm3
+    vphaddd 0x1000(%r9),%ymm2,%ymm14
+    vphaddsw %xmm1,%xmm2,%xmm3
+    vphaddsw %xmm9,%xmm12,%xmm15
+    vphaddsw %ymm1,%ymm10,%ymm3
+    vphaddsw %ymm13,%ymm2,%ymm14
+    vphaddsw (%rax),%xmm2,%xmm3
+    vphaddsw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vphaddsw -8(%rsp),%ymm10,%ymm3
+    vphaddsw 0x1000(%r9),%ymm2,%ymm14
+    vpmaddubsw %xmm1,%xmm2,%xmm3
+    vpmaddubsw %xmm9,%xmm12,%xmm15
+    vpmaddubsw %ymm1,%ymm10,%ymm3
+    vpmaddubsw %ymm13,%ymm2,%ymm14
+    vpmaddubsw (%rax),%xmm2,%xmm3
+    vpmaddubsw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmaddubsw -8(%rsp),%ymm10,%ymm3
+    vpmaddubsw 0x1000(%r9),%ymm2,%ymm14
+    vphsubw %xmm1,%xmm2,%xmm3
+    vphsubw %xmm9,%xmm12,%xmm15
+    vphsubw %ymm1,%ymm10,%ymm3
+    vphsubw %ymm13,%ymm2,%ymm14
+    vphsubw (%rax),%xmm2,%xmm3
+    vphsubw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vphsubw -8(%rsp),%ymm10,%ymm3
+    vphsubw 0x1000(%r9),%ymm2,%ymm14
+    vphsubd %xmm1,%xmm2,%xmm3
+    vphsubd %xmm9,%xmm12,%xmm15
+    vphsubd %ymm1,%ymm10,%ymm3
+    vphsubd %ymm13,%ymm2,%ymm14
+    vphsubd (%rax),%xmm2,%xmm3
+    vphsubd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vphsubd -8(%rsp),%ymm10,%ymm3
+    vphsubd 0x1000(%r9),%ymm2,%ymm14
+    vphsubsw %xmm1,%xmm2,%xmm3
+    vphsubsw %xmm9,%xmm12,%xmm15
+    vphsubsw %ymm1,%ymm10,%ymm3
+    vphsubsw %ymm13,%ymm2,%ymm14
+    vphsubsw (%rax),%xmm2,%xmm3
+    vphsubsw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vphsubsw -8(%rsp),%ymm10,%ymm3
+    vphsubsw 0x1000(%r9),%ymm2,%ymm14
+    vpsignb %xmm1,%xmm2,%xmm3
+    vpsignb %xmm9,%xmm12,%xmm15
+    vpsignb %ymm1,%ymm10,%ymm3
+    vpsignb %ymm13,%ymm2,%ymm14
+    vpsignb (%rax),%xmm2,%xmm3
+    vpsignb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsignb -8(%rsp),%ymm10,%ymm3
+    vpsignb 0x1000(%r9),%ymm2,%ymm14
+    vpsignw %xmm1,%xmm2,%xmm3
+    vpsignw %xmm9,%xmm12,%xmm15
+    vpsignw %ymm1,%ymm10,%ymm3
+    vpsignw %ymm13,%ymm2,%ymm14
+    vpsignw (%rax),%xmm2,%xmm3
+    vpsignw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsignw -8(%rsp),%ymm10,%ymm3
+    vpsignw 0x1000(%r9),%ymm2,%ymm14
+    vpsignd %xmm1,%xmm2,%xmm3
+    vpsignd %xmm9,%xmm12,%xmm15
+    vpsignd %ymm1,%ymm10,%ymm3
+    vpsignd %ymm13,%ymm2,%ymm14
+    vpsignd (%rax),%xmm2,%xmm3
+    vpsignd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsignd -8(%rsp),%ymm10,%ymm3
+    vpsignd 0x1000(%r9),%ymm2,%ymm14
+    vpmulhrsw %xmm1,%xmm2,%xmm3
+    vpmulhrsw %xmm9,%xmm12,%xmm15
+    vpmulhrsw %ymm1,%ymm10,%ymm3
+    vpmulhrsw %ymm13,%ymm2,%ymm14
+    vpmulhrsw (%rax),%xmm2,%xmm3
+    vpmulhrsw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmulhrsw -8(%rsp),%ymm10,%ymm3
+    vpmulhrsw 0x1000(%r9),%ymm2,%ymm14
+    vpabsb %xmm1,%xmm3
+    vpabsb %xmm9,%xmm15
+    vpabsb %ymm1,%ymm3
+    vpabsb %ymm13,%ymm14
+    vpabsb (%rax),%xmm3
+    vpabsb 0x40(%r13,%rcx,4),%xmm15
+    vpabsb -8(%rsp),%ymm3
+    vpabsb 0x1000(%r9),%ymm14
+    vpabsw %xmm1,%xmm3
+    vpabsw %xmm9,%xmm15
+    vpabsw %ymm1,%ymm3
+    vpabsw %ymm13,%ymm14
+    vpabsw (%rax),%xmm3
+    vpabsw 0x40(%r13,%rcx,4),%xmm15
+    vpabsw -8(%rsp),%ymm3
+    vpabsw 0x1000(%r9),%ymm14
+    vpabsd %xmm1,%xmm3
+    vpabsd %xmm9,%xmm15
+    vpabsd (%rax),%xmm3
+    vpabsd 0x40(%r13,%rcx,4),%xmm15
+    vptest %xmm1,%xmm3
+    vptest %xmm9,%xmm15
+    vptest (%rax),%xmm3
+    vptest 0x40(%r13,%rcx,4),%xmm15
+    vpmovsxbw (%rax),%xmm5
+    vpmovsxbw (%rax),%ymm11
+    vpmovsxbw 0x40(%r13,%rcx,4),%xmm5
+    vpmovsxbw 0x40(%r13,%rcx,4),%ymm11
+    vpmovsxbd (%rax),%xmm5
+    vpmovsxbd (%rax),%ymm11
+    vpmovsxbd 0x40(%r13,%rcx,4),%xmm5
+    vpmovsxbd 0x40(%r13,%rcx,4),%ymm11
+    vpmovsxbq (%rax),%xmm5
+    vpmovsxbq (%rax),%ymm11
+    vpmovsxbq 0x40(%r13,%rcx,4),%xmm5
+    vpmovsxbq 0x40(%r13,%rcx,4),%ymm11
+    vpmovsxwd (%rax),%xmm5
+    vpmovsxwd (%rax),%ymm11
+    vpmovsxwd 0x40(%r13,%rcx,4),%xmm5
+    vpmovsxwd 0x40(%r13,%rcx,4),%ymm11
+    vpmovsxwq (%rax),%xmm5
+    vpmovsxwq (%rax),%ymm11
+    vpmovsxwq 0x40(%r13,%rcx,4),%xmm5
+    vpmovsxwq 0x40(%r13,%rcx,4),%ymm11
+    vpmovsxdq (%rax),%xmm5
+    vpmovsxdq (%rax),%ymm11
+    vpmovsxdq 0x40(%r13,%rcx,4),%xmm5
+    vpmovsxdq 0x40(%r13,%rcx,4),%ymm11
+    vpmuldq %xmm1,%xmm2,%xmm3
+    vpmuldq %xmm9,%xmm12,%xmm15
+    vpmuldq %ymm1,%ymm10,%ymm3
+    vpmuldq %ymm13,%ymm2,%ymm14
+    vpmuldq (%rax),%xmm2,%xmm3
+    vpmuldq 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmuldq -8(%rsp),%ymm10,%ymm3
+    vpmuldq 0x1000(%r9),%ymm2,%ymm14
+    vpcmpeqq %xmm1,%xmm2,%xmm3
+    vpcmpeqq %xmm9,%xmm12,%xmm15
+    vpcmpeqq %ymm1,%ymm10,%ymm3
+    vpcmpeqq %ymm13,%ymm2,%ymm14
+    vpcmpeqq (%rax),%xmm2,%xmm3
+    vpcmpeqq 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpcmpeqq -8(%rsp),%ymm10,%ymm3
+    vpcmpeqq 0x1000(%r9),%ymm2,%ymm14
+    vmovntdqa (%rax),%xmm5
+    vmovntdqa 0x40(%r13,%rcx,4),%xmm5
+    vmovntdqa -8(%rsp),%xmm5
+    vmovntdqa 0x1000(%r9),%xmm5
+    vmovntdqa (%rdx),%ymm12
+    vpackusdw %xmm1,%xmm2,%xmm3
+    vpackusdw %xmm9,%xmm12,%xmm15
+    vpackusdw %ymm1,%ymm10,%ymm3
+    vpackusdw %ymm13,%ymm2,%ymm14
+    vpackusdw (%rax),%xmm2,%xmm3
+    vpackusdw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpackusdw -8(%rsp),%ymm10,%ymm3
+    vpackusdw 0x1000(%r9),%ymm2,%ymm14
+    vpmovzxbw (%rax),%xmm5
+    vpmovzxbw (%rax),%ymm11
+    vpmovzxbw 0x40(%r13,%rcx,4),%xmm5
+    vpmovzxbw 0x40(%r13,%rcx,4),%ymm11
+    vpmovzxbd (%rax),%xmm5
+    vpmovzxbd (%rax),%ymm11
+    vpmovzxbd 0x40(%r13,%rcx,4),%xmm5
+    vpmovzxbd 0x40(%r13,%rcx,4),%ymm11
+    vpmovzxbq (%rax),%xmm5
+    vpmovzxbq (%rax),%ymm11
+    vpmovzxbq 0x40(%r13,%rcx,4),%xmm5
+    vpmovzxbq 0x40(%r13,%rcx,4),%ymm11
+    vpmovzxwd (%rax),%xmm5
+    vpmovzxwd (%rax),%ymm11
+    vpmovzxwd 0x40(%r13,%rcx,4),%xmm5
+    vpmovzxwd 0x40(%r13,%rcx,4),%ymm11
+    vpmovzxwq (%rax),%xmm5
+    vpmovzxwq (%rax),%ymm11
+    vpmovzxwq 0x40(%r13,%rcx,4),%xmm5
+    vpmovzxwq 0x40(%r13,%rcx,4),%ymm11
+    vpmovzxdq (%rax),%xmm5
+    vpmovzxdq (%rax),%ymm11
+    vpmovzxdq 0x40(%r13,%rcx,4),%xmm5
+    vpmovzxdq 0x40(%r13,%rcx,4),%ymm11
+    vpcmpgtq %xmm1,%xmm2,%xmm3
+    vpcmpgtq %xmm9,%xmm12,%xmm15
+    vpcmpgtq %ymm1,%ymm10,%ymm3
+    vpcmpgtq %ymm13,%ymm2,%ymm14
+    vpcmpgtq (%rax),%xmm2,%xmm3
+    vpcmpgtq 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpcmpgtq -8(%rsp),%ymm10,%ymm3
+    vpcmpgtq 0x1000(%r9),%ymm2,%ymm14
+    vpminsb %xmm1,%xmm2,%xmm3
+    vpminsb %xmm9,%xmm12,%xmm15
+    vpminsb %ymm1,%ymm10,%ymm3
+    vpminsb %ymm13,%ymm2,%ymm14
+    vpminsb (%rax),%xmm2,%xmm3
+    vpminsb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpminsb -8(%rsp),%ymm10,%ymm3
+    vpminsb 0x1000(%r9),%ymm2,%ymm14
+    vpminsd %xmm1,%xmm2,%xmm3
+    vpminsd %xmm9,%xmm12,%xmm15
+    vpminsd (%rax),%xmm2,%xmm3
+    vpminsd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpminuw %xmm1,%xmm2,%xmm3
+    vpminuw %xmm9,%xmm12,%xmm15
+    vpminuw %ymm1,%ymm10,%ymm3
+    vpminuw %ymm13,%ymm2,%ymm14
+    vpminuw (%rax),%xmm2,%xmm3
+    vpminuw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpminuw -8(%rsp),%ymm10,%ymm3
+    vpminuw 0x1000(%r9),%ymm2,%ymm14
+    vpminud %xmm1,%xmm2,%xmm3
+    vpminud %xmm9,%xmm12,%xmm15
+    vpminud %ymm1,%ymm10,%ymm3
+    vpminud %ymm13,%ymm2,%ymm14
+    vpminud (%rax),%xmm2,%xmm3
+    vpminud 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpminud -8(%rsp),%ymm10,%ymm3
+    vpminud 0x1000(%r9),%ymm2,%ymm14
+    vpmaxsb %xmm1,%xmm2,%xmm3
+    vpmaxsb %xmm9,%xmm12,%xmm15
+    vpmaxsb %ymm1,%ymm10,%ymm3
+    vpmaxsb %ymm13,%ymm2,%ymm14
+    vpmaxsb (%rax),%xmm2,%xmm3
+    vpmaxsb 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmaxsb -8(%rsp),%ymm10,%ymm3
+    vpmaxsb 0x1000(%r9),%ymm2,%ymm14
+    vpmaxsd %xmm1,%xmm2,%xmm3
+    vpmaxsd %xmm9,%xmm12,%xmm15
+    vpmaxsd (%rax),%xmm2,%xmm3
+    vpmaxsd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmaxuw %xmm1,%xmm2,%xmm3
+    vpmaxuw %xmm9,%xmm12,%xmm15
+    vpmaxuw %ymm1,%ymm10,%ymm3
+    vpmaxuw %ymm13,%ymm2,%ymm14
+    vpmaxuw (%rax),%xmm2,%xmm3
+    vpmaxuw 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmaxuw -8(%rsp),%ymm10,%ymm3
+    vpmaxuw 0x1000(%r9),%ymm2,%ymm14
+    vpmaxud %xmm1,%xmm2,%xmm3
+    vpmaxud %xmm9,%xmm12,%xmm15
+    vpmaxud %ymm1,%ymm10,%ymm3
+    vpmaxud %ymm13,%ymm2,%ymm14
+    vpmaxud (%rax),%xmm2,%xmm3
+    vpmaxud 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmaxud -8(%rsp),%ymm10,%ymm3
+    vpmaxud 0x1000(%r9),%ymm2,%ymm14
+    vpmulld %xmm1,%xmm2,%xmm3
+    vpmulld %xmm9,%xmm12,%xmm15
+    vpmulld %ymm1,%ymm10,%ymm3
+    vpmulld %ymm13,%ymm2,%ymm14
+    vpmulld (%rax),%xmm2,%xmm3
+    vpmulld 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpmulld -8(%rsp),%ymm10,%ymm3
+    vpmulld 0x1000(%r9),%ymm2,%ymm14
+    vphminposuw %xmm1,%xmm3
+    vphminposuw %xmm9,%xmm15
+    vphminposuw (%rax),%xmm3
+    vphminposuw 0x40(%r13,%rcx,4),%xmm15
+    vpalignr $5,%xmm1,%xmm2,%xmm3
+    vpalignr $5,%xmm9,%xmm12,%xmm15
+    vpalignr $5,%ymm1,%ymm10,%ymm3
+    vpalignr $5,%ymm13,%ymm2,%ymm14
+    vpalignr $0x7f,(%rax),%xmm2,%xmm3
+    vpalignr $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpalignr $0x7f,-8(%rsp),%ymm10,%ymm3
+    vpalignr $0x7f,0x1000(%r9),%ymm2,%ymm14
+    vroundps $3,%xmm1,%xmm3
+    vroundps $3,%xmm9,%xmm15
+    vroundps $3,%ymm1,%ymm3
+    vroundps $3,%ymm13,%ymm14
+    vroundps $0x1b,(%rax),%xmm3
+    vroundps $0x1b,0x40(%r13,%rcx,4),%xmm15
+    vroundps $0x1b,-8(%rsp),%ymm3
+    vroundps $0x1b,0x1000(%r9),%ymm14
+    vroundpd $3,%xmm1,%xmm3
+    vroundpd $3,%xmm9,%xmm15
+    vroundpd $3,%ymm1,%ymm3
+    vroundpd $3,%ymm13,%ymm14
+    vroundpd $0x1b,(%rax),%xmm3
+    vroundpd $0x1b,0x40(%r13,%rcx,4),%xmm15
+    vroundpd $0x1b,-8(%rsp),%ymm3
+    vroundpd $0x1b,0x1000(%r9),%ymm14
+    vroundss $5,%xmm1,%xmm2,%xmm3
+    vroundss $5,%xmm9,%xmm12,%xmm15
+    vroundss $0x7f,(%rax),%xmm2,%xmm3
+    vroundss $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vroundsd $5,%xmm1,%xmm2,%xmm3
+    vroundsd $5,%xmm9,%xmm12,%xmm15
+    vroundsd $0x7f,(%rax),%xmm2,%xmm3
+    vroundsd $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vblendps $5,%xmm1,%xmm2,%xmm3
+    vblendps $5,%xmm9,%xmm12,%xmm15
+    vblendps $5,%ymm1,%ymm10,%ymm3
+    vblendps $5,%ymm13,%ymm2,%ymm14
+    vblendps $0x7f,(%rax),%xmm2,%xmm3
+    vblendps $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vblendps $0x7f,-8(%rsp),%ymm10,%ymm3
+    vblendps $0x7f,0x1000(%r9),%ymm2,%ymm14
+    vblendpd $5,%xmm1,%xmm2,%xmm3
+    vblendpd $5,%xmm9,%xmm12,%xmm15
+    vblendpd $5,%ymm1,%ymm10,%ymm3
+    vblendpd $5,%ymm13,%ymm2,%ymm14
+    vblendpd $0x7f,(%rax),%xmm2,%xmm3
+    vblendpd $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vblendpd $0x7f,-8(%rsp),%ymm10,%ymm3
+    vblendpd $0x7f,0x1000(%r9),%ymm2,%ymm14
+    vpblendw $5,%xmm1,%xmm2,%xmm3
+    vpblendw $5,%xmm9,%xmm12,%xmm15
+    vpblendw $5,%ymm1,%ymm10,%ymm3
+    vpblendw $5,%ymm13,%ymm2,%ymm14
+    vpblendw $0x7f,(%rax),%xmm2,%xmm3
+    vpblendw $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpblendw $0x7f,-8(%rsp),%ymm10,%ymm3
+    vpblendw $0x7f,0x1000(%r9),%ymm2,%ymm14
+    vinsertps $5,%xmm1,%xmm2,%xmm3
+    vinsertps $5,%xmm9,%xmm12,%xmm15
+    vinsertps $0x7f,(%rax),%xmm2,%xmm3
+    vinsertps $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vdpps $5,%xmm1,%xmm2,%xmm3
+    vdpps $5,%xmm9,%xmm12,%xmm15
+    vdpps $5,%ymm1,%ymm10,%ymm3
+    vdpps $5,%ymm13,%ymm2,%ymm14
+    vdpps $0x7f,(%rax),%xmm2,%xmm3
+    vdpps $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vdpps $0x7f,-8(%rsp),%ymm10,%ymm3
+    vdpps $0x7f,0x1000(%r9),%ymm2,%ymm14
+    vdppd $5,%xmm1,%xmm2,%xmm3
+    vdppd $5,%xmm9,%xmm12,%xmm15
+    vdppd $0x7f,(%rax),%xmm2,%xmm3
+    vdppd $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vmpsadbw $5,%xmm1,%xmm2,%xmm3
+    vmpsadbw $5,%xmm9,%xmm12,%xmm15
+    vmpsadbw $5,%ymm1,%ymm10,%ymm3
+    vmpsadbw $5,%ymm13,%ymm2,%ymm14
+    vmpsadbw $0x7f,(%rax),%xmm2,%xmm3
+    vmpsadbw $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vmpsadbw $0x7f,-8(%rsp),%ymm10,%ymm3
+    vmpsadbw $0x7f,0x1000(%r9),%ymm2,%ymm14
+    vpcmpestrm $3,%xmm1,%xmm3
+    vpcmpestrm $3,%xmm9,%xmm15
+    vpcmpestrm $0x1b,(%rax),%xmm3
+    vpcmpestrm $0x1b,0x40(%r13,%rcx,4),%xmm15
+    vpcmpestri $3,%xmm1,%xmm3
+    vpcmpestri $3,%xmm9,%xmm15
+    vpcmpestri $0x1b,(%rax),%xmm3
+    vpcmpestri $0x1b,0x40(%r13,%rcx,4),%xmm15
+    vpcmpistrm $3,%xmm1,%xmm3
+    vpcmpistrm $3,%xmm9,%xmm15
+    vpcmpistrm $0x1b,(%rax),%xmm3
+    vpcmpistrm $0x1b,0x40(%r13,%rcx,4),%xmm15
+    vpcmpistri $3,%xmm1,%xmm3
+    vpcmpistri $3,%xmm9,%xmm15
+    vpcmpistri $0x1b,(%rax),%xmm3
+    vpcmpistri $0x1b,0x40(%r13,%rcx,4),%xmm15
+    vblendvps %xmm7,%xmm1,%xmm2,%xmm3
+    vblendvps %xmm14,0x40(%r13,%rcx,4),%xmm2,%xmm3
+    vblendvps %xmm7,%xmm9,%xmm12,%xmm15
+    vblendvps %xmm14,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vblendvps %ymm7,%ymm1,%ymm10,%ymm3
+    vblendvps %ymm14,0x40(%r13,%rcx,4),%ymm10,%ymm3
+    vblendvps %ymm7,%ymm13,%ymm2,%ymm14
+    vblendvps %ymm14,0x40(%r13,%rcx,4),%ymm2,%ymm14
+    vblendvpd %xmm7,%xmm1,%xmm2,%xmm3
+    vblendvpd %xmm14,0x40(%r13,%rcx,4),%xmm2,%xmm3
+    vblendvpd %xmm7,%xmm9,%xmm12,%xmm15
+    vblendvpd %xmm14,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vblendvpd %ymm7,%ymm1,%ymm10,%ymm3
+    vblendvpd %ymm14,0x40(%r13,%rcx,4),%ymm10,%ymm3
+    vblendvpd %ymm7,%ymm13,%ymm2,%ymm14
+    vblendvpd %ymm14,0x40(%r13,%rcx,4),%ymm2,%ymm14
+    vpblendvb %xmm7,%xmm1,%xmm2,%xmm3
+    vpblendvb %xmm14,0x40(%r13,%rcx,4),%xmm2,%xmm3
+    vpblendvb %xmm7,%xmm9,%xmm12,%xmm15
+    vpblendvb %xmm14,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpblendvb %ymm7,%ymm1,%ymm10,%ymm3
+    vpblendvb %ymm14,0x40(%r13,%rcx,4),%ymm10,%ymm3
+    vpblendvb %ymm7,%ymm13,%ymm2,%ymm14
+    vpblendvb %ymm14,0x40(%r13,%rcx,4),%ymm2,%ymm14
+    vbroadcastss (%rax),%xmm5
+    vbroadcastss (%rax),%ymm11
+    vbroadcastss 0x40(%r13,%rcx,4),%xmm5
+    vbroadcastss 0x40(%r13,%rcx,4),%ymm11
+    vbroadcastss %xmm3,%ymm11
+    vbroadcastss %xmm12,%xmm5
+    vbroadcastsd (%rax),%ymm11
+    vbroadcastsd 0x40(%r13,%rcx,4),%ymm11
+    vbroadcastsd %xmm3,%ymm11
+    vbroadcastf128 (%rax),%ymm5
+    vbroadcastf128 0x40(%r13,%rcx,4),%ymm5
+    vbroadcastf128 -8(%rsp),%ymm5
+    vbroadcastf128 0x1000(%r9),%ymm5
+    vbroadcasti128 (%rax),%ymm5
+    vbroadcasti128 0x40(%r13,%rcx,4),%ymm5
+    vbroadcasti128 -8(%rsp),%ymm5
+    vbroadcasti128 0x1000(%r9),%ymm5
+    vpbroadcastb (%rax),%xmm5
+    vpbroadcastb (%rax),%ymm11
+    vpbroadcastb 0x40(%r13,%rcx,4),%xmm5
+    vpbroadcastb 0x40(%r13,%rcx,4),%ymm11
+    vpbroadcastb %xmm3,%ymm11
+    vpbroadcastb %xmm12,%xmm5
+    vpbroadcastw (%rax),%xmm5
+    vpbroadcastw (%rax),%ymm11
+    vpbroadcastw 0x40(%r13,%rcx,4),%xmm5
+    vpbroadcastw 0x40(%r13,%rcx,4),%ymm11
+    vpbroadcastw %xmm3,%ymm11
+    vpbroadcastw %xmm12,%xmm5
+    vpbroadcastd (%rax),%xmm5
+    vpbroadcastd (%rax),%ymm11
+    vpbroadcastd 0x40(%r13,%rcx,4),%xmm5
+    vpbroadcastd 0x40(%r13,%rcx,4),%ymm11
+    vpbroadcastd %xmm3,%ymm11
+    vpbroadcastd %xmm12,%xmm5
+    vpbroadcastq (%rax),%xmm5
+    vpbroadcastq (%rax),%ymm11
+    vpbroadcastq 0x40(%r13,%rcx,4),%xmm5
+    vpbroadcastq 0x40(%r13,%rcx,4),%ymm11
+    vpbroadcastq %xmm3,%ymm11
+    vpbroadcastq %xmm12,%xmm5
+    vinsertf128 $1,%xmm3,%ymm4,%ymm12
+    vinsertf128 $0,(%rax),%ymm9,%ymm2
+    vinserti128 $1,%xmm3,%ymm4,%ymm12
+    vinserti128 $0,(%rax),%ymm9,%ymm2
+    vextractf128 $1,%ymm3,%xmm12
+    vextractf128 $0,%ymm13,(%rax)
+    vextractf128 $1,%ymm2,0x10(%r12)
+    vextracti128 $1,%ymm3,%xmm12
+    vextracti128 $0,%ymm13,(%rax)
+    vextracti128 $1,%ymm2,0x10(%r12)
+    vperm2f128 $0x31,%ymm3,%ymm4,%ymm12
+    vperm2f128 $0x20,(%rax),%ymm9,%ymm2
+    vperm2i128 $0x31,%ymm3,%ymm4,%ymm12
+    vperm2i128 $0x20,(%rax),%ymm9,%ymm2
+    vpermd %ymm1,%ymm10,%ymm3
+    vpermd %ymm13,%ymm2,%ymm14
+    vpermd -8(%rsp),%ymm10,%ymm3
+    vpermd 0x1000(%r9),%ymm2,%ymm14
+    vpermps %ymm1,%ymm10,%ymm3
+    vpermps %ymm13,%ymm2,%ymm14
+    vpermps -8(%rsp),%ymm10,%ymm3
+    vpermps 0x1000(%r9),%ymm2,%ymm14
+    vpermq $3,%ymm1,%ymm3
+    vpermq $3,%ymm13,%ymm14
+    vpermq $0x1b,(%rax),%ymm3
+    vpermq $0x1b,0x40(%r13,%rcx,4),%ymm14
+    vpermpd $3,%ymm1,%ymm3
+    vpermpd $3,%ymm13,%ymm14
+    vpermpd $0x1b,(%rax),%ymm3
+    vpermpd $0x1b,0x40(%r13,%rcx,4),%ymm14
+    vpermilps $3,%xmm1,%xmm3
+    vpermilps $3,%xmm9,%xmm15
+    vpermilps $3,%ymm1,%ymm3
+    vpermilps $3,%ymm13,%ymm14
+    vpermilps $0x1b,(%rax),%xmm3
+    vpermilps $0x1b,0x40(%r13,%rcx,4),%xmm15
+    vpermilps $0x1b,-8(%rsp),%ymm3
+    vpermilps $0x1b,0x1000(%r9),%ymm14
+    vpermilps %xmm1,%xmm2,%xmm3
+    vpermilps %xmm9,%xmm12,%xmm15
+    vpermilps %ymm1,%ymm10,%ymm3
+    vpermilps %ymm13,%ymm2,%ymm14
+    vpermilpd $3,%xmm1,%xmm3
+    vpermilpd $3,%xmm9,%xmm15
+    vpermilpd $3,%ymm1,%ymm3
+    vpermilpd $3,%ymm13,%ymm14
+    vpermilpd $0x1b,(%rax),%xmm3
+    vpermilpd $0x1b,0x40(%r13,%rcx,4),%xmm15
+    vpermilpd $0x1b,-8(%rsp),%ymm3
+    vpermilpd $0x1b,0x1000(%r9),%ymm14
+    vpermilpd %xmm1,%xmm2,%xmm3
+    vpermilpd %xmm9,%xmm12,%xmm15
+    vpermilpd %ymm1,%ymm10,%ymm3
+    vpermilpd %ymm13,%ymm2,%ymm14
+    vpblendd $5,%xmm1,%xmm2,%xmm3
+    vpblendd $5,%xmm9,%xmm12,%xmm15
+    vpblendd $5,%ymm1,%ymm10,%ymm3
+    vpblendd $5,%ymm13,%ymm2,%ymm14
+    vpblendd $0x7f,(%rax),%xmm2,%xmm3
+    vpblendd $0x7f,0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpblendd $0x7f,-8(%rsp),%ymm10,%ymm3
+    vpblendd $0x7f,0x1000(%r9),%ymm2,%ymm14
+    vtestps %xmm1,%xmm3
+    vtestps %xmm9,%xmm15
+    vtestps %ymm1,%ymm3
+    vtestps %ymm13,%ymm14
+    vtestps (%rax),%xmm3
+    vtestps 0x40(%r13,%rcx,4),%xmm15
+    vtestps -8(%rsp),%ymm3
+    vtestps 0x1000(%r9),%ymm14
+    vtestpd %xmm1,%xmm3
+    vtestpd %xmm9,%xmm15
+    vtestpd %ymm1,%ymm3
+    vtestpd %ymm13,%ymm14
+    vtestpd (%rax),%xmm3
+    vtestpd 0x40(%r13,%rcx,4),%xmm15
+    vtestpd -8(%rsp),%ymm3
+    vtestpd 0x1000(%r9),%ymm14
+    vpsllvd %xmm1,%xmm2,%xmm3
+    vpsllvd %xmm9,%xmm12,%xmm15
+    vpsllvd %ymm1,%ymm10,%ymm3
+    vpsllvd %ymm13,%ymm2,%ymm14
+    vpsllvd (%rax),%xmm2,%xmm3
+    vpsllvd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsllvd -8(%rsp),%ymm10,%ymm3
+    vpsllvd 0x1000(%r9),%ymm2,%ymm14
+    vpsllvq %xmm1,%xmm2,%xmm3
+    vpsllvq %xmm9,%xmm12,%xmm15
+    vpsllvq %ymm1,%ymm10,%ymm3
+    vpsllvq %ymm13,%ymm2,%ymm14
+    vpsllvq (%rax),%xmm2,%xmm3
+    vpsllvq 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsllvq -8(%rsp),%ymm10,%ymm3
+    vpsllvq 0x1000(%r9),%ymm2,%ymm14
+    vpsrlvd %xmm1,%xmm2,%xmm3
+    vpsrlvd %xmm9,%xmm12,%xmm15
+    vpsrlvd %ymm1,%ymm10,%ymm3
+    vpsrlvd %ymm13,%ymm2,%ymm14
+    vpsrlvd (%rax),%xmm2,%xmm3
+    vpsrlvd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsrlvd -8(%rsp),%ymm10,%ymm3
+    vpsrlvd 0x1000(%r9),%ymm2,%ymm14
+    vpsrlvq %xmm1,%xmm2,%xmm3
+    vpsrlvq %xmm9,%xmm12,%xmm15
+    vpsrlvq %ymm1,%ymm10,%ymm3
+    vpsrlvq %ymm13,%ymm2,%ymm14
+    vpsrlvq (%rax),%xmm2,%xmm3
+    vpsrlvq 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsrlvq -8(%rsp),%ymm10,%ymm3
+    vpsrlvq 0x1000(%r9),%ymm2,%ymm14
+    vpsravd %xmm1,%xmm2,%xmm3
+    vpsravd %xmm9,%xmm12,%xmm15
+    vpsravd %ymm1,%ymm10,%ymm3
+    vpsravd %ymm13,%ymm2,%ymm14
+    vpsravd (%rax),%xmm2,%xmm3
+    vpsravd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vpsravd -8(%rsp),%ymm10,%ymm3
+    vpsravd 0x1000(%r9),%ymm2,%ymm14
+    vzeroupper
+    vzeroall
+    vpgatherdd %xmm1,(%rax,%xmm2,4),%xmm3
+    vpgatherdd %ymm9,8(%r8,%ymm12,8),%ymm3
+    vpgatherdq %xmm1,(%rax,%xmm2,4),%xmm3
+    vpgatherdq %ymm9,8(%r8,%xmm12,8),%ymm3
+    vpgatherqd %xmm1,(%rax,%xmm2,4),%xmm3
+    vpgatherqd %xmm9,8(%r8,%ymm12,8),%xmm3
+    vpgatherqq %xmm1,(%rax,%xmm2,4),%xmm3
+    vpgatherqq %ymm9,8(%r8,%ymm12,8),%ymm3
+    vpgatherqq %ymm9,(,%ymm12,2),%ymm3
+    vgatherdps %xmm1,(%rax,%xmm2,4),%xmm3
+    vgatherdps %ymm9,8(%r8,%ymm12,8),%ymm3
+    vgatherdpd %xmm1,(%rax,%xmm2,4),%xmm3
+    vgatherdpd %ymm9,8(%r8,%xmm12,8),%ymm3
+    vgatherqps %xmm1,(%rax,%xmm2,4),%xmm3
+    vgatherqps %xmm9,8(%r8,%ymm12,8),%xmm3
+    vgatherqpd %xmm1,(%rax,%xmm2,4),%xmm3
+    vgatherqpd %ymm9,8(%r8,%ymm12,8),%ymm3
+    vgatherqpd %ymm9,(,%ymm12,2),%ymm3
+    vfmadd132ps %xmm1,%xmm2,%xmm3
+    vfmadd132ps %xmm9,%xmm12,%xmm15
+    vfmadd132ps %ymm1,%ymm10,%ymm3
+    vfmadd132ps %ymm13,%ymm2,%ymm14
+    vfmadd132ps (%rax),%xmm2,%xmm3
+    vfmadd132ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmadd132ps -8(%rsp),%ymm10,%ymm3
+    vfmadd132ps 0x1000(%r9),%ymm2,%ymm14
+    vfmadd132pd %xmm1,%xmm2,%xmm3
+    vfmadd132pd %xmm9,%xmm12,%xmm15
+    vfmadd132pd %ymm1,%ymm10,%ymm3
+    vfmadd132pd %ymm13,%ymm2,%ymm14
+    vfmadd132pd (%rax),%xmm2,%xmm3
+    vfmadd132pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmadd132pd -8(%rsp),%ymm10,%ymm3
+    vfmadd132pd 0x1000(%r9),%ymm2,%ymm14
+    vfmadd132ss %xmm1,%xmm2,%xmm3
+    vfmadd132ss %xmm9,%xmm12,%xmm15
+    vfmadd132ss (%rax),%xmm2,%xmm3
+    vfmadd132ss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmadd132sd %xmm1,%xmm2,%xmm3
+    vfmadd132sd %xmm9,%xmm12,%xmm15
+    vfmadd132sd (%rax),%xmm2,%xmm3
+    vfmadd132sd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmadd213ps %xmm1,%xmm2,%xmm3
+    vfmadd213ps %xmm9,%xmm12,%xmm15
+    vfmadd213ps %ymm1,%ymm10,%ymm3
+    vfmadd213ps %ymm13,%ymm2,%ymm14
+    vfmadd213ps (%rax),%xmm2,%xmm3
+    vfmadd213ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmadd213ps -8(%rsp),%ymm10,%ymm3
+    vfmadd213ps 0x1000(%r9),%ymm2,%ymm14
+    vfmadd213pd %xmm1,%xmm2,%xmm3
+    vfmadd213pd %xmm9,%xmm12,%xmm15
+    vfmadd213pd %ymm1,%ymm10,%ymm3
+    vfmadd213pd %ymm13,%ymm2,%ymm14
+    vfmadd213pd (%rax),%xmm2,%xmm3
+    vfmadd213pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmadd213pd -8(%rsp),%ymm10,%ymm3
+    vfmadd213pd 0x1000(%r9),%ymm2,%ymm14
+    vfmadd213ss %xmm1,%xmm2,%xmm3
+    vfmadd213ss %xmm9,%xmm12,%xmm15
+    vfmadd213ss (%rax),%xmm2,%xmm3
+    vfmadd213ss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmadd213sd %xmm1,%xmm2,%xmm3
+    vfmadd213sd %xmm9,%xmm12,%xmm15
+    vfmadd213sd (%rax),%xmm2,%xmm3
+    vfmadd213sd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmadd231ps %xmm1,%xmm2,%xmm3
+    vfmadd231ps %xmm9,%xmm12,%xmm15
+    vfmadd231ps %ymm1,%ymm10,%ymm3
+    vfmadd231ps %ymm13,%ymm2,%ymm14
+    vfmadd231ps (%rax),%xmm2,%xmm3
+    vfmadd231ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmadd231ps -8(%rsp),%ymm10,%ymm3
+    vfmadd231ps 0x1000(%r9),%ymm2,%ymm14
+    vfmadd231pd %xmm1,%xmm2,%xmm3
+    vfmadd231pd %xmm9,%xmm12,%xmm15
+    vfmadd231pd %ymm1,%ymm10,%ymm3
+    vfmadd231pd %ymm13,%ymm2,%ymm14
+    vfmadd231pd (%rax),%xmm2,%xmm3
+    vfmadd231pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmadd231pd -8(%rsp),%ymm10,%ymm3
+    vfmadd231pd 0x1000(%r9),%ymm2,%ymm14
+    vfmadd231ss %xmm1,%xmm2,%xmm3
+    vfmadd231ss %xmm9,%xmm12,%xmm15
+    vfmadd231ss (%rax),%xmm2,%xmm3
+    vfmadd231ss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmadd231sd %xmm1,%xmm2,%xmm3
+    vfmadd231sd %xmm9,%xmm12,%xmm15
+    vfmadd231sd (%rax),%xmm2,%xmm3
+    vfmadd231sd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsub132ps %xmm1,%xmm2,%xmm3
+    vfmsub132ps %xmm9,%xmm12,%xmm15
+    vfmsub132ps %ymm1,%ymm10,%ymm3
+    vfmsub132ps %ymm13,%ymm2,%ymm14
+    vfmsub132ps (%rax),%xmm2,%xmm3
+    vfmsub132ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsub132ps -8(%rsp),%ymm10,%ymm3
+    vfmsub132ps 0x1000(%r9),%ymm2,%ymm14
+    vfmsub132pd %xmm1,%xmm2,%xmm3
+    vfmsub132pd %xmm9,%xmm12,%xmm15
+    vfmsub132pd %ymm1,%ymm10,%ymm3
+    vfmsub132pd %ymm13,%ymm2,%ymm14
+    vfmsub132pd (%rax),%xmm2,%xmm3
+    vfmsub132pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsub132pd -8(%rsp),%ymm10,%ymm3
+    vfmsub132pd 0x1000(%r9),%ymm2,%ymm14
+    vfmsub132ss %xmm1,%xmm2,%xmm3
+    vfmsub132ss %xmm9,%xmm12,%xmm15
+    vfmsub132ss (%rax),%xmm2,%xmm3
+    vfmsub132ss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsub132sd %xmm1,%xmm2,%xmm3
+    vfmsub132sd %xmm9,%xmm12,%xmm15
+    vfmsub132sd (%rax),%xmm2,%xmm3
+    vfmsub132sd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsub213ps %xmm1,%xmm2,%xmm3
+    vfmsub213ps %xmm9,%xmm12,%xmm15
+    vfmsub213ps %ymm1,%ymm10,%ymm3
+    vfmsub213ps %ymm13,%ymm2,%ymm14
+    vfmsub213ps (%rax),%xmm2,%xmm3
+    vfmsub213ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsub213ps -8(%rsp),%ymm10,%ymm3
+    vfmsub213ps 0x1000(%r9),%ymm2,%ymm14
+    vfmsub213pd %xmm1,%xmm2,%xmm3
+    vfmsub213pd %xmm9,%xmm12,%xmm15
+    vfmsub213pd %ymm1,%ymm10,%ymm3
+    vfmsub213pd %ymm13,%ymm2,%ymm14
+    vfmsub213pd (%rax),%xmm2,%xmm3
+    vfmsub213pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsub213pd -8(%rsp),%ymm10,%ymm3
+    vfmsub213pd 0x1000(%r9),%ymm2,%ymm14
+    vfmsub213ss %xmm1,%xmm2,%xmm3
+    vfmsub213ss %xmm9,%xmm12,%xmm15
+    vfmsub213ss (%rax),%xmm2,%xmm3
+    vfmsub213ss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsub213sd %xmm1,%xmm2,%xmm3
+    vfmsub213sd %xmm9,%xmm12,%xmm15
+    vfmsub213sd (%rax),%xmm2,%xmm3
+    vfmsub213sd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsub231ps %xmm1,%xmm2,%xmm3
+    vfmsub231ps %xmm9,%xmm12,%xmm15
+    vfmsub231ps %ymm1,%ymm10,%ymm3
+    vfmsub231ps %ymm13,%ymm2,%ymm14
+    vfmsub231ps (%rax),%xmm2,%xmm3
+    vfmsub231ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsub231ps -8(%rsp),%ymm10,%ymm3
+    vfmsub231ps 0x1000(%r9),%ymm2,%ymm14
+    vfmsub231pd %xmm1,%xmm2,%xmm3
+    vfmsub231pd %xmm9,%xmm12,%xmm15
+    vfmsub231pd %ymm1,%ymm10,%ymm3
+    vfmsub231pd %ymm13,%ymm2,%ymm14
+    vfmsub231pd (%rax),%xmm2,%xmm3
+    vfmsub231pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsub231pd -8(%rsp),%ymm10,%ymm3
+    vfmsub231pd 0x1000(%r9),%ymm2,%ymm14
+    vfmsub231ss %xmm1,%xmm2,%xmm3
+    vfmsub231ss %xmm9,%xmm12,%xmm15
+    vfmsub231ss (%rax),%xmm2,%xmm3
+    vfmsub231ss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsub231sd %xmm1,%xmm2,%xmm3
+    vfmsub231sd %xmm9,%xmm12,%xmm15
+    vfmsub231sd (%rax),%xmm2,%xmm3
+    vfmsub231sd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmadd132ps %xmm1,%xmm2,%xmm3
+    vfnmadd132ps %xmm9,%xmm12,%xmm15
+    vfnmadd132ps %ymm1,%ymm10,%ymm3
+    vfnmadd132ps %ymm13,%ymm2,%ymm14
+    vfnmadd132ps (%rax),%xmm2,%xmm3
+    vfnmadd132ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmadd132ps -8(%rsp),%ymm10,%ymm3
+    vfnmadd132ps 0x1000(%r9),%ymm2,%ymm14
+    vfnmadd132pd %xmm1,%xmm2,%xmm3
+    vfnmadd132pd %xmm9,%xmm12,%xmm15
+    vfnmadd132pd %ymm1,%ymm10,%ymm3
+    vfnmadd132pd %ymm13,%ymm2,%ymm14
+    vfnmadd132pd (%rax),%xmm2,%xmm3
+    vfnmadd132pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmadd132pd -8(%rsp),%ymm10,%ymm3
+    vfnmadd132pd 0x1000(%r9),%ymm2,%ymm14
+    vfnmadd132ss %xmm1,%xmm2,%xmm3
+    vfnmadd132ss %xmm9,%xmm12,%xmm15
+    vfnmadd132ss (%rax),%xmm2,%xmm3
+    vfnmadd132ss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmadd132sd %xmm1,%xmm2,%xmm3
+    vfnmadd132sd %xmm9,%xmm12,%xmm15
+    vfnmadd132sd (%rax),%xmm2,%xmm3
+    vfnmadd132sd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmadd213ps %xmm1,%xmm2,%xmm3
+    vfnmadd213ps %xmm9,%xmm12,%xmm15
+    vfnmadd213ps %ymm1,%ymm10,%ymm3
+    vfnmadd213ps %ymm13,%ymm2,%ymm14
+    vfnmadd213ps (%rax),%xmm2,%xmm3
+    vfnmadd213ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmadd213ps -8(%rsp),%ymm10,%ymm3
+    vfnmadd213ps 0x1000(%r9),%ymm2,%ymm14
+    vfnmadd213pd %xmm1,%xmm2,%xmm3
+    vfnmadd213pd %xmm9,%xmm12,%xmm15
+    vfnmadd213pd %ymm1,%ymm10,%ymm3
+    vfnmadd213pd %ymm13,%ymm2,%ymm14
+    vfnmadd213pd (%rax),%xmm2,%xmm3
+    vfnmadd213pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmadd213pd -8(%rsp),%ymm10,%ymm3
+    vfnmadd213pd 0x1000(%r9),%ymm2,%ymm14
+    vfnmadd213ss %xmm1,%xmm2,%xmm3
+    vfnmadd213ss %xmm9,%xmm12,%xmm15
+    vfnmadd213ss (%rax),%xmm2,%xmm3
+    vfnmadd213ss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmadd213sd %xmm1,%xmm2,%xmm3
+    vfnmadd213sd %xmm9,%xmm12,%xmm15
+    vfnmadd213sd (%rax),%xmm2,%xmm3
+    vfnmadd213sd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmadd231ps %xmm1,%xmm2,%xmm3
+    vfnmadd231ps %xmm9,%xmm12,%xmm15
+    vfnmadd231ps %ymm1,%ymm10,%ymm3
+    vfnmadd231ps %ymm13,%ymm2,%ymm14
+    vfnmadd231ps (%rax),%xmm2,%xmm3
+    vfnmadd231ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmadd231ps -8(%rsp),%ymm10,%ymm3
+    vfnmadd231ps 0x1000(%r9),%ymm2,%ymm14
+    vfnmadd231pd %xmm1,%xmm2,%xmm3
+    vfnmadd231pd %xmm9,%xmm12,%xmm15
+    vfnmadd231pd %ymm1,%ymm10,%ymm3
+    vfnmadd231pd %ymm13,%ymm2,%ymm14
+    vfnmadd231pd (%rax),%xmm2,%xmm3
+    vfnmadd231pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmadd231pd -8(%rsp),%ymm10,%ymm3
+    vfnmadd231pd 0x1000(%r9),%ymm2,%ymm14
+    vfnmadd231ss %xmm1,%xmm2,%xmm3
+    vfnmadd231ss %xmm9,%xmm12,%xmm15
+    vfnmadd231ss (%rax),%xmm2,%xmm3
+    vfnmadd231ss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmadd231sd %xmm1,%xmm2,%xmm3
+    vfnmadd231sd %xmm9,%xmm12,%xmm15
+    vfnmadd231sd (%rax),%xmm2,%xmm3
+    vfnmadd231sd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmsub132ps %xmm1,%xmm2,%xmm3
+    vfnmsub132ps %xmm9,%xmm12,%xmm15
+    vfnmsub132ps %ymm1,%ymm10,%ymm3
+    vfnmsub132ps %ymm13,%ymm2,%ymm14
+    vfnmsub132ps (%rax),%xmm2,%xmm3
+    vfnmsub132ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmsub132ps -8(%rsp),%ymm10,%ymm3
+    vfnmsub132ps 0x1000(%r9),%ymm2,%ymm14
+    vfnmsub132pd %xmm1,%xmm2,%xmm3
+    vfnmsub132pd %xmm9,%xmm12,%xmm15
+    vfnmsub132pd %ymm1,%ymm10,%ymm3
+    vfnmsub132pd %ymm13,%ymm2,%ymm14
+    vfnmsub132pd (%rax),%xmm2,%xmm3
+    vfnmsub132pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmsub132pd -8(%rsp),%ymm10,%ymm3
+    vfnmsub132pd 0x1000(%r9),%ymm2,%ymm14
+    vfnmsub132ss %xmm1,%xmm2,%xmm3
+    vfnmsub132ss %xmm9,%xmm12,%xmm15
+    vfnmsub132ss (%rax),%xmm2,%xmm3
+    vfnmsub132ss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmsub132sd %xmm1,%xmm2,%xmm3
+    vfnmsub132sd %xmm9,%xmm12,%xmm15
+    vfnmsub132sd (%rax),%xmm2,%xmm3
+    vfnmsub132sd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmsub213ps %xmm1,%xmm2,%xmm3
+    vfnmsub213ps %xmm9,%xmm12,%xmm15
+    vfnmsub213ps %ymm1,%ymm10,%ymm3
+    vfnmsub213ps %ymm13,%ymm2,%ymm14
+    vfnmsub213ps (%rax),%xmm2,%xmm3
+    vfnmsub213ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmsub213ps -8(%rsp),%ymm10,%ymm3
+    vfnmsub213ps 0x1000(%r9),%ymm2,%ymm14
+    vfnmsub213pd %xmm1,%xmm2,%xmm3
+    vfnmsub213pd %xmm9,%xmm12,%xmm15
+    vfnmsub213pd %ymm1,%ymm10,%ymm3
+    vfnmsub213pd %ymm13,%ymm2,%ymm14
+    vfnmsub213pd (%rax),%xmm2,%xmm3
+    vfnmsub213pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmsub213pd -8(%rsp),%ymm10,%ymm3
+    vfnmsub213pd 0x1000(%r9),%ymm2,%ymm14
+    vfnmsub213ss %xmm1,%xmm2,%xmm3
+    vfnmsub213ss %xmm9,%xmm12,%xmm15
+    vfnmsub213ss (%rax),%xmm2,%xmm3
+    vfnmsub213ss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmsub213sd %xmm1,%xmm2,%xmm3
+    vfnmsub213sd %xmm9,%xmm12,%xmm15
+    vfnmsub213sd (%rax),%xmm2,%xmm3
+    vfnmsub213sd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmsub231ps %xmm1,%xmm2,%xmm3
+    vfnmsub231ps %xmm9,%xmm12,%xmm15
+    vfnmsub231ps %ymm1,%ymm10,%ymm3
+    vfnmsub231ps %ymm13,%ymm2,%ymm14
+    vfnmsub231ps (%rax),%xmm2,%xmm3
+    vfnmsub231ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmsub231ps -8(%rsp),%ymm10,%ymm3
+    vfnmsub231ps 0x1000(%r9),%ymm2,%ymm14
+    vfnmsub231pd %xmm1,%xmm2,%xmm3
+    vfnmsub231pd %xmm9,%xmm12,%xmm15
+    vfnmsub231pd %ymm1,%ymm10,%ymm3
+    vfnmsub231pd %ymm13,%ymm2,%ymm14
+    vfnmsub231pd (%rax),%xmm2,%xmm3
+    vfnmsub231pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmsub231pd -8(%rsp),%ymm10,%ymm3
+    vfnmsub231pd 0x1000(%r9),%ymm2,%ymm14
+    vfnmsub231ss %xmm1,%xmm2,%xmm3
+    vfnmsub231ss %xmm9,%xmm12,%xmm15
+    vfnmsub231ss (%rax),%xmm2,%xmm3
+    vfnmsub231ss 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfnmsub231sd %xmm1,%xmm2,%xmm3
+    vfnmsub231sd %xmm9,%xmm12,%xmm15
+    vfnmsub231sd (%rax),%xmm2,%xmm3
+    vfnmsub231sd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmaddsub132ps %xmm1,%xmm2,%xmm3
+    vfmaddsub132ps %xmm9,%xmm12,%xmm15
+    vfmaddsub132ps %ymm1,%ymm10,%ymm3
+    vfmaddsub132ps %ymm13,%ymm2,%ymm14
+    vfmaddsub132ps (%rax),%xmm2,%xmm3
+    vfmaddsub132ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmaddsub132ps -8(%rsp),%ymm10,%ymm3
+    vfmaddsub132ps 0x1000(%r9),%ymm2,%ymm14
+    vfmaddsub132pd %xmm1,%xmm2,%xmm3
+    vfmaddsub132pd %xmm9,%xmm12,%xmm15
+    vfmaddsub132pd %ymm1,%ymm10,%ymm3
+    vfmaddsub132pd %ymm13,%ymm2,%ymm14
+    vfmaddsub132pd (%rax),%xmm2,%xmm3
+    vfmaddsub132pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmaddsub132pd -8(%rsp),%ymm10,%ymm3
+    vfmaddsub132pd 0x1000(%r9),%ymm2,%ymm14
+    vfmaddsub213ps %xmm1,%xmm2,%xmm3
+    vfmaddsub213ps %xmm9,%xmm12,%xmm15
+    vfmaddsub213ps %ymm1,%ymm10,%ymm3
+    vfmaddsub213ps %ymm13,%ymm2,%ymm14
+    vfmaddsub213ps (%rax),%xmm2,%xmm3
+    vfmaddsub213ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmaddsub213ps -8(%rsp),%ymm10,%ymm3
+    vfmaddsub213ps 0x1000(%r9),%ymm2,%ymm14
+    vfmaddsub213pd %xmm1,%xmm2,%xmm3
+    vfmaddsub213pd %xmm9,%xmm12,%xmm15
+    vfmaddsub213pd %ymm1,%ymm10,%ymm3
+    vfmaddsub213pd %ymm13,%ymm2,%ymm14
+    vfmaddsub213pd (%rax),%xmm2,%xmm3
+    vfmaddsub213pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmaddsub213pd -8(%rsp),%ymm10,%ymm3
+    vfmaddsub213pd 0x1000(%r9),%ymm2,%ymm14
+    vfmaddsub231ps %xmm1,%xmm2,%xmm3
+    vfmaddsub231ps %xmm9,%xmm12,%xmm15
+    vfmaddsub231ps %ymm1,%ymm10,%ymm3
+    vfmaddsub231ps %ymm13,%ymm2,%ymm14
+    vfmaddsub231ps (%rax),%xmm2,%xmm3
+    vfmaddsub231ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmaddsub231ps -8(%rsp),%ymm10,%ymm3
+    vfmaddsub231ps 0x1000(%r9),%ymm2,%ymm14
+    vfmaddsub231pd %xmm1,%xmm2,%xmm3
+    vfmaddsub231pd %xmm9,%xmm12,%xmm15
+    vfmaddsub231pd %ymm1,%ymm10,%ymm3
+    vfmaddsub231pd %ymm13,%ymm2,%ymm14
+    vfmaddsub231pd (%rax),%xmm2,%xmm3
+    vfmaddsub231pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmaddsub231pd -8(%rsp),%ymm10,%ymm3
+    vfmaddsub231pd 0x1000(%r9),%ymm2,%ymm14
+    vfmsubadd132ps %xmm1,%xmm2,%xmm3
+    vfmsubadd132ps %xmm9,%xmm12,%xmm15
+    vfmsubadd132ps %ymm1,%ymm10,%ymm3
+    vfmsubadd132ps %ymm13,%ymm2,%ymm14
+    vfmsubadd132ps (%rax),%xmm2,%xmm3
+    vfmsubadd132ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsubadd132ps -8(%rsp),%ymm10,%ymm3
+    vfmsubadd132ps 0x1000(%r9),%ymm2,%ymm14
+    vfmsubadd132pd %xmm1,%xmm2,%xmm3
+    vfmsubadd132pd %xmm9,%xmm12,%xmm15
+    vfmsubadd132pd %ymm1,%ymm10,%ymm3
+    vfmsubadd132pd %ymm13,%ymm2,%ymm14
+    vfmsubadd132pd (%rax),%xmm2,%xmm3
+    vfmsubadd132pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsubadd132pd -8(%rsp),%ymm10,%ymm3
+    vfmsubadd132pd 0x1000(%r9),%ymm2,%ymm14
+    vfmsubadd213ps %xmm1,%xmm2,%xmm3
+    vfmsubadd213ps %xmm9,%xmm12,%xmm15
+    vfmsubadd213ps %ymm1,%ymm10,%ymm3
+    vfmsubadd213ps %ymm13,%ymm2,%ymm14
+    vfmsubadd213ps (%rax),%xmm2,%xmm3
+    vfmsubadd213ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsubadd213ps -8(%rsp),%ymm10,%ymm3
+    vfmsubadd213ps 0x1000(%r9),%ymm2,%ymm14
+    vfmsubadd213pd %xmm1,%xmm2,%xmm3
+    vfmsubadd213pd %xmm9,%xmm12,%xmm15
+    vfmsubadd213pd %ymm1,%ymm10,%ymm3
+    vfmsubadd213pd %ymm13,%ymm2,%ymm14
+    vfmsubadd213pd (%rax),%xmm2,%xmm3
+    vfmsubadd213pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsubadd213pd -8(%rsp),%ymm10,%ymm3
+    vfmsubadd213pd 0x1000(%r9),%ymm2,%ymm14
+    vfmsubadd231ps %xmm1,%xmm2,%xmm3
+    vfmsubadd231ps %xmm9,%xmm12,%xmm15
+    vfmsubadd231ps %ymm1,%ymm10,%ymm3
+    vfmsubadd231ps %ymm13,%ymm2,%ymm14
+    vfmsubadd231ps (%rax),%xmm2,%xmm3
+    vfmsubadd231ps 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsubadd231ps -8(%rsp),%ymm10,%ymm3
+    vfmsubadd231ps 0x1000(%r9),%ymm2,%ymm14
+    vfmsubadd231pd %xmm1,%xmm2,%xmm3
+    vfmsubadd231pd %xmm9,%xmm12,%xmm15
+    vfmsubadd231pd %ymm1,%ymm10,%ymm3
+    vfmsubadd231pd %ymm13,%ymm2,%ymm14
+    vfmsubadd231pd (%rax),%xmm2,%xmm3
+    vfmsubadd231pd 0x40(%r13,%rcx,4),%xmm12,%xmm15
+    vfmsubadd231pd -8(%rsp),%ymm10,%ymm3
+    vfmsubadd231pd 0x1000(%r9),%ymm2,%ymm14
+    andn %eax,%ebx,%ecx
+    andn %r9,%r10,%r11
+    andn (%rax),%r10d,%ecx
+    andn 8(%r13),%rbx,%r15
+    andnq (%rax),%rbx,%rcx
+    bextr %eax,%ebx,%ecx
+    bextr %r9,%r10,%r11
+    bextr %r10d,(%rax),%ecx
+    bextr %rbx,8(%r13),%r15
+    bextrl %eax,(%rsi),%edx
+    blsi %eax,%ebx
+    blsi %r9,%r10
+    blsi (%rax),%r10d
+    blsiq 8(%r13),%rbx
+    blsmsk %eax,%ebx
+    blsmsk %r9,%r10
+    blsmsk (%rax),%r10d
+    blsmskq 8(%r13),%rbx
+    blsr %eax,%ebx
+    blsr %r9,%r10
+    blsr (%rax),%r10d
+    blsrq 8(%r13),%rbx
+    bzhi %eax,%ebx,%ecx
+    bzhi %r9,%r10,%r11
+    bzhi %r10d,(%rax),%ecx
+    bzhi %rbx,8(%r13),%r15
+    bzhil %eax,(%rsi),%edx
+    pdep %eax,%ebx,%ecx
+    pdep %r9,%r10,%r11
+    pdep (%rax),%r10d,%ecx
+    pdep 8(%r13),%rbx,%r15
+    pdepq (%rax),%rbx,%rcx
+    pext %eax,%ebx,%ecx
+    pext %r9,%r10,%r11
+    pext (%rax),%r10d,%ecx
+    pext 8(%r13),%rbx,%r15
+    pextq (%rax),%rbx,%rcx
+    mulx %eax,%ebx,%ecx
+    mulx %r9,%r10,%r11
+    mulx (%rax),%r10d,%ecx
+    mulx 8(%r13),%rbx,%r15
+    mulxq (%rax),%rbx,%rcx
+    rorx $5,%eax,%ebx
+    rorx $63,%r9,%r10
+    rorx $1,(%rax),%r10d
+    rorxq $7,8(%r13),%rbx
+    sarx %eax,%ebx,%ecx
+    sarx %r9,%r10,%r11
+    sarx %r10d,(%rax),%ecx
+    sarx %rbx,8(%r13),%r15
+    sarxl %eax,(%rsi),%edx
+    shlx %eax,%ebx,%ecx
+    shlx %r9,%r10,%r11
+    shlx %r10d,(%rax),%ecx
+    shlx %rbx,8(%r13),%r15
+    shlxl %eax,(%rsi),%edx
+    shrx %eax,%ebx,%ecx
+    shrx %r9,%r10,%r11
+    shrx %r10d,(%rax),%ecx
+    shrx %rbx,8(%r13),%r15
+    shrxl %eax,(%rsi),%edx
+    vaddps sym(%rip),%ymm1,%ymm2
+    vmovdqu %ymm3,sym(%rip)
+    vfmadd231pd sym+8(%rip),%ymm1,%ymm2
+    vpgatherdd %ymm1,(%eax,%ymm2,4),%ymm3
+    vaddps (%eax),%xmm1,%xmm2
+sym: nop
+vmovdqa %ymm15,%ymm0
+vmovdqu %xmm9,%xmm1
+vmovaps %ymm8,%ymm2
+vmovups %xmm12,%xmm3
+vmovapd %xmm12,%xmm3
+vmovupd %xmm12,%xmm3
+vmovdqa %ymm15,%ymm10
+vmovdqa %ymm1,%ymm10
+vmovss %xmm8,%xmm1,%xmm2
+vmovsd %xmm8,%xmm1,%xmm2
+vmovsd %xmm1,%xmm8,%xmm2
+vmovq %xmm8,%xmm1
+vmovq %xmm1,%xmm8
+vmovq (%rax),%xmm8
+vmovq %xmm9,8(%rax)
+vmovq %rax,%xmm1
+vmovq %xmm1,%r9
+vmovq %r9,%xmm12
+vmovd %eax,%xmm1
+vmovd %xmm1,%r10d
+vmovd (%rax),%xmm3
+vmovd %xmm3,(%rax)
+vpextrb $1,%xmm1,%eax
+vpextrb $1,%xmm1,(%rax)
+vpextrw $2,%xmm9,%eax
+vpextrw $2,%xmm1,(%rax)
+vpextrd $3,%xmm1,%r8d
+vpextrd $3,%xmm1,4(%rax)
+vpextrq $1,%xmm10,%rax
+vpextrq $1,%xmm1,(%r11)
+vextractps $1,%xmm1,%eax
+vextractps $1,%xmm1,(%rax)
+vpinsrb $1,%eax,%xmm2,%xmm3
+vpinsrb $1,(%rax),%xmm2,%xmm3
+vpinsrw $1,%r8d,%xmm2,%xmm3
+vpinsrd $1,%eax,%xmm12,%xmm3
+vpinsrq $1,%rax,%xmm2,%xmm13
+vpinsrq $1,(%rax),%xmm2,%xmm3
+vcvtsi2ss %eax,%xmm1,%xmm2
+vcvtsi2ss %rax,%xmm1,%xmm2
+vcvtsi2sdl (%rax),%xmm1,%xmm2
+vcvtsi2sdq (%rax),%xmm1,%xmm12
+vcvtss2si %xmm1,%eax
+vcvtss2si %xmm1,%r9
+vcvttss2si (%rax),%eax
+vcvtsd2si %xmm11,%rax
+vcvttsd2si (%rax),%r12
+vmaskmovps (%rax),%ymm1,%ymm2
+vmaskmovps %ymm2,%ymm1,(%rax)
+vmaskmovpd (%rax),%xmm1,%xmm2
+vmaskmovpd %xmm2,%xmm11,(%rax)
+vpmaskmovd (%rax),%ymm1,%ymm2
+vpmaskmovd %xmm2,%xmm1,(%rax)
+vpmaskmovq (%rax),%ymm1,%ymm12
+vpmaskmovq %ymm2,%ymm1,(%r8)
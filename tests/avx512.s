@@ -0,0 +1,4848 @@
+# AVX-512 in EVEX encoding: masking, broadcast, rounding and disp8*N
+.text
+    vaddps %zmm1,%zmm2,%zmm3
+    vaddps %zmm17,%zmm28,%zmm9{%k1}
+    vaddps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vaddps %ymm19,%ymm2,%ymm23
+    vaddps %xmm1,%xmm30,%xmm18{%k1}
+    vaddps (%rax),%zmm2,%zmm3
+    vaddps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vaddps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vaddps -0x100(%rsp),%ymm2,%ymm23
+    vaddps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vaddps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vaddps -8(%rax),%zmm28,%zmm9
+    vaddps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vaddps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vaddps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vaddps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vaddps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vaddps {rz-sae},%zmm1,%zmm17,%zmm30
+    vaddpd %zmm1,%zmm2,%zmm3
+    vaddpd %zmm17,%zmm28,%zmm9{%k1}
+    vaddpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vaddpd %ymm19,%ymm2,%ymm23
+    vaddpd %xmm1,%xmm30,%xmm18{%k1}
+    vaddpd (%rax),%zmm2,%zmm3
+    vaddpd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vaddpd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vaddpd -0x100(%rsp),%ymm2,%ymm23
+    vaddpd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vaddpd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vaddpd -8(%rax),%zmm28,%zmm9
+    vaddpd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vaddpd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vaddpd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vaddpd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vaddpd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vaddpd {rz-sae},%zmm1,%zmm17,%zmm30
+    vaddss %xmm1,%xmm17,%xmm30
+    vaddss %xmm20,%xmm2,%xmm9{%k1}
+    vaddss (%rax),%xmm17,%xmm30
+    vaddss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vaddss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vaddss -0x100(%rsp),%xmm2,%xmm9
+    vaddss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vaddss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vaddss -8(%rax),%xmm17,%xmm30
+    vaddss {rz-sae},%xmm1,%xmm17,%xmm30
+    vaddsd %xmm1,%xmm17,%xmm30
+    vaddsd %xmm20,%xmm2,%xmm9{%k1}
+    vaddsd (%rax),%xmm17,%xmm30
+    vaddsd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vaddsd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vaddsd -0x100(%rsp),%xmm2,%xmm9
+    vaddsd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vaddsd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vaddsd -8(%rax),%xmm17,%xmm30
+    vaddsd {rz-sae},%xmm1,%xmm17,%xmm30
+    vsubps %zmm1,%zmm2,%zmm3
+    vsubps %zmm17,%zmm28,%zmm9{%k1}
+    vsubps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vsubps %ymm19,%ymm2,%ymm23
+    vsubps %xmm1,%xmm30,%xmm18{%k1}
+    vsubps (%rax),%zmm2,%zmm3
+    vsubps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vsubps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vsubps -0x100(%rsp),%ymm2,%ymm23
+    vsubps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vsubps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vsubps -8(%rax),%zmm28,%zmm9
+    vsubps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vsubps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vsubps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vsubps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vsubps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vsubps {rz-sae},%zmm1,%zmm17,%zmm30
+    vsubpd %zmm1,%zmm2,%zmm3
+    vsubpd %zmm17,%zmm28,%zmm9{%k1}
+    vsubpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vsubpd %ymm19,%ymm2,%ymm23
+    vsubpd %xmm1,%xmm30,%xmm18{%k1}
+    vsubpd (%rax),%zmm2,%zmm3
+    vsubpd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vsubpd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vsubpd -0x100(%rsp),%ymm2,%ymm23
+    vsubpd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vsubpd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vsubpd -8(%rax),%zmm28,%zmm9
+    vsubpd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vsubpd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vsubpd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vsubpd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vsubpd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vsubpd {rz-sae},%zmm1,%zmm17,%zmm30
+    vsubss %xmm1,%xmm17,%xmm30
+    vsubss %xmm20,%xmm2,%xmm9{%k1}
+    vsubss (%rax),%xmm17,%xmm30
+    vsubss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vsubss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vsubss -0x100(%rsp),%xmm2,%xmm9
+    vsubss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vsubss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vsubss -8(%rax),%xmm17,%xmm30
+    vsubss {rz-sae},%xmm1,%xmm17,%xmm30
+    vsubsd %xmm1,%xmm17,%xmm30
+    vsubsd %xmm20,%xmm2,%xmm9{%k1}
+    vsubsd (%rax),%xmm17,%xmm30
+    vsubsd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vsubsd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vsubsd -0x100(%rsp),%xmm2,%xmm9
+    vsubsd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vsubsd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vsubsd -8(%rax),%xmm17,%xmm30
+    vsubsd {rz-sae},%xmm1,%xmm17,%xmm30
+    vmulps %zmm1,%zmm2,%zmm3
+    vmulps %zmm17,%zmm28,%zmm9{%k1}
+    vmulps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vmulps %ymm19,%ymm2,%ymm23
+    vmulps %xmm1,%xmm30,%xmm18{%k1}
+    vmulps (%rax),%zmm2,%zmm3
+    vmulps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vmulps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vmulps -0x100(%rsp),%ymm2,%ymm23
+    vmulps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vmulps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vmulps -8(%rax),%zmm28,%zmm9
+    vmulps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vmulps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vmulps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vmulps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vmulps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vmulps {rz-sae},%zmm1,%zmm17,%zmm30
+    vmulpd %zmm1,%zmm2,%zmm3
+    vmulpd %zmm17,%zmm28,%zmm9{%k1}
+    vmulpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vmulpd %ymm19,%ymm2,%ymm23
+    vmulpd %xmm1,%xmm30,%xmm18{%k1}
+    vmulpd (%rax),%zmm2,%zmm3
+    vmulpd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vmulpd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vmulpd -0x100(%rsp),%ymm2,%ymm23
+    vmulpd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vmulpd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vmulpd -8(%rax),%zmm28,%zmm9
+    vmulpd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vmulpd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vmulpd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vmulpd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vmulpd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vmulpd {rz-sae},%zmm1,%zmm17,%zmm30
+    vmulss %xmm1,%xmm17,%xmm30
+    vmulss %xmm20,%xmm2,%xmm9{%k1}
+    vmulss (%rax),%xmm17,%xmm30
+    vmulss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vmulss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vmulss -0x100(%rsp),%xmm2,%xmm9
+    vmulss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vmulss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vmulss -8(%rax),%xmm17,%xmm30
+    vmulss {rz-sae},%xmm1,%xmm17,%xmm30
+    vmulsd %xmm1,%xmm17,%xmm30
+    vmulsd %xmm20,%xmm2,%xmm9{%k1}
+    vmulsd (%rax),%xmm17,%xmm30
+    vmulsd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vmulsd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vmulsd -0x100(%rsp),%xmm2,%xmm9
+    vmulsd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vmulsd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vmulsd -8(%rax),%xmm17,%xmm30
+    vmulsd {rz-sae},%xmm1,%xmm17,%xmm30
+    vdivps %zmm1,%zmm2,%zmm3
+    vdivps %zmm17,%zmm28,%zmm9{%k1}
+    vdivps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vdivps %ymm19,%ymm2,%ymm23
+    vdivps %xmm1,%xmm30,%xmm18{%k1}
+    vdivps (%rax),%zmm2,%zmm3
+    vdivps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vdivps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vdivps -0x100(%rsp),%ymm2,%ymm23
+    vdivps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vdivps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vdivps -8(%rax),%zmm28,%zmm9
+    vdivps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vdivps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vdivps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vdivps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vdivps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vdivps {rz-sae},%zmm1,%zmm17,%zmm30
+    vdivpd %zmm1,%zmm2,%zmm3
+    vdivpd %zmm17,%zmm28,%zmm9{%k1}
+    vdivpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vdivpd %ymm19,%ymm2,%ymm23
+    vdivpd %xmm1,%xmm30,%xmm18{%k1}
+    vdivpd (%rax),%zmm2,%zmm3
+    vdivpd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vdivpd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vdivpd -0x100(%rsp),%ymm2,%ymm23
+    vdivpd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vdivpd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vdivpd -8(%rax),%zmm28,%zmm9
+    vdivpd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vdivpd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vdivpd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vdivpd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vdivpd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vdivpd {rz-sae},%zmm1,%zmm17,%zmm30
+    vdivss %xmm1,%xmm17,%xmm30
+    vdivss %xmm20,%xmm2,%xmm9{%k1}
+    vdivss (%rax),%xmm17,%xmm30
+    vdivss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vdivss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vdivss -0x100(%rsp),%xmm2,%xmm9
+    vdivss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vdivss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vdivss -8(%rax),%xmm17,%xmm30
+    vdivss {rz-sae},%xmm1,%xmm17,%xmm30
+    vdivsd %xmm1,%xmm17,%xmm30
+    vdivsd %xmm20,%xmm2,%xmm9{%k1}
+    vdivsd (%rax),%xmm17,%xmm30
+    vdivsd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vdivsd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vdivsd -0x100(%rsp),%xmm2,%xmm9
+    vdivsd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vdivsd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vdivsd -8(%rax),%xmm17,%xmm30
+    vdivsd {rz-sae},%xmm1,%xmm17,%xmm30
+    vminps %zmm1,%zmm2,%zmm3
+    vminps %zmm17,%zmm28,%zmm9{%k1}
+    vminps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vminps %ymm19,%ymm2,%ymm23
+    vminps %xmm1,%xmm30,%xmm18{%k1}
+    vminps (%rax),%zmm2,%zmm3
+    vminps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vminps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vminps -0x100(%rsp),%ymm2,%ymm23
+    vminps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vminps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vminps -8(%rax),%zmm28,%zmm9
+    vminps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vminps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vminps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vminps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vminps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vminps {sae},%zmm1,%zmm17,%zmm30
+    vminpd %zmm1,%zmm2,%zmm3
+    vminpd %zmm17,%zmm28,%zmm9{%k1}
+    vminpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vminpd %ymm19,%ymm2,%ymm23
+    vminpd %xmm1,%xmm30,%xmm18{%k1}
+    vminpd (%rax),%zmm2,%zmm3
+    vminpd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vminpd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vminpd -0x100(%rsp),%ymm2,%ymm23
+    vminpd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vminpd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vminpd -8(%rax),%zmm28,%zmm9
+    vminpd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vminpd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vminpd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vminpd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vminpd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vminpd {sae},%zmm1,%zmm17,%zmm30
+    vminss %xmm1,%xmm17,%xmm30
+    vminss %xmm20,%xmm2,%xmm9{%k1}
+    vminss (%rax),%xmm17,%xmm30
+    vminss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vminss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vminss -0x100(%rsp),%xmm2,%xmm9
+    vminss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vminss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vminss -8(%rax),%xmm17,%xmm30
+    vminss {sae},%xmm1,%xmm17,%xmm30
+    vminsd %xmm1,%xmm17,%xmm30
+    vminsd %xmm20,%xmm2,%xmm9{%k1}
+    vminsd (%rax),%xmm17,%xmm30
+    vminsd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vminsd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vminsd -0x100(%rsp),%xmm2,%xmm9
+    vminsd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vminsd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vminsd -8(%rax),%xmm17,%xmm30
+    vminsd {sae},%xmm1,%xmm17,%xmm30
+    vmaxps %zmm1,%zmm2,%zmm3
+    vmaxps %zmm17,%zmm28,%zmm9{%k1}
+    vmaxps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vmaxps %ymm19,%ymm2,%ymm23
+    vmaxps %xmm1,%xmm30,%xmm18{%k1}
+    vmaxps (%rax),%zmm2,%zmm3
+    vmaxps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vmaxps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vmaxps -0x100(%rsp),%ymm2,%ymm23
+    vmaxps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vmaxps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vmaxps -8(%rax),%zmm28,%zmm9
+    vmaxps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vmaxps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vmaxps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vmaxps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vmaxps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vmaxps {sae},%zmm1,%zmm17,%zmm30
+    vmaxpd %zmm1,%zmm2,%zmm3
+    vmaxpd %zmm17,%zmm28,%zmm9{%k1}
+    vmaxpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vmaxpd %ymm19,%ymm2,%ymm23
+    vmaxpd %xmm1,%xmm30,%xmm18{%k1}
+    vmaxpd (%rax),%zmm2,%zmm3
+    vmaxpd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vmaxpd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vmaxpd -0x100(%rsp),%ymm2,%ymm23
+    vmaxpd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vmaxpd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vmaxpd -8(%rax),%zmm28,%zmm9
+    vmaxpd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vmaxpd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vmaxpd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vmaxpd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vmaxpd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vmaxpd {sae},%zmm1,%zmm17,%zmm30
+    vmaxss %xmm1,%xmm17,%xmm30
+    vmaxss %xmm20,%xmm2,%xmm9{%k1}
+    vmaxss (%rax),%xmm17,%xmm30
+    vmaxss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vmaxss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vmaxss -0x100(%rsp),%xmm2,%xmm9
+    vmaxss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vmaxss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vmaxss -8(%rax),%xmm17,%xmm30
+    vmaxss {sae},%xmm1,%xmm17,%xmm30
+    vmaxsd %xmm1,%xmm17,%xmm30
+    vmaxsd %xmm20,%xmm2,%xmm9{%k1}
+    vmaxsd (%rax),%xmm17,%xmm30
+    vmaxsd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vmaxsd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vmaxsd -0x100(%rsp),%xmm2,%xmm9
+    vmaxsd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vmaxsd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vmaxsd -8(%rax),%xmm17,%xmm30
+    vmaxsd {sae},%xmm1,%xmm17,%xmm30
+    vsqrtps %zmm1,%zmm3
+    vsqrtps %zmm17,%zmm9{%k1}
+    vsqrtps %zmm31,%zmm0{%k2}{z}
+    vsqrtps %ymm19,%ymm23
+    vsqrtps %xmm1,%xmm18{%k1}
+    vsqrtps (%rax),%zmm3
+    vsqrtps 0x40(%rax),%zmm9{%k1}
+    vsqrtps 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vsqrtps -0x100(%rsp),%ymm23
+    vsqrtps 0x44(%rax),%xmm18{%k1}
+    vsqrtps 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vsqrtps -8(%rax),%zmm9
+    vsqrtps 0x40(%rax){1to16},%zmm3
+    vsqrtps 0x40(%rax){1to16},%zmm9
+    vsqrtps 0x40(%rax){1to16},%zmm0
+    vsqrtps 0x40(%rax){1to8},%ymm23
+    vsqrtps 0x40(%rax){1to4},%xmm18
+    vsqrtps {rz-sae},%zmm1,%zmm30
+    vsqrtpd %zmm1,%zmm3
+    vsqrtpd %zmm17,%zmm9{%k1}
+    vsqrtpd %zmm31,%zmm0{%k2}{z}
+    vsqrtpd %ymm19,%ymm23
+    vsqrtpd %xmm1,%xmm18{%k1}
+    vsqrtpd (%rax),%zmm3
+    vsqrtpd 0x40(%rax),%zmm9{%k1}
+    vsqrtpd 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vsqrtpd -0x100(%rsp),%ymm23
+    vsqrtpd 0x44(%rax),%xmm18{%k1}
+    vsqrtpd 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vsqrtpd -8(%rax),%zmm9
+    vsqrtpd 0x40(%rax){1to8},%zmm3
+    vsqrtpd 0x40(%rax){1to8},%zmm9
+    vsqrtpd 0x40(%rax){1to8},%zmm0
+    vsqrtpd 0x40(%rax){1to4},%ymm23
+    vsqrtpd 0x40(%rax){1to2},%xmm18
+    vsqrtpd {rz-sae},%zmm1,%zmm30
+    vsqrtss %xmm1,%xmm17,%xmm30
+    vsqrtss %xmm20,%xmm2,%xmm9{%k1}
+    vsqrtss (%rax),%xmm17,%xmm30
+    vsqrtss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vsqrtss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vsqrtss -0x100(%rsp),%xmm2,%xmm9
+    vsqrtss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vsqrtss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vsqrtss -8(%rax),%xmm17,%xmm30
+    vsqrtss {rz-sae},%xmm1,%xmm17,%xmm30
+    vsqrtsd %xmm1,%xmm17,%xmm30
+    vsqrtsd %xmm20,%xmm2,%xmm9{%k1}
+    vsqrtsd (%rax),%xmm17,%xmm30
+    vsqrtsd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vsqrtsd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vsqrtsd -0x100(%rsp),%xmm2,%xmm9
+    vsqrtsd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vsqrtsd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vsqrtsd -8(%rax),%xmm17,%xmm30
+    vsqrtsd {rz-sae},%xmm1,%xmm17,%xmm30
+    vandps %zmm1,%zmm2,%zmm3
+    vandps %zmm17,%zmm28,%zmm9{%k1}
+    vandps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vandps %ymm19,%ymm2,%ymm23
+    vandps %xmm1,%xmm30,%xmm18{%k1}
+    vandps (%rax),%zmm2,%zmm3
+    vandps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vandps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vandps -0x100(%rsp),%ymm2,%ymm23
+    vandps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vandps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vandps -8(%rax),%zmm28,%zmm9
+    vandps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vandps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vandps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vandps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vandps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vandpd %zmm1,%zmm2,%zmm3
+    vandpd %zmm17,%zmm28,%zmm9{%k1}
+    vandpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vandpd %ymm19,%ymm2,%ymm23
+    vandpd %xmm1,%xmm30,%xmm18{%k1}
+    vandpd (%rax),%zmm2,%zmm3
+    vandpd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vandpd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vandpd -0x100(%rsp),%ymm2,%ymm23
+    vandpd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vandpd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vandpd -8(%rax),%zmm28,%zmm9
+    vandpd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vandpd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vandpd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vandpd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vandpd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vandnps %zmm1,%zmm2,%zmm3
+    vandnps %zmm17,%zmm28,%zmm9{%k1}
+    vandnps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vandnps %ymm19,%ymm2,%ymm23
+    vandnps %xmm1,%xmm30,%xmm18{%k1}
+    vandnps (%rax),%zmm2,%zmm3
+    vandnps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vandnps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vandnps -0x100(%rsp),%ymm2,%ymm23
+    vandnps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vandnps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vandnps -8(%rax),%zmm28,%zmm9
+    vandnps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vandnps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vandnps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vandnps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vandnps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vandnpd %zmm1,%zmm2,%zmm3
+    vandnpd %zmm17,%zmm28,%zmm9{%k1}
+    vandnpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vandnpd %ymm19,%ymm2,%ymm23
+    vandnpd %xmm1,%xmm30,%xmm18{%k1}
+    vandnpd (%rax),%zmm2,%zmm3
+    vandnpd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vandnpd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vandnpd -0x100(%rsp),%ymm2,%ymm23
+    vandnpd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vandnpd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vandnpd -8(%rax),%zmm28,%zmm9
+    vandnpd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vandnpd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vandnpd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vandnpd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vandnpd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vorps %zmm1,%zmm2,%zmm3
+    vorps %zmm17,%zmm28,%zmm9{%k1}
+    vorps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vorps %ymm19,%ymm2,%ymm23
+    vorps %xmm1,%xmm30,%xmm18{%k1}
+    vorps (%rax),%zmm2,%zmm3
+    vorps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vorps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vorps -0x100(%rsp),%ymm2,%ymm23
+    vorps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vorps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vorps -8(%rax),%zmm28,%zmm9
+    vorps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vorps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vorps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vorps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vorps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vorpd %zmm1,%zmm2,%zmm3
+    vorpd %zmm17,%zmm28,%zmm9{%k1}
+    vorpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vorpd %ymm19,%ymm2,%ymm23
+    vorpd %xmm1,%xmm30,%xmm18{%k1}
+    vorpd (%rax),%zmm2,%zmm3
+    vorpd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vorpd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vorpd -0x100(%rsp),%ymm2,%ymm23
+    vorpd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vorpd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vorpd -8(%rax),%zmm28,%zmm9
+    vorpd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vorpd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vorpd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vorpd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vorpd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vxorps %zmm1,%zmm2,%zmm3
+    vxorps %zmm17,%zmm28,%zmm9{%k1}
+    vxorps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vxorps %ymm19,%ymm2,%ymm23
+    vxorps %xmm1,%xmm30,%xmm18{%k1}
+    vxorps (%rax),%zmm2,%zmm3
+    vxorps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vxorps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vxorps -0x100(%rsp),%ymm2,%ymm23
+    vxorps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vxorps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vxorps -8(%rax),%zmm28,%zmm9
+    vxorps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vxorps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vxorps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vxorps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vxorps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vxorpd %zmm1,%zmm2,%zmm3
+    vxorpd %zmm17,%zmm28,%zmm9{%k1}
+    vxorpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vxorpd %ymm19,%ymm2,%ymm23
+    vxorpd %xmm1,%xmm30,%xmm18{%k1}
+    vxorpd (%rax),%zmm2,%zmm3
+    vxorpd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vxorpd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vxorpd -0x100(%rsp),%ymm2,%ymm23
+    vxorpd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vxorpd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vxorpd -8(%rax),%zmm28,%zmm9
+    vxorpd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vxorpd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vxorpd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vxorpd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vxorpd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vunpcklps %zmm1,%zmm2,%zmm3
+    vunpcklps %zmm17,%zmm28,%zmm9{%k1}
+    vunpcklps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vunpcklps %ymm19,%ymm2,%ymm23
+    vunpcklps %xmm1,%xmm30,%xmm18{%k1}
+    vunpcklps (%rax),%zmm2,%zmm3
+    vunpcklps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vunpcklps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vunpcklps -0x100(%rsp),%ymm2,%ymm23
+    vunpcklps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vunpcklps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vunpcklps -8(%rax),%zmm28,%zmm9
+    vunpcklps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vunpcklps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vunpcklps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vunpcklps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vunpcklps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vunpcklpd %zmm1,%zmm2,%zmm3
+    vunpcklpd %zmm17,%zmm28,%zmm9{%k1}
+    vunpcklpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vunpcklpd %ymm19,%ymm2,%ymm23
+    vunpcklpd %xmm1,%xmm30,%xmm18{%k1}
+    vunpcklpd (%rax),%zmm2,%zmm3
+    vunpcklpd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vunpcklpd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vunpcklpd -0x100(%rsp),%ymm2,%ymm23
+    vunpcklpd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vunpcklpd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vunpcklpd -8(%rax),%zmm28,%zmm9
+    vunpcklpd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vunpcklpd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vunpcklpd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vunpcklpd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vunpcklpd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vunpckhps %zmm1,%zmm2,%zmm3
+    vunpckhps %zmm17,%zmm28,%zmm9{%k1}
+    vunpckhps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vunpckhps %ymm19,%ymm2,%ymm23
+    vunpckhps %xmm1,%xmm30,%xmm18{%k1}
+    vunpckhps (%rax),%zmm2,%zmm3
+    vunpckhps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vunpckhps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vunpckhps -0x100(%rsp),%ymm2,%ymm23
+    vunpckhps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vunpckhps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vunpckhps -8(%rax),%zmm28,%zmm9
+    vunpckhps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vunpckhps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vunpckhps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vunpckhps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vunpckhps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vunpckhpd %zmm1,%zmm2,%zmm3
+    vunpckhpd %zmm17,%zmm28,%zmm9{%k1}
+    vunpckhpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vunpckhpd %ymm19,%ymm2,%ymm23
+    vunpckhpd %xmm1,%xmm30,%xmm18{%k1}
+    vunpckhpd (%rax),%zmm2,%zmm3
+    vunpckhpd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vunpckhpd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vunpckhpd -0x100(%rsp),%ymm2,%ymm23
+    vunpckhpd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vunpckhpd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vunpckhpd -8(%rax),%zmm28,%zmm9
+    vunpckhpd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vunpckhpd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vunpckhpd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vunpckhpd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vunpckhpd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vshufps $5,%zmm1,%zmm2,%zmm3
+    vshufps $5,%zmm17,%zmm28,%zmm9{%k1}
+    vshufps $5,%zmm31,%zmm16,%zmm0{%k2}{z}
+    vshufps $5,%ymm19,%ymm2,%ymm23
+    vshufps $5,%xmm1,%xmm30,%xmm18{%k1}
+    vshufps $0x7f,(%rax),%zmm2,%zmm3
+    vshufps $0x7f,0x40(%rax),%zmm28,%zmm9{%k1}
+    vshufps $0x7f,0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vshufps $0x7f,-0x100(%rsp),%ymm2,%ymm23
+    vshufps $0x7f,0x44(%rax),%xmm30,%xmm18{%k1}
+    vshufps $0x7f,0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vshufps $0x7f,-8(%rax),%zmm28,%zmm9
+    vshufps $1,0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vshufps $1,0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vshufps $1,0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vshufps $1,0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vshufps $1,0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vshufpd $5,%zmm1,%zmm2,%zmm3
+    vshufpd $5,%zmm17,%zmm28,%zmm9{%k1}
+    vshufpd $5,%zmm31,%zmm16,%zmm0{%k2}{z}
+    vshufpd $5,%ymm19,%ymm2,%ymm23
+    vshufpd $5,%xmm1,%xmm30,%xmm18{%k1}
+    vshufpd $0x7f,(%rax),%zmm2,%zmm3
+    vshufpd $0x7f,0x40(%rax),%zmm28,%zmm9{%k1}
+    vshufpd $0x7f,0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vshufpd $0x7f,-0x100(%rsp),%ymm2,%ymm23
+    vshufpd $0x7f,0x44(%rax),%xmm30,%xmm18{%k1}
+    vshufpd $0x7f,0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vshufpd $0x7f,-8(%rax),%zmm28,%zmm9
+    vshufpd $1,0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vshufpd $1,0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vshufpd $1,0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vshufpd $1,0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vshufpd $1,0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vcmpps $5,%zmm1,%zmm2,%k1
+    vcmpps $5,%zmm17,%zmm28,%k2{%k3}
+    vcmpps $5,%zmm31,%zmm16,%k3
+    vcmpps $5,%ymm19,%ymm2,%k4{%k3}
+    vcmpps $5,%xmm1,%xmm30,%k5
+    vcmpps $0x7f,(%rax),%zmm2,%k1
+    vcmpps $0x7f,0x40(%rax),%zmm28,%k2{%k3}
+    vcmpps $0x7f,0x80(%r13,%rcx,4),%zmm16,%k3
+    vcmpps $0x7f,-0x100(%rsp),%ymm2,%k4{%k3}
+    vcmpps $0x7f,0x44(%rax),%xmm30,%k5
+    vcmpps $0x7f,0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vcmpps $0x7f,-8(%rax),%zmm28,%k7
+    vcmpps $1,0x40(%rax){1to16},%zmm2,%k2{%k3}
+    vcmpps $1,0x40(%rax){1to16},%zmm28,%k2{%k3}
+    vcmpps $1,0x40(%rax){1to16},%zmm16,%k2{%k3}
+    vcmpps $1,0x40(%rax){1to8},%ymm2,%k2{%k3}
+    vcmpps $1,0x40(%rax){1to4},%xmm30,%k2{%k3}
+    vcmpps $4,{sae},%zmm1,%zmm17,%k2
+    vcmppd $5,%zmm1,%zmm2,%k1
+    vcmppd $5,%zmm17,%zmm28,%k2{%k3}
+    vcmppd $5,%zmm31,%zmm16,%k3
+    vcmppd $5,%ymm19,%ymm2,%k4{%k3}
+    vcmppd $5,%xmm1,%xmm30,%k5
+    vcmppd $0x7f,(%rax),%zmm2,%k1
+    vcmppd $0x7f,0x40(%rax),%zmm28,%k2{%k3}
+    vcmppd $0x7f,0x80(%r13,%rcx,4),%zmm16,%k3
+    vcmppd $0x7f,-0x100(%rsp),%ymm2,%k4{%k3}
+    vcmppd $0x7f,0x44(%rax),%xmm30,%k5
+    vcmppd $0x7f,0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vcmppd $0x7f,-8(%rax),%zmm28,%k7
+    vcmppd $1,0x40(%rax){1to8},%zmm2,%k2{%k3}
+    vcmppd $1,0x40(%rax){1to8},%zmm28,%k2{%k3}
+    vcmppd $1,0x40(%rax){1to8},%zmm16,%k2{%k3}
+    vcmppd $1,0x40(%rax){1to4},%ymm2,%k2{%k3}
+    vcmppd $1,0x40(%rax){1to2},%xmm30,%k2{%k3}
+    vcmppd $4,{sae},%zmm1,%zmm17,%k2
+    vcmpss $5,%xmm1,%xmm17,%k1
+    vcmpss $5,%xmm20,%xmm2,%k2{%k3}
+    vcmpss $0x7f,(%rax),%xmm17,%k1
+    vcmpss $0x7f,0x40(%rax),%xmm2,%k2{%k3}
+    vcmpss $0x7f,0x80(%r13,%rcx,4),%xmm17,%k3
+    vcmpss $0x7f,-0x100(%rsp),%xmm2,%k4{%k3}
+    vcmpss $0x7f,0x44(%rax),%xmm17,%k5
+    vcmpss $0x7f,0x1000(%r9,%r10,2),%xmm2,%k6{%k3}
+    vcmpss $0x7f,-8(%rax),%xmm17,%k7
+    vcmpss $4,{sae},%xmm1,%xmm17,%k2
+    vcmpsd $5,%xmm1,%xmm17,%k1
+    vcmpsd $5,%xmm20,%xmm2,%k2{%k3}
+    vcmpsd $0x7f,(%rax),%xmm17,%k1
+    vcmpsd $0x7f,0x40(%rax),%xmm2,%k2{%k3}
+    vcmpsd $0x7f,0x80(%r13,%rcx,4),%xmm17,%k3
+    vcmpsd $0x7f,-0x100(%rsp),%xmm2,%k4{%k3}
+    vcmpsd $0x7f,0x44(%rax),%xmm17,%k5
+    vcmpsd $0x7f,0x1000(%r9,%r10,2),%xmm2,%k6{%k3}
+    vcmpsd $0x7f,-8(%rax),%xmm17,%k7
+    vcmpsd $4,{sae},%xmm1,%xmm17,%k2
+    vpaddb %zmm1,%zmm2,%zmm3
+    vpaddb %zmm17,%zmm28,%zmm9{%k1}
+    vpaddb %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpaddb %ymm19,%ymm2,%ymm23
+    vpaddb %xmm1,%xmm30,%xmm18{%k1}
+    vpaddb (%rax),%zmm2,%zmm3
+    vpaddb 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpaddb 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpaddb -0x100(%rsp),%ymm2,%ymm23
+    vpaddb 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpaddb 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpaddb -8(%rax),%zmm28,%zmm9
+    vpaddw %zmm1,%zmm2,%zmm3
+    vpaddw %zmm17,%zmm28,%zmm9{%k1}
+    vpaddw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpaddw %ymm19,%ymm2,%ymm23
+    vpaddw %xmm1,%xmm30,%xmm18{%k1}
+    vpaddw (%rax),%zmm2,%zmm3
+    vpaddw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpaddw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpaddw -0x100(%rsp),%ymm2,%ymm23
+    vpaddw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpaddw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpaddw -8(%rax),%zmm28,%zmm9
+    vpaddsb %zmm1,%zmm2,%zmm3
+    vpaddsb %zmm17,%zmm28,%zmm9{%k1}
+    vpaddsb %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpaddsb %ymm19,%ymm2,%ymm23
+    vpaddsb %xmm1,%xmm30,%xmm18{%k1}
+    vpaddsb (%rax),%zmm2,%zmm3
+    vpaddsb 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpaddsb 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpaddsb -0x100(%rsp),%ymm2,%ymm23
+    vpaddsb 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpaddsb 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpaddsb -8(%rax),%zmm28,%zmm9
+    vpaddsw %zmm1,%zmm2,%zmm3
+    vpaddsw %zmm17,%zmm28,%zmm9{%k1}
+    vpaddsw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpaddsw %ymm19,%ymm2,%ymm23
+    vpaddsw %xmm1,%xmm30,%xmm18{%k1}
+    vpaddsw (%rax),%zmm2,%zmm3
+    vpaddsw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpaddsw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpaddsw -0x100(%rsp),%ymm2,%ymm23
+    vpaddsw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpaddsw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpaddsw -8(%rax),%zmm28,%zmm9
+    vpaddusb %zmm1,%zmm2,%zmm3
+    vpaddusb %zmm17,%zmm28,%zmm9{%k1}
+    vpaddusb %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpaddusb %ymm19,%ymm2,%ymm23
+    vpaddusb %xmm1,%xmm30,%xmm18{%k1}
+    vpaddusb (%rax),%zmm2,%zmm3
+    vpaddusb 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpaddusb 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpaddusb -0x100(%rsp),%ymm2,%ymm23
+    vpaddusb 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpaddusb 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpaddusb -8(%rax),%zmm28,%zmm9
+    vpaddusw %zmm1,%zmm2,%zmm3
+    vpaddusw %zmm17,%zmm28,%zmm9{%k1}
+    vpaddusw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpaddusw %ymm19,%ymm2,%ymm23
+    vpaddusw %xmm1,%xmm30,%xmm18{%k1}
+    vpaddusw (%rax),%zmm2,%zmm3
+    vpaddusw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpaddusw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpaddusw -0x100(%rsp),%ymm2,%ymm23
+    vpaddusw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpaddusw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpaddusw -8(%rax),%zmm28,%zmm9
+    vpsubb %zmm1,%zmm2,%zmm3
+    vpsubb %zmm17,%zmm28,%zmm9{%k1}
+    vpsubb %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsubb %ymm19,%ymm2,%ymm23
+    vpsubb %xmm1,%xmm30,%xmm18{%k1}
+    vpsubb (%rax),%zmm2,%zmm3
+    vpsubb 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsubb 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsubb -0x100(%rsp),%ymm2,%ymm23
+    vpsubb 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsubb 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsubb -8(%rax),%zmm28,%zmm9
+    vpsubw %zmm1,%zmm2,%zmm3
+    vpsubw %zmm17,%zmm28,%zmm9{%k1}
+    vpsubw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsubw %ymm19,%ymm2,%ymm23
+    vpsubw %xmm1,%xmm30,%xmm18{%k1}
+    vpsubw (%rax),%zmm2,%zmm3
+    vpsubw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsubw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsubw -0x100(%rsp),%ymm2,%ymm23
+    vpsubw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsubw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsubw -8(%rax),%zmm28,%zmm9
+    vpsubsb %zmm1,%zmm2,%zmm3
+    vpsubsb %zmm17,%zmm28,%zmm9{%k1}
+    vpsubsb %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsubsb %ymm19,%ymm2,%ymm23
+    vpsubsb %xmm1,%xmm30,%xmm18{%k1}
+    vpsubsb (%rax),%zmm2,%zmm3
+    vpsubsb 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsubsb 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsubsb -0x100(%rsp),%ymm2,%ymm23
+    vpsubsb 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsubsb 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsubsb -8(%rax),%zmm28,%zmm9
+    vpsubsw %zmm1,%zmm2,%zmm3
+    vpsubsw %zmm17,%zmm28,%zmm9{%k1}
+    vpsubsw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsubsw %ymm19,%ymm2,%ymm23
+    vpsubsw %xmm1,%xmm30,%xmm18{%k1}
+    vpsubsw (%rax),%zmm2,%zmm3
+    vpsubsw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsubsw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsubsw -0x100(%rsp),%ymm2,%ymm23
+    vpsubsw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsubsw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsubsw -8(%rax),%zmm28,%zmm9
+    vpsubusb %zmm1,%zmm2,%zmm3
+    vpsubusb %zmm17,%zmm28,%zmm9{%k1}
+    vpsubusb %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsubusb %ymm19,%ymm2,%ymm23
+    vpsubusb %xmm1,%xmm30,%xmm18{%k1}
+    vpsubusb (%rax),%zmm2,%zmm3
+    vpsubusb 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsubusb 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsubusb -0x100(%rsp),%ymm2,%ymm23
+    vpsubusb 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsubusb 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsubusb -8(%rax),%zmm28,%zmm9
+    vpsubusw %zmm1,%zmm2,%zmm3
+    vpsubusw %zmm17,%zmm28,%zmm9{%k1}
+    vpsubusw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsubusw %ymm19,%ymm2,%ymm23
+    vpsubusw %xmm1,%xmm30,%xmm18{%k1}
+    vpsubusw (%rax),%zmm2,%zmm3
+    vpsubusw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsubusw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsubusw -0x100(%rsp),%ymm2,%ymm23
+    vpsubusw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsubusw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsubusw -8(%rax),%zmm28,%zmm9
+    vpmullw %zmm1,%zmm2,%zmm3
+    vpmullw %zmm17,%zmm28,%zmm9{%k1}
+    vpmullw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmullw %ymm19,%ymm2,%ymm23
+    vpmullw %xmm1,%xmm30,%xmm18{%k1}
+    vpmullw (%rax),%zmm2,%zmm3
+    vpmullw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmullw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmullw -0x100(%rsp),%ymm2,%ymm23
+    vpmullw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmullw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmullw -8(%rax),%zmm28,%zmm9
+    vpmulhw %zmm1,%zmm2,%zmm3
+    vpmulhw %zmm17,%zmm28,%zmm9{%k1}
+    vpmulhw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmulhw %ymm19,%ymm2,%ymm23
+    vpmulhw %xmm1,%xmm30,%xmm18{%k1}
+    vpmulhw (%rax),%zmm2,%zmm3
+    vpmulhw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmulhw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmulhw -0x100(%rsp),%ymm2,%ymm23
+    vpmulhw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmulhw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmulhw -8(%rax),%zmm28,%zmm9
+    vpmulhuw %zmm1,%zmm2,%zmm3
+    vpmulhuw %zmm17,%zmm28,%zmm9{%k1}
+    vpmulhuw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmulhuw %ymm19,%ymm2,%ymm23
+    vpmulhuw %xmm1,%xmm30,%xmm18{%k1}
+    vpmulhuw (%rax),%zmm2,%zmm3
+    vpmulhuw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmulhuw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmulhuw -0x100(%rsp),%ymm2,%ymm23
+    vpmulhuw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmulhuw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmulhuw -8(%rax),%zmm28,%zmm9
+    vpmaddwd %zmm1,%zmm2,%zmm3
+    vpmaddwd %zmm17,%zmm28,%zmm9{%k1}
+    vpmaddwd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmaddwd %ymm19,%ymm2,%ymm23
+    vpmaddwd %xmm1,%xmm30,%xmm18{%k1}
+    vpmaddwd (%rax),%zmm2,%zmm3
+    vpmaddwd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmaddwd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmaddwd -0x100(%rsp),%ymm2,%ymm23
+    vpmaddwd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmaddwd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmaddwd -8(%rax),%zmm28,%zmm9
+    vpsadbw %zmm1,%zmm2,%zmm3
+    vpsadbw %ymm19,%ymm2,%ymm23
+    vpsadbw (%rax),%zmm2,%zmm3
+    vpsadbw -0x100(%rsp),%ymm2,%ymm23
+    vpsadbw -8(%rax),%zmm28,%zmm9
+    vpavgb %zmm1,%zmm2,%zmm3
+    vpavgb %zmm17,%zmm28,%zmm9{%k1}
+    vpavgb %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpavgb %ymm19,%ymm2,%ymm23
+    vpavgb %xmm1,%xmm30,%xmm18{%k1}
+    vpavgb (%rax),%zmm2,%zmm3
+    vpavgb 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpavgb 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpavgb -0x100(%rsp),%ymm2,%ymm23
+    vpavgb 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpavgb 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpavgb -8(%rax),%zmm28,%zmm9
+    vpavgw %zmm1,%zmm2,%zmm3
+    vpavgw %zmm17,%zmm28,%zmm9{%k1}
+    vpavgw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpavgw %ymm19,%ymm2,%ymm23
+    vpavgw %xmm1,%xmm30,%xmm18{%k1}
+    vpavgw (%rax),%zmm2,%zmm3
+    vpavgw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpavgw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpavgw -0x100(%rsp),%ymm2,%ymm23
+    vpavgw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpavgw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpavgw -8(%rax),%zmm28,%zmm9
+    vpminub %zmm1,%zmm2,%zmm3
+    vpminub %zmm17,%zmm28,%zmm9{%k1}
+    vpminub %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpminub %ymm19,%ymm2,%ymm23
+    vpminub %xmm1,%xmm30,%xmm18{%k1}
+    vpminub (%rax),%zmm2,%zmm3
+    vpminub 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpminub 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpminub -0x100(%rsp),%ymm2,%ymm23
+    vpminub 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpminub 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpminub -8(%rax),%zmm28,%zmm9
+    vpmaxub %zmm1,%zmm2,%zmm3
+    vpmaxub %zmm17,%zmm28,%zmm9{%k1}
+    vpmaxub %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmaxub %ymm19,%ymm2,%ymm23
+    vpmaxub %xmm1,%xmm30,%xmm18{%k1}
+    vpmaxub (%rax),%zmm2,%zmm3
+    vpmaxub 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmaxub 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmaxub -0x100(%rsp),%ymm2,%ymm23
+    vpmaxub 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmaxub 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmaxub -8(%rax),%zmm28,%zmm9
+    vpminsw %zmm1,%zmm2,%zmm3
+    vpminsw %zmm17,%zmm28,%zmm9{%k1}
+    vpminsw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpminsw %ymm19,%ymm2,%ymm23
+    vpminsw %xmm1,%xmm30,%xmm18{%k1}
+    vpminsw (%rax),%zmm2,%zmm3
+    vpminsw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpminsw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpminsw -0x100(%rsp),%ymm2,%ymm23
+    vpminsw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpminsw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpminsw -8(%rax),%zmm28,%zmm9
+    vpmaxsw %zmm1,%zmm2,%zmm3
+    vpmaxsw %zmm17,%zmm28,%zmm9{%k1}
+    vpmaxsw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmaxsw %ymm19,%ymm2,%ymm23
+    vpmaxsw %xmm1,%xmm30,%xmm18{%k1}
+    vpmaxsw (%rax),%zmm2,%zmm3
+    vpmaxsw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmaxsw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmaxsw -0x100(%rsp),%ymm2,%ymm23
+    vpmaxsw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmaxsw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmaxsw -8(%rax),%zmm28,%zmm9
+    vpacksswb %zmm1,%zmm2,%zmm3
+    vpacksswb %zmm17,%zmm28,%zmm9{%k1}
+    vpacksswb %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpacksswb %ymm19,%ymm2,%ymm23
+    vpacksswb %xmm1,%xmm30,%xmm18{%k1}
+    vpacksswb (%rax),%zmm2,%zmm3
+    vpacksswb 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpacksswb 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpacksswb -0x100(%rsp),%ymm2,%ymm23
+    vpacksswb 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpacksswb 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpacksswb -8(%rax),%zmm28,%zmm9
+    vpackuswb %zmm1,%zmm2,%zmm3
+    vpackuswb %zmm17,%zmm28,%zmm9{%k1}
+    vpackuswb %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpackuswb %ymm19,%ymm2,%ymm23
+    vpackuswb %xmm1,%xmm30,%xmm18{%k1}
+    vpackuswb (%rax),%zmm2,%zmm3
+    vpackuswb 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpackuswb 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpackuswb -0x100(%rsp),%ymm2,%ymm23
+    vpackuswb 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpackuswb 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpackuswb -8(%rax),%zmm28,%zmm9
+    vpunpcklbw %zmm1,%zmm2,%zmm3
+    vpunpcklbw %zmm17,%zmm28,%zmm9{%k1}
+    vpunpcklbw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpunpcklbw %ymm19,%ymm2,%ymm23
+    vpunpcklbw %xmm1,%xmm30,%xmm18{%k1}
+    vpunpcklbw (%rax),%zmm2,%zmm3
+    vpunpcklbw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpunpcklbw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpunpcklbw -0x100(%rsp),%ymm2,%ymm23
+    vpunpcklbw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpunpcklbw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpunpcklbw -8(%rax),%zmm28,%zmm9
+    vpunpcklwd %zmm1,%zmm2,%zmm3
+    vpunpcklwd %zmm17,%zmm28,%zmm9{%k1}
+    vpunpcklwd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpunpcklwd %ymm19,%ymm2,%ymm23
+    vpunpcklwd %xmm1,%xmm30,%xmm18{%k1}
+    vpunpcklwd (%rax),%zmm2,%zmm3
+    vpunpcklwd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpunpcklwd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpunpcklwd -0x100(%rsp),%ymm2,%ymm23
+    vpunpcklwd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpunpcklwd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpunpcklwd -8(%rax),%zmm28,%zmm9
+    vpunpckhbw %zmm1,%zmm2,%zmm3
+    vpunpckhbw %zmm17,%zmm28,%zmm9{%k1}
+    vpunpckhbw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpunpckhbw %ymm19,%ymm2,%ymm23
+    vpunpckhbw %xmm1,%xmm30,%xmm18{%k1}
+    vpunpckhbw (%rax),%zmm2,%zmm3
+    vpunpckhbw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpunpckhbw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpunpckhbw -0x100(%rsp),%ymm2,%ymm23
+    vpunpckhbw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpunpckhbw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpunpckhbw -8(%rax),%zmm28,%zmm9
+    vpunpckhwd %zmm1,%zmm2,%zmm3
+    vpunpckhwd %zmm17,%zmm28,%zmm9{%k1}
+    vpunpckhwd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpunpckhwd %ymm19,%ymm2,%ymm23
+    vpunpckhwd %xmm1,%xmm30,%xmm18{%k1}
+    vpunpckhwd (%rax),%zmm2,%zmm3
+    vpunpckhwd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpunpckhwd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpunpckhwd -0x100(%rsp),%ymm2,%ymm23
+    vpunpckhwd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpunpckhwd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpunpckhwd -8(%rax),%zmm28,%zmm9
+    vpshufb %zmm1,%zmm2,%zmm3
+    vpshufb %zmm17,%zmm28,%zmm9{%k1}
+    vpshufb %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpshufb %ymm19,%ymm2,%ymm23
+    vpshufb %xmm1,%xmm30,%xmm18{%k1}
+    vpshufb (%rax),%zmm2,%zmm3
+    vpshufb 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpshufb 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpshufb -0x100(%rsp),%ymm2,%ymm23
+    vpshufb 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpshufb 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpshufb -8(%rax),%zmm28,%zmm9
+    vpmaddubsw %zmm1,%zmm2,%zmm3
+    vpmaddubsw %zmm17,%zmm28,%zmm9{%k1}
+    vpmaddubsw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmaddubsw %ymm19,%ymm2,%ymm23
+    vpmaddubsw %xmm1,%xmm30,%xmm18{%k1}
+    vpmaddubsw (%rax),%zmm2,%zmm3
+    vpmaddubsw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmaddubsw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmaddubsw -0x100(%rsp),%ymm2,%ymm23
+    vpmaddubsw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmaddubsw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmaddubsw -8(%rax),%zmm28,%zmm9
+    vpmulhrsw %zmm1,%zmm2,%zmm3
+    vpmulhrsw %zmm17,%zmm28,%zmm9{%k1}
+    vpmulhrsw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmulhrsw %ymm19,%ymm2,%ymm23
+    vpmulhrsw %xmm1,%xmm30,%xmm18{%k1}
+    vpmulhrsw (%rax),%zmm2,%zmm3
+    vpmulhrsw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmulhrsw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmulhrsw -0x100(%rsp),%ymm2,%ymm23
+    vpmulhrsw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmulhrsw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmulhrsw -8(%rax),%zmm28,%zmm9
+    vpminsb %zmm1,%zmm2,%zmm3
+    vpminsb %zmm17,%zmm28,%zmm9{%k1}
+    vpminsb %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpminsb %ymm19,%ymm2,%ymm23
+    vpminsb %xmm1,%xmm30,%xmm18{%k1}
+    vpminsb (%rax),%zmm2,%zmm3
+    vpminsb 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpminsb 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpminsb -0x100(%rsp),%ymm2,%ymm23
+    vpminsb 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpminsb 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpminsb -8(%rax),%zmm28,%zmm9
+    vpminuw %zmm1,%zmm2,%zmm3
+    vpminuw %zmm17,%zmm28,%zmm9{%k1}
+    vpminuw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpminuw %ymm19,%ymm2,%ymm23
+    vpminuw %xmm1,%xmm30,%xmm18{%k1}
+    vpminuw (%rax),%zmm2,%zmm3
+    vpminuw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpminuw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpminuw -0x100(%rsp),%ymm2,%ymm23
+    vpminuw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpminuw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpminuw -8(%rax),%zmm28,%zmm9
+    vpmaxsb %zmm1,%zmm2,%zmm3
+    vpmaxsb %zmm17,%zmm28,%zmm9{%k1}
+    vpmaxsb %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmaxsb %ymm19,%ymm2,%ymm23
+    vpmaxsb %xmm1,%xmm30,%xmm18{%k1}
+    vpmaxsb (%rax),%zmm2,%zmm3
+    vpmaxsb 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmaxsb 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmaxsb -0x100(%rsp),%ymm2,%ymm23
+    vpmaxsb 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmaxsb 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmaxsb -8(%rax),%zmm28,%zmm9
+    vpmaxuw %zmm1,%zmm2,%zmm3
+    vpmaxuw %zmm17,%zmm28,%zmm9{%k1}
+    vpmaxuw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmaxuw %ymm19,%ymm2,%ymm23
+    vpmaxuw %xmm1,%xmm30,%xmm18{%k1}
+    vpmaxuw (%rax),%zmm2,%zmm3
+    vpmaxuw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmaxuw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmaxuw -0x100(%rsp),%ymm2,%ymm23
+    vpmaxuw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmaxuw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmaxuw -8(%rax),%zmm28,%zmm9
+    vpabsb %zmm1,%zmm3
+    vpabsb %zmm17,%zmm9{%k1}
+    vpabsb %zmm31,%zmm0{%k2}{z}
+    vpabsb %ymm19,%ymm23
+    vpabsb %xmm1,%xmm18{%k1}
+    vpabsb (%rax),%zmm3
+    vpabsb 0x40(%rax),%zmm9{%k1}
+    vpabsb 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vpabsb -0x100(%rsp),%ymm23
+    vpabsb 0x44(%rax),%xmm18{%k1}
+    vpabsb 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vpabsb -8(%rax),%zmm9
+    vpabsw %zmm1,%zmm3
+    vpabsw %zmm17,%zmm9{%k1}
+    vpabsw %zmm31,%zmm0{%k2}{z}
+    vpabsw %ymm19,%ymm23
+    vpabsw %xmm1,%xmm18{%k1}
+    vpabsw (%rax),%zmm3
+    vpabsw 0x40(%rax),%zmm9{%k1}
+    vpabsw 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vpabsw -0x100(%rsp),%ymm23
+    vpabsw 0x44(%rax),%xmm18{%k1}
+    vpabsw 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vpabsw -8(%rax),%zmm9
+    vpalignr $5,%zmm1,%zmm2,%zmm3
+    vpalignr $5,%zmm17,%zmm28,%zmm9{%k1}
+    vpalignr $5,%zmm31,%zmm16,%zmm0{%k2}{z}
+    vpalignr $5,%ymm19,%ymm2,%ymm23
+    vpalignr $5,%xmm1,%xmm30,%xmm18{%k1}
+    vpalignr $0x7f,(%rax),%zmm2,%zmm3
+    vpalignr $0x7f,0x40(%rax),%zmm28,%zmm9{%k1}
+    vpalignr $0x7f,0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpalignr $0x7f,-0x100(%rsp),%ymm2,%ymm23
+    vpalignr $0x7f,0x44(%rax),%xmm30,%xmm18{%k1}
+    vpalignr $0x7f,0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpalignr $0x7f,-8(%rax),%zmm28,%zmm9
+    vpshufhw $3,%zmm1,%zmm3
+    vpshufhw $3,%zmm17,%zmm9{%k1}
+    vpshufhw $3,%zmm31,%zmm0{%k2}{z}
+    vpshufhw $3,%ymm19,%ymm23
+    vpshufhw $3,%xmm1,%xmm18{%k1}
+    vpshufhw $0x1b,(%rax),%zmm3
+    vpshufhw $0x1b,0x40(%rax),%zmm9{%k1}
+    vpshufhw $0x1b,0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vpshufhw $0x1b,-0x100(%rsp),%ymm23
+    vpshufhw $0x1b,0x44(%rax),%xmm18{%k1}
+    vpshufhw $0x1b,0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vpshufhw $0x1b,-8(%rax),%zmm9
+    vpshuflw $3,%zmm1,%zmm3
+    vpshuflw $3,%zmm17,%zmm9{%k1}
+    vpshuflw $3,%zmm31,%zmm0{%k2}{z}
+    vpshuflw $3,%ymm19,%ymm23
+    vpshuflw $3,%xmm1,%xmm18{%k1}
+    vpshuflw $0x1b,(%rax),%zmm3
+    vpshuflw $0x1b,0x40(%rax),%zmm9{%k1}
+    vpshuflw $0x1b,0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vpshuflw $0x1b,-0x100(%rsp),%ymm23
+    vpshuflw $0x1b,0x44(%rax),%xmm18{%k1}
+    vpshuflw $0x1b,0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vpshuflw $0x1b,-8(%rax),%zmm9
+    vpslldq $3,%zmm2,%zmm3
+    vpslldq $3,0x40(%rax),%zmm3
+    vpslldq $3,0x40(%rax),%zmm9
+    vpslldq $3,0x40(%rax),%zmm0
+    vpslldq $3,%ymm2,%ymm23
+    vpslldq $3,0x40(%rax),%ymm23
+    vpslldq $3,0x40(%rax),%xmm18
+    vpsrldq $3,%zmm2,%zmm3
+    vpsrldq $3,0x40(%rax),%zmm3
+    vpsrldq $3,0x40(%rax),%zmm9
+    vpsrldq $3,0x40(%rax),%zmm0
+    vpsrldq $3,%ymm2,%ymm23
+    vpsrldq $3,0x40(%rax),%ymm23
+    vpsrldq $3,0x40(%rax),%xmm18
+    vpsllw $3,%zmm2,%zmm3
+    vpsllw $3,0x40(%rax),%zmm3
+    vpsllw %xmm4,%zmm2,%zmm3
+    vpsllw 0x10(%rax),%zmm2,%zmm3
+    vpsllw 0x40(%rax),%zmm2,%zmm3
+    vpsllw $3,%zmm28,%zmm9{%k1}
+    vpsllw $3,0x40(%rax),%zmm9
+    vpsllw %xmm4,%zmm28,%zmm9{%k1}
+    vpsllw 0x10(%rax),%zmm28,%zmm9
+    vpsllw 0x40(%rax),%zmm28,%zmm9
+    vpsllw $3,%zmm16,%zmm0{%k2}{z}
+    vpsllw $3,0x40(%rax),%zmm0
+    vpsllw %xmm4,%zmm16,%zmm0{%k2}{z}
+    vpsllw 0x10(%rax),%zmm16,%zmm0
+    vpsllw 0x40(%rax),%zmm16,%zmm0
+    vpsllw $3,%ymm2,%ymm23
+    vpsllw $3,0x40(%rax),%ymm23
+    vpsllw %xmm4,%ymm2,%ymm23
+    vpsllw 0x10(%rax),%ymm2,%ymm23
+    vpsllw 0x40(%rax),%ymm2,%ymm23
+    vpsllw $3,%xmm30,%xmm18{%k1}
+    vpsllw $3,0x40(%rax),%xmm18
+    vpsllw %xmm4,%xmm30,%xmm18{%k1}
+    vpsllw 0x10(%rax),%xmm30,%xmm18
+    vpsllw 0x40(%rax),%xmm30,%xmm18
+    vpsrlw $3,%zmm2,%zmm3
+    vpsrlw $3,0x40(%rax),%zmm3
+    vpsrlw %xmm4,%zmm2,%zmm3
+    vpsrlw 0x10(%rax),%zmm2,%zmm3
+    vpsrlw 0x40(%rax),%zmm2,%zmm3
+    vpsrlw $3,%zmm28,%zmm9{%k1}
+    vpsrlw $3,0x40(%rax),%zmm9
+    vpsrlw %xmm4,%zmm28,%zmm9{%k1}
+    vpsrlw 0x10(%rax),%zmm28,%zmm9
+    vpsrlw 0x40(%rax),%zmm28,%zmm9
+    vpsrlw $3,%zmm16,%zmm0{%k2}{z}
+    vpsrlw $3,0x40(%rax),%zmm0
+    vpsrlw %xmm4,%zmm16,%zmm0{%k2}{z}
+    vpsrlw 0x10(%rax),%zmm16,%zmm0
+    vpsrlw 0x40(%rax),%zmm16,%zmm0
+    vpsrlw $3,%ymm2,%ymm23
+    vpsrlw $3,0x40(%rax),%ymm23
+    vpsrlw %xmm4,%ymm2,%ymm23
+    vpsrlw 0x10(%rax),%ymm2,%ymm23
+    vpsrlw 0x40(%rax),%ymm2,%ymm23
+    vpsrlw $3,%xmm30,%xmm18{%k1}
+    vpsrlw $3,0x40(%rax),%xmm18
+    vpsrlw %xmm4,%xmm30,%xmm18{%k1}
+    vpsrlw 0x10(%rax),%xmm30,%xmm18
+    vpsrlw 0x40(%rax),%xmm30,%xmm18
+    vpsraw $3,%zmm2,%zmm3
+    vpsraw $3,0x40(%rax),%zmm3
+    vpsraw %xmm4,%zmm2,%zmm3
+    vpsraw 0x10(%rax),%zmm2,%zmm3
+    vpsraw 0x40(%rax),%zmm2,%zmm3
+    vpsraw $3,%zmm28,%zmm9{%k1}
+    vpsraw $3,0x40(%rax),%zmm9
+    vpsraw %xmm4,%zmm28,%zmm9{%k1}
+    vpsraw 0x10(%rax),%zmm28,%zmm9
+    vpsraw 0x40(%rax),%zmm28,%zmm9
+    vpsraw $3,%zmm16,%zmm0{%k2}{z}
+    vpsraw $3,0x40(%rax),%zmm0
+    vpsraw %xmm4,%zmm16,%zmm0{%k2}{z}
+    vpsraw 0x10(%rax),%zmm16,%zmm0
+    vpsraw 0x40(%rax),%zmm16,%zmm0
+    vpsraw $3,%ymm2,%ymm23
+    vpsraw $3,0x40(%rax),%ymm23
+    vpsraw %xmm4,%ymm2,%ymm23
+    vpsraw 0x10(%rax),%ymm2,%ymm23
+    vpsraw 0x40(%rax),%ymm2,%ymm23
+    vpsraw $3,%xmm30,%xmm18{%k1}
+    vpsraw $3,0x40(%rax),%xmm18
+    vpsraw %xmm4,%xmm30,%xmm18{%k1}
+    vpsraw 0x10(%rax),%xmm30,%xmm18
+    vpsraw 0x40(%rax),%xmm30,%xmm18
+    vmovshdup %zmm1,%zmm3
+    vmovshdup %zmm17,%zmm9{%k1}
+    vmovshdup %zmm31,%zmm0{%k2}{z}
+    vmovshdup %ymm19,%ymm23
+    vmovshdup %xmm1,%xmm18{%k1}
+    vmovshdup (%rax),%zmm3
+    vmovshdup 0x40(%rax),%zmm9{%k1}
+    vmovshdup 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vmovshdup -0x100(%rsp),%ymm23
+    vmovshdup 0x44(%rax),%xmm18{%k1}
+    vmovshdup 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vmovshdup -8(%rax),%zmm9
+    vmovsldup %zmm1,%zmm3
+    vmovsldup %zmm17,%zmm9{%k1}
+    vmovsldup %zmm31,%zmm0{%k2}{z}
+    vmovsldup %ymm19,%ymm23
+    vmovsldup %xmm1,%xmm18{%k1}
+    vmovsldup (%rax),%zmm3
+    vmovsldup 0x40(%rax),%zmm9{%k1}
+    vmovsldup 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vmovsldup -0x100(%rsp),%ymm23
+    vmovsldup 0x44(%rax),%xmm18{%k1}
+    vmovsldup 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vmovsldup -8(%rax),%zmm9
+    vpcmpeqb %zmm1,%zmm2,%k1
+    vpcmpeqb %zmm17,%zmm28,%k2{%k3}
+    vpcmpeqb %zmm31,%zmm16,%k3
+    vpcmpeqb %ymm19,%ymm2,%k4{%k3}
+    vpcmpeqb %xmm1,%xmm30,%k5
+    vpcmpeqb (%rax),%zmm2,%k1
+    vpcmpeqb 0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpeqb 0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpeqb -0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpeqb 0x44(%rax),%xmm30,%k5
+    vpcmpeqb 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpeqb -8(%rax),%zmm28,%k7
+    vpcmpeqw %zmm1,%zmm2,%k1
+    vpcmpeqw %zmm17,%zmm28,%k2{%k3}
+    vpcmpeqw %zmm31,%zmm16,%k3
+    vpcmpeqw %ymm19,%ymm2,%k4{%k3}
+    vpcmpeqw %xmm1,%xmm30,%k5
+    vpcmpeqw (%rax),%zmm2,%k1
+    vpcmpeqw 0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpeqw 0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpeqw -0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpeqw 0x44(%rax),%xmm30,%k5
+    vpcmpeqw 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpeqw -8(%rax),%zmm28,%k7
+    vpcmpgtb %zmm1,%zmm2,%k1
+    vpcmpgtb %zmm17,%zmm28,%k2{%k3}
+    vpcmpgtb %zmm31,%zmm16,%k3
+    vpcmpgtb %ymm19,%ymm2,%k4{%k3}
+    vpcmpgtb %xmm1,%xmm30,%k5
+    vpcmpgtb (%rax),%zmm2,%k1
+    vpcmpgtb 0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpgtb 0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpgtb -0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpgtb 0x44(%rax),%xmm30,%k5
+    vpcmpgtb 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpgtb -8(%rax),%zmm28,%k7
+    vpcmpgtw %zmm1,%zmm2,%k1
+    vpcmpgtw %zmm17,%zmm28,%k2{%k3}
+    vpcmpgtw %zmm31,%zmm16,%k3
+    vpcmpgtw %ymm19,%ymm2,%k4{%k3}
+    vpcmpgtw %xmm1,%xmm30,%k5
+    vpcmpgtw (%rax),%zmm2,%k1
+    vpcmpgtw 0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpgtw 0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpgtw -0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpgtw 0x44(%rax),%xmm30,%k5
+    vpcmpgtw 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpgtw -8(%rax),%zmm28,%k7
+    vpaddd %zmm1,%zmm2,%zmm3
+    vpaddd %zmm17,%zmm28,%zmm9{%k1}
+    vpaddd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpaddd %ymm19,%ymm2,%ymm23
+    vpaddd %xmm1,%xmm30,%xmm18{%k1}
+    vpaddd (%rax),%zmm2,%zmm3
+    vpaddd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpaddd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpaddd -0x100(%rsp),%ymm2,%ymm23
+    vpaddd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpaddd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpaddd -8(%rax),%zmm28,%zmm9
+    vpaddd 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpaddd 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpaddd 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpaddd 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpaddd 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpsubd %zmm1,%zmm2,%zmm3
+    vpsubd %zmm17,%zmm28,%zmm9{%k1}
+    vpsubd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsubd %ymm19,%ymm2,%ymm23
+    vpsubd %xmm1,%xmm30,%xmm18{%k1}
+    vpsubd (%rax),%zmm2,%zmm3
+    vpsubd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsubd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsubd -0x100(%rsp),%ymm2,%ymm23
+    vpsubd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsubd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsubd -8(%rax),%zmm28,%zmm9
+    vpsubd 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpsubd 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpsubd 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpsubd 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpsubd 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpmulld %zmm1,%zmm2,%zmm3
+    vpmulld %zmm17,%zmm28,%zmm9{%k1}
+    vpmulld %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmulld %ymm19,%ymm2,%ymm23
+    vpmulld %xmm1,%xmm30,%xmm18{%k1}
+    vpmulld (%rax),%zmm2,%zmm3
+    vpmulld 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmulld 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmulld -0x100(%rsp),%ymm2,%ymm23
+    vpmulld 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmulld 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmulld -8(%rax),%zmm28,%zmm9
+    vpmulld 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpmulld 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpmulld 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpmulld 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpmulld 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpminsd %zmm1,%zmm2,%zmm3
+    vpminsd %zmm17,%zmm28,%zmm9{%k1}
+    vpminsd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpminsd %ymm19,%ymm2,%ymm23
+    vpminsd %xmm1,%xmm30,%xmm18{%k1}
+    vpminsd (%rax),%zmm2,%zmm3
+    vpminsd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpminsd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpminsd -0x100(%rsp),%ymm2,%ymm23
+    vpminsd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpminsd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpminsd -8(%rax),%zmm28,%zmm9
+    vpminsd 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpminsd 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpminsd 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpminsd 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpminsd 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpminud %zmm1,%zmm2,%zmm3
+    vpminud %zmm17,%zmm28,%zmm9{%k1}
+    vpminud %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpminud %ymm19,%ymm2,%ymm23
+    vpminud %xmm1,%xmm30,%xmm18{%k1}
+    vpminud (%rax),%zmm2,%zmm3
+    vpminud 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpminud 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpminud -0x100(%rsp),%ymm2,%ymm23
+    vpminud 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpminud 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpminud -8(%rax),%zmm28,%zmm9
+    vpminud 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpminud 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpminud 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpminud 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpminud 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpmaxsd %zmm1,%zmm2,%zmm3
+    vpmaxsd %zmm17,%zmm28,%zmm9{%k1}
+    vpmaxsd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmaxsd %ymm19,%ymm2,%ymm23
+    vpmaxsd %xmm1,%xmm30,%xmm18{%k1}
+    vpmaxsd (%rax),%zmm2,%zmm3
+    vpmaxsd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmaxsd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmaxsd -0x100(%rsp),%ymm2,%ymm23
+    vpmaxsd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmaxsd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmaxsd -8(%rax),%zmm28,%zmm9
+    vpmaxsd 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpmaxsd 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpmaxsd 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpmaxsd 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpmaxsd 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpmaxud %zmm1,%zmm2,%zmm3
+    vpmaxud %zmm17,%zmm28,%zmm9{%k1}
+    vpmaxud %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmaxud %ymm19,%ymm2,%ymm23
+    vpmaxud %xmm1,%xmm30,%xmm18{%k1}
+    vpmaxud (%rax),%zmm2,%zmm3
+    vpmaxud 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmaxud 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmaxud -0x100(%rsp),%ymm2,%ymm23
+    vpmaxud 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmaxud 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmaxud -8(%rax),%zmm28,%zmm9
+    vpmaxud 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpmaxud 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpmaxud 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpmaxud 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpmaxud 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpackssdw %zmm1,%zmm2,%zmm3
+    vpackssdw %zmm17,%zmm28,%zmm9{%k1}
+    vpackssdw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpackssdw %ymm19,%ymm2,%ymm23
+    vpackssdw %xmm1,%xmm30,%xmm18{%k1}
+    vpackssdw (%rax),%zmm2,%zmm3
+    vpackssdw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpackssdw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpackssdw -0x100(%rsp),%ymm2,%ymm23
+    vpackssdw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpackssdw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpackssdw -8(%rax),%zmm28,%zmm9
+    vpackssdw 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpackssdw 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpackssdw 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpackssdw 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpackssdw 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpackusdw %zmm1,%zmm2,%zmm3
+    vpackusdw %zmm17,%zmm28,%zmm9{%k1}
+    vpackusdw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpackusdw %ymm19,%ymm2,%ymm23
+    vpackusdw %xmm1,%xmm30,%xmm18{%k1}
+    vpackusdw (%rax),%zmm2,%zmm3
+    vpackusdw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpackusdw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpackusdw -0x100(%rsp),%ymm2,%ymm23
+    vpackusdw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpackusdw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpackusdw -8(%rax),%zmm28,%zmm9
+    vpackusdw 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpackusdw 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpackusdw 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpackusdw 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpackusdw 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpunpckldq %zmm1,%zmm2,%zmm3
+    vpunpckldq %zmm17,%zmm28,%zmm9{%k1}
+    vpunpckldq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpunpckldq %ymm19,%ymm2,%ymm23
+    vpunpckldq %xmm1,%xmm30,%xmm18{%k1}
+    vpunpckldq (%rax),%zmm2,%zmm3
+    vpunpckldq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpunpckldq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpunpckldq -0x100(%rsp),%ymm2,%ymm23
+    vpunpckldq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpunpckldq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpunpckldq -8(%rax),%zmm28,%zmm9
+    vpunpckldq 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpunpckldq 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpunpckldq 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpunpckldq 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpunpckldq 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpunpckhdq %zmm1,%zmm2,%zmm3
+    vpunpckhdq %zmm17,%zmm28,%zmm9{%k1}
+    vpunpckhdq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpunpckhdq %ymm19,%ymm2,%ymm23
+    vpunpckhdq %xmm1,%xmm30,%xmm18{%k1}
+    vpunpckhdq (%rax),%zmm2,%zmm3
+    vpunpckhdq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpunpckhdq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpunpckhdq -0x100(%rsp),%ymm2,%ymm23
+    vpunpckhdq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpunpckhdq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpunpckhdq -8(%rax),%zmm28,%zmm9
+    vpunpckhdq 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpunpckhdq 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpunpckhdq 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpunpckhdq 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpunpckhdq 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpabsd %zmm1,%zmm3
+    vpabsd %zmm17,%zmm9{%k1}
+    vpabsd %zmm31,%zmm0{%k2}{z}
+    vpabsd %ymm19,%ymm23
+    vpabsd %xmm1,%xmm18{%k1}
+    vpabsd (%rax),%zmm3
+    vpabsd 0x40(%rax),%zmm9{%k1}
+    vpabsd 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vpabsd -0x100(%rsp),%ymm23
+    vpabsd 0x44(%rax),%xmm18{%k1}
+    vpabsd 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vpabsd -8(%rax),%zmm9
+    vpabsd 0x40(%rax){1to16},%zmm3
+    vpabsd 0x40(%rax){1to16},%zmm9
+    vpabsd 0x40(%rax){1to16},%zmm0
+    vpabsd 0x40(%rax){1to8},%ymm23
+    vpabsd 0x40(%rax){1to4},%xmm18
+    vpshufd $3,%zmm1,%zmm3
+    vpshufd $3,%zmm17,%zmm9{%k1}
+    vpshufd $3,%zmm31,%zmm0{%k2}{z}
+    vpshufd $3,%ymm19,%ymm23
+    vpshufd $3,%xmm1,%xmm18{%k1}
+    vpshufd $0x1b,(%rax),%zmm3
+    vpshufd $0x1b,0x40(%rax),%zmm9{%k1}
+    vpshufd $0x1b,0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vpshufd $0x1b,-0x100(%rsp),%ymm23
+    vpshufd $0x1b,0x44(%rax),%xmm18{%k1}
+    vpshufd $0x1b,0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vpshufd $0x1b,-8(%rax),%zmm9
+    vpshufd $1,0x40(%rax){1to16},%zmm3
+    vpshufd $1,0x40(%rax){1to16},%zmm9
+    vpshufd $1,0x40(%rax){1to16},%zmm0
+    vpshufd $1,0x40(%rax){1to8},%ymm23
+    vpshufd $1,0x40(%rax){1to4},%xmm18
+    vpslld $3,%zmm2,%zmm3
+    vpslld $3,0x40(%rax),%zmm3
+    vpslld $3,0x40(%rax){1to16},%zmm3
+    vpslld %xmm4,%zmm2,%zmm3
+    vpslld 0x10(%rax),%zmm2,%zmm3
+    vpslld 0x40(%rax),%zmm2,%zmm3
+    vpslld $3,%zmm28,%zmm9{%k1}
+    vpslld $3,0x40(%rax),%zmm9
+    vpslld $3,0x40(%rax){1to16},%zmm9
+    vpslld %xmm4,%zmm28,%zmm9{%k1}
+    vpslld 0x10(%rax),%zmm28,%zmm9
+    vpslld 0x40(%rax),%zmm28,%zmm9
+    vpslld $3,%zmm16,%zmm0{%k2}{z}
+    vpslld $3,0x40(%rax),%zmm0
+    vpslld $3,0x40(%rax){1to16},%zmm0
+    vpslld %xmm4,%zmm16,%zmm0{%k2}{z}
+    vpslld 0x10(%rax),%zmm16,%zmm0
+    vpslld 0x40(%rax),%zmm16,%zmm0
+    vpslld $3,%ymm2,%ymm23
+    vpslld $3,0x40(%rax),%ymm23
+    vpslld $3,0x40(%rax){1to8},%ymm23
+    vpslld %xmm4,%ymm2,%ymm23
+    vpslld 0x10(%rax),%ymm2,%ymm23
+    vpslld 0x40(%rax),%ymm2,%ymm23
+    vpslld $3,%xmm30,%xmm18{%k1}
+    vpslld $3,0x40(%rax),%xmm18
+    vpslld $3,0x40(%rax){1to4},%xmm18
+    vpslld %xmm4,%xmm30,%xmm18{%k1}
+    vpslld 0x10(%rax),%xmm30,%xmm18
+    vpslld 0x40(%rax),%xmm30,%xmm18
+    vpsrld $3,%zmm2,%zmm3
+    vpsrld $3,0x40(%rax),%zmm3
+    vpsrld $3,0x40(%rax){1to16},%zmm3
+    vpsrld %xmm4,%zmm2,%zmm3
+    vpsrld 0x10(%rax),%zmm2,%zmm3
+    vpsrld 0x40(%rax),%zmm2,%zmm3
+    vpsrld $3,%zmm28,%zmm9{%k1}
+    vpsrld $3,0x40(%rax),%zmm9
+    vpsrld $3,0x40(%rax){1to16},%zmm9
+    vpsrld %xmm4,%zmm28,%zmm9{%k1}
+    vpsrld 0x10(%rax),%zmm28,%zmm9
+    vpsrld 0x40(%rax),%zmm28,%zmm9
+    vpsrld $3,%zmm16,%zmm0{%k2}{z}
+    vpsrld $3,0x40(%rax),%zmm0
+    vpsrld $3,0x40(%rax){1to16},%zmm0
+    vpsrld %xmm4,%zmm16,%zmm0{%k2}{z}
+    vpsrld 0x10(%rax),%zmm16,%zmm0
+    vpsrld 0x40(%rax),%zmm16,%zmm0
+    vpsrld $3,%ymm2,%ymm23
+    vpsrld $3,0x40(%rax),%ymm23
+    vpsrld $3,0x40(%rax){1to8},%ymm23
+    vpsrld %xmm4,%ymm2,%ymm23
+    vpsrld 0x10(%rax),%ymm2,%ymm23
+    vpsrld 0x40(%rax),%ymm2,%ymm23
+    vpsrld $3,%xmm30,%xmm18{%k1}
+    vpsrld $3,0x40(%rax),%xmm18
+    vpsrld $3,0x40(%rax){1to4},%xmm18
+    vpsrld %xmm4,%xmm30,%xmm18{%k1}
+    vpsrld 0x10(%rax),%xmm30,%xmm18
+    vpsrld 0x40(%rax),%xmm30,%xmm18
+    vpsrad $3,%zmm2,%zmm3
+    vpsrad $3,0x40(%rax),%zmm3
+    vpsrad $3,0x40(%rax){1to16},%zmm3
+    vpsrad %xmm4,%zmm2,%zmm3
+    vpsrad 0x10(%rax),%zmm2,%zmm3
+    vpsrad 0x40(%rax),%zmm2,%zmm3
+    vpsrad $3,%zmm28,%zmm9{%k1}
+    vpsrad $3,0x40(%rax),%zmm9
+    vpsrad $3,0x40(%rax){1to16},%zmm9
+    vpsrad %xmm4,%zmm28,%zmm9{%k1}
+    vpsrad 0x10(%rax),%zmm28,%zmm9
+    vpsrad 0x40(%rax),%zmm28,%zmm9
+    vpsrad $3,%zmm16,%zmm0{%k2}{z}
+    vpsrad $3,0x40(%rax),%zmm0
+    vpsrad $3,0x40(%rax){1to16},%zmm0
+    vpsrad %xmm4,%zmm16,%zmm0{%k2}{z}
+    vpsrad 0x10(%rax),%zmm16,%zmm0
+    vpsrad 0x40(%rax),%zmm16,%zmm0
+    vpsrad $3,%ymm2,%ymm23
+    vpsrad $3,0x40(%rax),%ymm23
+    vpsrad $3,0x40(%rax){1to8},%ymm23
+    vpsrad %xmm4,%ymm2,%ymm23
+    vpsrad 0x10(%rax),%ymm2,%ymm23
+    vpsrad 0x40(%rax),%ymm2,%ymm23
+    vpsrad $3,%xmm30,%xmm18{%k1}
+    vpsrad $3,0x40(%rax),%xmm18
+    vpsrad $3,0x40(%rax){1to4},%xmm18
+    vpsrad %xmm4,%xmm30,%xmm18{%k1}
+    vpsrad 0x10(%rax),%xmm30,%xmm18
+    vpsrad 0x40(%rax),%xmm30,%xmm18
+    vpsllvd %zmm1,%zmm2,%zmm3
+    vpsllvd %zmm17,%zmm28,%zmm9{%k1}
+    vpsllvd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsllvd %ymm19,%ymm2,%ymm23
+    vpsllvd %xmm1,%xmm30,%xmm18{%k1}
+    vpsllvd (%rax),%zmm2,%zmm3
+    vpsllvd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsllvd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsllvd -0x100(%rsp),%ymm2,%ymm23
+    vpsllvd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsllvd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsllvd -8(%rax),%zmm28,%zmm9
+    vpsllvd 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpsllvd 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpsllvd 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpsllvd 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpsllvd 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpsrlvd %zmm1,%zmm2,%zmm3
+    vpsrlvd %zmm17,%zmm28,%zmm9{%k1}
+    vpsrlvd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsrlvd %ymm19,%ymm2,%ymm23
+    vpsrlvd %xmm1,%xmm30,%xmm18{%k1}
+    vpsrlvd (%rax),%zmm2,%zmm3
+    vpsrlvd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsrlvd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsrlvd -0x100(%rsp),%ymm2,%ymm23
+    vpsrlvd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsrlvd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsrlvd -8(%rax),%zmm28,%zmm9
+    vpsrlvd 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpsrlvd 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpsrlvd 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpsrlvd 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpsrlvd 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpsravd %zmm1,%zmm2,%zmm3
+    vpsravd %zmm17,%zmm28,%zmm9{%k1}
+    vpsravd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsravd %ymm19,%ymm2,%ymm23
+    vpsravd %xmm1,%xmm30,%xmm18{%k1}
+    vpsravd (%rax),%zmm2,%zmm3
+    vpsravd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsravd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsravd -0x100(%rsp),%ymm2,%ymm23
+    vpsravd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsravd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsravd -8(%rax),%zmm28,%zmm9
+    vpsravd 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpsravd 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpsravd 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpsravd 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpsravd 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpermd %zmm1,%zmm2,%zmm3
+    vpermd %zmm17,%zmm28,%zmm9{%k1}
+    vpermd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpermd %ymm19,%ymm2,%ymm23
+    vpermd (%rax),%zmm2,%zmm3
+    vpermd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpermd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpermd -0x100(%rsp),%ymm2,%ymm23
+    vpermd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpermd -8(%rax),%zmm28,%zmm9
+    vpermd 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpermd 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpermd 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpermd 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpermps %zmm1,%zmm2,%zmm3
+    vpermps %zmm17,%zmm28,%zmm9{%k1}
+    vpermps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpermps %ymm19,%ymm2,%ymm23
+    vpermps (%rax),%zmm2,%zmm3
+    vpermps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpermps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpermps -0x100(%rsp),%ymm2,%ymm23
+    vpermps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpermps -8(%rax),%zmm28,%zmm9
+    vpermps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpermps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpermps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpermps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpermilps $3,%zmm1,%zmm3
+    vpermilps $3,%zmm17,%zmm9{%k1}
+    vpermilps $3,%zmm31,%zmm0{%k2}{z}
+    vpermilps $3,%ymm19,%ymm23
+    vpermilps $3,%xmm1,%xmm18{%k1}
+    vpermilps $0x1b,(%rax),%zmm3
+    vpermilps $0x1b,0x40(%rax),%zmm9{%k1}
+    vpermilps $0x1b,0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vpermilps $0x1b,-0x100(%rsp),%ymm23
+    vpermilps $0x1b,0x44(%rax),%xmm18{%k1}
+    vpermilps $0x1b,0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vpermilps $0x1b,-8(%rax),%zmm9
+    vpermilps $1,0x40(%rax){1to16},%zmm3
+    vpermilps $1,0x40(%rax){1to16},%zmm9
+    vpermilps $1,0x40(%rax){1to16},%zmm0
+    vpermilps $1,0x40(%rax){1to8},%ymm23
+    vpermilps $1,0x40(%rax){1to4},%xmm18
+    vpermilps %zmm1,%zmm2,%zmm3
+    vpermilps %zmm17,%zmm28,%zmm9{%k1}
+    vpermilps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpermilps %ymm19,%ymm2,%ymm23
+    vpermilps %xmm1,%xmm30,%xmm18{%k1}
+    vpermilps 0x40(%rax){1to16},%zmm2,%zmm3
+    vpermilps 0x40(%rax){1to16},%zmm28,%zmm9
+    vpermilps 0x40(%rax){1to16},%zmm16,%zmm0
+    vpermilps 0x40(%rax){1to8},%ymm2,%ymm23
+    vpermilps 0x40(%rax){1to4},%xmm30,%xmm18
+    vcvtdq2ps %zmm1,%zmm3
+    vcvtdq2ps %zmm17,%zmm9{%k1}
+    vcvtdq2ps %zmm31,%zmm0{%k2}{z}
+    vcvtdq2ps %ymm19,%ymm23
+    vcvtdq2ps %xmm1,%xmm18{%k1}
+    vcvtdq2ps (%rax),%zmm3
+    vcvtdq2ps 0x40(%rax),%zmm9{%k1}
+    vcvtdq2ps 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vcvtdq2ps -0x100(%rsp),%ymm23
+    vcvtdq2ps 0x44(%rax),%xmm18{%k1}
+    vcvtdq2ps 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vcvtdq2ps -8(%rax),%zmm9
+    vcvtdq2ps 0x40(%rax){1to16},%zmm3
+    vcvtdq2ps 0x40(%rax){1to16},%zmm9
+    vcvtdq2ps 0x40(%rax){1to16},%zmm0
+    vcvtdq2ps 0x40(%rax){1to8},%ymm23
+    vcvtdq2ps 0x40(%rax){1to4},%xmm18
+    vpcmpeqd %zmm1,%zmm2,%k1
+    vpcmpeqd %zmm17,%zmm28,%k2{%k3}
+    vpcmpeqd %zmm31,%zmm16,%k3
+    vpcmpeqd %ymm19,%ymm2,%k4{%k3}
+    vpcmpeqd %xmm1,%xmm30,%k5
+    vpcmpeqd (%rax),%zmm2,%k1
+    vpcmpeqd 0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpeqd 0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpeqd -0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpeqd 0x44(%rax),%xmm30,%k5
+    vpcmpeqd 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpeqd -8(%rax),%zmm28,%k7
+    vpcmpeqd 0x40(%rax){1to16},%zmm2,%k2{%k3}
+    vpcmpeqd 0x40(%rax){1to16},%zmm28,%k2{%k3}
+    vpcmpeqd 0x40(%rax){1to16},%zmm16,%k2{%k3}
+    vpcmpeqd 0x40(%rax){1to8},%ymm2,%k2{%k3}
+    vpcmpeqd 0x40(%rax){1to4},%xmm30,%k2{%k3}
+    vpcmpgtd %zmm1,%zmm2,%k1
+    vpcmpgtd %zmm17,%zmm28,%k2{%k3}
+    vpcmpgtd %zmm31,%zmm16,%k3
+    vpcmpgtd %ymm19,%ymm2,%k4{%k3}
+    vpcmpgtd %xmm1,%xmm30,%k5
+    vpcmpgtd (%rax),%zmm2,%k1
+    vpcmpgtd 0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpgtd 0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpgtd -0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpgtd 0x44(%rax),%xmm30,%k5
+    vpcmpgtd 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpgtd -8(%rax),%zmm28,%k7
+    vpcmpgtd 0x40(%rax){1to16},%zmm2,%k2{%k3}
+    vpcmpgtd 0x40(%rax){1to16},%zmm28,%k2{%k3}
+    vpcmpgtd 0x40(%rax){1to16},%zmm16,%k2{%k3}
+    vpcmpgtd 0x40(%rax){1to8},%ymm2,%k2{%k3}
+    vpcmpgtd 0x40(%rax){1to4},%xmm30,%k2{%k3}
+    vcvtps2dq %zmm1,%zmm3
+    vcvtps2dq %zmm17,%zmm9{%k1}
+    vcvtps2dq %zmm31,%zmm0{%k2}{z}
+    vcvtps2dq %ymm19,%ymm23
+    vcvtps2dq %xmm1,%xmm18{%k1}
+    vcvtps2dq (%rax),%zmm3
+    vcvtps2dq 0x40(%rax),%zmm9{%k1}
+    vcvtps2dq 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vcvtps2dq -0x100(%rsp),%ymm23
+    vcvtps2dq 0x44(%rax),%xmm18{%k1}
+    vcvtps2dq 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vcvtps2dq -8(%rax),%zmm9
+    vcvtps2dq 0x40(%rax){1to16},%zmm3
+    vcvtps2dq 0x40(%rax){1to16},%zmm9
+    vcvtps2dq 0x40(%rax){1to16},%zmm0
+    vcvtps2dq 0x40(%rax){1to8},%ymm23
+    vcvtps2dq 0x40(%rax){1to4},%xmm18
+    vcvtps2dq {rz-sae},%zmm1,%zmm30
+    vcvttps2dq %zmm1,%zmm3
+    vcvttps2dq %zmm17,%zmm9{%k1}
+    vcvttps2dq %zmm31,%zmm0{%k2}{z}
+    vcvttps2dq %ymm19,%ymm23
+    vcvttps2dq %xmm1,%xmm18{%k1}
+    vcvttps2dq (%rax),%zmm3
+    vcvttps2dq 0x40(%rax),%zmm9{%k1}
+    vcvttps2dq 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vcvttps2dq -0x100(%rsp),%ymm23
+    vcvttps2dq 0x44(%rax),%xmm18{%k1}
+    vcvttps2dq 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vcvttps2dq -8(%rax),%zmm9
+    vcvttps2dq 0x40(%rax){1to16},%zmm3
+    vcvttps2dq 0x40(%rax){1to16},%zmm9
+    vcvttps2dq 0x40(%rax){1to16},%zmm0
+    vcvttps2dq 0x40(%rax){1to8},%ymm23
+    vcvttps2dq 0x40(%rax){1to4},%xmm18
+    vcvttps2dq {sae},%zmm1,%zmm30
+    vpaddq %zmm1,%zmm2,%zmm3
+    vpaddq %zmm17,%zmm28,%zmm9{%k1}
+    vpaddq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpaddq %ymm19,%ymm2,%ymm23
+    vpaddq %xmm1,%xmm30,%xmm18{%k1}
+    vpaddq (%rax),%zmm2,%zmm3
+    vpaddq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpaddq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpaddq -0x100(%rsp),%ymm2,%ymm23
+    vpaddq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpaddq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpaddq -8(%rax),%zmm28,%zmm9
+    vpaddq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpaddq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpaddq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpaddq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpaddq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpsubq %zmm1,%zmm2,%zmm3
+    vpsubq %zmm17,%zmm28,%zmm9{%k1}
+    vpsubq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsubq %ymm19,%ymm2,%ymm23
+    vpsubq %xmm1,%xmm30,%xmm18{%k1}
+    vpsubq (%rax),%zmm2,%zmm3
+    vpsubq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsubq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsubq -0x100(%rsp),%ymm2,%ymm23
+    vpsubq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsubq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsubq -8(%rax),%zmm28,%zmm9
+    vpsubq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpsubq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpsubq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpsubq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpsubq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpmuludq %zmm1,%zmm2,%zmm3
+    vpmuludq %zmm17,%zmm28,%zmm9{%k1}
+    vpmuludq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmuludq %ymm19,%ymm2,%ymm23
+    vpmuludq %xmm1,%xmm30,%xmm18{%k1}
+    vpmuludq (%rax),%zmm2,%zmm3
+    vpmuludq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmuludq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmuludq -0x100(%rsp),%ymm2,%ymm23
+    vpmuludq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmuludq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmuludq -8(%rax),%zmm28,%zmm9
+    vpmuludq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpmuludq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpmuludq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpmuludq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpmuludq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpmuldq %zmm1,%zmm2,%zmm3
+    vpmuldq %zmm17,%zmm28,%zmm9{%k1}
+    vpmuldq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmuldq %ymm19,%ymm2,%ymm23
+    vpmuldq %xmm1,%xmm30,%xmm18{%k1}
+    vpmuldq (%rax),%zmm2,%zmm3
+    vpmuldq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmuldq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmuldq -0x100(%rsp),%ymm2,%ymm23
+    vpmuldq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmuldq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmuldq -8(%rax),%zmm28,%zmm9
+    vpmuldq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpmuldq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpmuldq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpmuldq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpmuldq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpunpcklqdq %zmm1,%zmm2,%zmm3
+    vpunpcklqdq %zmm17,%zmm28,%zmm9{%k1}
+    vpunpcklqdq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpunpcklqdq %ymm19,%ymm2,%ymm23
+    vpunpcklqdq %xmm1,%xmm30,%xmm18{%k1}
+    vpunpcklqdq (%rax),%zmm2,%zmm3
+    vpunpcklqdq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpunpcklqdq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpunpcklqdq -0x100(%rsp),%ymm2,%ymm23
+    vpunpcklqdq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpunpcklqdq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpunpcklqdq -8(%rax),%zmm28,%zmm9
+    vpunpcklqdq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpunpcklqdq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpunpcklqdq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpunpcklqdq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpunpcklqdq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpunpckhqdq %zmm1,%zmm2,%zmm3
+    vpunpckhqdq %zmm17,%zmm28,%zmm9{%k1}
+    vpunpckhqdq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpunpckhqdq %ymm19,%ymm2,%ymm23
+    vpunpckhqdq %xmm1,%xmm30,%xmm18{%k1}
+    vpunpckhqdq (%rax),%zmm2,%zmm3
+    vpunpckhqdq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpunpckhqdq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpunpckhqdq -0x100(%rsp),%ymm2,%ymm23
+    vpunpckhqdq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpunpckhqdq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpunpckhqdq -8(%rax),%zmm28,%zmm9
+    vpunpckhqdq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpunpckhqdq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpunpckhqdq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpunpckhqdq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpunpckhqdq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpsllq $3,%zmm2,%zmm3
+    vpsllq $3,0x40(%rax),%zmm3
+    vpsllq $3,0x40(%rax){1to8},%zmm3
+    vpsllq %xmm4,%zmm2,%zmm3
+    vpsllq 0x10(%rax),%zmm2,%zmm3
+    vpsllq 0x40(%rax),%zmm2,%zmm3
+    vpsllq $3,%zmm28,%zmm9{%k1}
+    vpsllq $3,0x40(%rax),%zmm9
+    vpsllq $3,0x40(%rax){1to8},%zmm9
+    vpsllq %xmm4,%zmm28,%zmm9{%k1}
+    vpsllq 0x10(%rax),%zmm28,%zmm9
+    vpsllq 0x40(%rax),%zmm28,%zmm9
+    vpsllq $3,%zmm16,%zmm0{%k2}{z}
+    vpsllq $3,0x40(%rax),%zmm0
+    vpsllq $3,0x40(%rax){1to8},%zmm0
+    vpsllq %xmm4,%zmm16,%zmm0{%k2}{z}
+    vpsllq 0x10(%rax),%zmm16,%zmm0
+    vpsllq 0x40(%rax),%zmm16,%zmm0
+    vpsllq $3,%ymm2,%ymm23
+    vpsllq $3,0x40(%rax),%ymm23
+    vpsllq $3,0x40(%rax){1to4},%ymm23
+    vpsllq %xmm4,%ymm2,%ymm23
+    vpsllq 0x10(%rax),%ymm2,%ymm23
+    vpsllq 0x40(%rax),%ymm2,%ymm23
+    vpsllq $3,%xmm30,%xmm18{%k1}
+    vpsllq $3,0x40(%rax),%xmm18
+    vpsllq $3,0x40(%rax){1to2},%xmm18
+    vpsllq %xmm4,%xmm30,%xmm18{%k1}
+    vpsllq 0x10(%rax),%xmm30,%xmm18
+    vpsllq 0x40(%rax),%xmm30,%xmm18
+    vpsrlq $3,%zmm2,%zmm3
+    vpsrlq $3,0x40(%rax),%zmm3
+    vpsrlq $3,0x40(%rax){1to8},%zmm3
+    vpsrlq %xmm4,%zmm2,%zmm3
+    vpsrlq 0x10(%rax),%zmm2,%zmm3
+    vpsrlq 0x40(%rax),%zmm2,%zmm3
+    vpsrlq $3,%zmm28,%zmm9{%k1}
+    vpsrlq $3,0x40(%rax),%zmm9
+    vpsrlq $3,0x40(%rax){1to8},%zmm9
+    vpsrlq %xmm4,%zmm28,%zmm9{%k1}
+    vpsrlq 0x10(%rax),%zmm28,%zmm9
+    vpsrlq 0x40(%rax),%zmm28,%zmm9
+    vpsrlq $3,%zmm16,%zmm0{%k2}{z}
+    vpsrlq $3,0x40(%rax),%zmm0
+    vpsrlq $3,0x40(%rax){1to8},%zmm0
+    vpsrlq %xmm4,%zmm16,%zmm0{%k2}{z}
+    vpsrlq 0x10(%rax),%zmm16,%zmm0
+    vpsrlq 0x40(%rax),%zmm16,%zmm0
+    vpsrlq $3,%ymm2,%ymm23
+    vpsrlq $3,0x40(%rax),%ymm23
+    vpsrlq $3,0x40(%rax){1to4},%ymm23
+    vpsrlq %xmm4,%ymm2,%ymm23
+    vpsrlq 0x10(%rax),%ymm2,%ymm23
+    vpsrlq 0x40(%rax),%ymm2,%ymm23
+    vpsrlq $3,%xmm30,%xmm18{%k1}
+    vpsrlq $3,0x40(%rax),%xmm18
+    vpsrlq $3,0x40(%rax){1to2},%xmm18
+    vpsrlq %xmm4,%xmm30,%xmm18{%k1}
+    vpsrlq 0x10(%rax),%xmm30,%xmm18
+    vpsrlq 0x40(%rax),%xmm30,%xmm18
+    vpsllvq %zmm1,%zmm2,%zmm3
+    vpsllvq %zmm17,%zmm28,%zmm9{%k1}
+    vpsllvq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsllvq %ymm19,%ymm2,%ymm23
+    vpsllvq %xmm1,%xmm30,%xmm18{%k1}
+    vpsllvq (%rax),%zmm2,%zmm3
+    vpsllvq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsllvq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsllvq -0x100(%rsp),%ymm2,%ymm23
+    vpsllvq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsllvq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsllvq -8(%rax),%zmm28,%zmm9
+    vpsllvq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpsllvq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpsllvq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpsllvq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpsllvq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpsrlvq %zmm1,%zmm2,%zmm3
+    vpsrlvq %zmm17,%zmm28,%zmm9{%k1}
+    vpsrlvq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsrlvq %ymm19,%ymm2,%ymm23
+    vpsrlvq %xmm1,%xmm30,%xmm18{%k1}
+    vpsrlvq (%rax),%zmm2,%zmm3
+    vpsrlvq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsrlvq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsrlvq -0x100(%rsp),%ymm2,%ymm23
+    vpsrlvq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsrlvq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsrlvq -8(%rax),%zmm28,%zmm9
+    vpsrlvq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpsrlvq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpsrlvq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpsrlvq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpsrlvq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpermq $3,%zmm1,%zmm3
+    vpermq $3,%zmm17,%zmm9{%k1}
+    vpermq $3,%zmm31,%zmm0{%k2}{z}
+    vpermq $3,%ymm19,%ymm23
+    vpermq $0x1b,(%rax),%zmm3
+    vpermq $0x1b,0x40(%rax),%zmm9{%k1}
+    vpermq $0x1b,0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vpermq $0x1b,-0x100(%rsp),%ymm23
+    vpermq $0x1b,0x44(%rax),%zmm3{%k1}
+    vpermq $0x1b,0x1000(%r9,%r10,2),%zmm9{%k2}{z}
+    vpermq $0x1b,-8(%rax),%zmm0
+    vpermq $1,0x40(%rax){1to8},%zmm3
+    vpermq $1,0x40(%rax){1to8},%zmm9
+    vpermq $1,0x40(%rax){1to8},%zmm0
+    vpermq $1,0x40(%rax){1to4},%ymm23
+    vpermpd $3,%zmm1,%zmm3
+    vpermpd $3,%zmm17,%zmm9{%k1}
+    vpermpd $3,%zmm31,%zmm0{%k2}{z}
+    vpermpd $3,%ymm19,%ymm23
+    vpermpd $0x1b,(%rax),%zmm3
+    vpermpd $0x1b,0x40(%rax),%zmm9{%k1}
+    vpermpd $0x1b,0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vpermpd $0x1b,-0x100(%rsp),%ymm23
+    vpermpd $0x1b,0x44(%rax),%zmm3{%k1}
+    vpermpd $0x1b,0x1000(%r9,%r10,2),%zmm9{%k2}{z}
+    vpermpd $0x1b,-8(%rax),%zmm0
+    vpermpd $1,0x40(%rax){1to8},%zmm3
+    vpermpd $1,0x40(%rax){1to8},%zmm9
+    vpermpd $1,0x40(%rax){1to8},%zmm0
+    vpermpd $1,0x40(%rax){1to4},%ymm23
+    vpermilpd $3,%zmm1,%zmm3
+    vpermilpd $3,%zmm17,%zmm9{%k1}
+    vpermilpd $3,%zmm31,%zmm0{%k2}{z}
+    vpermilpd $3,%ymm19,%ymm23
+    vpermilpd $3,%xmm1,%xmm18{%k1}
+    vpermilpd $0x1b,(%rax),%zmm3
+    vpermilpd $0x1b,0x40(%rax),%zmm9{%k1}
+    vpermilpd $0x1b,0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vpermilpd $0x1b,-0x100(%rsp),%ymm23
+    vpermilpd $0x1b,0x44(%rax),%xmm18{%k1}
+    vpermilpd $0x1b,0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vpermilpd $0x1b,-8(%rax),%zmm9
+    vpermilpd $1,0x40(%rax){1to8},%zmm3
+    vpermilpd $1,0x40(%rax){1to8},%zmm9
+    vpermilpd $1,0x40(%rax){1to8},%zmm0
+    vpermilpd $1,0x40(%rax){1to4},%ymm23
+    vpermilpd $1,0x40(%rax){1to2},%xmm18
+    vpermilpd %zmm1,%zmm2,%zmm3
+    vpermilpd %zmm17,%zmm28,%zmm9{%k1}
+    vpermilpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpermilpd %ymm19,%ymm2,%ymm23
+    vpermilpd %xmm1,%xmm30,%xmm18{%k1}
+    vpermilpd 0x40(%rax){1to8},%zmm2,%zmm3
+    vpermilpd 0x40(%rax){1to8},%zmm28,%zmm9
+    vpermilpd 0x40(%rax){1to8},%zmm16,%zmm0
+    vpermilpd 0x40(%rax){1to4},%ymm2,%ymm23
+    vpermilpd 0x40(%rax){1to2},%xmm30,%xmm18
+    vpcmpeqq %zmm1,%zmm2,%k1
+    vpcmpeqq %zmm17,%zmm28,%k2{%k3}
+    vpcmpeqq %zmm31,%zmm16,%k3
+    vpcmpeqq %ymm19,%ymm2,%k4{%k3}
+    vpcmpeqq %xmm1,%xmm30,%k5
+    vpcmpeqq (%rax),%zmm2,%k1
+    vpcmpeqq 0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpeqq 0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpeqq -0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpeqq 0x44(%rax),%xmm30,%k5
+    vpcmpeqq 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpeqq -8(%rax),%zmm28,%k7
+    vpcmpeqq 0x40(%rax){1to8},%zmm2,%k2{%k3}
+    vpcmpeqq 0x40(%rax){1to8},%zmm28,%k2{%k3}
+    vpcmpeqq 0x40(%rax){1to8},%zmm16,%k2{%k3}
+    vpcmpeqq 0x40(%rax){1to4},%ymm2,%k2{%k3}
+    vpcmpeqq 0x40(%rax){1to2},%xmm30,%k2{%k3}
+    vpcmpgtq %zmm1,%zmm2,%k1
+    vpcmpgtq %zmm17,%zmm28,%k2{%k3}
+    vpcmpgtq %zmm31,%zmm16,%k3
+    vpcmpgtq %ymm19,%ymm2,%k4{%k3}
+    vpcmpgtq %xmm1,%xmm30,%k5
+    vpcmpgtq (%rax),%zmm2,%k1
+    vpcmpgtq 0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpgtq 0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpgtq -0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpgtq 0x44(%rax),%xmm30,%k5
+    vpcmpgtq 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpgtq -8(%rax),%zmm28,%k7
+    vpcmpgtq 0x40(%rax){1to8},%zmm2,%k2{%k3}
+    vpcmpgtq 0x40(%rax){1to8},%zmm28,%k2{%k3}
+    vpcmpgtq 0x40(%rax){1to8},%zmm16,%k2{%k3}
+    vpcmpgtq 0x40(%rax){1to4},%ymm2,%k2{%k3}
+    vpcmpgtq 0x40(%rax){1to2},%xmm30,%k2{%k3}
+    vcvtpd2ps %zmm1,%ymm20
+    vcvtpd2ps 0x40(%rax),%ymm20{%k1}
+    vcvtpd2ps -0x20(%rax),%ymm20
+    vcvtpd2ps %ymm17,%xmm3{%k1}
+    vcvtpd2ps 8(%rax){1to8},%ymm20
+    vcvtpd2ps 8(%rax){1to4},%xmm3
+    vcvtpd2dq %zmm1,%ymm20
+    vcvtpd2dq 0x40(%rax),%ymm20{%k1}
+    vcvtpd2dq -0x20(%rax),%ymm20
+    vcvtpd2dq %ymm17,%xmm3{%k1}
+    vcvtpd2dq 8(%rax){1to8},%ymm20
+    vcvtpd2dq 8(%rax){1to4},%xmm3
+    vcvttpd2dq %zmm1,%ymm20
+    vcvttpd2dq 0x40(%rax),%ymm20{%k1}
+    vcvttpd2dq -0x20(%rax),%ymm20
+    vcvttpd2dq %ymm17,%xmm3{%k1}
+    vcvttpd2dq 8(%rax){1to8},%ymm20
+    vcvttpd2dq 8(%rax){1to4},%xmm3
+    vcvtps2pd %ymm17,%zmm2
+    vcvtps2pd 0x40(%rax),%zmm2{%k1}
+    vcvtps2pd -0x20(%rax),%zmm2
+    vcvtps2pd %xmm3,%ymm29{%k1}
+    vcvtps2pd 0x40(%rax),%ymm29{%k2}{z}
+    vcvtps2pd -0x20(%rax),%ymm29
+    vcvtps2pd %xmm9,%xmm16{%k2}{z}
+    vcvtps2pd 0x40(%rax),%xmm16
+    vcvtps2pd -0x20(%rax),%xmm16
+    vcvtps2pd 8(%rax){1to8},%zmm2
+    vcvtps2pd 8(%rax){1to4},%ymm29
+    vcvtps2pd 8(%rax){1to2},%xmm16
+    vcvtdq2pd %ymm17,%zmm2
+    vcvtdq2pd 0x40(%rax),%zmm2{%k1}
+    vcvtdq2pd -0x20(%rax),%zmm2
+    vcvtdq2pd %xmm3,%ymm29{%k1}
+    vcvtdq2pd 0x40(%rax),%ymm29{%k2}{z}
+    vcvtdq2pd -0x20(%rax),%ymm29
+    vcvtdq2pd %xmm9,%xmm16{%k2}{z}
+    vcvtdq2pd 0x40(%rax),%xmm16
+    vcvtdq2pd -0x20(%rax),%xmm16
+    vcvtdq2pd 8(%rax){1to8},%zmm2
+    vcvtdq2pd 8(%rax){1to4},%ymm29
+    vcvtdq2pd 8(%rax){1to2},%xmm16
+    vpmovsxbw %ymm17,%zmm2
+    vpmovsxbw 0x40(%rax),%zmm2{%k1}
+    vpmovsxbw -0x20(%rax),%zmm2
+    vpmovsxbw %xmm3,%ymm29{%k1}
+    vpmovsxbw 0x40(%rax),%ymm29{%k2}{z}
+    vpmovsxbw -0x20(%rax),%ymm29
+    vpmovsxbw %xmm9,%xmm16{%k2}{z}
+    vpmovsxbw 0x40(%rax),%xmm16
+    vpmovsxbw -0x20(%rax),%xmm16
+    vpmovsxbd %xmm17,%zmm2
+    vpmovsxbd 0x40(%rax),%zmm2{%k1}
+    vpmovsxbd -0x20(%rax),%zmm2
+    vpmovsxbd %xmm3,%ymm29{%k1}
+    vpmovsxbd 0x40(%rax),%ymm29{%k2}{z}
+    vpmovsxbd -0x20(%rax),%ymm29
+    vpmovsxbd %xmm9,%xmm16{%k2}{z}
+    vpmovsxbd 0x40(%rax),%xmm16
+    vpmovsxbd -0x20(%rax),%xmm16
+    vpmovsxbq %xmm17,%zmm2
+    vpmovsxbq 0x40(%rax),%zmm2{%k1}
+    vpmovsxbq -0x20(%rax),%zmm2
+    vpmovsxbq %xmm3,%ymm29{%k1}
+    vpmovsxbq 0x40(%rax),%ymm29{%k2}{z}
+    vpmovsxbq -0x20(%rax),%ymm29
+    vpmovsxbq %xmm9,%xmm16{%k2}{z}
+    vpmovsxbq 0x40(%rax),%xmm16
+    vpmovsxbq -0x20(%rax),%xmm16
+    vpmovsxwd %ymm17,%zmm2
+    vpmovsxwd 0x40(%rax),%zmm2{%k1}
+    vpmovsxwd -0x20(%rax),%zmm2
+    vpmovsxwd %xmm3,%ymm29{%k1}
+    vpmovsxwd 0x40(%rax),%ymm29{%k2}{z}
+    vpmovsxwd -0x20(%rax),%ymm29
+    vpmovsxwd %xmm9,%xmm16{%k2}{z}
+    vpmovsxwd 0x40(%rax),%xmm16
+    vpmovsxwd -0x20(%rax),%xmm16
+    vpmovsxwq %xmm17,%zmm2
+    vpmovsxwq 0x40(%rax),%zmm2{%k1}
+    vpmovsxwq -0x20(%rax),%zmm2
+    vpmovsxwq %xmm3,%ymm29{%k1}
+    vpmovsxwq 0x40(%rax),%ymm29{%k2}{z}
+    vpmovsxwq -0x20(%rax),%ymm29
+    vpmovsxwq %xmm9,%xmm16{%k2}{z}
+    vpmovsxwq 0x40(%rax),%xmm16
+    vpmovsxwq -0x20(%rax),%xmm16
+    vpmovsxdq %ymm17,%zmm2
+    vpmovsxdq 0x40(%rax),%zmm2{%k1}
+    vpmovsxdq -0x20(%rax),%zmm2
+    vpmovsxdq %xmm3,%ymm29{%k1}
+    vpmovsxdq 0x40(%rax),%ymm29{%k2}{z}
+    vpmovsxdq -0x20(%rax),%ymm29
+    vpmovsxdq %xmm9,%xmm16{%k2}{z}
+    vpmovsxdq 0x40(%rax),%xmm16
+    vpmovsxdq -0x20(%rax),%xmm16
+    vpmovzxbw %ymm17,%zmm2
+    vpmovzxbw 0x40(%rax),%zmm2{%k1}
+    vpmovzxbw -0x20(%rax),%zmm2
+    vpmovzxbw %xmm3,%ymm29{%k1}
+    vpmovzxbw 0x40(%rax),%ymm29{%k2}{z}
+    vpmovzxbw -0x20(%rax),%ymm29
+    vpmovzxbw %xmm9,%xmm16{%k2}{z}
+    vpmovzxbw 0x40(%rax),%xmm16
+    vpmovzxbw -0x20(%rax),%xmm16
+    vpmovzxbd %xmm17,%zmm2
+    vpmovzxbd 0x40(%rax),%zmm2{%k1}
+    vpmovzxbd -0x20(%rax),%zmm2
+    vpmovzxbd %xmm3,%ymm29{%k1}
+    vpmovzxbd 0x40(%rax),%ymm29{%k2}{z}
+    vpmovzxbd -0x20(%rax),%ymm29
+    vpmovzxbd %xmm9,%xmm16{%k2}{z}
+    vpmovzxbd 0x40(%rax),%xmm16
+    vpmovzxbd -0x20(%rax),%xmm16
+    vpmovzxbq %xmm17,%zmm2
+    vpmovzxbq 0x40(%rax),%zmm2{%k1}
+    vpmovzxbq -0x20(%rax),%zmm2
+    vpmovzxbq %xmm3,%ymm29{%k1}
+    vpmovzxbq 0x40(%rax),%ymm29{%k2}{z}
+    vpmovzxbq -0x20(%rax),%ymm29
+    vpmovzxbq %xmm9,%xmm16{%k2}{z}
+    vpmovzxbq 0x40(%rax),%xmm16
+    vpmovzxbq -0x20(%rax),%xmm16
+    vpmovzxwd %ymm17,%zmm2
+    vpmovzxwd 0x40(%rax),%zmm2{%k1}
+    vpmovzxwd -0x20(%rax),%zmm2
+    vpmovzxwd %xmm3,%ymm29{%k1}
+    vpmovzxwd 0x40(%rax),%ymm29{%k2}{z}
+    vpmovzxwd -0x20(%rax),%ymm29
+    vpmovzxwd %xmm9,%xmm16{%k2}{z}
+    vpmovzxwd 0x40(%rax),%xmm16
+    vpmovzxwd -0x20(%rax),%xmm16
+    vpmovzxwq %xmm17,%zmm2
+    vpmovzxwq 0x40(%rax),%zmm2{%k1}
+    vpmovzxwq -0x20(%rax),%zmm2
+    vpmovzxwq %xmm3,%ymm29{%k1}
+    vpmovzxwq 0x40(%rax),%ymm29{%k2}{z}
+    vpmovzxwq -0x20(%rax),%ymm29
+    vpmovzxwq %xmm9,%xmm16{%k2}{z}
+    vpmovzxwq 0x40(%rax),%xmm16
+    vpmovzxwq -0x20(%rax),%xmm16
+    vpmovzxdq %ymm17,%zmm2
+    vpmovzxdq 0x40(%rax),%zmm2{%k1}
+    vpmovzxdq -0x20(%rax),%zmm2
+    vpmovzxdq %xmm3,%ymm29{%k1}
+    vpmovzxdq 0x40(%rax),%ymm29{%k2}{z}
+    vpmovzxdq -0x20(%rax),%ymm29
+    vpmovzxdq %xmm9,%xmm16{%k2}{z}
+    vpmovzxdq 0x40(%rax),%xmm16
+    vpmovzxdq -0x20(%rax),%xmm16
+    vfmadd132ps %zmm1,%zmm2,%zmm3
+    vfmadd132ps %zmm17,%zmm28,%zmm9{%k1}
+    vfmadd132ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmadd132ps %ymm19,%ymm2,%ymm23
+    vfmadd132ps %xmm1,%xmm30,%xmm18{%k1}
+    vfmadd132ps (%rax),%zmm2,%zmm3
+    vfmadd132ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmadd132ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmadd132ps -0x100(%rsp),%ymm2,%ymm23
+    vfmadd132ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmadd132ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmadd132ps -8(%rax),%zmm28,%zmm9
+    vfmadd132ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfmadd132ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfmadd132ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfmadd132ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfmadd132ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfmadd132ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmadd132pd %zmm1,%zmm2,%zmm3
+    vfmadd132pd %zmm17,%zmm28,%zmm9{%k1}
+    vfmadd132pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmadd132pd %ymm19,%ymm2,%ymm23
+    vfmadd132pd %xmm1,%xmm30,%xmm18{%k1}
+    vfmadd132pd (%rax),%zmm2,%zmm3
+    vfmadd132pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmadd132pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmadd132pd -0x100(%rsp),%ymm2,%ymm23
+    vfmadd132pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmadd132pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmadd132pd -8(%rax),%zmm28,%zmm9
+    vfmadd132pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfmadd132pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfmadd132pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfmadd132pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfmadd132pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfmadd132pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmadd132ss %xmm1,%xmm17,%xmm30
+    vfmadd132ss %xmm20,%xmm2,%xmm9{%k1}
+    vfmadd132ss (%rax),%xmm17,%xmm30
+    vfmadd132ss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfmadd132ss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfmadd132ss -0x100(%rsp),%xmm2,%xmm9
+    vfmadd132ss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfmadd132ss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfmadd132ss -8(%rax),%xmm17,%xmm30
+    vfmadd132ss {rz-sae},%xmm1,%xmm17,%xmm30
+    vfmadd132sd %xmm1,%xmm17,%xmm30
+    vfmadd132sd %xmm20,%xmm2,%xmm9{%k1}
+    vfmadd132sd (%rax),%xmm17,%xmm30
+    vfmadd132sd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfmadd132sd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfmadd132sd -0x100(%rsp),%xmm2,%xmm9
+    vfmadd132sd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfmadd132sd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfmadd132sd -8(%rax),%xmm17,%xmm30
+    vfmadd132sd {rz-sae},%xmm1,%xmm17,%xmm30
+    vfmadd213ps %zmm1,%zmm2,%zmm3
+    vfmadd213ps %zmm17,%zmm28,%zmm9{%k1}
+    vfmadd213ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmadd213ps %ymm19,%ymm2,%ymm23
+    vfmadd213ps %xmm1,%xmm30,%xmm18{%k1}
+    vfmadd213ps (%rax),%zmm2,%zmm3
+    vfmadd213ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmadd213ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmadd213ps -0x100(%rsp),%ymm2,%ymm23
+    vfmadd213ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmadd213ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmadd213ps -8(%rax),%zmm28,%zmm9
+    vfmadd213ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfmadd213ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfmadd213ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfmadd213ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfmadd213ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfmadd213ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmadd213pd %zmm1,%zmm2,%zmm3
+    vfmadd213pd %zmm17,%zmm28,%zmm9{%k1}
+    vfmadd213pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmadd213pd %ymm19,%ymm2,%ymm23
+    vfmadd213pd %xmm1,%xmm30,%xmm18{%k1}
+    vfmadd213pd (%rax),%zmm2,%zmm3
+    vfmadd213pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmadd213pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmadd213pd -0x100(%rsp),%ymm2,%ymm23
+    vfmadd213pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmadd213pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmadd213pd -8(%rax),%zmm28,%zmm9
+    vfmadd213pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfmadd213pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfmadd213pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfmadd213pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfmadd213pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfmadd213pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmadd213ss %xmm1,%xmm17,%xmm30
+    vfmadd213ss %xmm20,%xmm2,%xmm9{%k1}
+    vfmadd213ss (%rax),%xmm17,%xmm30
+    vfmadd213ss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfmadd213ss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfmadd213ss -0x100(%rsp),%xmm2,%xmm9
+    vfmadd213ss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfmadd213ss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfmadd213ss -8(%rax),%xmm17,%xmm30
+    vfmadd213ss {rz-sae},%xmm1,%xmm17,%xmm30
+    vfmadd213sd %xmm1,%xmm17,%xmm30
+    vfmadd213sd %xmm20,%xmm2,%xmm9{%k1}
+    vfmadd213sd (%rax),%xmm17,%xmm30
+    vfmadd213sd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfmadd213sd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfmadd213sd -0x100(%rsp),%xmm2,%xmm9
+    vfmadd213sd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfmadd213sd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfmadd213sd -8(%rax),%xmm17,%xmm30
+    vfmadd213sd {rz-sae},%xmm1,%xmm17,%xmm30
+    vfmadd231ps %zmm1,%zmm2,%zmm3
+    vfmadd231ps %zmm17,%zmm28,%zmm9{%k1}
+    vfmadd231ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmadd231ps %ymm19,%ymm2,%ymm23
+    vfmadd231ps %xmm1,%xmm30,%xmm18{%k1}
+    vfmadd231ps (%rax),%zmm2,%zmm3
+    vfmadd231ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmadd231ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmadd231ps -0x100(%rsp),%ymm2,%ymm23
+    vfmadd231ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmadd231ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmadd231ps -8(%rax),%zmm28,%zmm9
+    vfmadd231ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfmadd231ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfmadd231ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfmadd231ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfmadd231ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfmadd231ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmadd231pd %zmm1,%zmm2,%zmm3
+    vfmadd231pd %zmm17,%zmm28,%zmm9{%k1}
+    vfmadd231pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmadd231pd %ymm19,%ymm2,%ymm23
+    vfmadd231pd %xmm1,%xmm30,%xmm18{%k1}
+    vfmadd231pd (%rax),%zmm2,%zmm3
+    vfmadd231pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmadd231pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmadd231pd -0x100(%rsp),%ymm2,%ymm23
+    vfmadd231pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmadd231pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmadd231pd -8(%rax),%zmm28,%zmm9
+    vfmadd231pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfmadd231pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfmadd231pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfmadd231pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfmadd231pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfmadd231pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmadd231ss %xmm1,%xmm17,%xmm30
+    vfmadd231ss %xmm20,%xmm2,%xmm9{%k1}
+    vfmadd231ss (%rax),%xmm17,%xmm30
+    vfmadd231ss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfmadd231ss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfmadd231ss -0x100(%rsp),%xmm2,%xmm9
+    vfmadd231ss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfmadd231ss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfmadd231ss -8(%rax),%xmm17,%xmm30
+    vfmadd231ss {rz-sae},%xmm1,%xmm17,%xmm30
+    vfmadd231sd %xmm1,%xmm17,%xmm30
+    vfmadd231sd %xmm20,%xmm2,%xmm9{%k1}
+    vfmadd231sd (%rax),%xmm17,%xmm30
+    vfmadd231sd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfmadd231sd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfmadd231sd -0x100(%rsp),%xmm2,%xmm9
+    vfmadd231sd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfmadd231sd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfmadd231sd -8(%rax),%xmm17,%xmm30
+    vfmadd231sd {rz-sae},%xmm1,%xmm17,%xmm30
+    vfmsub132ps %zmm1,%zmm2,%zmm3
+    vfmsub132ps %zmm17,%zmm28,%zmm9{%k1}
+    vfmsub132ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmsub132ps %ymm19,%ymm2,%ymm23
+    vfmsub132ps %xmm1,%xmm30,%xmm18{%k1}
+    vfmsub132ps (%rax),%zmm2,%zmm3
+    vfmsub132ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmsub132ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmsub132ps -0x100(%rsp),%ymm2,%ymm23
+    vfmsub132ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmsub132ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmsub132ps -8(%rax),%zmm28,%zmm9
+    vfmsub132ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfmsub132ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfmsub132ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfmsub132ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfmsub132ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfmsub132ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmsub132pd %zmm1,%zmm2,%zmm3
+    vfmsub132pd %zmm17,%zmm28,%zmm9{%k1}
+    vfmsub132pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmsub132pd %ymm19,%ymm2,%ymm23
+    vfmsub132pd %xmm1,%xmm30,%xmm18{%k1}
+    vfmsub132pd (%rax),%zmm2,%zmm3
+    vfmsub132pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmsub132pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmsub132pd -0x100(%rsp),%ymm2,%ymm23
+    vfmsub132pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmsub132pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmsub132pd -8(%rax),%zmm28,%zmm9
+    vfmsub132pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfmsub132pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfmsub132pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfmsub132pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfmsub132pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfmsub132pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmsub132ss %xmm1,%xmm17,%xmm30
+    vfmsub132ss %xmm20,%xmm2,%xmm9{%k1}
+    vfmsub132ss (%rax),%xmm17,%xmm30
+    vfmsub132ss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfmsub132ss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfmsub132ss -0x100(%rsp),%xmm2,%xmm9
+    vfmsub132ss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfmsub132ss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfmsub132ss -8(%rax),%xmm17,%xmm30
+    vfmsub132ss {rz-sae},%xmm1,%xmm17,%xmm30
+    vfmsub132sd %xmm1,%xmm17,%xmm30
+    vfmsub132sd %xmm20,%xmm2,%xmm9{%k1}
+    vfmsub132sd (%rax),%xmm17,%xmm30
+    vfmsub132sd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfmsub132sd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfmsub132sd -0x100(%rsp),%xmm2,%xmm9
+    vfmsub132sd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfmsub132sd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfmsub132sd -8(%rax),%xmm17,%xmm30
+    vfmsub132sd {rz-sae},%xmm1,%xmm17,%xmm30
+    vfmsub213ps %zmm1,%zmm2,%zmm3
+    vfmsub213ps %zmm17,%zmm28,%zmm9{%k1}
+    vfmsub213ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmsub213ps %ymm19,%ymm2,%ymm23
+    vfmsub213ps %xmm1,%xmm30,%xmm18{%k1}
+    vfmsub213ps (%rax),%zmm2,%zmm3
+    vfmsub213ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmsub213ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmsub213ps -0x100(%rsp),%ymm2,%ymm23
+    vfmsub213ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmsub213ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmsub213ps -8(%rax),%zmm28,%zmm9
+    vfmsub213ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfmsub213ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfmsub213ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfmsub213ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfmsub213ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfmsub213ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmsub213pd %zmm1,%zmm2,%zmm3
+    vfmsub213pd %zmm17,%zmm28,%zmm9{%k1}
+    vfmsub213pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmsub213pd %ymm19,%ymm2,%ymm23
+    vfmsub213pd %xmm1,%xmm30,%xmm18{%k1}
+    vfmsub213pd (%rax),%zmm2,%zmm3
+    vfmsub213pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmsub213pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmsub213pd -0x100(%rsp),%ymm2,%ymm23
+    vfmsub213pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmsub213pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmsub213pd -8(%rax),%zmm28,%zmm9
+    vfmsub213pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfmsub213pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfmsub213pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfmsub213pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfmsub213pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfmsub213pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmsub213ss %xmm1,%xmm17,%xmm30
+    vfmsub213ss %xmm20,%xmm2,%xmm9{%k1}
+    vfmsub213ss (%rax),%xmm17,%xmm30
+    vfmsub213ss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfmsub213ss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfmsub213ss -0x100(%rsp),%xmm2,%xmm9
+    vfmsub213ss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfmsub213ss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfmsub213ss -8(%rax),%xmm17,%xmm30
+    vfmsub213ss {rz-sae},%xmm1,%xmm17,%xmm30
+    vfmsub213sd %xmm1,%xmm17,%xmm30
+    vfmsub213sd %xmm20,%xmm2,%xmm9{%k1}
+    vfmsub213sd (%rax),%xmm17,%xmm30
+    vfmsub213sd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfmsub213sd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfmsub213sd -0x100(%rsp),%xmm2,%xmm9
+    vfmsub213sd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfmsub213sd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfmsub213sd -8(%rax),%xmm17,%xmm30
+    vfmsub213sd {rz-sae},%xmm1,%xmm17,%xmm30
+    vfmsub231ps %zmm1,%zmm2,%zmm3
+    vfmsub231ps %zmm17,%zmm28,%zmm9{%k1}
+    vfmsub231ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmsub231ps %ymm19,%ymm2,%ymm23
+    vfmsub231ps %xmm1,%xmm30,%xmm18{%k1}
+    vfmsub231ps (%rax),%zmm2,%zmm3
+    vfmsub231ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmsub231ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmsub231ps -0x100(%rsp),%ymm2,%ymm23
+    vfmsub231ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmsub231ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmsub231ps -8(%rax),%zmm28,%zmm9
+    vfmsub231ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfmsub231ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfmsub231ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfmsub231ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfmsub231ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfmsub231ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmsub231pd %zmm1,%zmm2,%zmm3
+    vfmsub231pd %zmm17,%zmm28,%zmm9{%k1}
+    vfmsub231pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmsub231pd %ymm19,%ymm2,%ymm23
+    vfmsub231pd %xmm1,%xmm30,%xmm18{%k1}
+    vfmsub231pd (%rax),%zmm2,%zmm3
+    vfmsub231pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmsub231pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmsub231pd -0x100(%rsp),%ymm2,%ymm23
+    vfmsub231pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmsub231pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmsub231pd -8(%rax),%zmm28,%zmm9
+    vfmsub231pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfmsub231pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfmsub231pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfmsub231pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfmsub231pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfmsub231pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmsub231ss %xmm1,%xmm17,%xmm30
+    vfmsub231ss %xmm20,%xmm2,%xmm9{%k1}
+    vfmsub231ss (%rax),%xmm17,%xmm30
+    vfmsub231ss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfmsub231ss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfmsub231ss -0x100(%rsp),%xmm2,%xmm9
+    vfmsub231ss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfmsub231ss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfmsub231ss -8(%rax),%xmm17,%xmm30
+    vfmsub231ss {rz-sae},%xmm1,%xmm17,%xmm30
+    vfmsub231sd %xmm1,%xmm17,%xmm30
+    vfmsub231sd %xmm20,%xmm2,%xmm9{%k1}
+    vfmsub231sd (%rax),%xmm17,%xmm30
+    vfmsub231sd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfmsub231sd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfmsub231sd -0x100(%rsp),%xmm2,%xmm9
+    vfmsub231sd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfmsub231sd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfmsub231sd -8(%rax),%xmm17,%xmm30
+    vfmsub231sd {rz-sae},%xmm1,%xmm17,%xmm30
+    vfnmadd132ps %zmm1,%zmm2,%zmm3
+    vfnmadd132ps %zmm17,%zmm28,%zmm9{%k1}
+    vfnmadd132ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfnmadd132ps %ymm19,%ymm2,%ymm23
+    vfnmadd132ps %xmm1,%xmm30,%xmm18{%k1}
+    vfnmadd132ps (%rax),%zmm2,%zmm3
+    vfnmadd132ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfnmadd132ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfnmadd132ps -0x100(%rsp),%ymm2,%ymm23
+    vfnmadd132ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfnmadd132ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfnmadd132ps -8(%rax),%zmm28,%zmm9
+    vfnmadd132ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfnmadd132ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfnmadd132ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfnmadd132ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfnmadd132ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfnmadd132ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfnmadd132pd %zmm1,%zmm2,%zmm3
+    vfnmadd132pd %zmm17,%zmm28,%zmm9{%k1}
+    vfnmadd132pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfnmadd132pd %ymm19,%ymm2,%ymm23
+    vfnmadd132pd %xmm1,%xmm30,%xmm18{%k1}
+    vfnmadd132pd (%rax),%zmm2,%zmm3
+    vfnmadd132pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfnmadd132pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfnmadd132pd -0x100(%rsp),%ymm2,%ymm23
+    vfnmadd132pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfnmadd132pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfnmadd132pd -8(%rax),%zmm28,%zmm9
+    vfnmadd132pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfnmadd132pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfnmadd132pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfnmadd132pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfnmadd132pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfnmadd132pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfnmadd132ss %xmm1,%xmm17,%xmm30
+    vfnmadd132ss %xmm20,%xmm2,%xmm9{%k1}
+    vfnmadd132ss (%rax),%xmm17,%xmm30
+    vfnmadd132ss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfnmadd132ss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfnmadd132ss -0x100(%rsp),%xmm2,%xmm9
+    vfnmadd132ss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfnmadd132ss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfnmadd132ss -8(%rax),%xmm17,%xmm30
+    vfnmadd132ss {rz-sae},%xmm1,%xmm17,%xmm30
+    vfnmadd132sd %xmm1,%xmm17,%xmm30
+    vfnmadd132sd %xmm20,%xmm2,%xmm9{%k1}
+    vfnmadd132sd (%rax),%xmm17,%xmm30
+    vfnmadd132sd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfnmadd132sd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfnmadd132sd -0x100(%rsp),%xmm2,%xmm9
+    vfnmadd132sd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfnmadd132sd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfnmadd132sd -8(%rax),%xmm17,%xmm30
+    vfnmadd132sd {rz-sae},%xmm1,%xmm17,%xmm30
+    vfnmadd213ps %zmm1,%zmm2,%zmm3
+    vfnmadd213ps %zmm17,%zmm28,%zmm9{%k1}
+    vfnmadd213ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfnmadd213ps %ymm19,%ymm2,%ymm23
+    vfnmadd213ps %xmm1,%xmm30,%xmm18{%k1}
+    vfnmadd213ps (%rax),%zmm2,%zmm3
+    vfnmadd213ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfnmadd213ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfnmadd213ps -0x100(%rsp),%ymm2,%ymm23
+    vfnmadd213ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfnmadd213ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfnmadd213ps -8(%rax),%zmm28,%zmm9
+    vfnmadd213ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfnmadd213ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfnmadd213ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfnmadd213ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfnmadd213ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfnmadd213ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfnmadd213pd %zmm1,%zmm2,%zmm3
+    vfnmadd213pd %zmm17,%zmm28,%zmm9{%k1}
+    vfnmadd213pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfnmadd213pd %ymm19,%ymm2,%ymm23
+    vfnmadd213pd %xmm1,%xmm30,%xmm18{%k1}
+    vfnmadd213pd (%rax),%zmm2,%zmm3
+    vfnmadd213pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfnmadd213pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfnmadd213pd -0x100(%rsp),%ymm2,%ymm23
+    vfnmadd213pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfnmadd213pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfnmadd213pd -8(%rax),%zmm28,%zmm9
+    vfnmadd213pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfnmadd213pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfnmadd213pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfnmadd213pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfnmadd213pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfnmadd213pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfnmadd213ss %xmm1,%xmm17,%xmm30
+    vfnmadd213ss %xmm20,%xmm2,%xmm9{%k1}
+    vfnmadd213ss (%rax),%xmm17,%xmm30
+    vfnmadd213ss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfnmadd213ss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfnmadd213ss -0x100(%rsp),%xmm2,%xmm9
+    vfnmadd213ss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfnmadd213ss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfnmadd213ss -8(%rax),%xmm17,%xmm30
+    vfnmadd213ss {rz-sae},%xmm1,%xmm17,%xmm30
+    vfnmadd213sd %xmm1,%xmm17,%xmm30
+    vfnmadd213sd %xmm20,%xmm2,%xmm9{%k1}
+    vfnmadd213sd (%rax),%xmm17,%xmm30
+    vfnmadd213sd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfnmadd213sd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfnmadd213sd -0x100(%rsp),%xmm2,%xmm9
+    vfnmadd213sd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfnmadd213sd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfnmadd213sd -8(%rax),%xmm17,%xmm30
+    vfnmadd213sd {rz-sae},%xmm1,%xmm17,%xmm30
+    vfnmadd231ps %zmm1,%zmm2,%zmm3
+    vfnmadd231ps %zmm17,%zmm28,%zmm9{%k1}
+    vfnmadd231ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfnmadd231ps %ymm19,%ymm2,%ymm23
+    vfnmadd231ps %xmm1,%xmm30,%xmm18{%k1}
+    vfnmadd231ps (%rax),%zmm2,%zmm3
+    vfnmadd231ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfnmadd231ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfnmadd231ps -0x100(%rsp),%ymm2,%ymm23
+    vfnmadd231ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfnmadd231ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfnmadd231ps -8(%rax),%zmm28,%zmm9
+    vfnmadd231ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfnmadd231ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfnmadd231ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfnmadd231ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfnmadd231ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfnmadd231ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfnmadd231pd %zmm1,%zmm2,%zmm3
+    vfnmadd231pd %zmm17,%zmm28,%zmm9{%k1}
+    vfnmadd231pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfnmadd231pd %ymm19,%ymm2,%ymm23
+    vfnmadd231pd %xmm1,%xmm30,%xmm18{%k1}
+    vfnmadd231pd (%rax),%zmm2,%zmm3
+    vfnmadd231pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfnmadd231pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfnmadd231pd -0x100(%rsp),%ymm2,%ymm23
+    vfnmadd231pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfnmadd231pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfnmadd231pd -8(%rax),%zmm28,%zmm9
+    vfnmadd231pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfnmadd231pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfnmadd231pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfnmadd231pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfnmadd231pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfnmadd231pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfnmadd231ss %xmm1,%xmm17,%xmm30
+    vfnmadd231ss %xmm20,%xmm2,%xmm9{%k1}
+    vfnmadd231ss (%rax),%xmm17,%xmm30
+    vfnmadd231ss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfnmadd231ss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfnmadd231ss -0x100(%rsp),%xmm2,%xmm9
+    vfnmadd231ss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfnmadd231ss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfnmadd231ss -8(%rax),%xmm17,%xmm30
+    vfnmadd231ss {rz-sae},%xmm1,%xmm17,%xmm30
+    vfnmadd231sd %xmm1,%xmm17,%xmm30
+    vfnmadd231sd %xmm20,%xmm2,%xmm9{%k1}
+    vfnmadd231sd (%rax),%xmm17,%xmm30
+    vfnmadd231sd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfnmadd231sd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfnmadd231sd -0x100(%rsp),%xmm2,%xmm9
+    vfnmadd231sd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfnmadd231sd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfnmadd231sd -8(%rax),%xmm17,%xmm30
+    vfnmadd231sd {rz-sae},%xmm1,%xmm17,%xmm30
+    vfnmsub132ps %zmm1,%zmm2,%zmm3
+    vfnmsub132ps %zmm17,%zmm28,%zmm9{%k1}
+    vfnmsub132ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfnmsub132ps %ymm19,%ymm2,%ymm23
+    vfnmsub132ps %xmm1,%xmm30,%xmm18{%k1}
+    vfnmsub132ps (%rax),%zmm2,%zmm3
+    vfnmsub132ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfnmsub132ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfnmsub132ps -0x100(%rsp),%ymm2,%ymm23
+    vfnmsub132ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfnmsub132ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfnmsub132ps -8(%rax),%zmm28,%zmm9
+    vfnmsub132ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfnmsub132ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfnmsub132ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfnmsub132ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfnmsub132ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfnmsub132ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfnmsub132pd %zmm1,%zmm2,%zmm3
+    vfnmsub132pd %zmm17,%zmm28,%zmm9{%k1}
+    vfnmsub132pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfnmsub132pd %ymm19,%ymm2,%ymm23
+    vfnmsub132pd %xmm1,%xmm30,%xmm18{%k1}
+    vfnmsub132pd (%rax),%zmm2,%zmm3
+    vfnmsub132pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfnmsub132pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfnmsub132pd -0x100(%rsp),%ymm2,%ymm23
+    vfnmsub132pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfnmsub132pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfnmsub132pd -8(%rax),%zmm28,%zmm9
+    vfnmsub132pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfnmsub132pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfnmsub132pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfnmsub132pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfnmsub132pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfnmsub132pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfnmsub132ss %xmm1,%xmm17,%xmm30
+    vfnmsub132ss %xmm20,%xmm2,%xmm9{%k1}
+    vfnmsub132ss (%rax),%xmm17,%xmm30
+    vfnmsub132ss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfnmsub132ss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfnmsub132ss -0x100(%rsp),%xmm2,%xmm9
+    vfnmsub132ss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfnmsub132ss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfnmsub132ss -8(%rax),%xmm17,%xmm30
+    vfnmsub132ss {rz-sae},%xmm1,%xmm17,%xmm30
+    vfnmsub132sd %xmm1,%xmm17,%xmm30
+    vfnmsub132sd %xmm20,%xmm2,%xmm9{%k1}
+    vfnmsub132sd (%rax),%xmm17,%xmm30
+    vfnmsub132sd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfnmsub132sd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfnmsub132sd -0x100(%rsp),%xmm2,%xmm9
+    vfnmsub132sd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfnmsub132sd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfnmsub132sd -8(%rax),%xmm17,%xmm30
+    vfnmsub132sd {rz-sae},%xmm1,%xmm17,%xmm30
+    vfnmsub213ps %zmm1,%zmm2,%zmm3
+    vfnmsub213ps %zmm17,%zmm28,%zmm9{%k1}
+    vfnmsub213ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfnmsub213ps %ymm19,%ymm2,%ymm23
+    vfnmsub213ps %xmm1,%xmm30,%xmm18{%k1}
+    vfnmsub213ps (%rax),%zmm2,%zmm3
+    vfnmsub213ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfnmsub213ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfnmsub213ps -0x100(%rsp),%ymm2,%ymm23
+    vfnmsub213ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfnmsub213ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfnmsub213ps -8(%rax),%zmm28,%zmm9
+    vfnmsub213ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfnmsub213ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfnmsub213ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfnmsub213ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfnmsub213ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfnmsub213ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfnmsub213pd %zmm1,%zmm2,%zmm3
+    vfnmsub213pd %zmm17,%zmm28,%zmm9{%k1}
+    vfnmsub213pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfnmsub213pd %ymm19,%ymm2,%ymm23
+    vfnmsub213pd %xmm1,%xmm30,%xmm18{%k1}
+    vfnmsub213pd (%rax),%zmm2,%zmm3
+    vfnmsub213pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfnmsub213pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfnmsub213pd -0x100(%rsp),%ymm2,%ymm23
+    vfnmsub213pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfnmsub213pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfnmsub213pd -8(%rax),%zmm28,%zmm9
+    vfnmsub213pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfnmsub213pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfnmsub213pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfnmsub213pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfnmsub213pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfnmsub213pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfnmsub213ss %xmm1,%xmm17,%xmm30
+    vfnmsub213ss %xmm20,%xmm2,%xmm9{%k1}
+    vfnmsub213ss (%rax),%xmm17,%xmm30
+    vfnmsub213ss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfnmsub213ss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfnmsub213ss -0x100(%rsp),%xmm2,%xmm9
+    vfnmsub213ss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfnmsub213ss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfnmsub213ss -8(%rax),%xmm17,%xmm30
+    vfnmsub213ss {rz-sae},%xmm1,%xmm17,%xmm30
+    vfnmsub213sd %xmm1,%xmm17,%xmm30
+    vfnmsub213sd %xmm20,%xmm2,%xmm9{%k1}
+    vfnmsub213sd (%rax),%xmm17,%xmm30
+    vfnmsub213sd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfnmsub213sd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfnmsub213sd -0x100(%rsp),%xmm2,%xmm9
+    vfnmsub213sd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfnmsub213sd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfnmsub213sd -8(%rax),%xmm17,%xmm30
+    vfnmsub213sd {rz-sae},%xmm1,%xmm17,%xmm30
+    vfnmsub231ps %zmm1,%zmm2,%zmm3
+    vfnmsub231ps %zmm17,%zmm28,%zmm9{%k1}
+    vfnmsub231ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfnmsub231ps %ymm19,%ymm2,%ymm23
+    vfnmsub231ps %xmm1,%xmm30,%xmm18{%k1}
+    vfnmsub231ps (%rax),%zmm2,%zmm3
+    vfnmsub231ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfnmsub231ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfnmsub231ps -0x100(%rsp),%ymm2,%ymm23
+    vfnmsub231ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfnmsub231ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfnmsub231ps -8(%rax),%zmm28,%zmm9
+    vfnmsub231ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfnmsub231ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfnmsub231ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfnmsub231ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfnmsub231ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfnmsub231ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfnmsub231pd %zmm1,%zmm2,%zmm3
+    vfnmsub231pd %zmm17,%zmm28,%zmm9{%k1}
+    vfnmsub231pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfnmsub231pd %ymm19,%ymm2,%ymm23
+    vfnmsub231pd %xmm1,%xmm30,%xmm18{%k1}
+    vfnmsub231pd (%rax),%zmm2,%zmm3
+    vfnmsub231pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfnmsub231pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfnmsub231pd -0x100(%rsp),%ymm2,%ymm23
+    vfnmsub231pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfnmsub231pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfnmsub231pd -8(%rax),%zmm28,%zmm9
+    vfnmsub231pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfnmsub231pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfnmsub231pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfnmsub231pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfnmsub231pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfnmsub231pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfnmsub231ss %xmm1,%xmm17,%xmm30
+    vfnmsub231ss %xmm20,%xmm2,%xmm9{%k1}
+    vfnmsub231ss (%rax),%xmm17,%xmm30
+    vfnmsub231ss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfnmsub231ss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfnmsub231ss -0x100(%rsp),%xmm2,%xmm9
+    vfnmsub231ss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfnmsub231ss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfnmsub231ss -8(%rax),%xmm17,%xmm30
+    vfnmsub231ss {rz-sae},%xmm1,%xmm17,%xmm30
+    vfnmsub231sd %xmm1,%xmm17,%xmm30
+    vfnmsub231sd %xmm20,%xmm2,%xmm9{%k1}
+    vfnmsub231sd (%rax),%xmm17,%xmm30
+    vfnmsub231sd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vfnmsub231sd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vfnmsub231sd -0x100(%rsp),%xmm2,%xmm9
+    vfnmsub231sd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vfnmsub231sd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vfnmsub231sd -8(%rax),%xmm17,%xmm30
+    vfnmsub231sd {rz-sae},%xmm1,%xmm17,%xmm30
+    vfmaddsub132ps %zmm1,%zmm2,%zmm3
+    vfmaddsub132ps %zmm17,%zmm28,%zmm9{%k1}
+    vfmaddsub132ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmaddsub132ps %ymm19,%ymm2,%ymm23
+    vfmaddsub132ps %xmm1,%xmm30,%xmm18{%k1}
+    vfmaddsub132ps (%rax),%zmm2,%zmm3
+    vfmaddsub132ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmaddsub132ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmaddsub132ps -0x100(%rsp),%ymm2,%ymm23
+    vfmaddsub132ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmaddsub132ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmaddsub132ps -8(%rax),%zmm28,%zmm9
+    vfmaddsub132ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfmaddsub132ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfmaddsub132ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfmaddsub132ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfmaddsub132ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfmaddsub132ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmaddsub132pd %zmm1,%zmm2,%zmm3
+    vfmaddsub132pd %zmm17,%zmm28,%zmm9{%k1}
+    vfmaddsub132pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmaddsub132pd %ymm19,%ymm2,%ymm23
+    vfmaddsub132pd %xmm1,%xmm30,%xmm18{%k1}
+    vfmaddsub132pd (%rax),%zmm2,%zmm3
+    vfmaddsub132pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmaddsub132pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmaddsub132pd -0x100(%rsp),%ymm2,%ymm23
+    vfmaddsub132pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmaddsub132pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmaddsub132pd -8(%rax),%zmm28,%zmm9
+    vfmaddsub132pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfmaddsub132pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfmaddsub132pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfmaddsub132pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfmaddsub132pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfmaddsub132pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmaddsub213ps %zmm1,%zmm2,%zmm3
+    vfmaddsub213ps %zmm17,%zmm28,%zmm9{%k1}
+    vfmaddsub213ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmaddsub213ps %ymm19,%ymm2,%ymm23
+    vfmaddsub213ps %xmm1,%xmm30,%xmm18{%k1}
+    vfmaddsub213ps (%rax),%zmm2,%zmm3
+    vfmaddsub213ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmaddsub213ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmaddsub213ps -0x100(%rsp),%ymm2,%ymm23
+    vfmaddsub213ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmaddsub213ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmaddsub213ps -8(%rax),%zmm28,%zmm9
+    vfmaddsub213ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfmaddsub213ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfmaddsub213ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfmaddsub213ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfmaddsub213ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfmaddsub213ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmaddsub213pd %zmm1,%zmm2,%zmm3
+    vfmaddsub213pd %zmm17,%zmm28,%zmm9{%k1}
+    vfmaddsub213pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmaddsub213pd %ymm19,%ymm2,%ymm23
+    vfmaddsub213pd %xmm1,%xmm30,%xmm18{%k1}
+    vfmaddsub213pd (%rax),%zmm2,%zmm3
+    vfmaddsub213pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmaddsub213pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmaddsub213pd -0x100(%rsp),%ymm2,%ymm23
+    vfmaddsub213pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmaddsub213pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmaddsub213pd -8(%rax),%zmm28,%zmm9
+    vfmaddsub213pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfmaddsub213pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfmaddsub213pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfmaddsub213pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfmaddsub213pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfmaddsub213pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmaddsub231ps %zmm1,%zmm2,%zmm3
+    vfmaddsub231ps %zmm17,%zmm28,%zmm9{%k1}
+    vfmaddsub231ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmaddsub231ps %ymm19,%ymm2,%ymm23
+    vfmaddsub231ps %xmm1,%xmm30,%xmm18{%k1}
+    vfmaddsub231ps (%rax),%zmm2,%zmm3
+    vfmaddsub231ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmaddsub231ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmaddsub231ps -0x100(%rsp),%ymm2,%ymm23
+    vfmaddsub231ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmaddsub231ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmaddsub231ps -8(%rax),%zmm28,%zmm9
+    vfmaddsub231ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfmaddsub231ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfmaddsub231ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfmaddsub231ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfmaddsub231ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfmaddsub231ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmaddsub231pd %zmm1,%zmm2,%zmm3
+    vfmaddsub231pd %zmm17,%zmm28,%zmm9{%k1}
+    vfmaddsub231pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmaddsub231pd %ymm19,%ymm2,%ymm23
+    vfmaddsub231pd %xmm1,%xmm30,%xmm18{%k1}
+    vfmaddsub231pd (%rax),%zmm2,%zmm3
+    vfmaddsub231pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmaddsub231pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmaddsub231pd -0x100(%rsp),%ymm2,%ymm23
+    vfmaddsub231pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmaddsub231pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmaddsub231pd -8(%rax),%zmm28,%zmm9
+    vfmaddsub231pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfmaddsub231pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfmaddsub231pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfmaddsub231pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfmaddsub231pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfmaddsub231pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmsubadd132ps %zmm1,%zmm2,%zmm3
+    vfmsubadd132ps %zmm17,%zmm28,%zmm9{%k1}
+    vfmsubadd132ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmsubadd132ps %ymm19,%ymm2,%ymm23
+    vfmsubadd132ps %xmm1,%xmm30,%xmm18{%k1}
+    vfmsubadd132ps (%rax),%zmm2,%zmm3
+    vfmsubadd132ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmsubadd132ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmsubadd132ps -0x100(%rsp),%ymm2,%ymm23
+    vfmsubadd132ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmsubadd132ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmsubadd132ps -8(%rax),%zmm28,%zmm9
+    vfmsubadd132ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfmsubadd132ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfmsubadd132ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfmsubadd132ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfmsubadd132ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfmsubadd132ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmsubadd132pd %zmm1,%zmm2,%zmm3
+    vfmsubadd132pd %zmm17,%zmm28,%zmm9{%k1}
+    vfmsubadd132pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmsubadd132pd %ymm19,%ymm2,%ymm23
+    vfmsubadd132pd %xmm1,%xmm30,%xmm18{%k1}
+    vfmsubadd132pd (%rax),%zmm2,%zmm3
+    vfmsubadd132pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmsubadd132pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmsubadd132pd -0x100(%rsp),%ymm2,%ymm23
+    vfmsubadd132pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmsubadd132pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmsubadd132pd -8(%rax),%zmm28,%zmm9
+    vfmsubadd132pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfmsubadd132pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfmsubadd132pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfmsubadd132pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfmsubadd132pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfmsubadd132pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmsubadd213ps %zmm1,%zmm2,%zmm3
+    vfmsubadd213ps %zmm17,%zmm28,%zmm9{%k1}
+    vfmsubadd213ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmsubadd213ps %ymm19,%ymm2,%ymm23
+    vfmsubadd213ps %xmm1,%xmm30,%xmm18{%k1}
+    vfmsubadd213ps (%rax),%zmm2,%zmm3
+    vfmsubadd213ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmsubadd213ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmsubadd213ps -0x100(%rsp),%ymm2,%ymm23
+    vfmsubadd213ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmsubadd213ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmsubadd213ps -8(%rax),%zmm28,%zmm9
+    vfmsubadd213ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfmsubadd213ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfmsubadd213ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfmsubadd213ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfmsubadd213ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfmsubadd213ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmsubadd213pd %zmm1,%zmm2,%zmm3
+    vfmsubadd213pd %zmm17,%zmm28,%zmm9{%k1}
+    vfmsubadd213pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmsubadd213pd %ymm19,%ymm2,%ymm23
+    vfmsubadd213pd %xmm1,%xmm30,%xmm18{%k1}
+    vfmsubadd213pd (%rax),%zmm2,%zmm3
+    vfmsubadd213pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmsubadd213pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmsubadd213pd -0x100(%rsp),%ymm2,%ymm23
+    vfmsubadd213pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmsubadd213pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmsubadd213pd -8(%rax),%zmm28,%zmm9
+    vfmsubadd213pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfmsubadd213pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfmsubadd213pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfmsubadd213pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfmsubadd213pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfmsubadd213pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmsubadd231ps %zmm1,%zmm2,%zmm3
+    vfmsubadd231ps %zmm17,%zmm28,%zmm9{%k1}
+    vfmsubadd231ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmsubadd231ps %ymm19,%ymm2,%ymm23
+    vfmsubadd231ps %xmm1,%xmm30,%xmm18{%k1}
+    vfmsubadd231ps (%rax),%zmm2,%zmm3
+    vfmsubadd231ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmsubadd231ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmsubadd231ps -0x100(%rsp),%ymm2,%ymm23
+    vfmsubadd231ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmsubadd231ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmsubadd231ps -8(%rax),%zmm28,%zmm9
+    vfmsubadd231ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vfmsubadd231ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vfmsubadd231ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vfmsubadd231ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vfmsubadd231ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vfmsubadd231ps {rz-sae},%zmm1,%zmm17,%zmm30
+    vfmsubadd231pd %zmm1,%zmm2,%zmm3
+    vfmsubadd231pd %zmm17,%zmm28,%zmm9{%k1}
+    vfmsubadd231pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vfmsubadd231pd %ymm19,%ymm2,%ymm23
+    vfmsubadd231pd %xmm1,%xmm30,%xmm18{%k1}
+    vfmsubadd231pd (%rax),%zmm2,%zmm3
+    vfmsubadd231pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vfmsubadd231pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vfmsubadd231pd -0x100(%rsp),%ymm2,%ymm23
+    vfmsubadd231pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vfmsubadd231pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vfmsubadd231pd -8(%rax),%zmm28,%zmm9
+    vfmsubadd231pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vfmsubadd231pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vfmsubadd231pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vfmsubadd231pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vfmsubadd231pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vfmsubadd231pd {rz-sae},%zmm1,%zmm17,%zmm30
+    vmovaps %zmm1,%zmm3
+    vmovaps %zmm17,%zmm9{%k1}
+    vmovaps %zmm31,%zmm0{%k2}{z}
+    vmovaps %ymm19,%ymm23
+    vmovaps %xmm1,%xmm18{%k1}
+    vmovaps (%rax),%zmm3
+    vmovaps %zmm3,(%rax){%k4}
+    vmovaps 0x40(%rax),%zmm9{%k1}
+    vmovaps %zmm9,0x40(%rax){%k4}
+    vmovaps 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vmovaps %zmm0,0x80(%r13,%rcx,4){%k4}
+    vmovaps -0x100(%rsp),%ymm23
+    vmovaps %ymm23,-0x100(%rsp){%k4}
+    vmovaps 0x44(%rax),%xmm18{%k1}
+    vmovaps %xmm18,0x44(%rax){%k4}
+    vmovaps 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vmovaps %zmm3,0x1000(%r9,%r10,2){%k4}
+    vmovaps -8(%rax),%zmm9
+    vmovaps %zmm9,-8(%rax){%k4}
+    vmovups %zmm1,%zmm3
+    vmovups %zmm17,%zmm9{%k1}
+    vmovups %zmm31,%zmm0{%k2}{z}
+    vmovups %ymm19,%ymm23
+    vmovups %xmm1,%xmm18{%k1}
+    vmovups (%rax),%zmm3
+    vmovups %zmm3,(%rax){%k4}
+    vmovups 0x40(%rax),%zmm9{%k1}
+    vmovups %zmm9,0x40(%rax){%k4}
+    vmovups 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vmovups %zmm0,0x80(%r13,%rcx,4){%k4}
+    vmovups -0x100(%rsp),%ymm23
+    vmovups %ymm23,-0x100(%rsp){%k4}
+    vmovups 0x44(%rax),%xmm18{%k1}
+    vmovups %xmm18,0x44(%rax){%k4}
+    vmovups 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vmovups %zmm3,0x1000(%r9,%r10,2){%k4}
+    vmovups -8(%rax),%zmm9
+    vmovups %zmm9,-8(%rax){%k4}
+    vmovapd %zmm1,%zmm3
+    vmovapd %zmm17,%zmm9{%k1}
+    vmovapd %zmm31,%zmm0{%k2}{z}
+    vmovapd %ymm19,%ymm23
+    vmovapd %xmm1,%xmm18{%k1}
+    vmovapd (%rax),%zmm3
+    vmovapd %zmm3,(%rax){%k4}
+    vmovapd 0x40(%rax),%zmm9{%k1}
+    vmovapd %zmm9,0x40(%rax){%k4}
+    vmovapd 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vmovapd %zmm0,0x80(%r13,%rcx,4){%k4}
+    vmovapd -0x100(%rsp),%ymm23
+    vmovapd %ymm23,-0x100(%rsp){%k4}
+    vmovapd 0x44(%rax),%xmm18{%k1}
+    vmovapd %xmm18,0x44(%rax){%k4}
+    vmovapd 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vmovapd %zmm3,0x1000(%r9,%r10,2){%k4}
+    vmovapd -8(%rax),%zmm9
+    vmovapd %zmm9,-8(%rax){%k4}
+    vmovupd %zmm1,%zmm3
+    vmovupd %zmm17,%zmm9{%k1}
+    vmovupd %zmm31,%zmm0{%k2}{z}
+    vmovupd %ymm19,%ymm23
+    vmovupd %xmm1,%xmm18{%k1}
+    vmovupd (%rax),%zmm3
+    vmovupd %zmm3,(%rax){%k4}
+    vmovupd 0x40(%rax),%zmm9{%k1}
+    vmovupd %zmm9,0x40(%rax){%k4}
+    vmovupd 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vmovupd %zmm0,0x80(%r13,%rcx,4){%k4}
+    vmovupd -0x100(%rsp),%ymm23
+    vmovupd %ymm23,-0x100(%rsp){%k4}
+    vmovupd 0x44(%rax),%xmm18{%k1}
+    vmovupd %xmm18,0x44(%rax){%k4}
+    vmovupd 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vmovupd %zmm3,0x1000(%r9,%r10,2){%k4}
+    vmovupd -8(%rax),%zmm9
+    vmovupd %zmm9,-8(%rax){%k4}
+    vmovss %xmm1,%xmm17,%xmm30
+    vmovss %xmm20,%xmm2,%xmm9{%k1}
+    vmovss (%rax),%xmm17{%k1}{z}
+    vmovss %xmm20,(%rax){%k3}
+    vmovss 0x40(%rax),%xmm17{%k1}{z}
+    vmovss %xmm20,0x40(%rax){%k3}
+    vmovss 0x80(%r13,%rcx,4),%xmm17{%k1}{z}
+    vmovss %xmm20,0x80(%r13,%rcx,4){%k3}
+    vmovss -0x100(%rsp),%xmm17{%k1}{z}
+    vmovss %xmm20,-0x100(%rsp){%k3}
+    vmovsd %xmm1,%xmm17,%xmm30
+    vmovsd %xmm20,%xmm2,%xmm9{%k1}
+    vmovsd (%rax),%xmm17{%k1}{z}
+    vmovsd %xmm20,(%rax){%k3}
+    vmovsd 0x40(%rax),%xmm17{%k1}{z}
+    vmovsd %xmm20,0x40(%rax){%k3}
+    vmovsd 0x80(%r13,%rcx,4),%xmm17{%k1}{z}
+    vmovsd %xmm20,0x80(%r13,%rcx,4){%k3}
+    vmovsd -0x100(%rsp),%xmm17{%k1}{z}
+    vmovsd %xmm20,-0x100(%rsp){%k3}
+    vmovntdqa 0x40(%rax),%zmm3
+    vmovntdqa 0x20(%rax),%zmm3
+    vmovntdqa 0x10(%rax),%zmm3
+    vmovntdqa 0x40(%rax),%zmm17
+    vmovntdqa 0x40(%rax),%ymm17
+    vbroadcastss %xmm18,%zmm3
+    vbroadcastss 0x40(%rax),%zmm3{%k1}
+    vbroadcastss 4(%rax),%zmm3
+    vbroadcastss %xmm18,%ymm20{%k1}
+    vbroadcastss 0x40(%rax),%ymm20{%k2}{z}
+    vbroadcastss 4(%rax),%ymm20
+    vbroadcastss %xmm18,%xmm31{%k2}{z}
+    vbroadcastss 0x40(%rax),%xmm31
+    vbroadcastss 4(%rax),%xmm31
+    vbroadcastsd %xmm18,%zmm3
+    vbroadcastsd 0x40(%rax),%zmm3{%k1}
+    vbroadcastsd 8(%rax),%zmm3
+    vbroadcastsd %xmm18,%ymm20{%k1}
+    vbroadcastsd 0x40(%rax),%ymm20{%k2}{z}
+    vbroadcastsd 8(%rax),%ymm20
+    vpbroadcastb %xmm18,%zmm3
+    vpbroadcastb 0x40(%rax),%zmm3{%k1}
+    vpbroadcastb 1(%rax),%zmm3
+    vpbroadcastb %xmm18,%ymm20{%k1}
+    vpbroadcastb 0x40(%rax),%ymm20{%k2}{z}
+    vpbroadcastb 1(%rax),%ymm20
+    vpbroadcastb %xmm18,%xmm31{%k2}{z}
+    vpbroadcastb 0x40(%rax),%xmm31
+    vpbroadcastb 1(%rax),%xmm31
+    vpbroadcastw %xmm18,%zmm3
+    vpbroadcastw 0x40(%rax),%zmm3{%k1}
+    vpbroadcastw 2(%rax),%zmm3
+    vpbroadcastw %xmm18,%ymm20{%k1}
+    vpbroadcastw 0x40(%rax),%ymm20{%k2}{z}
+    vpbroadcastw 2(%rax),%ymm20
+    vpbroadcastw %xmm18,%xmm31{%k2}{z}
+    vpbroadcastw 0x40(%rax),%xmm31
+    vpbroadcastw 2(%rax),%xmm31
+    vpbroadcastd %xmm18,%zmm3
+    vpbroadcastd 0x40(%rax),%zmm3{%k1}
+    vpbroadcastd 4(%rax),%zmm3
+    vpbroadcastd %xmm18,%ymm20{%k1}
+    vpbroadcastd 0x40(%rax),%ymm20{%k2}{z}
+    vpbroadcastd 4(%rax),%ymm20
+    vpbroadcastd %xmm18,%xmm31{%k2}{z}
+    vpbroadcastd 0x40(%rax),%xmm31
+    vpbroadcastd 4(%rax),%xmm31
+    vpbroadcastq %xmm18,%zmm3
+    vpbroadcastq 0x40(%rax),%zmm3{%k1}
+    vpbroadcastq 8(%rax),%zmm3
+    vpbroadcastq %xmm18,%ymm20{%k1}
+    vpbroadcastq 0x40(%rax),%ymm20{%k2}{z}
+    vpbroadcastq 8(%rax),%ymm20
+    vpbroadcastq %xmm18,%xmm31{%k2}{z}
+    vpbroadcastq 0x40(%rax),%xmm31
+    vpbroadcastq 8(%rax),%xmm31
+    vcomiss %xmm1,%xmm30
+    vcomiss (%rax),%xmm30
+    vcomiss -0x100(%rsp),%xmm9
+    vcomiss -8(%rax),%xmm30
+    vcomiss {sae},%xmm1,%xmm30
+    vucomiss %xmm1,%xmm30
+    vucomiss (%rax),%xmm30
+    vucomiss -0x100(%rsp),%xmm9
+    vucomiss -8(%rax),%xmm30
+    vucomiss {sae},%xmm1,%xmm30
+    vcomisd %xmm1,%xmm30
+    vcomisd (%rax),%xmm30
+    vcomisd -0x100(%rsp),%xmm9
+    vcomisd -8(%rax),%xmm30
+    vcomisd {sae},%xmm1,%xmm30
+    vucomisd %xmm1,%xmm30
+    vucomisd (%rax),%xmm30
+    vucomisd -0x100(%rsp),%xmm9
+    vucomisd -8(%rax),%xmm30
+    vucomisd {sae},%xmm1,%xmm30
+    vcvtss2sd %xmm1,%xmm17,%xmm30
+    vcvtss2sd %xmm20,%xmm2,%xmm9{%k1}
+    vcvtss2sd (%rax),%xmm17,%xmm30
+    vcvtss2sd 0x40(%rax),%xmm2,%xmm9{%k1}
+    vcvtss2sd 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vcvtss2sd -0x100(%rsp),%xmm2,%xmm9
+    vcvtss2sd 0x44(%rax),%xmm17,%xmm30{%k1}
+    vcvtss2sd 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vcvtss2sd -8(%rax),%xmm17,%xmm30
+    vcvtss2sd {sae},%xmm1,%xmm17,%xmm30
+    vcvtsd2ss %xmm1,%xmm17,%xmm30
+    vcvtsd2ss %xmm20,%xmm2,%xmm9{%k1}
+    vcvtsd2ss (%rax),%xmm17,%xmm30
+    vcvtsd2ss 0x40(%rax),%xmm2,%xmm9{%k1}
+    vcvtsd2ss 0x80(%r13,%rcx,4),%xmm17,%xmm30{%k2}{z}
+    vcvtsd2ss -0x100(%rsp),%xmm2,%xmm9
+    vcvtsd2ss 0x44(%rax),%xmm17,%xmm30{%k1}
+    vcvtsd2ss 0x1000(%r9,%r10,2),%xmm2,%xmm9{%k2}{z}
+    vcvtsd2ss -8(%rax),%xmm17,%xmm30
+    vcvtsd2ss {rz-sae},%xmm1,%xmm17,%xmm30
+    vmovhlps %xmm1,%xmm17,%xmm30
+    vmovlhps %xmm1,%xmm17,%xmm30
+    vpgatherdd 0x40(%rax,%zmm17,4),%zmm2{%k1}
+    vpgatherdd 8(%r9,%zmm5,8),%zmm26{%k7}
+    vpgatherdd 0x40(%rax,%ymm17,4),%ymm2{%k1}
+    vpgatherdd 8(%r9,%ymm5,8),%ymm26{%k7}
+    vpgatherdd 0x40(%rax,%xmm17,4),%xmm2{%k1}
+    vpgatherdd 8(%r9,%xmm5,8),%xmm26{%k7}
+    vpgatherdq 0x40(%rax,%ymm17,4),%zmm2{%k1}
+    vpgatherdq 8(%r9,%ymm5,8),%zmm26{%k7}
+    vpgatherdq 0x40(%rax,%xmm17,4),%ymm2{%k1}
+    vpgatherdq 8(%r9,%xmm5,8),%ymm26{%k7}
+    vpgatherqd 0x40(%rax,%zmm17,4),%ymm2{%k1}
+    vpgatherqd 8(%r9,%zmm5,8),%ymm26{%k7}
+    vpgatherqd 0x40(%rax,%ymm17,4),%xmm2{%k1}
+    vpgatherqd 8(%r9,%ymm5,8),%xmm26{%k7}
+    vpgatherqq 0x40(%rax,%zmm17,4),%zmm2{%k1}
+    vpgatherqq 8(%r9,%zmm5,8),%zmm26{%k7}
+    vpgatherqq 0x40(%rax,%ymm17,4),%ymm2{%k1}
+    vpgatherqq 8(%r9,%ymm5,8),%ymm26{%k7}
+    vpgatherqq 0x40(%rax,%xmm17,4),%xmm2{%k1}
+    vpgatherqq 8(%r9,%xmm5,8),%xmm26{%k7}
+    vgatherdps 0x40(%rax,%zmm17,4),%zmm2{%k1}
+    vgatherdps 8(%r9,%zmm5,8),%zmm26{%k7}
+    vgatherdps 0x40(%rax,%ymm17,4),%ymm2{%k1}
+    vgatherdps 8(%r9,%ymm5,8),%ymm26{%k7}
+    vgatherdps 0x40(%rax,%xmm17,4),%xmm2{%k1}
+    vgatherdps 8(%r9,%xmm5,8),%xmm26{%k7}
+    vgatherdpd 0x40(%rax,%ymm17,4),%zmm2{%k1}
+    vgatherdpd 8(%r9,%ymm5,8),%zmm26{%k7}
+    vgatherdpd 0x40(%rax,%xmm17,4),%ymm2{%k1}
+    vgatherdpd 8(%r9,%xmm5,8),%ymm26{%k7}
+    vgatherqps 0x40(%rax,%zmm17,4),%ymm2{%k1}
+    vgatherqps 8(%r9,%zmm5,8),%ymm26{%k7}
+    vgatherqps 0x40(%rax,%ymm17,4),%xmm2{%k1}
+    vgatherqps 8(%r9,%ymm5,8),%xmm26{%k7}
+    vgatherqpd 0x40(%rax,%zmm17,4),%zmm2{%k1}
+    vgatherqpd 8(%r9,%zmm5,8),%zmm26{%k7}
+    vgatherqpd 0x40(%rax,%ymm17,4),%ymm2{%k1}
+    vgatherqpd 8(%r9,%ymm5,8),%ymm26{%k7}
+    vgatherqpd 0x40(%rax,%xmm17,4),%xmm2{%k1}
+    vgatherqpd 8(%r9,%xmm5,8),%xmm26{%k7}
+    vmovdqa32 %zmm1,%zmm3
+    vmovdqa32 %zmm17,%zmm9{%k1}
+    vmovdqa32 %zmm31,%zmm0{%k2}{z}
+    vmovdqa32 %ymm19,%ymm23
+    vmovdqa32 %xmm1,%xmm18{%k1}
+    vmovdqa32 (%rax),%zmm3
+    vmovdqa32 %zmm3,(%rax){%k4}
+    vmovdqa32 0x40(%rax),%zmm9{%k1}
+    vmovdqa32 %zmm9,0x40(%rax){%k4}
+    vmovdqa32 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vmovdqa32 %zmm0,0x80(%r13,%rcx,4){%k4}
+    vmovdqa32 -0x100(%rsp),%ymm23
+    vmovdqa32 %ymm23,-0x100(%rsp){%k4}
+    vmovdqa32 0x44(%rax),%xmm18{%k1}
+    vmovdqa32 %xmm18,0x44(%rax){%k4}
+    vmovdqa32 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vmovdqa32 %zmm3,0x1000(%r9,%r10,2){%k4}
+    vmovdqa32 -8(%rax),%zmm9
+    vmovdqa32 %zmm9,-8(%rax){%k4}
+    vmovdqa64 %zmm1,%zmm3
+    vmovdqa64 %zmm17,%zmm9{%k1}
+    vmovdqa64 %zmm31,%zmm0{%k2}{z}
+    vmovdqa64 %ymm19,%ymm23
+    vmovdqa64 %xmm1,%xmm18{%k1}
+    vmovdqa64 (%rax),%zmm3
+    vmovdqa64 %zmm3,(%rax){%k4}
+    vmovdqa64 0x40(%rax),%zmm9{%k1}
+    vmovdqa64 %zmm9,0x40(%rax){%k4}
+    vmovdqa64 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vmovdqa64 %zmm0,0x80(%r13,%rcx,4){%k4}
+    vmovdqa64 -0x100(%rsp),%ymm23
+    vmovdqa64 %ymm23,-0x100(%rsp){%k4}
+    vmovdqa64 0x44(%rax),%xmm18{%k1}
+    vmovdqa64 %xmm18,0x44(%rax){%k4}
+    vmovdqa64 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vmovdqa64 %zmm3,0x1000(%r9,%r10,2){%k4}
+    vmovdqa64 -8(%rax),%zmm9
+    vmovdqa64 %zmm9,-8(%rax){%k4}
+    vmovdqu8 %zmm1,%zmm3
+    vmovdqu8 %zmm17,%zmm9{%k1}
+    vmovdqu8 %zmm31,%zmm0{%k2}{z}
+    vmovdqu8 %ymm19,%ymm23
+    vmovdqu8 %xmm1,%xmm18{%k1}
+    vmovdqu8 (%rax),%zmm3
+    vmovdqu8 %zmm3,(%rax){%k4}
+    vmovdqu8 0x40(%rax),%zmm9{%k1}
+    vmovdqu8 %zmm9,0x40(%rax){%k4}
+    vmovdqu8 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vmovdqu8 %zmm0,0x80(%r13,%rcx,4){%k4}
+    vmovdqu8 -0x100(%rsp),%ymm23
+    vmovdqu8 %ymm23,-0x100(%rsp){%k4}
+    vmovdqu8 0x44(%rax),%xmm18{%k1}
+    vmovdqu8 %xmm18,0x44(%rax){%k4}
+    vmovdqu8 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vmovdqu8 %zmm3,0x1000(%r9,%r10,2){%k4}
+    vmovdqu8 -8(%rax),%zmm9
+    vmovdqu8 %zmm9,-8(%rax){%k4}
+    vmovdqu16 %zmm1,%zmm3
+    vmovdqu16 %zmm17,%zmm9{%k1}
+    vmovdqu16 %zmm31,%zmm0{%k2}{z}
+    vmovdqu16 %ymm19,%ymm23
+    vmovdqu16 %xmm1,%xmm18{%k1}
+    vmovdqu16 (%rax),%zmm3
+    vmovdqu16 %zmm3,(%rax){%k4}
+    vmovdqu16 0x40(%rax),%zmm9{%k1}
+    vmovdqu16 %zmm9,0x40(%rax){%k4}
+    vmovdqu16 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vmovdqu16 %zmm0,0x80(%r13,%rcx,4){%k4}
+    vmovdqu16 -0x100(%rsp),%ymm23
+    vmovdqu16 %ymm23,-0x100(%rsp){%k4}
+    vmovdqu16 0x44(%rax),%xmm18{%k1}
+    vmovdqu16 %xmm18,0x44(%rax){%k4}
+    vmovdqu16 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vmovdqu16 %zmm3,0x1000(%r9,%r10,2){%k4}
+    vmovdqu16 -8(%rax),%zmm9
+    vmovdqu16 %zmm9,-8(%rax){%k4}
+    vmovdqu32 %zmm1,%zmm3
+    vmovdqu32 %zmm17,%zmm9{%k1}
+    vmovdqu32 %zmm31,%zmm0{%k2}{z}
+    vmovdqu32 %ymm19,%ymm23
+    vmovdqu32 %xmm1,%xmm18{%k1}
+    vmovdqu32 (%rax),%zmm3
+    vmovdqu32 %zmm3,(%rax){%k4}
+    vmovdqu32 0x40(%rax),%zmm9{%k1}
+    vmovdqu32 %zmm9,0x40(%rax){%k4}
+    vmovdqu32 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vmovdqu32 %zmm0,0x80(%r13,%rcx,4){%k4}
+    vmovdqu32 -0x100(%rsp),%ymm23
+    vmovdqu32 %ymm23,-0x100(%rsp){%k4}
+    vmovdqu32 0x44(%rax),%xmm18{%k1}
+    vmovdqu32 %xmm18,0x44(%rax){%k4}
+    vmovdqu32 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vmovdqu32 %zmm3,0x1000(%r9,%r10,2){%k4}
+    vmovdqu32 -8(%rax),%zmm9
+    vmovdqu32 %zmm9,-8(%rax){%k4}
+    vmovdqu64 %zmm1,%zmm3
+    vmovdqu64 %zmm17,%zmm9{%k1}
+    vmovdqu64 %zmm31,%zmm0{%k2}{z}
+    vmovdqu64 %ymm19,%ymm23
+    vmovdqu64 %xmm1,%xmm18{%k1}
+    vmovdqu64 (%rax),%zmm3
+    vmovdqu64 %zmm3,(%rax){%k4}
+    vmovdqu64 0x40(%rax),%zmm9{%k1}
+    vmovdqu64 %zmm9,0x40(%rax){%k4}
+    vmovdqu64 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vmovdqu64 %zmm0,0x80(%r13,%rcx,4){%k4}
+    vmovdqu64 -0x100(%rsp),%ymm23
+    vmovdqu64 %ymm23,-0x100(%rsp){%k4}
+    vmovdqu64 0x44(%rax),%xmm18{%k1}
+    vmovdqu64 %xmm18,0x44(%rax){%k4}
+    vmovdqu64 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vmovdqu64 %zmm3,0x1000(%r9,%r10,2){%k4}
+    vmovdqu64 -8(%rax),%zmm9
+    vmovdqu64 %zmm9,-8(%rax){%k4}
+    vpandd %zmm1,%zmm2,%zmm3
+    vpandd %zmm17,%zmm28,%zmm9{%k1}
+    vpandd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpandd %ymm19,%ymm2,%ymm23
+    vpandd %xmm1,%xmm30,%xmm18{%k1}
+    vpandd (%rax),%zmm2,%zmm3
+    vpandd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpandd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpandd -0x100(%rsp),%ymm2,%ymm23
+    vpandd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpandd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpandd -8(%rax),%zmm28,%zmm9
+    vpandd 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpandd 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpandd 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpandd 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpandd 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpandq %zmm1,%zmm2,%zmm3
+    vpandq %zmm17,%zmm28,%zmm9{%k1}
+    vpandq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpandq %ymm19,%ymm2,%ymm23
+    vpandq %xmm1,%xmm30,%xmm18{%k1}
+    vpandq (%rax),%zmm2,%zmm3
+    vpandq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpandq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpandq -0x100(%rsp),%ymm2,%ymm23
+    vpandq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpandq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpandq -8(%rax),%zmm28,%zmm9
+    vpandq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpandq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpandq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpandq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpandq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpandnd %zmm1,%zmm2,%zmm3
+    vpandnd %zmm17,%zmm28,%zmm9{%k1}
+    vpandnd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpandnd %ymm19,%ymm2,%ymm23
+    vpandnd %xmm1,%xmm30,%xmm18{%k1}
+    vpandnd (%rax),%zmm2,%zmm3
+    vpandnd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpandnd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpandnd -0x100(%rsp),%ymm2,%ymm23
+    vpandnd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpandnd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpandnd -8(%rax),%zmm28,%zmm9
+    vpandnd 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpandnd 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpandnd 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpandnd 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpandnd 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpandnq %zmm1,%zmm2,%zmm3
+    vpandnq %zmm17,%zmm28,%zmm9{%k1}
+    vpandnq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpandnq %ymm19,%ymm2,%ymm23
+    vpandnq %xmm1,%xmm30,%xmm18{%k1}
+    vpandnq (%rax),%zmm2,%zmm3
+    vpandnq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpandnq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpandnq -0x100(%rsp),%ymm2,%ymm23
+    vpandnq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpandnq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpandnq -8(%rax),%zmm28,%zmm9
+    vpandnq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpandnq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpandnq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpandnq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpandnq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpord %zmm1,%zmm2,%zmm3
+    vpord %zmm17,%zmm28,%zmm9{%k1}
+    vpord %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpord %ymm19,%ymm2,%ymm23
+    vpord %xmm1,%xmm30,%xmm18{%k1}
+    vpord (%rax),%zmm2,%zmm3
+    vpord 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpord 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpord -0x100(%rsp),%ymm2,%ymm23
+    vpord 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpord 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpord -8(%rax),%zmm28,%zmm9
+    vpord 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpord 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpord 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpord 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpord 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vporq %zmm1,%zmm2,%zmm3
+    vporq %zmm17,%zmm28,%zmm9{%k1}
+    vporq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vporq %ymm19,%ymm2,%ymm23
+    vporq %xmm1,%xmm30,%xmm18{%k1}
+    vporq (%rax),%zmm2,%zmm3
+    vporq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vporq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vporq -0x100(%rsp),%ymm2,%ymm23
+    vporq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vporq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vporq -8(%rax),%zmm28,%zmm9
+    vporq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vporq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vporq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vporq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vporq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpxord %zmm1,%zmm2,%zmm3
+    vpxord %zmm17,%zmm28,%zmm9{%k1}
+    vpxord %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpxord %ymm19,%ymm2,%ymm23
+    vpxord %xmm1,%xmm30,%xmm18{%k1}
+    vpxord (%rax),%zmm2,%zmm3
+    vpxord 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpxord 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpxord -0x100(%rsp),%ymm2,%ymm23
+    vpxord 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpxord 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpxord -8(%rax),%zmm28,%zmm9
+    vpxord 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpxord 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpxord 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpxord 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpxord 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpxorq %zmm1,%zmm2,%zmm3
+    vpxorq %zmm17,%zmm28,%zmm9{%k1}
+    vpxorq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpxorq %ymm19,%ymm2,%ymm23
+    vpxorq %xmm1,%xmm30,%xmm18{%k1}
+    vpxorq (%rax),%zmm2,%zmm3
+    vpxorq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpxorq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpxorq -0x100(%rsp),%ymm2,%ymm23
+    vpxorq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpxorq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpxorq -8(%rax),%zmm28,%zmm9
+    vpxorq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpxorq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpxorq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpxorq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpxorq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpternlogd $5,%zmm1,%zmm2,%zmm3
+    vpternlogd $5,%zmm17,%zmm28,%zmm9{%k1}
+    vpternlogd $5,%zmm31,%zmm16,%zmm0{%k2}{z}
+    vpternlogd $5,%ymm19,%ymm2,%ymm23
+    vpternlogd $5,%xmm1,%xmm30,%xmm18{%k1}
+    vpternlogd $0x7f,(%rax),%zmm2,%zmm3
+    vpternlogd $0x7f,0x40(%rax),%zmm28,%zmm9{%k1}
+    vpternlogd $0x7f,0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpternlogd $0x7f,-0x100(%rsp),%ymm2,%ymm23
+    vpternlogd $0x7f,0x44(%rax),%xmm30,%xmm18{%k1}
+    vpternlogd $0x7f,0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpternlogd $0x7f,-8(%rax),%zmm28,%zmm9
+    vpternlogd $1,0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpternlogd $1,0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpternlogd $1,0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpternlogd $1,0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpternlogd $1,0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpternlogq $5,%zmm1,%zmm2,%zmm3
+    vpternlogq $5,%zmm17,%zmm28,%zmm9{%k1}
+    vpternlogq $5,%zmm31,%zmm16,%zmm0{%k2}{z}
+    vpternlogq $5,%ymm19,%ymm2,%ymm23
+    vpternlogq $5,%xmm1,%xmm30,%xmm18{%k1}
+    vpternlogq $0x7f,(%rax),%zmm2,%zmm3
+    vpternlogq $0x7f,0x40(%rax),%zmm28,%zmm9{%k1}
+    vpternlogq $0x7f,0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpternlogq $0x7f,-0x100(%rsp),%ymm2,%ymm23
+    vpternlogq $0x7f,0x44(%rax),%xmm30,%xmm18{%k1}
+    vpternlogq $0x7f,0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpternlogq $0x7f,-8(%rax),%zmm28,%zmm9
+    vpternlogq $1,0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpternlogq $1,0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpternlogq $1,0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpternlogq $1,0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpternlogq $1,0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpmullq %zmm1,%zmm2,%zmm3
+    vpmullq %zmm17,%zmm28,%zmm9{%k1}
+    vpmullq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmullq %ymm19,%ymm2,%ymm23
+    vpmullq %xmm1,%xmm30,%xmm18{%k1}
+    vpmullq (%rax),%zmm2,%zmm3
+    vpmullq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmullq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmullq -0x100(%rsp),%ymm2,%ymm23
+    vpmullq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmullq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmullq -8(%rax),%zmm28,%zmm9
+    vpmullq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpmullq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpmullq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpmullq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpmullq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpabsq %zmm1,%zmm3
+    vpabsq %zmm17,%zmm9{%k1}
+    vpabsq %zmm31,%zmm0{%k2}{z}
+    vpabsq %ymm19,%ymm23
+    vpabsq %xmm1,%xmm18{%k1}
+    vpabsq (%rax),%zmm3
+    vpabsq 0x40(%rax),%zmm9{%k1}
+    vpabsq 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vpabsq -0x100(%rsp),%ymm23
+    vpabsq 0x44(%rax),%xmm18{%k1}
+    vpabsq 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vpabsq -8(%rax),%zmm9
+    vpabsq 0x40(%rax){1to8},%zmm3
+    vpabsq 0x40(%rax){1to8},%zmm9
+    vpabsq 0x40(%rax){1to8},%zmm0
+    vpabsq 0x40(%rax){1to4},%ymm23
+    vpabsq 0x40(%rax){1to2},%xmm18
+    vpminsq %zmm1,%zmm2,%zmm3
+    vpminsq %zmm17,%zmm28,%zmm9{%k1}
+    vpminsq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpminsq %ymm19,%ymm2,%ymm23
+    vpminsq %xmm1,%xmm30,%xmm18{%k1}
+    vpminsq (%rax),%zmm2,%zmm3
+    vpminsq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpminsq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpminsq -0x100(%rsp),%ymm2,%ymm23
+    vpminsq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpminsq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpminsq -8(%rax),%zmm28,%zmm9
+    vpminsq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpminsq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpminsq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpminsq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpminsq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpminuq %zmm1,%zmm2,%zmm3
+    vpminuq %zmm17,%zmm28,%zmm9{%k1}
+    vpminuq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpminuq %ymm19,%ymm2,%ymm23
+    vpminuq %xmm1,%xmm30,%xmm18{%k1}
+    vpminuq (%rax),%zmm2,%zmm3
+    vpminuq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpminuq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpminuq -0x100(%rsp),%ymm2,%ymm23
+    vpminuq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpminuq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpminuq -8(%rax),%zmm28,%zmm9
+    vpminuq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpminuq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpminuq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpminuq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpminuq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpmaxsq %zmm1,%zmm2,%zmm3
+    vpmaxsq %zmm17,%zmm28,%zmm9{%k1}
+    vpmaxsq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmaxsq %ymm19,%ymm2,%ymm23
+    vpmaxsq %xmm1,%xmm30,%xmm18{%k1}
+    vpmaxsq (%rax),%zmm2,%zmm3
+    vpmaxsq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmaxsq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmaxsq -0x100(%rsp),%ymm2,%ymm23
+    vpmaxsq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmaxsq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmaxsq -8(%rax),%zmm28,%zmm9
+    vpmaxsq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpmaxsq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpmaxsq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpmaxsq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpmaxsq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpmaxuq %zmm1,%zmm2,%zmm3
+    vpmaxuq %zmm17,%zmm28,%zmm9{%k1}
+    vpmaxuq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpmaxuq %ymm19,%ymm2,%ymm23
+    vpmaxuq %xmm1,%xmm30,%xmm18{%k1}
+    vpmaxuq (%rax),%zmm2,%zmm3
+    vpmaxuq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpmaxuq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpmaxuq -0x100(%rsp),%ymm2,%ymm23
+    vpmaxuq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpmaxuq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpmaxuq -8(%rax),%zmm28,%zmm9
+    vpmaxuq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpmaxuq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpmaxuq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpmaxuq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpmaxuq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpsraq $3,%zmm2,%zmm3
+    vpsraq $3,0x40(%rax),%zmm3
+    vpsraq $3,0x40(%rax){1to8},%zmm3
+    vpsraq %xmm4,%zmm2,%zmm3
+    vpsraq 0x10(%rax),%zmm2,%zmm3
+    vpsraq 0x40(%rax),%zmm2,%zmm3
+    vpsraq $3,%zmm28,%zmm9{%k1}
+    vpsraq $3,0x40(%rax),%zmm9
+    vpsraq $3,0x40(%rax){1to8},%zmm9
+    vpsraq %xmm4,%zmm28,%zmm9{%k1}
+    vpsraq 0x10(%rax),%zmm28,%zmm9
+    vpsraq 0x40(%rax),%zmm28,%zmm9
+    vpsraq $3,%zmm16,%zmm0{%k2}{z}
+    vpsraq $3,0x40(%rax),%zmm0
+    vpsraq $3,0x40(%rax){1to8},%zmm0
+    vpsraq %xmm4,%zmm16,%zmm0{%k2}{z}
+    vpsraq 0x10(%rax),%zmm16,%zmm0
+    vpsraq 0x40(%rax),%zmm16,%zmm0
+    vpsraq $3,%ymm2,%ymm23
+    vpsraq $3,0x40(%rax),%ymm23
+    vpsraq $3,0x40(%rax){1to4},%ymm23
+    vpsraq %xmm4,%ymm2,%ymm23
+    vpsraq 0x10(%rax),%ymm2,%ymm23
+    vpsraq 0x40(%rax),%ymm2,%ymm23
+    vpsraq $3,%xmm30,%xmm18{%k1}
+    vpsraq $3,0x40(%rax),%xmm18
+    vpsraq $3,0x40(%rax){1to2},%xmm18
+    vpsraq %xmm4,%xmm30,%xmm18{%k1}
+    vpsraq 0x10(%rax),%xmm30,%xmm18
+    vpsraq 0x40(%rax),%xmm30,%xmm18
+    vpsravq %zmm1,%zmm2,%zmm3
+    vpsravq %zmm17,%zmm28,%zmm9{%k1}
+    vpsravq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpsravq %ymm19,%ymm2,%ymm23
+    vpsravq %xmm1,%xmm30,%xmm18{%k1}
+    vpsravq (%rax),%zmm2,%zmm3
+    vpsravq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpsravq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpsravq -0x100(%rsp),%ymm2,%ymm23
+    vpsravq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpsravq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpsravq -8(%rax),%zmm28,%zmm9
+    vpsravq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpsravq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpsravq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpsravq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpsravq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vprold $3,%zmm2,%zmm3
+    vprold $3,0x40(%rax),%zmm3
+    vprold $3,0x40(%rax){1to16},%zmm3
+    vprold $3,%zmm28,%zmm9{%k1}
+    vprold $3,0x40(%rax),%zmm9
+    vprold $3,0x40(%rax){1to16},%zmm9
+    vprold $3,%zmm16,%zmm0{%k2}{z}
+    vprold $3,0x40(%rax),%zmm0
+    vprold $3,0x40(%rax){1to16},%zmm0
+    vprold $3,%ymm2,%ymm23
+    vprold $3,0x40(%rax),%ymm23
+    vprold $3,0x40(%rax){1to8},%ymm23
+    vprold $3,%xmm30,%xmm18{%k1}
+    vprold $3,0x40(%rax),%xmm18
+    vprold $3,0x40(%rax){1to4},%xmm18
+    vprolq $3,%zmm2,%zmm3
+    vprolq $3,0x40(%rax),%zmm3
+    vprolq $3,0x40(%rax){1to8},%zmm3
+    vprolq $3,%zmm28,%zmm9{%k1}
+    vprolq $3,0x40(%rax),%zmm9
+    vprolq $3,0x40(%rax){1to8},%zmm9
+    vprolq $3,%zmm16,%zmm0{%k2}{z}
+    vprolq $3,0x40(%rax),%zmm0
+    vprolq $3,0x40(%rax){1to8},%zmm0
+    vprolq $3,%ymm2,%ymm23
+    vprolq $3,0x40(%rax),%ymm23
+    vprolq $3,0x40(%rax){1to4},%ymm23
+    vprolq $3,%xmm30,%xmm18{%k1}
+    vprolq $3,0x40(%rax),%xmm18
+    vprolq $3,0x40(%rax){1to2},%xmm18
+    vprord $3,%zmm2,%zmm3
+    vprord $3,0x40(%rax),%zmm3
+    vprord $3,0x40(%rax){1to16},%zmm3
+    vprord $3,%zmm28,%zmm9{%k1}
+    vprord $3,0x40(%rax),%zmm9
+    vprord $3,0x40(%rax){1to16},%zmm9
+    vprord $3,%zmm16,%zmm0{%k2}{z}
+    vprord $3,0x40(%rax),%zmm0
+    vprord $3,0x40(%rax){1to16},%zmm0
+    vprord $3,%ymm2,%ymm23
+    vprord $3,0x40(%rax),%ymm23
+    vprord $3,0x40(%rax){1to8},%ymm23
+    vprord $3,%xmm30,%xmm18{%k1}
+    vprord $3,0x40(%rax),%xmm18
+    vprord $3,0x40(%rax){1to4},%xmm18
+    vprorq $3,%zmm2,%zmm3
+    vprorq $3,0x40(%rax),%zmm3
+    vprorq $3,0x40(%rax){1to8},%zmm3
+    vprorq $3,%zmm28,%zmm9{%k1}
+    vprorq $3,0x40(%rax),%zmm9
+    vprorq $3,0x40(%rax){1to8},%zmm9
+    vprorq $3,%zmm16,%zmm0{%k2}{z}
+    vprorq $3,0x40(%rax),%zmm0
+    vprorq $3,0x40(%rax){1to8},%zmm0
+    vprorq $3,%ymm2,%ymm23
+    vprorq $3,0x40(%rax),%ymm23
+    vprorq $3,0x40(%rax){1to4},%ymm23
+    vprorq $3,%xmm30,%xmm18{%k1}
+    vprorq $3,0x40(%rax),%xmm18
+    vprorq $3,0x40(%rax){1to2},%xmm18
+    vprolvd %zmm1,%zmm2,%zmm3
+    vprolvd %zmm17,%zmm28,%zmm9{%k1}
+    vprolvd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vprolvd %ymm19,%ymm2,%ymm23
+    vprolvd %xmm1,%xmm30,%xmm18{%k1}
+    vprolvd (%rax),%zmm2,%zmm3
+    vprolvd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vprolvd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vprolvd -0x100(%rsp),%ymm2,%ymm23
+    vprolvd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vprolvd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vprolvd -8(%rax),%zmm28,%zmm9
+    vprolvd 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vprolvd 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vprolvd 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vprolvd 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vprolvd 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vprolvq %zmm1,%zmm2,%zmm3
+    vprolvq %zmm17,%zmm28,%zmm9{%k1}
+    vprolvq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vprolvq %ymm19,%ymm2,%ymm23
+    vprolvq %xmm1,%xmm30,%xmm18{%k1}
+    vprolvq (%rax),%zmm2,%zmm3
+    vprolvq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vprolvq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vprolvq -0x100(%rsp),%ymm2,%ymm23
+    vprolvq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vprolvq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vprolvq -8(%rax),%zmm28,%zmm9
+    vprolvq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vprolvq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vprolvq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vprolvq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vprolvq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vprorvd %zmm1,%zmm2,%zmm3
+    vprorvd %zmm17,%zmm28,%zmm9{%k1}
+    vprorvd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vprorvd %ymm19,%ymm2,%ymm23
+    vprorvd %xmm1,%xmm30,%xmm18{%k1}
+    vprorvd (%rax),%zmm2,%zmm3
+    vprorvd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vprorvd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vprorvd -0x100(%rsp),%ymm2,%ymm23
+    vprorvd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vprorvd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vprorvd -8(%rax),%zmm28,%zmm9
+    vprorvd 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vprorvd 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vprorvd 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vprorvd 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vprorvd 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vprorvq %zmm1,%zmm2,%zmm3
+    vprorvq %zmm17,%zmm28,%zmm9{%k1}
+    vprorvq %zmm31,%zmm16,%zmm0{%k2}{z}
+    vprorvq %ymm19,%ymm2,%ymm23
+    vprorvq %xmm1,%xmm30,%xmm18{%k1}
+    vprorvq (%rax),%zmm2,%zmm3
+    vprorvq 0x40(%rax),%zmm28,%zmm9{%k1}
+    vprorvq 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vprorvq -0x100(%rsp),%ymm2,%ymm23
+    vprorvq 0x44(%rax),%xmm30,%xmm18{%k1}
+    vprorvq 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vprorvq -8(%rax),%zmm28,%zmm9
+    vprorvq 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vprorvq 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vprorvq 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vprorvq 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vprorvq 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpermt2d %zmm1,%zmm2,%zmm3
+    vpermt2d %zmm17,%zmm28,%zmm9{%k1}
+    vpermt2d %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpermt2d %ymm19,%ymm2,%ymm23
+    vpermt2d %xmm1,%xmm30,%xmm18{%k1}
+    vpermt2d (%rax),%zmm2,%zmm3
+    vpermt2d 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpermt2d 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpermt2d -0x100(%rsp),%ymm2,%ymm23
+    vpermt2d 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpermt2d 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpermt2d -8(%rax),%zmm28,%zmm9
+    vpermt2d 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpermt2d 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpermt2d 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpermt2d 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpermt2d 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpermt2q %zmm1,%zmm2,%zmm3
+    vpermt2q %zmm17,%zmm28,%zmm9{%k1}
+    vpermt2q %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpermt2q %ymm19,%ymm2,%ymm23
+    vpermt2q %xmm1,%xmm30,%xmm18{%k1}
+    vpermt2q (%rax),%zmm2,%zmm3
+    vpermt2q 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpermt2q 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpermt2q -0x100(%rsp),%ymm2,%ymm23
+    vpermt2q 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpermt2q 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpermt2q -8(%rax),%zmm28,%zmm9
+    vpermt2q 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpermt2q 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpermt2q 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpermt2q 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpermt2q 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpermt2ps %zmm1,%zmm2,%zmm3
+    vpermt2ps %zmm17,%zmm28,%zmm9{%k1}
+    vpermt2ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpermt2ps %ymm19,%ymm2,%ymm23
+    vpermt2ps %xmm1,%xmm30,%xmm18{%k1}
+    vpermt2ps (%rax),%zmm2,%zmm3
+    vpermt2ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpermt2ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpermt2ps -0x100(%rsp),%ymm2,%ymm23
+    vpermt2ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpermt2ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpermt2ps -8(%rax),%zmm28,%zmm9
+    vpermt2ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpermt2ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpermt2ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpermt2ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpermt2ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpermt2pd %zmm1,%zmm2,%zmm3
+    vpermt2pd %zmm17,%zmm28,%zmm9{%k1}
+    vpermt2pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpermt2pd %ymm19,%ymm2,%ymm23
+    vpermt2pd %xmm1,%xmm30,%xmm18{%k1}
+    vpermt2pd (%rax),%zmm2,%zmm3
+    vpermt2pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpermt2pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpermt2pd -0x100(%rsp),%ymm2,%ymm23
+    vpermt2pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpermt2pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpermt2pd -8(%rax),%zmm28,%zmm9
+    vpermt2pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpermt2pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpermt2pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpermt2pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpermt2pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpermi2d %zmm1,%zmm2,%zmm3
+    vpermi2d %zmm17,%zmm28,%zmm9{%k1}
+    vpermi2d %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpermi2d %ymm19,%ymm2,%ymm23
+    vpermi2d %xmm1,%xmm30,%xmm18{%k1}
+    vpermi2d (%rax),%zmm2,%zmm3
+    vpermi2d 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpermi2d 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpermi2d -0x100(%rsp),%ymm2,%ymm23
+    vpermi2d 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpermi2d 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpermi2d -8(%rax),%zmm28,%zmm9
+    vpermi2d 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpermi2d 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpermi2d 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpermi2d 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpermi2d 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpermi2q %zmm1,%zmm2,%zmm3
+    vpermi2q %zmm17,%zmm28,%zmm9{%k1}
+    vpermi2q %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpermi2q %ymm19,%ymm2,%ymm23
+    vpermi2q %xmm1,%xmm30,%xmm18{%k1}
+    vpermi2q (%rax),%zmm2,%zmm3
+    vpermi2q 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpermi2q 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpermi2q -0x100(%rsp),%ymm2,%ymm23
+    vpermi2q 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpermi2q 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpermi2q -8(%rax),%zmm28,%zmm9
+    vpermi2q 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpermi2q 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpermi2q 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpermi2q 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpermi2q 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpermi2ps %zmm1,%zmm2,%zmm3
+    vpermi2ps %zmm17,%zmm28,%zmm9{%k1}
+    vpermi2ps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpermi2ps %ymm19,%ymm2,%ymm23
+    vpermi2ps %xmm1,%xmm30,%xmm18{%k1}
+    vpermi2ps (%rax),%zmm2,%zmm3
+    vpermi2ps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpermi2ps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpermi2ps -0x100(%rsp),%ymm2,%ymm23
+    vpermi2ps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpermi2ps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpermi2ps -8(%rax),%zmm28,%zmm9
+    vpermi2ps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vpermi2ps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vpermi2ps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vpermi2ps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vpermi2ps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vpermi2pd %zmm1,%zmm2,%zmm3
+    vpermi2pd %zmm17,%zmm28,%zmm9{%k1}
+    vpermi2pd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpermi2pd %ymm19,%ymm2,%ymm23
+    vpermi2pd %xmm1,%xmm30,%xmm18{%k1}
+    vpermi2pd (%rax),%zmm2,%zmm3
+    vpermi2pd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpermi2pd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpermi2pd -0x100(%rsp),%ymm2,%ymm23
+    vpermi2pd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpermi2pd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpermi2pd -8(%rax),%zmm28,%zmm9
+    vpermi2pd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vpermi2pd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vpermi2pd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vpermi2pd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vpermi2pd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vpermw %zmm1,%zmm2,%zmm3
+    vpermw %zmm17,%zmm28,%zmm9{%k1}
+    vpermw %zmm31,%zmm16,%zmm0{%k2}{z}
+    vpermw %ymm19,%ymm2,%ymm23
+    vpermw %xmm1,%xmm30,%xmm18{%k1}
+    vpermw (%rax),%zmm2,%zmm3
+    vpermw 0x40(%rax),%zmm28,%zmm9{%k1}
+    vpermw 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vpermw -0x100(%rsp),%ymm2,%ymm23
+    vpermw 0x44(%rax),%xmm30,%xmm18{%k1}
+    vpermw 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vpermw -8(%rax),%zmm28,%zmm9
+    vpcompressd %zmm3,%zmm9{%k1}{z}
+    vpcompressd %zmm3,0x40(%rax){%k2}
+    vpcompressd %zmm3,4(%rax)
+    vpcompressd %ymm20,%ymm9{%k1}{z}
+    vpcompressd %ymm20,0x40(%rax){%k2}
+    vpcompressd %ymm20,4(%rax)
+    vpcompressd %xmm31,%xmm9{%k1}{z}
+    vpcompressd %xmm31,0x40(%rax){%k2}
+    vpcompressd %xmm31,4(%rax)
+    vpcompressq %zmm3,%zmm9{%k1}{z}
+    vpcompressq %zmm3,0x40(%rax){%k2}
+    vpcompressq %zmm3,8(%rax)
+    vpcompressq %ymm20,%ymm9{%k1}{z}
+    vpcompressq %ymm20,0x40(%rax){%k2}
+    vpcompressq %ymm20,8(%rax)
+    vpcompressq %xmm31,%xmm9{%k1}{z}
+    vpcompressq %xmm31,0x40(%rax){%k2}
+    vpcompressq %xmm31,8(%rax)
+    vcompressps %zmm3,%zmm9{%k1}{z}
+    vcompressps %zmm3,0x40(%rax){%k2}
+    vcompressps %zmm3,4(%rax)
+    vcompressps %ymm20,%ymm9{%k1}{z}
+    vcompressps %ymm20,0x40(%rax){%k2}
+    vcompressps %ymm20,4(%rax)
+    vcompressps %xmm31,%xmm9{%k1}{z}
+    vcompressps %xmm31,0x40(%rax){%k2}
+    vcompressps %xmm31,4(%rax)
+    vcompresspd %zmm3,%zmm9{%k1}{z}
+    vcompresspd %zmm3,0x40(%rax){%k2}
+    vcompresspd %zmm3,8(%rax)
+    vcompresspd %ymm20,%ymm9{%k1}{z}
+    vcompresspd %ymm20,0x40(%rax){%k2}
+    vcompresspd %ymm20,8(%rax)
+    vcompresspd %xmm31,%xmm9{%k1}{z}
+    vcompresspd %xmm31,0x40(%rax){%k2}
+    vcompresspd %xmm31,8(%rax)
+    vpexpandd %zmm1,%zmm3
+    vpexpandd %zmm17,%zmm9{%k1}
+    vpexpandd %zmm31,%zmm0{%k2}{z}
+    vpexpandd %ymm19,%ymm23
+    vpexpandd %xmm1,%xmm18{%k1}
+    vpexpandd (%rax),%zmm3
+    vpexpandd 0x40(%rax),%zmm9{%k1}
+    vpexpandd 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vpexpandd -0x100(%rsp),%ymm23
+    vpexpandd 0x44(%rax),%xmm18{%k1}
+    vpexpandd 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vpexpandd -8(%rax),%zmm9
+    vpexpandq %zmm1,%zmm3
+    vpexpandq %zmm17,%zmm9{%k1}
+    vpexpandq %zmm31,%zmm0{%k2}{z}
+    vpexpandq %ymm19,%ymm23
+    vpexpandq %xmm1,%xmm18{%k1}
+    vpexpandq (%rax),%zmm3
+    vpexpandq 0x40(%rax),%zmm9{%k1}
+    vpexpandq 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vpexpandq -0x100(%rsp),%ymm23
+    vpexpandq 0x44(%rax),%xmm18{%k1}
+    vpexpandq 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vpexpandq -8(%rax),%zmm9
+    vexpandps %zmm1,%zmm3
+    vexpandps %zmm17,%zmm9{%k1}
+    vexpandps %zmm31,%zmm0{%k2}{z}
+    vexpandps %ymm19,%ymm23
+    vexpandps %xmm1,%xmm18{%k1}
+    vexpandps (%rax),%zmm3
+    vexpandps 0x40(%rax),%zmm9{%k1}
+    vexpandps 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vexpandps -0x100(%rsp),%ymm23
+    vexpandps 0x44(%rax),%xmm18{%k1}
+    vexpandps 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vexpandps -8(%rax),%zmm9
+    vexpandpd %zmm1,%zmm3
+    vexpandpd %zmm17,%zmm9{%k1}
+    vexpandpd %zmm31,%zmm0{%k2}{z}
+    vexpandpd %ymm19,%ymm23
+    vexpandpd %xmm1,%xmm18{%k1}
+    vexpandpd (%rax),%zmm3
+    vexpandpd 0x40(%rax),%zmm9{%k1}
+    vexpandpd 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vexpandpd -0x100(%rsp),%ymm23
+    vexpandpd 0x44(%rax),%xmm18{%k1}
+    vexpandpd 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vexpandpd -8(%rax),%zmm9
+    vextracti32x4 $1,%zmm3,%xmm12{%k1}{z}
+    vextracti32x4 $0,%zmm23,0x40(%rax){%k2}
+    vextracti32x4 $1,%zmm2,0x10(%r12)
+    vextracti32x4 $1,%zmm2,0x20(%r12)
+    vextracti32x4 $1,%ymm3,%xmm12{%k1}{z}
+    vextracti32x4 $0,%ymm23,0x40(%rax){%k2}
+    vextracti32x4 $1,%ymm2,0x10(%r12)
+    vextracti32x4 $1,%ymm2,0x20(%r12)
+    vextracti64x4 $1,%zmm3,%ymm12{%k1}{z}
+    vextracti64x4 $0,%zmm23,0x40(%rax){%k2}
+    vextracti64x4 $1,%zmm2,0x10(%r12)
+    vextracti64x4 $1,%zmm2,0x20(%r12)
+    vextractf32x4 $1,%zmm3,%xmm12{%k1}{z}
+    vextractf32x4 $0,%zmm23,0x40(%rax){%k2}
+    vextractf32x4 $1,%zmm2,0x10(%r12)
+    vextractf32x4 $1,%zmm2,0x20(%r12)
+    vextractf32x4 $1,%ymm3,%xmm12{%k1}{z}
+    vextractf32x4 $0,%ymm23,0x40(%rax){%k2}
+    vextractf32x4 $1,%ymm2,0x10(%r12)
+    vextractf32x4 $1,%ymm2,0x20(%r12)
+    vextractf64x4 $1,%zmm3,%ymm12{%k1}{z}
+    vextractf64x4 $0,%zmm23,0x40(%rax){%k2}
+    vextractf64x4 $1,%zmm2,0x10(%r12)
+    vextractf64x4 $1,%zmm2,0x20(%r12)
+    vinserti32x4 $1,%xmm19,%zmm4,%zmm12{%k1}
+    vinserti32x4 $0,0x40(%rax),%zmm29,%zmm2
+    vinserti32x4 $1,0x10(%rax),%zmm29,%zmm2
+    vinserti32x4 $1,%xmm19,%ymm4,%ymm12{%k1}
+    vinserti32x4 $0,0x40(%rax),%ymm29,%ymm2
+    vinserti32x4 $1,0x10(%rax),%ymm29,%ymm2
+    vinserti64x4 $1,%ymm19,%zmm4,%zmm12{%k1}
+    vinserti64x4 $0,0x40(%rax),%zmm29,%zmm2
+    vinserti64x4 $1,0x10(%rax),%zmm29,%zmm2
+    vinsertf32x4 $1,%xmm19,%zmm4,%zmm12{%k1}
+    vinsertf32x4 $0,0x40(%rax),%zmm29,%zmm2
+    vinsertf32x4 $1,0x10(%rax),%zmm29,%zmm2
+    vinsertf32x4 $1,%xmm19,%ymm4,%ymm12{%k1}
+    vinsertf32x4 $0,0x40(%rax),%ymm29,%ymm2
+    vinsertf32x4 $1,0x10(%rax),%ymm29,%ymm2
+    vinsertf64x4 $1,%ymm19,%zmm4,%zmm12{%k1}
+    vinsertf64x4 $0,0x40(%rax),%zmm29,%zmm2
+    vinsertf64x4 $1,0x10(%rax),%zmm29,%zmm2
+    vbroadcasti32x4 0x40(%rax),%zmm3
+    vbroadcasti32x4 0x20(%rax),%zmm3
+    vbroadcasti32x4 0x10(%rax),%zmm3
+    vbroadcasti32x4 0x40(%rax),%ymm20{%k1}
+    vbroadcasti32x4 0x20(%rax),%ymm20
+    vbroadcasti32x4 0x10(%rax),%ymm20
+    vbroadcasti64x4 0x40(%rax),%zmm3
+    vbroadcasti64x4 0x20(%rax),%zmm3
+    vbroadcasti64x4 0x10(%rax),%zmm3
+    vbroadcastf32x4 0x40(%rax),%zmm3
+    vbroadcastf32x4 0x20(%rax),%zmm3
+    vbroadcastf32x4 0x10(%rax),%zmm3
+    vbroadcastf32x4 0x40(%rax),%ymm20{%k1}
+    vbroadcastf32x4 0x20(%rax),%ymm20
+    vbroadcastf32x4 0x10(%rax),%ymm20
+    vbroadcastf64x4 0x40(%rax),%zmm3
+    vbroadcastf64x4 0x20(%rax),%zmm3
+    vbroadcastf64x4 0x10(%rax),%zmm3
+    vpcmpd $5,%zmm1,%zmm2,%k1
+    vpcmpd $5,%zmm17,%zmm28,%k2{%k3}
+    vpcmpd $5,%zmm31,%zmm16,%k3
+    vpcmpd $5,%ymm19,%ymm2,%k4{%k3}
+    vpcmpd $5,%xmm1,%xmm30,%k5
+    vpcmpd $0x7f,(%rax),%zmm2,%k1
+    vpcmpd $0x7f,0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpd $0x7f,0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpd $0x7f,-0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpd $0x7f,0x44(%rax),%xmm30,%k5
+    vpcmpd $0x7f,0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpd $0x7f,-8(%rax),%zmm28,%k7
+    vpcmpd $1,0x40(%rax){1to16},%zmm2,%k2{%k3}
+    vpcmpd $1,0x40(%rax){1to16},%zmm28,%k2{%k3}
+    vpcmpd $1,0x40(%rax){1to16},%zmm16,%k2{%k3}
+    vpcmpd $1,0x40(%rax){1to8},%ymm2,%k2{%k3}
+    vpcmpd $1,0x40(%rax){1to4},%xmm30,%k2{%k3}
+    vpcmpud $5,%zmm1,%zmm2,%k1
+    vpcmpud $5,%zmm17,%zmm28,%k2{%k3}
+    vpcmpud $5,%zmm31,%zmm16,%k3
+    vpcmpud $5,%ymm19,%ymm2,%k4{%k3}
+    vpcmpud $5,%xmm1,%xmm30,%k5
+    vpcmpud $0x7f,(%rax),%zmm2,%k1
+    vpcmpud $0x7f,0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpud $0x7f,0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpud $0x7f,-0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpud $0x7f,0x44(%rax),%xmm30,%k5
+    vpcmpud $0x7f,0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpud $0x7f,-8(%rax),%zmm28,%k7
+    vpcmpud $1,0x40(%rax){1to16},%zmm2,%k2{%k3}
+    vpcmpud $1,0x40(%rax){1to16},%zmm28,%k2{%k3}
+    vpcmpud $1,0x40(%rax){1to16},%zmm16,%k2{%k3}
+    vpcmpud $1,0x40(%rax){1to8},%ymm2,%k2{%k3}
+    vpcmpud $1,0x40(%rax){1to4},%xmm30,%k2{%k3}
+    vpcmpq $5,%zmm1,%zmm2,%k1
+    vpcmpq $5,%zmm17,%zmm28,%k2{%k3}
+    vpcmpq $5,%zmm31,%zmm16,%k3
+    vpcmpq $5,%ymm19,%ymm2,%k4{%k3}
+    vpcmpq $5,%xmm1,%xmm30,%k5
+    vpcmpq $0x7f,(%rax),%zmm2,%k1
+    vpcmpq $0x7f,0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpq $0x7f,0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpq $0x7f,-0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpq $0x7f,0x44(%rax),%xmm30,%k5
+    vpcmpq $0x7f,0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpq $0x7f,-8(%rax),%zmm28,%k7
+    vpcmpq $1,0x40(%rax){1to8},%zmm2,%k2{%k3}
+    vpcmpq $1,0x40(%rax){1to8},%zmm28,%k2{%k3}
+    vpcmpq $1,0x40(%rax){1to8},%zmm16,%k2{%k3}
+    vpcmpq $1,0x40(%rax){1to4},%ymm2,%k2{%k3}
+    vpcmpq $1,0x40(%rax){1to2},%xmm30,%k2{%k3}
+    vpcmpuq $5,%zmm1,%zmm2,%k1
+    vpcmpuq $5,%zmm17,%zmm28,%k2{%k3}
+    vpcmpuq $5,%zmm31,%zmm16,%k3
+    vpcmpuq $5,%ymm19,%ymm2,%k4{%k3}
+    vpcmpuq $5,%xmm1,%xmm30,%k5
+    vpcmpuq $0x7f,(%rax),%zmm2,%k1
+    vpcmpuq $0x7f,0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpuq $0x7f,0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpuq $0x7f,-0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpuq $0x7f,0x44(%rax),%xmm30,%k5
+    vpcmpuq $0x7f,0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpuq $0x7f,-8(%rax),%zmm28,%k7
+    vpcmpuq $1,0x40(%rax){1to8},%zmm2,%k2{%k3}
+    vpcmpuq $1,0x40(%rax){1to8},%zmm28,%k2{%k3}
+    vpcmpuq $1,0x40(%rax){1to8},%zmm16,%k2{%k3}
+    vpcmpuq $1,0x40(%rax){1to4},%ymm2,%k2{%k3}
+    vpcmpuq $1,0x40(%rax){1to2},%xmm30,%k2{%k3}
+    vpcmpb $5,%zmm1,%zmm2,%k1
+    vpcmpb $5,%zmm17,%zmm28,%k2{%k3}
+    vpcmpb $5,%zmm31,%zmm16,%k3
+    vpcmpb $5,%ymm19,%ymm2,%k4{%k3}
+    vpcmpb $5,%xmm1,%xmm30,%k5
+    vpcmpb $0x7f,(%rax),%zmm2,%k1
+    vpcmpb $0x7f,0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpb $0x7f,0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpb $0x7f,-0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpb $0x7f,0x44(%rax),%xmm30,%k5
+    vpcmpb $0x7f,0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpb $0x7f,-8(%rax),%zmm28,%k7
+    vpcmpub $5,%zmm1,%zmm2,%k1
+    vpcmpub $5,%zmm17,%zmm28,%k2{%k3}
+    vpcmpub $5,%zmm31,%zmm16,%k3
+    vpcmpub $5,%ymm19,%ymm2,%k4{%k3}
+    vpcmpub $5,%xmm1,%xmm30,%k5
+    vpcmpub $0x7f,(%rax),%zmm2,%k1
+    vpcmpub $0x7f,0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpub $0x7f,0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpub $0x7f,-0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpub $0x7f,0x44(%rax),%xmm30,%k5
+    vpcmpub $0x7f,0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpub $0x7f,-8(%rax),%zmm28,%k7
+    vpcmpw $5,%zmm1,%zmm2,%k1
+    vpcmpw $5,%zmm17,%zmm28,%k2{%k3}
+    vpcmpw $5,%zmm31,%zmm16,%k3
+    vpcmpw $5,%ymm19,%ymm2,%k4{%k3}
+    vpcmpw $5,%xmm1,%xmm30,%k5
+    vpcmpw $0x7f,(%rax),%zmm2,%k1
+    vpcmpw $0x7f,0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpw $0x7f,0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpw $0x7f,-0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpw $0x7f,0x44(%rax),%xmm30,%k5
+    vpcmpw $0x7f,0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpw $0x7f,-8(%rax),%zmm28,%k7
+    vpcmpuw $5,%zmm1,%zmm2,%k1
+    vpcmpuw $5,%zmm17,%zmm28,%k2{%k3}
+    vpcmpuw $5,%zmm31,%zmm16,%k3
+    vpcmpuw $5,%ymm19,%ymm2,%k4{%k3}
+    vpcmpuw $5,%xmm1,%xmm30,%k5
+    vpcmpuw $0x7f,(%rax),%zmm2,%k1
+    vpcmpuw $0x7f,0x40(%rax),%zmm28,%k2{%k3}
+    vpcmpuw $0x7f,0x80(%r13,%rcx,4),%zmm16,%k3
+    vpcmpuw $0x7f,-0x100(%rsp),%ymm2,%k4{%k3}
+    vpcmpuw $0x7f,0x44(%rax),%xmm30,%k5
+    vpcmpuw $0x7f,0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vpcmpuw $0x7f,-8(%rax),%zmm28,%k7
+    vptestmd %zmm1,%zmm2,%k1
+    vptestmd %zmm17,%zmm28,%k2{%k3}
+    vptestmd %zmm31,%zmm16,%k3
+    vptestmd %ymm19,%ymm2,%k4{%k3}
+    vptestmd %xmm1,%xmm30,%k5
+    vptestmd (%rax),%zmm2,%k1
+    vptestmd 0x40(%rax),%zmm28,%k2{%k3}
+    vptestmd 0x80(%r13,%rcx,4),%zmm16,%k3
+    vptestmd -0x100(%rsp),%ymm2,%k4{%k3}
+    vptestmd 0x44(%rax),%xmm30,%k5
+    vptestmd 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vptestmd -8(%rax),%zmm28,%k7
+    vptestmd 0x40(%rax){1to16},%zmm2,%k2{%k3}
+    vptestmd 0x40(%rax){1to16},%zmm28,%k2{%k3}
+    vptestmd 0x40(%rax){1to16},%zmm16,%k2{%k3}
+    vptestmd 0x40(%rax){1to8},%ymm2,%k2{%k3}
+    vptestmd 0x40(%rax){1to4},%xmm30,%k2{%k3}
+    vptestmq %zmm1,%zmm2,%k1
+    vptestmq %zmm17,%zmm28,%k2{%k3}
+    vptestmq %zmm31,%zmm16,%k3
+    vptestmq %ymm19,%ymm2,%k4{%k3}
+    vptestmq %xmm1,%xmm30,%k5
+    vptestmq (%rax),%zmm2,%k1
+    vptestmq 0x40(%rax),%zmm28,%k2{%k3}
+    vptestmq 0x80(%r13,%rcx,4),%zmm16,%k3
+    vptestmq -0x100(%rsp),%ymm2,%k4{%k3}
+    vptestmq 0x44(%rax),%xmm30,%k5
+    vptestmq 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vptestmq -8(%rax),%zmm28,%k7
+    vptestmq 0x40(%rax){1to8},%zmm2,%k2{%k3}
+    vptestmq 0x40(%rax){1to8},%zmm28,%k2{%k3}
+    vptestmq 0x40(%rax){1to8},%zmm16,%k2{%k3}
+    vptestmq 0x40(%rax){1to4},%ymm2,%k2{%k3}
+    vptestmq 0x40(%rax){1to2},%xmm30,%k2{%k3}
+    vptestnmd %zmm1,%zmm2,%k1
+    vptestnmd %zmm17,%zmm28,%k2{%k3}
+    vptestnmd %zmm31,%zmm16,%k3
+    vptestnmd %ymm19,%ymm2,%k4{%k3}
+    vptestnmd %xmm1,%xmm30,%k5
+    vptestnmd (%rax),%zmm2,%k1
+    vptestnmd 0x40(%rax),%zmm28,%k2{%k3}
+    vptestnmd 0x80(%r13,%rcx,4),%zmm16,%k3
+    vptestnmd -0x100(%rsp),%ymm2,%k4{%k3}
+    vptestnmd 0x44(%rax),%xmm30,%k5
+    vptestnmd 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vptestnmd -8(%rax),%zmm28,%k7
+    vptestnmd 0x40(%rax){1to16},%zmm2,%k2{%k3}
+    vptestnmd 0x40(%rax){1to16},%zmm28,%k2{%k3}
+    vptestnmd 0x40(%rax){1to16},%zmm16,%k2{%k3}
+    vptestnmd 0x40(%rax){1to8},%ymm2,%k2{%k3}
+    vptestnmd 0x40(%rax){1to4},%xmm30,%k2{%k3}
+    vptestnmq %zmm1,%zmm2,%k1
+    vptestnmq %zmm17,%zmm28,%k2{%k3}
+    vptestnmq %zmm31,%zmm16,%k3
+    vptestnmq %ymm19,%ymm2,%k4{%k3}
+    vptestnmq %xmm1,%xmm30,%k5
+    vptestnmq (%rax),%zmm2,%k1
+    vptestnmq 0x40(%rax),%zmm28,%k2{%k3}
+    vptestnmq 0x80(%r13,%rcx,4),%zmm16,%k3
+    vptestnmq -0x100(%rsp),%ymm2,%k4{%k3}
+    vptestnmq 0x44(%rax),%xmm30,%k5
+    vptestnmq 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vptestnmq -8(%rax),%zmm28,%k7
+    vptestnmq 0x40(%rax){1to8},%zmm2,%k2{%k3}
+    vptestnmq 0x40(%rax){1to8},%zmm28,%k2{%k3}
+    vptestnmq 0x40(%rax){1to8},%zmm16,%k2{%k3}
+    vptestnmq 0x40(%rax){1to4},%ymm2,%k2{%k3}
+    vptestnmq 0x40(%rax){1to2},%xmm30,%k2{%k3}
+    vptestmb %zmm1,%zmm2,%k1
+    vptestmb %zmm17,%zmm28,%k2{%k3}
+    vptestmb %zmm31,%zmm16,%k3
+    vptestmb %ymm19,%ymm2,%k4{%k3}
+    vptestmb %xmm1,%xmm30,%k5
+    vptestmb (%rax),%zmm2,%k1
+    vptestmb 0x40(%rax),%zmm28,%k2{%k3}
+    vptestmb 0x80(%r13,%rcx,4),%zmm16,%k3
+    vptestmb -0x100(%rsp),%ymm2,%k4{%k3}
+    vptestmb 0x44(%rax),%xmm30,%k5
+    vptestmb 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vptestmb -8(%rax),%zmm28,%k7
+    vptestmw %zmm1,%zmm2,%k1
+    vptestmw %zmm17,%zmm28,%k2{%k3}
+    vptestmw %zmm31,%zmm16,%k3
+    vptestmw %ymm19,%ymm2,%k4{%k3}
+    vptestmw %xmm1,%xmm30,%k5
+    vptestmw (%rax),%zmm2,%k1
+    vptestmw 0x40(%rax),%zmm28,%k2{%k3}
+    vptestmw 0x80(%r13,%rcx,4),%zmm16,%k3
+    vptestmw -0x100(%rsp),%ymm2,%k4{%k3}
+    vptestmw 0x44(%rax),%xmm30,%k5
+    vptestmw 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vptestmw -8(%rax),%zmm28,%k7
+    vptestnmb %zmm1,%zmm2,%k1
+    vptestnmb %zmm17,%zmm28,%k2{%k3}
+    vptestnmb %zmm31,%zmm16,%k3
+    vptestnmb %ymm19,%ymm2,%k4{%k3}
+    vptestnmb %xmm1,%xmm30,%k5
+    vptestnmb (%rax),%zmm2,%k1
+    vptestnmb 0x40(%rax),%zmm28,%k2{%k3}
+    vptestnmb 0x80(%r13,%rcx,4),%zmm16,%k3
+    vptestnmb -0x100(%rsp),%ymm2,%k4{%k3}
+    vptestnmb 0x44(%rax),%xmm30,%k5
+    vptestnmb 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vptestnmb -8(%rax),%zmm28,%k7
+    vptestnmw %zmm1,%zmm2,%k1
+    vptestnmw %zmm17,%zmm28,%k2{%k3}
+    vptestnmw %zmm31,%zmm16,%k3
+    vptestnmw %ymm19,%ymm2,%k4{%k3}
+    vptestnmw %xmm1,%xmm30,%k5
+    vptestnmw (%rax),%zmm2,%k1
+    vptestnmw 0x40(%rax),%zmm28,%k2{%k3}
+    vptestnmw 0x80(%r13,%rcx,4),%zmm16,%k3
+    vptestnmw -0x100(%rsp),%ymm2,%k4{%k3}
+    vptestnmw 0x44(%rax),%xmm30,%k5
+    vptestnmw 0x1000(%r9,%r10,2),%zmm2,%k6{%k3}
+    vptestnmw -8(%rax),%zmm28,%k7
+    vrndscaleps $3,%zmm1,%zmm3
+    vrndscaleps $3,%zmm17,%zmm9{%k1}
+    vrndscaleps $3,%zmm31,%zmm0{%k2}{z}
+    vrndscaleps $3,%ymm19,%ymm23
+    vrndscaleps $3,%xmm1,%xmm18{%k1}
+    vrndscaleps $0x1b,(%rax),%zmm3
+    vrndscaleps $0x1b,0x40(%rax),%zmm9{%k1}
+    vrndscaleps $0x1b,0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vrndscaleps $0x1b,-0x100(%rsp),%ymm23
+    vrndscaleps $0x1b,0x44(%rax),%xmm18{%k1}
+    vrndscaleps $0x1b,0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vrndscaleps $0x1b,-8(%rax),%zmm9
+    vrndscaleps $1,0x40(%rax){1to16},%zmm3
+    vrndscaleps $1,0x40(%rax){1to16},%zmm9
+    vrndscaleps $1,0x40(%rax){1to16},%zmm0
+    vrndscaleps $1,0x40(%rax){1to8},%ymm23
+    vrndscaleps $1,0x40(%rax){1to4},%xmm18
+    vrndscaleps $4,{sae},%zmm1,%zmm30
+    vrndscalepd $3,%zmm1,%zmm3
+    vrndscalepd $3,%zmm17,%zmm9{%k1}
+    vrndscalepd $3,%zmm31,%zmm0{%k2}{z}
+    vrndscalepd $3,%ymm19,%ymm23
+    vrndscalepd $3,%xmm1,%xmm18{%k1}
+    vrndscalepd $0x1b,(%rax),%zmm3
+    vrndscalepd $0x1b,0x40(%rax),%zmm9{%k1}
+    vrndscalepd $0x1b,0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vrndscalepd $0x1b,-0x100(%rsp),%ymm23
+    vrndscalepd $0x1b,0x44(%rax),%xmm18{%k1}
+    vrndscalepd $0x1b,0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vrndscalepd $0x1b,-8(%rax),%zmm9
+    vrndscalepd $1,0x40(%rax){1to8},%zmm3
+    vrndscalepd $1,0x40(%rax){1to8},%zmm9
+    vrndscalepd $1,0x40(%rax){1to8},%zmm0
+    vrndscalepd $1,0x40(%rax){1to4},%ymm23
+    vrndscalepd $1,0x40(%rax){1to2},%xmm18
+    vrndscalepd $4,{sae},%zmm1,%zmm30
+    vrcp14ps %zmm1,%zmm3
+    vrcp14ps %zmm17,%zmm9{%k1}
+    vrcp14ps %zmm31,%zmm0{%k2}{z}
+    vrcp14ps %ymm19,%ymm23
+    vrcp14ps %xmm1,%xmm18{%k1}
+    vrcp14ps (%rax),%zmm3
+    vrcp14ps 0x40(%rax),%zmm9{%k1}
+    vrcp14ps 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vrcp14ps -0x100(%rsp),%ymm23
+    vrcp14ps 0x44(%rax),%xmm18{%k1}
+    vrcp14ps 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vrcp14ps -8(%rax),%zmm9
+    vrcp14ps 0x40(%rax){1to16},%zmm3
+    vrcp14ps 0x40(%rax){1to16},%zmm9
+    vrcp14ps 0x40(%rax){1to16},%zmm0
+    vrcp14ps 0x40(%rax){1to8},%ymm23
+    vrcp14ps 0x40(%rax){1to4},%xmm18
+    vrcp14pd %zmm1,%zmm3
+    vrcp14pd %zmm17,%zmm9{%k1}
+    vrcp14pd %zmm31,%zmm0{%k2}{z}
+    vrcp14pd %ymm19,%ymm23
+    vrcp14pd %xmm1,%xmm18{%k1}
+    vrcp14pd (%rax),%zmm3
+    vrcp14pd 0x40(%rax),%zmm9{%k1}
+    vrcp14pd 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vrcp14pd -0x100(%rsp),%ymm23
+    vrcp14pd 0x44(%rax),%xmm18{%k1}
+    vrcp14pd 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vrcp14pd -8(%rax),%zmm9
+    vrcp14pd 0x40(%rax){1to8},%zmm3
+    vrcp14pd 0x40(%rax){1to8},%zmm9
+    vrcp14pd 0x40(%rax){1to8},%zmm0
+    vrcp14pd 0x40(%rax){1to4},%ymm23
+    vrcp14pd 0x40(%rax){1to2},%xmm18
+    vrsqrt14ps %zmm1,%zmm3
+    vrsqrt14ps %zmm17,%zmm9{%k1}
+    vrsqrt14ps %zmm31,%zmm0{%k2}{z}
+    vrsqrt14ps %ymm19,%ymm23
+    vrsqrt14ps %xmm1,%xmm18{%k1}
+    vrsqrt14ps (%rax),%zmm3
+    vrsqrt14ps 0x40(%rax),%zmm9{%k1}
+    vrsqrt14ps 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vrsqrt14ps -0x100(%rsp),%ymm23
+    vrsqrt14ps 0x44(%rax),%xmm18{%k1}
+    vrsqrt14ps 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vrsqrt14ps -8(%rax),%zmm9
+    vrsqrt14ps 0x40(%rax){1to16},%zmm3
+    vrsqrt14ps 0x40(%rax){1to16},%zmm9
+    vrsqrt14ps 0x40(%rax){1to16},%zmm0
+    vrsqrt14ps 0x40(%rax){1to8},%ymm23
+    vrsqrt14ps 0x40(%rax){1to4},%xmm18
+    vrsqrt14pd %zmm1,%zmm3
+    vrsqrt14pd %zmm17,%zmm9{%k1}
+    vrsqrt14pd %zmm31,%zmm0{%k2}{z}
+    vrsqrt14pd %ymm19,%ymm23
+    vrsqrt14pd %xmm1,%xmm18{%k1}
+    vrsqrt14pd (%rax),%zmm3
+    vrsqrt14pd 0x40(%rax),%zmm9{%k1}
+    vrsqrt14pd 0x80(%r13,%rcx,4),%zmm0{%k2}{z}
+    vrsqrt14pd -0x100(%rsp),%ymm23
+    vrsqrt14pd 0x44(%rax),%xmm18{%k1}
+    vrsqrt14pd 0x1000(%r9,%r10,2),%zmm3{%k2}{z}
+    vrsqrt14pd -8(%rax),%zmm9
+    vrsqrt14pd 0x40(%rax){1to8},%zmm3
+    vrsqrt14pd 0x40(%rax){1to8},%zmm9
+    vrsqrt14pd 0x40(%rax){1to8},%zmm0
+    vrsqrt14pd 0x40(%rax){1to4},%ymm23
+    vrsqrt14pd 0x40(%rax){1to2},%xmm18
+    vscalefps %zmm1,%zmm2,%zmm3
+    vscalefps %zmm17,%zmm28,%zmm9{%k1}
+    vscalefps %zmm31,%zmm16,%zmm0{%k2}{z}
+    vscalefps %ymm19,%ymm2,%ymm23
+    vscalefps %xmm1,%xmm30,%xmm18{%k1}
+    vscalefps (%rax),%zmm2,%zmm3
+    vscalefps 0x40(%rax),%zmm28,%zmm9{%k1}
+    vscalefps 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vscalefps -0x100(%rsp),%ymm2,%ymm23
+    vscalefps 0x44(%rax),%xmm30,%xmm18{%k1}
+    vscalefps 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vscalefps -8(%rax),%zmm28,%zmm9
+    vscalefps 0x40(%rax){1to16},%zmm2,%zmm3{%k1}
+    vscalefps 0x40(%rax){1to16},%zmm28,%zmm9{%k1}
+    vscalefps 0x40(%rax){1to16},%zmm16,%zmm0{%k1}
+    vscalefps 0x40(%rax){1to8},%ymm2,%ymm23{%k1}
+    vscalefps 0x40(%rax){1to4},%xmm30,%xmm18{%k1}
+    vscalefps {rz-sae},%zmm1,%zmm17,%zmm30
+    vscalefpd %zmm1,%zmm2,%zmm3
+    vscalefpd %zmm17,%zmm28,%zmm9{%k1}
+    vscalefpd %zmm31,%zmm16,%zmm0{%k2}{z}
+    vscalefpd %ymm19,%ymm2,%ymm23
+    vscalefpd %xmm1,%xmm30,%xmm18{%k1}
+    vscalefpd (%rax),%zmm2,%zmm3
+    vscalefpd 0x40(%rax),%zmm28,%zmm9{%k1}
+    vscalefpd 0x80(%r13,%rcx,4),%zmm16,%zmm0{%k2}{z}
+    vscalefpd -0x100(%rsp),%ymm2,%ymm23
+    vscalefpd 0x44(%rax),%xmm30,%xmm18{%k1}
+    vscalefpd 0x1000(%r9,%r10,2),%zmm2,%zmm3{%k2}{z}
+    vscalefpd -8(%rax),%zmm28,%zmm9
+    vscalefpd 0x40(%rax){1to8},%zmm2,%zmm3{%k1}
+    vscalefpd 0x40(%rax){1to8},%zmm28,%zmm9{%k1}
+    vscalefpd 0x40(%rax){1to8},%zmm16,%zmm0{%k1}
+    vscalefpd 0x40(%rax){1to4},%ymm2,%ymm23{%k1}
+    vscalefpd 0x40(%rax){1to2},%xmm30,%xmm18{%k1}
+    vscalefpd {rz-sae},%zmm1,%zmm17,%zmm30
+    vpscatterdd %zmm2,0x40(%rax,%zmm17,4){%k1}
+    vpscatterdd %zmm26,-8(%r9,%zmm5,8){%k6}
+    vpscatterdd %ymm2,0x40(%rax,%ymm17,4){%k1}
+    vpscatterdd %ymm26,-8(%r9,%ymm5,8){%k6}
+    vpscatterdd %xmm2,0x40(%rax,%xmm17,4){%k1}
+    vpscatterdd %xmm26,-8(%r9,%xmm5,8){%k6}
+    vpscatterdq %zmm2,0x40(%rax,%ymm17,4){%k1}
+    vpscatterdq %zmm26,-8(%r9,%ymm5,8){%k6}
+    vpscatterdq %ymm2,0x40(%rax,%xmm17,4){%k1}
+    vpscatterdq %ymm26,-8(%r9,%xmm5,8){%k6}
+    vpscatterqd %ymm2,0x40(%rax,%zmm17,4){%k1}
+    vpscatterqd %ymm26,-8(%r9,%zmm5,8){%k6}
+    vpscatterqd %xmm2,0x40(%rax,%ymm17,4){%k1}
+    vpscatterqd %xmm26,-8(%r9,%ymm5,8){%k6}
+    vpscatterqq %zmm2,0x40(%rax,%zmm17,4){%k1}
+    vpscatterqq %zmm26,-8(%r9,%zmm5,8){%k6}
+    vpscatterqq %ymm2,0x40(%rax,%ymm17,4){%k1}
+    vpscatterqq %ymm26,-8(%r9,%ymm5,8){%k6}
+    vpscatterqq %xmm2,0x40(%rax,%xmm17,4){%k1}
+    vpscatterqq %xmm26,-8(%r9,%xmm5,8){%k6}
+    vscatterdps %zmm2,0x40(%rax,%zmm17,4){%k1}
+    vscatterdps %zmm26,-8(%r9,%zmm5,8){%k6}
+    vscatterdps %ymm2,0x40(%rax,%ymm17,4){%k1}
+    vscatterdps %ymm26,-8(%r9,%ymm5,8){%k6}
+    vscatterdps %xmm2,0x40(%rax,%xmm17,4){%k1}
+    vscatterdps %xmm26,-8(%r9,%xmm5,8){%k6}
+    vscatterdpd %zmm2,0x40(%rax,%ymm17,4){%k1}
+    vscatterdpd %zmm26,-8(%r9,%ymm5,8){%k6}
+    vscatterdpd %ymm2,0x40(%rax,%xmm17,4){%k1}
+    vscatterdpd %ymm26,-8(%r9,%xmm5,8){%k6}
+    vscatterqps %ymm2,0x40(%rax,%zmm17,4){%k1}
+    vscatterqps %ymm26,-8(%r9,%zmm5,8){%k6}
+    vscatterqps %xmm2,0x40(%rax,%ymm17,4){%k1}
+    vscatterqps %xmm26,-8(%r9,%ymm5,8){%k6}
+    vscatterqpd %zmm2,0x40(%rax,%zmm17,4){%k1}
+    vscatterqpd %zmm26,-8(%r9,%zmm5,8){%k6}
+    vscatterqpd %ymm2,0x40(%rax,%ymm17,4){%k1}
+    vscatterqpd %ymm26,-8(%r9,%ymm5,8){%k6}
+    vscatterqpd %xmm2,0x40(%rax,%xmm17,4){%k1}
+    vscatterqpd %xmm26,-8(%r9,%xmm5,8){%k6}
+    kmovb %k1,%k2
+    kmovb (%rax),%k3
+    kmovb %k4,8(%rsp)
+    kmovb %eax,%k5
+    kmovb %k6,%eax
+    kmovb %k6,%r9d
+    kandb %k1,%k2,%k3
+    kandnb %k1,%k2,%k3
+    korb %k1,%k2,%k3
+    kxnorb %k1,%k2,%k3
+    kxorb %k1,%k2,%k3
+    kaddb %k1,%k2,%k3
+    knotb %k1,%k7
+    kortestb %k1,%k7
+    ktestb %k1,%k7
+    kmovw %k1,%k2
+    kmovw (%rax),%k3
+    kmovw %k4,8(%rsp)
+    kmovw %eax,%k5
+    kmovw %k6,%eax
+    kmovw %k6,%r9d
+    kandw %k1,%k2,%k3
+    kandnw %k1,%k2,%k3
+    korw %k1,%k2,%k3
+    kxnorw %k1,%k2,%k3
+    kxorw %k1,%k2,%k3
+    kaddw %k1,%k2,%k3
+    knotw %k1,%k7
+    kortestw %k1,%k7
+    ktestw %k1,%k7
+    kmovd %k1,%k2
+    kmovd (%rax),%k3
+    kmovd %k4,8(%rsp)
+    kmovd %eax,%k5
+    kmovd %k6,%eax
+    kmovd %k6,%r9d
+    kandd %k1,%k2,%k3
+    kandnd %k1,%k2,%k3
+    kord %k1,%k2,%k3
+    kxnord %k1,%k2,%k3
+    kxord %k1,%k2,%k3
+    kaddd %k1,%k2,%k3
+    knotd %k1,%k7
+    kortestd %k1,%k7
+    ktestd %k1,%k7
+    kmovq %k1,%k2
+    kmovq (%rax),%k3
+    kmovq %k4,8(%rsp)
+    kmovq %rax,%k5
+    kmovq %k6,%rax
+    kmovq %k6,%r9
+    kandq %k1,%k2,%k3
+    kandnq %k1,%k2,%k3
+    korq %k1,%k2,%k3
+    kxnorq %k1,%k2,%k3
+    kxorq %k1,%k2,%k3
+    kaddq %k1,%k2,%k3
+    knotq %k1,%k7
+    kortestq %k1,%k7
+    ktestq %k1,%k7
+vmaxps {sae},%zmm1,%zmm2,%zmm3
+vmaxss {sae},%xmm1,%xmm2,%xmm3
+vcomiss {sae},%xmm1,%xmm2
+vcvtps2pd {sae},%ymm1,%zmm2
+vaddps {rz-sae},%zmm1,%zmm2,%zmm3
+vaddss {rd-sae},%xmm1,%xmm2,%xmm3
+vaddps %xmm17,%xmm2,%xmm3
+vaddps 64(%rax),%zmm2,%zmm3
+vaddps 256(%rax){1to16},%zmm2,%zmm3{%k1}{z}
+vcvtpd2ps (%rax){1to4},%xmm1
+vcvtpd2ps %zmm1,%ymm2
+vpgatherdd (%rax,%zmm1,4),%zmm2{%k1}
+vpscatterdd %zmm2,8(%rax,%zmm17,4){%k1}
+kmovw %k1,%k2
+kmovd %eax,%k1
+kmovq %k1,%rax
+kandq %k1,%k2,%k3
+vpcmpeqd %zmm1,%zmm2,%k3{%k1}
+vpternlogd $0x96,%zmm1,%zmm2,%zmm3
+vmovdqu8 %zmm1,(%rax){%k1}
+vsqrtps {rn-sae},%zmm1,%zmm2
+vpaddd %xmm1,%xmm2,%xmm3{%k1}
+vpconflictd %zmm1,%zmm2
+vpconflictq 64(%rax),%ymm2{%k1}{z}
+vpconflictd (%rax){1to16},%zmm3
+vplzcntd %xmm1,%xmm2
+vplzcntq %zmm17,%zmm2
+vpbroadcastmb2q %k1,%zmm2
+vpbroadcastmw2d %k3,%ymm20
+valignd $3,%zmm1,%zmm2,%zmm3
+valignq $1,128(%rax),%ymm2,%ymm3{%k2}
+vshuff32x4 $1,%zmm1,%zmm2,%zmm3
+vshuff64x2 $1,%ymm1,%ymm2,%ymm3
+vshufi32x4 $2,(%rax),%zmm2,%zmm3
+vshufi64x2 $0x44,%zmm1,%zmm2,%zmm30
+vpblendmd %zmm1,%zmm2,%zmm3{%k1}
+vpblendmq %ymm1,%ymm2,%ymm3{%k1}
+vpblendmb %zmm1,%zmm2,%zmm3{%k1}
+vpblendmw 64(%rax),%zmm2,%zmm3{%k1}
+vblendmps %zmm1,%zmm2,%zmm3{%k1}
+vblendmpd (%rax){1to8},%zmm2,%zmm3{%k1}
+vpmovdb %zmm1,%xmm2
+vpmovdb %zmm1,16(%rax)
+vpmovsdb %ymm1,%xmm2
+vpmovusdb %xmm1,%xmm2{%k1}{z}
+vpmovqb %zmm1,8(%rax)
+vpmovsqb %zmm1,%xmm2
+vpmovusqb %zmm1,%xmm2
+vpmovdw %zmm1,%ymm2
+vpmovsdw %zmm1,32(%rax)
+vpmovusdw %ymm1,%xmm2
+vpmovqw %zmm1,%xmm2
+vpmovsqw %zmm1,16(%rax)
+vpmovusqw %ymm1,%xmm2
+vpmovqd %zmm1,%ymm2
+vpmovsqd %zmm1,32(%rax){%k1}
+vpmovusqd %xmm1,%xmm2
+vpmovwb %zmm1,%ymm2
+vpmovswb %zmm1,32(%rax)
+vpmovuswb %xmm1,%xmm2
+vpmovm2b %k1,%zmm2
+vpmovm2w %k1,%ymm2
+vpmovm2d %k1,%xmm2
+vpmovm2q %k1,%zmm22
+vpmovb2m %zmm1,%k2
+vpmovw2m %ymm1,%k2
+vpmovd2m %xmm21,%k2
+vpmovq2m %zmm1,%k7
+vpbroadcastb %eax,%zmm1
+vpbroadcastw %r9d,%ymm1
+vpbroadcastd %eax,%xmm1
+vpbroadcastq %r10,%zmm1{%k1}{z}
+vpbroadcastd %xmm1,%ymm2
+vpbroadcastq (%rax),%zmm2
+vcvtqq2pd %zmm1,%zmm2
+vcvtqq2pd {rn-sae},%zmm1,%zmm2
+vcvtqq2ps %zmm1,%ymm2
+vcvtqq2ps (%rax){1to8},%ymm2
+vcvtuqq2pd %ymm1,%ymm2
+vcvtuqq2ps %zmm1,%ymm2
+vgetexpps %zmm1,%zmm2
+vgetexpps {sae},%zmm1,%zmm2
+vgetexppd 64(%rax),%zmm2
+vgetexpss %xmm1,%xmm2,%xmm3
+vgetexpsd 8(%rax),%xmm2,%xmm3{%k1}
+vfixupimmps $1,%zmm1,%zmm2,%zmm3
+vfixupimmpd $1,(%rax){1to8},%zmm2,%zmm3
+vfixupimmss $2,%xmm1,%xmm2,%xmm3
+vfixupimmsd $2,{sae},%xmm1,%xmm2,%xmm3
+vmovd %eax,%xmm17
+vmovd %xmm17,4(%rax)
+vmovq %rax,%xmm20
+vmovq %xmm20,%rax
+vmovq %xmm20,%xmm1
+vmovq 8(%rax),%xmm25
+vmovq %xmm25,8(%rax)
+vpextrb $1,%xmm17,%eax
+vpextrw $1,%xmm17,%eax
+vpextrw $1,%xmm17,2(%rax)
+vpextrd $1,%xmm17,4(%rax)
+vpextrq $1,%xmm17,%rax
+vextractps $1,%xmm17,4(%rax)
+vpinsrb $1,%eax,%xmm17,%xmm18
+vpinsrw $1,2(%rax),%xmm17,%xmm18
+vpinsrd $1,4(%rax),%xmm17,%xmm18
+vpinsrq $1,%rax,%xmm17,%xmm18
+vcvtsi2ss %eax,%xmm17,%xmm18
+vcvtsi2sdq 8(%rax),%xmm17,%xmm18
+vcvtsi2ssl 4(%rax),%xmm17,%xmm18
+vcvtsi2ss %rax,{rn-sae},%xmm1,%xmm2
+vcvtss2si %xmm17,%eax
+vcvtsd2si 8(%rax),%rax
+vcvtsd2si {rz-sae},%xmm1,%rax
+vcvttss2si {sae},%xmm1,%eax
+vcvttsd2si %xmm31,%r9
+kunpckbw %k1,%k2,%k3
+kunpckwd %k1,%k2,%k3
+kunpckdq %k1,%k2,%k3
+kshiftrb $1,%k1,%k2
+kshiftrw $1,%k1,%k2
+kshiftrd $1,%k1,%k2
+kshiftrq $1,%k1,%k2
+kshiftlb $1,%k1,%k2
+kshiftlw $1,%k1,%k2
+kshiftld $1,%k1,%k2
+kshiftlq $63,%k1,%k2
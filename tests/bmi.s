@@ -0,0 +1,50 @@
+# Bit manipulation: popcnt, lzcnt, tzcnt, bt*, BMI1 and BMI2
+	popcnt %rax,%rbx
+	popcnt %ax,%r9w
+	popcntl (%rax),%ecx
+	popcnt 8(%r12),%r15
+	lzcnt %eax,%edx
+	lzcntq (%rsp),%rax
+	tzcnt %r8,%r9
+	tzcntw %ax,%bx
+	bsf %eax,%ecx
+	bsfq 16(%rbp),%r10
+	bsr %r11w,%cx
+	bsr %rax,%rax
+	bt %eax,%ecx
+	bt %r9,(%rax)
+	btl $5,(%rax)
+	btq $63,%r12
+	btw $3,%ax
+	bts %rax,%rbx
+	btsl $31,4(%rdi)
+	lock btsq %rcx,(%rdx)
+	btr %ecx,%edx
+	lock btrl $2,(%rax)
+	btc %r13,%r14
+	btcq $1,(%rax,%rbx,8)
+	adcx %eax,%ebx
+	adcx (%rax),%r10
+	adcxq %r8,%r9
+	adox %eax,%ebx
+	adox 8(%rax),%r10
+	movbe (%rax),%eax
+	movbe %r9,(%rdi)
+	movbe 2(%rsi),%r10w
+	movbew %ax,(%rbx)
+	movbeq (%rax),%rcx
+	bswap %eax
+	bswap %r12
+	andn %rax,%rbx,%rcx
+	bextr %eax,(%rdi),%edx
+	blsr %rax,%rbx
+	blsi (%rax),%ecx
+	blsmsk %r9,%r10
+	bzhi %rdx,%rax,%rcx
+	pdep %rax,%rbx,%rcx
+	pext (%rax),%r9d,%r10d
+	shlx %rax,%rbx,%rcx
+	sarx %eax,(%rdi),%edx
+	shrx %r9,%r10,%r11
+	rorx $13,%rax,%rbx
+	mulx %rax,%rbx,%rcx
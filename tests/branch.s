@@ -0,0 +1,205 @@
+# Calls, jumps and returns, short and near
+.text
+top:
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+jmp top2
+cmp %rax, %rbx
+dec %ecx
+test %eax,%eax
+mov %rax, %rbx
+push %r12
+nop
+call top
+jne top
+jnz top
+je top2
+add $1000, %rcx
+top2:
+ret
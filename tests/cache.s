@@ -0,0 +1,32 @@
+# Prefetch, cache flush and timing instructions
+	prefetcht0 (%rax)
+	prefetcht1 64(%rsi)
+	prefetcht2 (%r12,%rcx,8)
+	prefetchnta 0x100(%rdi)
+	prefetchw (%r13)
+	clflush (%rax)
+	clflushopt 64(%r9)
+	clwb (%rdi,%rsi)
+	movnti %eax,(%rdi)
+	movnti %r10,8(%rdi)
+	movntiq %rax,(%rsi)
+	movntdq %xmm0,(%rdi)
+	movntdq %xmm9,16(%r8)
+	movntps %xmm1,(%rax)
+	movntpd %xmm12,(%rax)
+	vmovntdq %ymm0,(%rdi)
+	vmovntdq %xmm3,32(%rdi)
+	vmovntps %ymm12,(%r9)
+	vmovntpd %xmm1,(%rax)
+	vmovntdq %zmm1,0x40(%rdi)
+	vmovntps %zmm17,0x80(%rdi)
+	vmovntpd %ymm20,(%rax)
+	vmovntdqa 0x40(%rax),%zmm2
+	rdtsc
+	rdtscp
+	rdpmc
+	cpuid
+	serialize
+	lfence
+	rdtsc
+	lfence
@@ -0,0 +1,61 @@
+#!/bin/sh
+# Assembles each tests/*.s with jasm and with as and compares the code
+# objdump -d shows for both, as addresses and bytes (jasm keeps .L symbols,
+# so symbolic operands can differ). Each line of tests/reject/*.s is a case
+# on its own that both assemblers must reject.
+#
+#     sh tests/check.sh            JASM=path/to/jasm AS=as to override
+
+JASM=${JASM:-./jasm}
+AS=${AS:-as}
+dir=$(dirname "$0")
+tmp=$(mktemp -d) || exit 1
+trap 'rm -rf "$tmp"' EXIT
+fail=0
+
+code() {
+    objdump -d "$1" | grep '^ *[0-9a-f]*:' | cut -f1,2
+}
+
+for src in "$dir"/*.s; do
+    name=$(basename "$src" .s)
+    if ! "$AS" "$src" -o "$tmp/want.o" 2> "$tmp/log"; then
+        echo "FAIL $name: as rejects it"
+        cat "$tmp/log"
+        fail=1
+    elif ! "$JASM" "$src" -o "$tmp/got.o" -f elf > /dev/null 2> "$tmp/log"; then
+        echo "FAIL $name: jasm rejects it"
+        cat "$tmp/log"
+        fail=1
+    elif code "$tmp/want.o" > "$tmp/want" && code "$tmp/got.o" > "$tmp/got" &&
+            diff -u "$tmp/want" "$tmp/got" > "$tmp/diff"; then
+        echo "ok   $name ($(wc -l < "$tmp/want") instructions)"
+    else
+        echo "FAIL $name: objdump -d differs (- as, + jasm)"
+        head -n 40 "$tmp/diff"
+        fail=1
+    fi
+done
+
+for src in "$dir"/reject/*.s; do
+    name=reject/$(basename "$src" .s)
+    n=0
+    bad=0
+    while IFS= read -r line; do
+        case $line in '' | '#'*) continue ;; esac
+        n=$((n + 1))
+        printf '%s\n' "$line" > "$tmp/case.s"
+        if "$JASM" "$tmp/case.s" -o "$tmp/case.o" -f elf > /dev/null 2>&1; then
+            echo "FAIL $name: jasm accepts: $line"
+            bad=1
+        fi
+        if "$AS" "$tmp/case.s" -o "$tmp/case.o" 2> /dev/null; then
+            echo "FAIL $name: as accepts, so the case is not invalid: $line"
+            bad=1
+        fi
+    done < "$src"
+    [ $bad = 0 ] && echo "ok   $name ($n cases)"
+    [ $bad = 0 ] || fail=1
+done
+
+exit $fail
@@ -0,0 +1,338 @@
+# jcc, setcc and cmovcc under every condition name gas accepts
+.Lfwd:
+	jo .Lfwd
+	jo .Lfar
+	seto %al
+	seto %r9b
+	seto (%rax)
+	seto 8(%rsp,%rcx,2)
+	cmovo %eax,%ebx
+	cmovo (%rdi),%r10
+	cmovo %ax,%r8w
+	cmovoq %rax,%rbx
+	cmovol 4(%rax),%ecx
+	jno .Lfwd
+	jno .Lfar
+	setno %al
+	setno %r9b
+	setno (%rax)
+	setno 8(%rsp,%rcx,2)
+	cmovno %eax,%ebx
+	cmovno (%rdi),%r10
+	cmovno %ax,%r8w
+	cmovnoq %rax,%rbx
+	cmovnol 4(%rax),%ecx
+	jb .Lfwd
+	jb .Lfar
+	setb %al
+	setb %r9b
+	setb (%rax)
+	setb 8(%rsp,%rcx,2)
+	cmovb %eax,%ebx
+	cmovb (%rdi),%r10
+	cmovb %ax,%r8w
+	cmovbq %rax,%rbx
+	cmovbl 4(%rax),%ecx
+	jc .Lfwd
+	jc .Lfar
+	setc %al
+	setc %r9b
+	setc (%rax)
+	setc 8(%rsp,%rcx,2)
+	cmovc %eax,%ebx
+	cmovc (%rdi),%r10
+	cmovc %ax,%r8w
+	cmovcq %rax,%rbx
+	cmovcl 4(%rax),%ecx
+	jnae .Lfwd
+	jnae .Lfar
+	setnae %al
+	setnae %r9b
+	setnae (%rax)
+	setnae 8(%rsp,%rcx,2)
+	cmovnae %eax,%ebx
+	cmovnae (%rdi),%r10
+	cmovnae %ax,%r8w
+	cmovnaeq %rax,%rbx
+	cmovnael 4(%rax),%ecx
+	jae .Lfwd
+	jae .Lfar
+	setae %al
+	setae %r9b
+	setae (%rax)
+	setae 8(%rsp,%rcx,2)
+	cmovae %eax,%ebx
+	cmovae (%rdi),%r10
+	cmovae %ax,%r8w
+	cmovaeq %rax,%rbx
+	cmovael 4(%rax),%ecx
+	jnb .Lfwd
+	jnb .Lfar
+	setnb %al
+	setnb %r9b
+	setnb (%rax)
+	setnb 8(%rsp,%rcx,2)
+	cmovnb %eax,%ebx
+	cmovnb (%rdi),%r10
+	cmovnb %ax,%r8w
+	cmovnbq %rax,%rbx
+	cmovnbl 4(%rax),%ecx
+	jnc .Lfwd
+	jnc .Lfar
+	setnc %al
+	setnc %r9b
+	setnc (%rax)
+	setnc 8(%rsp,%rcx,2)
+	cmovnc %eax,%ebx
+	cmovnc (%rdi),%r10
+	cmovnc %ax,%r8w
+	cmovncq %rax,%rbx
+	cmovncl 4(%rax),%ecx
+	je .Lfwd
+	je .Lfar
+	sete %al
+	sete %r9b
+	sete (%rax)
+	sete 8(%rsp,%rcx,2)
+	cmove %eax,%ebx
+	cmove (%rdi),%r10
+	cmove %ax,%r8w
+	cmoveq %rax,%rbx
+	cmovel 4(%rax),%ecx
+	jz .Lfwd
+	jz .Lfar
+	setz %al
+	setz %r9b
+	setz (%rax)
+	setz 8(%rsp,%rcx,2)
+	cmovz %eax,%ebx
+	cmovz (%rdi),%r10
+	cmovz %ax,%r8w
+	cmovzq %rax,%rbx
+	cmovzl 4(%rax),%ecx
+	jne .Lfwd
+	jne .Lfar
+	setne %al
+	setne %r9b
+	setne (%rax)
+	setne 8(%rsp,%rcx,2)
+	cmovne %eax,%ebx
+	cmovne (%rdi),%r10
+	cmovne %ax,%r8w
+	cmovneq %rax,%rbx
+	cmovnel 4(%rax),%ecx
+	jnz .Lfwd
+	jnz .Lfar
+	setnz %al
+	setnz %r9b
+	setnz (%rax)
+	setnz 8(%rsp,%rcx,2)
+	cmovnz %eax,%ebx
+	cmovnz (%rdi),%r10
+	cmovnz %ax,%r8w
+	cmovnzq %rax,%rbx
+	cmovnzl 4(%rax),%ecx
+	jbe .Lfwd
+	jbe .Lfar
+	setbe %al
+	setbe %r9b
+	setbe (%rax)
+	setbe 8(%rsp,%rcx,2)
+	cmovbe %eax,%ebx
+	cmovbe (%rdi),%r10
+	cmovbe %ax,%r8w
+	cmovbeq %rax,%rbx
+	cmovbel 4(%rax),%ecx
+	jna .Lfwd
+	jna .Lfar
+	setna %al
+	setna %r9b
+	setna (%rax)
+	setna 8(%rsp,%rcx,2)
+	cmovna %eax,%ebx
+	cmovna (%rdi),%r10
+	cmovna %ax,%r8w
+	cmovnaq %rax,%rbx
+	cmovnal 4(%rax),%ecx
+	ja .Lfwd
+	ja .Lfar
+	seta %al
+	seta %r9b
+	seta (%rax)
+	seta 8(%rsp,%rcx,2)
+	cmova %eax,%ebx
+	cmova (%rdi),%r10
+	cmova %ax,%r8w
+	cmovaq %rax,%rbx
+	cmoval 4(%rax),%ecx
+	jnbe .Lfwd
+	jnbe .Lfar
+	setnbe %al
+	setnbe %r9b
+	setnbe (%rax)
+	setnbe 8(%rsp,%rcx,2)
+	cmovnbe %eax,%ebx
+	cmovnbe (%rdi),%r10
+	cmovnbe %ax,%r8w
+	cmovnbeq %rax,%rbx
+	cmovnbel 4(%rax),%ecx
+	js .Lfwd
+	js .Lfar
+	sets %al
+	sets %r9b
+	sets (%rax)
+	sets 8(%rsp,%rcx,2)
+	cmovs %eax,%ebx
+	cmovs (%rdi),%r10
+	cmovs %ax,%r8w
+	cmovsq %rax,%rbx
+	cmovsl 4(%rax),%ecx
+	jns .Lfwd
+	jns .Lfar
+	setns %al
+	setns %r9b
+	setns (%rax)
+	setns 8(%rsp,%rcx,2)
+	cmovns %eax,%ebx
+	cmovns (%rdi),%r10
+	cmovns %ax,%r8w
+	cmovnsq %rax,%rbx
+	cmovnsl 4(%rax),%ecx
+	jp .Lfwd
+	jp .Lfar
+	setp %al
+	setp %r9b
+	setp (%rax)
+	setp 8(%rsp,%rcx,2)
+	cmovp %eax,%ebx
+	cmovp (%rdi),%r10
+	cmovp %ax,%r8w
+	cmovpq %rax,%rbx
+	cmovpl 4(%rax),%ecx
+	jpe .Lfwd
+	jpe .Lfar
+	setpe %al
+	setpe %r9b
+	setpe (%rax)
+	setpe 8(%rsp,%rcx,2)
+	cmovpe %eax,%ebx
+	cmovpe (%rdi),%r10
+	cmovpe %ax,%r8w
+	cmovpeq %rax,%rbx
+	cmovpel 4(%rax),%ecx
+	jnp .Lfwd
+	jnp .Lfar
+	setnp %al
+	setnp %r9b
+	setnp (%rax)
+	setnp 8(%rsp,%rcx,2)
+	cmovnp %eax,%ebx
+	cmovnp (%rdi),%r10
+	cmovnp %ax,%r8w
+	cmovnpq %rax,%rbx
+	cmovnpl 4(%rax),%ecx
+	jpo .Lfwd
+	jpo .Lfar
+	setpo %al
+	setpo %r9b
+	setpo (%rax)
+	setpo 8(%rsp,%rcx,2)
+	cmovpo %eax,%ebx
+	cmovpo (%rdi),%r10
+	cmovpo %ax,%r8w
+	cmovpoq %rax,%rbx
+	cmovpol 4(%rax),%ecx
+	jl .Lfwd
+	jl .Lfar
+	setl %al
+	setl %r9b
+	setl (%rax)
+	setl 8(%rsp,%rcx,2)
+	cmovl %eax,%ebx
+	cmovl (%rdi),%r10
+	cmovl %ax,%r8w
+	cmovlq %rax,%rbx
+	cmovll 4(%rax),%ecx
+	jnge .Lfwd
+	jnge .Lfar
+	setnge %al
+	setnge %r9b
+	setnge (%rax)
+	setnge 8(%rsp,%rcx,2)
+	cmovnge %eax,%ebx
+	cmovnge (%rdi),%r10
+	cmovnge %ax,%r8w
+	cmovngeq %rax,%rbx
+	cmovngel 4(%rax),%ecx
+	jge .Lfwd
+	jge .Lfar
+	setge %al
+	setge %r9b
+	setge (%rax)
+	setge 8(%rsp,%rcx,2)
+	cmovge %eax,%ebx
+	cmovge (%rdi),%r10
+	cmovge %ax,%r8w
+	cmovgeq %rax,%rbx
+	cmovgel 4(%rax),%ecx
+	jnl .Lfwd
+	jnl .Lfar
+	setnl %al
+	setnl %r9b
+	setnl (%rax)
+	setnl 8(%rsp,%rcx,2)
+	cmovnl %eax,%ebx
+	cmovnl (%rdi),%r10
+	cmovnl %ax,%r8w
+	cmovnlq %rax,%rbx
+	cmovnll 4(%rax),%ecx
+	jle .Lfwd
+	jle .Lfar
+	setle %al
+	setle %r9b
+	setle (%rax)
+	setle 8(%rsp,%rcx,2)
+	cmovle %eax,%ebx
+	cmovle (%rdi),%r10
+	cmovle %ax,%r8w
+	cmovleq %rax,%rbx
+	cmovlel 4(%rax),%ecx
+	jng .Lfwd
+	jng .Lfar
+	setng %al
+	setng %r9b
+	setng (%rax)
+	setng 8(%rsp,%rcx,2)
+	cmovng %eax,%ebx
+	cmovng (%rdi),%r10
+	cmovng %ax,%r8w
+	cmovngq %rax,%rbx
+	cmovngl 4(%rax),%ecx
+	jg .Lfwd
+	jg .Lfar
+	setg %al
+	setg %r9b
+	setg (%rax)
+	setg 8(%rsp,%rcx,2)
+	cmovg %eax,%ebx
+	cmovg (%rdi),%r10
+	cmovg %ax,%r8w
+	cmovgq %rax,%rbx
+	cmovgl 4(%rax),%ecx
+	jnle .Lfwd
+	jnle .Lfar
+	setnle %al
+	setnle %r9b
+	setnle (%rax)
+	setnle 8(%rsp,%rcx,2)
+	cmovnle %eax,%ebx
+	cmovnle (%rdi),%r10
+	cmovnle %ax,%r8w
+	cmovnleq %rax,%rbx
+	cmovnlel 4(%rax),%ecx
+	.fill 200,1,0x90
+.Lfar:
+	adc %eax,%ebx
+	sbb $1,%rax
+	setbb %cl
+	cmovbw %ax,%bx
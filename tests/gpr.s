@@ -0,0 +1,205 @@
+# General-purpose integer instructions: every register, memory and immediate form
+.text
+f:
+add %rax, %rbx
+add %r8d, %r9d
+add %al, %bl
+add %sil, %dil
+add %ax, %cx
+add $1, %rax
+add $1000, %rax
+add $1000, %rbx
+add $1, %al
+add $100, %bl
+add $-1, %eax
+add $0x80, %eax
+add $0x80, %ax
+add $1, %cx
+addq $1, (%rax)
+addl $1000, 8(%rbx)
+addb $1, (%rcx)
+addw $300, (%rdx)
+add %rax, (%rbx)
+add (%rbx), %rax
+or %rax, %rbx
+or $1, %r12
+orb $1, (%rax)
+adc %rax, %rbx
+adc $5, %eax
+sbb %rcx, %rdx
+sbbl $1, (%rsp)
+sbbq $1, (%rsp)
+and $0xff, %eax
+and $-16, %rsp
+andl $7, 4(%rbp)
+and %r15, %r14
+sub %rax, %rbx
+sub $8, %rsp
+sub $1000, %eax
+xor %eax, %eax
+xor %r8, %r8
+xor $1, %cl
+xorl $0x12345678, (%rdi)
+cmp %rax, %rbx
+cmp $0, %rdi
+cmpb $0, (%rsi)
+cmp (%rdi), %ecx
+cmp $0x7f, %al
+test %rax, %rax
+test %al, %bl
+test $1, %al
+test $1, %ecx
+test $0x100, %eax
+test $1, %rax
+testb $1, (%rdi)
+testq $8, 16(%rsp)
+test %rax, (%rdi)
+test (%rdi), %rax
+mov %rax, %rbx
+mov %r9, %r10
+mov %eax, %ecx
+mov %ax, %cx
+mov %al, %cl
+mov %ah, %bl
+mov %spl, %dil
+mov $1, %eax
+mov $1, %rax
+mov $-1, %rax
+mov $0x7fffffff, %rax
+mov $0x80000000, %rax
+mov $0x123456789, %rax
+mov $1, %r8
+mov $1, %al
+mov $1, %ah
+mov $1, %r9b
+mov $1, %ax
+mov $1, %r10w
+movq $1, (%rax)
+movl $1, (%rax)
+movw $1, (%rax)
+movb $1, (%rax)
+mov %rax, (%rbx)
+mov (%rbx), %rax
+mov 8(%rsp), %r11d
+mov %cl, (%rax,%rbx,2)
+movabs $1, %rax
+movabs $0x1122334455667788, %r15
+xchg %rax, %rbx
+xchg %rbx, %rax
+xchg %eax, %eax
+xchg %rax, %rax
+xchg %ax, %cx
+xchg %eax, %r8d
+xchg %al, %bl
+xchg %rcx, %rdx
+xchg %rax, (%rbx)
+xchg (%rbx), %rax
+lea 8(%rax), %rbx
+lea (%rax,%rbx,4), %ecx
+lea 4(%rsp), %ax
+push %rax
+push %r12
+push %ax
+push $1
+push $1000
+pushq $-1
+pushw $1
+push (%rax)
+pushq 8(%rsp)
+pop %rbx
+pop %r15
+pop %ax
+pop (%rax)
+popq 8(%rsp)
+inc %rax
+inc %eax
+inc %al
+inc %r8w
+incq (%rax)
+incb (%rax)
+dec %rcx
+decl 4(%rsp)
+not %rax
+notb (%rdi)
+neg %eax
+negq (%rsi)
+mul %rcx
+mulb (%rdi)
+imul %rcx
+imull (%rdi)
+div %rcx
+divq (%rdi)
+idiv %r8d
+idivw (%rdi)
+imul %rbx, %rax
+imul (%rdi), %eax
+imul $10, %rax
+imul $1000, %rax
+imul $10, %rbx, %rax
+imul $1000, (%rdi), %ecx
+imul $-3, %cx, %dx
+rol %rax
+rol $1, %rax
+rol $3, %rax
+rol %cl, %rax
+ror $4, %eax
+rcl %cl, %bl
+rcr $2, %r9
+shl %rax
+shl $4, %rdi
+shl %cl, %edx
+sal $2, %rax
+shr $1, %al
+shr $63, %rax
+sar $3, %r10
+sar %cl, %r11
+shlq $2, (%rax)
+shrl %cl, 8(%rsp)
+sarb (%rdi)
+movzbl %al, %eax
+movzbl (%rdi), %eax
+movzbq %cl, %rcx
+movzbw %al, %ax
+movzwl %ax, %eax
+movzwq (%rsi), %r8
+movsbl %al, %eax
+movsbq (%rdi), %rax
+movsbw %al, %ax
+movswl %cx, %edx
+movswq (%rsi), %rdi
+movslq %eax, %rax
+movslq (%rdi), %r9
+movzbl %ah, %eax
+movzbl %sil, %eax
+call *%rax
+call *%r11
+call *(%rax)
+call *8(%rsp,%rbx,8)
+jmp *%rax
+jmp *%r12
+jmp *(%rdi)
+ret
+ret $16
+leave
+nop
+hlt
+ud2
+int3
+int $0x80
+int $3
+clc
+stc
+cmc
+cld
+std
+cbtw
+cwtl
+cltq
+cwtd
+cltd
+cqto
+syscall
+bswap %eax
+bswap %r9
+bswap %rax
+notq %rax
@@ -0,0 +1,36 @@
+# lock prefixes and atomics
+f:
+lock addq $1, (%rax)
+lock addl %eax, 8(%rbx)
+lock addw $1, (%rax)
+lock incq (%rdi)
+lock decl counter(%rip)
+lock xaddq %rax, (%rdi)
+lock xadd %ecx, (%rdi,%rsi,4)
+xadd %rax, %rbx
+lock cmpxchgq %rcx, (%rdi)
+lock cmpxchg %r8d, 4(%rsp)
+lock cmpxchgb %cl, (%rdi)
+cmpxchg %rbx, %rcx
+lock cmpxchg8b (%rdi)
+lock cmpxchg16b (%rdi)
+cmpxchg16b 16(%rsp)
+xchg %rax, (%rdi)
+lock xchg (%rdi), %rax
+lock orb $1, (%rax)
+lock andq %rax, (%rbx)
+lock negq (%rax)
+lock notl (%rax)
+lock subq $1, (%rax)
+lock xorq $1, (%rax)
+lock sbbq $1, (%rax)
+lock adcl $1, (%rax)
+lock
+addq $1, (%rcx)
+mfence
+lfence
+sfence
+pause
+lock addw $1, (%eax)
+lock xchgw %ax, (%ebx)
+counter: ret
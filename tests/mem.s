@@ -0,0 +1,49 @@
+# Addressing: SIB, displacements, index-only, RIP-relative
+start:
+    movq (%r13), %rax
+    movq (%rsp), %rax
+    movq (%r12), %rax
+    movq 0(%rbp), %rax
+    movq (,%rax,1), %rbx
+    movq (,%r12,2), %rbx
+    movq 127(%rax), %rbx
+    movq 128(%rax), %rbx
+    movq -128(%rax), %rbx
+    movq -129(%rax), %rbx
+    movl (%eax), %ebx
+    movl 4(%r8d,%r9d,8), %ebx
+    movq 0x1000, %rax
+    movq (%rbp,%r13,4), %rax
+    movq (%r13,%rbp), %rax
+    addl $5, (%rsp)
+    cmpb $-1, 3(%r12)
+.text
+f:
+  lea d(%rip), %rax
+  mov d+8(%rip), %rcx
+  movl $5, d(%rip)
+  addq $1000, d+4(%rip)
+  lea loc(%rip), %rdx
+  cmpb $1, loc(%rip)
+  call ext
+  call ext@PLT
+  jmp ext
+  mov ext@GOTPCREL(%rip), %rax
+  mov ext@GOTPCREL(%rip), %eax
+  add ext@GOTPCREL(%rip), %rax
+  call *ext@GOTPCREL(%rip)
+  jmp *ext@GOTPCREL(%rip)
+  lea ext(%rip), %rax
+  vmovdqa d(%rip), %ymm0
+  vpaddd d(%rip){1to16}, %zmm0, %zmm1
+  pinsrd $1, d(%rip), %xmm0
+  je ext
+  movq ext@GOTPCREL(%rip), %r9
+  test %rax, ext@GOTPCREL(%rip)
+  ret
+loc:
+  .byte 0
+.data
+d: .quad 0, 0
+  .quad ext
+  .long ext - 4
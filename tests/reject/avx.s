@@ -0,0 +1,9 @@
+# Each line must be rejected, by jasm and by as.
+vaddps %ymm0, %xmm1, %xmm2
+vpxor %zmm1, %zmm2, %zmm3
+vmaskmovps %ymm1, %ymm2, %ymm3
+vpmaskmovd (%rax), %zmm1, %zmm2
+vpinsrd $1, %rax, %xmm1, %xmm2
+vpextrq $1, %xmm1, %eax
+vcvtss2si %xmm1, %ax
+vpgatherdd %ymm1, (%rax), %ymm2
@@ -0,0 +1,18 @@
+# Each line must be rejected, by jasm and by as.
+vaddps {sae}, %zmm1, %zmm2, %zmm3
+vaddps {rn-sae}, (%rax), %zmm1, %zmm2
+vaddps {rn-sae}, %ymm1, %ymm2, %ymm3
+vaddps (%rax){1to8}, %zmm1, %zmm2
+vaddps %zmm1, %zmm2, %zmm3{z}
+vpcmpeqd %zmm1, %zmm2, %k1{z}
+vmovaps %zmm1, (%rax){z}
+vpmovm2d %k1, %zmm2{%k1}
+vpscatterdd %zmm1, (%rax,%zmm2,4)
+vpcompressd %zmm1, %ymm2
+vpternlogd $1, %xmm1, %xmm2, %k1
+vshuff32x4 $1, %xmm1, %xmm2, %xmm3
+vpmovdb %zmm1, %ymm2
+vpbroadcastd %rax, %zmm1
+vmovd %xmm17, %xmm1
+kandw %k1, %k2, %zmm3
+kshiftlw $1, %k1, %xmm2
@@ -0,0 +1,15 @@
+# Each line must be rejected, by jasm and by as.
+addq %xmm0, %rax
+mov %ymm1, %rax
+inc %zmm1
+popcnt %xmm1, %rax
+add %eax, %rbx
+addl %rax, %rbx
+movb %ax, %bl
+add (%rax), (%rbx)
+lea %rax, %rbx
+push %eax
+shl %bl, %eax
+imul $1, %al, %bl
+andn %rax, %ebx, %ecx
+bzhi %ax, %bx, %cx
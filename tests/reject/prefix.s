@@ -0,0 +1,7 @@
+# Each line must be rejected, by jasm and by as.
+lock addq %rax, %rbx
+lock incq %rax
+lock movq %rax, (%rbx)
+lock lock addq $1, (%rax)
+rep rep movsb
+rep repne movsb
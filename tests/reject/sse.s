@@ -0,0 +1,9 @@
+# Each line must be rejected, by jasm and by as.
+addps %ymm0, %xmm1
+movaps %xmm1, %eax
+movd %xmm0, %ax
+pextrd $1, %xmm0, %ax
+cvtsi2ss %xmm1, %xmm2
+pshufd %xmm1, %xmm2
+cmpeqps $1, %xmm1, %xmm2
+maskmovdqu (%rax), %xmm1
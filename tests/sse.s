@@ -0,0 +1,985 @@
+# SSE through SSE4.2, and the cmpps predicate pseudo-ops
+f:
+addps %xmm1, %xmm2
+addps %xmm10, %xmm3
+addps (%rax), %xmm12
+addps 16(%rsp,%r9,4), %xmm7
+addpd %xmm1, %xmm2
+addpd %xmm10, %xmm3
+addpd (%rax), %xmm12
+addpd 16(%rsp,%r9,4), %xmm7
+addss %xmm1, %xmm2
+addss %xmm10, %xmm3
+addss (%rax), %xmm12
+addss 16(%rsp,%r9,4), %xmm7
+addsd %xmm1, %xmm2
+addsd %xmm10, %xmm3
+addsd (%rax), %xmm12
+addsd 16(%rsp,%r9,4), %xmm7
+mulps %xmm1, %xmm2
+mulps %xmm10, %xmm3
+mulps (%rax), %xmm12
+mulps 16(%rsp,%r9,4), %xmm7
+mulpd %xmm1, %xmm2
+mulpd %xmm10, %xmm3
+mulpd (%rax), %xmm12
+mulpd 16(%rsp,%r9,4), %xmm7
+mulss %xmm1, %xmm2
+mulss %xmm10, %xmm3
+mulss (%rax), %xmm12
+mulss 16(%rsp,%r9,4), %xmm7
+mulsd %xmm1, %xmm2
+mulsd %xmm10, %xmm3
+mulsd (%rax), %xmm12
+mulsd 16(%rsp,%r9,4), %xmm7
+subps %xmm1, %xmm2
+subps %xmm10, %xmm3
+subps (%rax), %xmm12
+subps 16(%rsp,%r9,4), %xmm7
+subpd %xmm1, %xmm2
+subpd %xmm10, %xmm3
+subpd (%rax), %xmm12
+subpd 16(%rsp,%r9,4), %xmm7
+subss %xmm1, %xmm2
+subss %xmm10, %xmm3
+subss (%rax), %xmm12
+subss 16(%rsp,%r9,4), %xmm7
+subsd %xmm1, %xmm2
+subsd %xmm10, %xmm3
+subsd (%rax), %xmm12
+subsd 16(%rsp,%r9,4), %xmm7
+minps %xmm1, %xmm2
+minps %xmm10, %xmm3
+minps (%rax), %xmm12
+minps 16(%rsp,%r9,4), %xmm7
+minpd %xmm1, %xmm2
+minpd %xmm10, %xmm3
+minpd (%rax), %xmm12
+minpd 16(%rsp,%r9,4), %xmm7
+minss %xmm1, %xmm2
+minss %xmm10, %xmm3
+minss (%rax), %xmm12
+minss 16(%rsp,%r9,4), %xmm7
+minsd %xmm1, %xmm2
+minsd %xmm10, %xmm3
+minsd (%rax), %xmm12
+minsd 16(%rsp,%r9,4), %xmm7
+divps %xmm1, %xmm2
+divps %xmm10, %xmm3
+divps (%rax), %xmm12
+divps 16(%rsp,%r9,4), %xmm7
+divpd %xmm1, %xmm2
+divpd %xmm10, %xmm3
+divpd (%rax), %xmm12
+divpd 16(%rsp,%r9,4), %xmm7
+divss %xmm1, %xmm2
+divss %xmm10, %xmm3
+divss (%rax), %xmm12
+divss 16(%rsp,%r9,4), %xmm7
+divsd %xmm1, %xmm2
+divsd %xmm10, %xmm3
+divsd (%rax), %xmm12
+divsd 16(%rsp,%r9,4), %xmm7
+maxps %xmm1, %xmm2
+maxps %xmm10, %xmm3
+maxps (%rax), %xmm12
+maxps 16(%rsp,%r9,4), %xmm7
+maxpd %xmm1, %xmm2
+maxpd %xmm10, %xmm3
+maxpd (%rax), %xmm12
+maxpd 16(%rsp,%r9,4), %xmm7
+maxss %xmm1, %xmm2
+maxss %xmm10, %xmm3
+maxss (%rax), %xmm12
+maxss 16(%rsp,%r9,4), %xmm7
+maxsd %xmm1, %xmm2
+maxsd %xmm10, %xmm3
+maxsd (%rax), %xmm12
+maxsd 16(%rsp,%r9,4), %xmm7
+sqrtps %xmm1, %xmm2
+sqrtps %xmm10, %xmm3
+sqrtps (%rax), %xmm12
+sqrtps 16(%rsp,%r9,4), %xmm7
+sqrtpd %xmm1, %xmm2
+sqrtpd %xmm10, %xmm3
+sqrtpd (%rax), %xmm12
+sqrtpd 16(%rsp,%r9,4), %xmm7
+sqrtss %xmm1, %xmm2
+sqrtss %xmm10, %xmm3
+sqrtss (%rax), %xmm12
+sqrtss 16(%rsp,%r9,4), %xmm7
+sqrtsd %xmm1, %xmm2
+sqrtsd %xmm10, %xmm3
+sqrtsd (%rax), %xmm12
+sqrtsd 16(%rsp,%r9,4), %xmm7
+rsqrtps %xmm1, %xmm2
+rsqrtps %xmm10, %xmm3
+rsqrtps (%rax), %xmm12
+rsqrtps 16(%rsp,%r9,4), %xmm7
+rsqrtss %xmm1, %xmm2
+rsqrtss %xmm10, %xmm3
+rsqrtss (%rax), %xmm12
+rsqrtss 16(%rsp,%r9,4), %xmm7
+rcpps %xmm1, %xmm2
+rcpps %xmm10, %xmm3
+rcpps (%rax), %xmm12
+rcpps 16(%rsp,%r9,4), %xmm7
+rcpss %xmm1, %xmm2
+rcpss %xmm10, %xmm3
+rcpss (%rax), %xmm12
+rcpss 16(%rsp,%r9,4), %xmm7
+andps %xmm1, %xmm2
+andps %xmm10, %xmm3
+andps (%rax), %xmm12
+andps 16(%rsp,%r9,4), %xmm7
+andpd %xmm1, %xmm2
+andpd %xmm10, %xmm3
+andpd (%rax), %xmm12
+andpd 16(%rsp,%r9,4), %xmm7
+andnps %xmm1, %xmm2
+andnps %xmm10, %xmm3
+andnps (%rax), %xmm12
+andnps 16(%rsp,%r9,4), %xmm7
+andnpd %xmm1, %xmm2
+andnpd %xmm10, %xmm3
+andnpd (%rax), %xmm12
+andnpd 16(%rsp,%r9,4), %xmm7
+orps %xmm1, %xmm2
+orps %xmm10, %xmm3
+orps (%rax), %xmm12
+orps 16(%rsp,%r9,4), %xmm7
+orpd %xmm1, %xmm2
+orpd %xmm10, %xmm3
+orpd (%rax), %xmm12
+orpd 16(%rsp,%r9,4), %xmm7
+xorps %xmm1, %xmm2
+xorps %xmm10, %xmm3
+xorps (%rax), %xmm12
+xorps 16(%rsp,%r9,4), %xmm7
+xorpd %xmm1, %xmm2
+xorpd %xmm10, %xmm3
+xorpd (%rax), %xmm12
+xorpd 16(%rsp,%r9,4), %xmm7
+unpcklps %xmm1, %xmm2
+unpcklps %xmm10, %xmm3
+unpcklps (%rax), %xmm12
+unpcklps 16(%rsp,%r9,4), %xmm7
+unpcklpd %xmm1, %xmm2
+unpcklpd %xmm10, %xmm3
+unpcklpd (%rax), %xmm12
+unpcklpd 16(%rsp,%r9,4), %xmm7
+unpckhps %xmm1, %xmm2
+unpckhps %xmm10, %xmm3
+unpckhps (%rax), %xmm12
+unpckhps 16(%rsp,%r9,4), %xmm7
+unpckhpd %xmm1, %xmm2
+unpckhpd %xmm10, %xmm3
+unpckhpd (%rax), %xmm12
+unpckhpd 16(%rsp,%r9,4), %xmm7
+comiss %xmm1, %xmm2
+comiss %xmm10, %xmm3
+comiss (%rax), %xmm12
+comiss 16(%rsp,%r9,4), %xmm7
+comisd %xmm1, %xmm2
+comisd %xmm10, %xmm3
+comisd (%rax), %xmm12
+comisd 16(%rsp,%r9,4), %xmm7
+ucomiss %xmm1, %xmm2
+ucomiss %xmm10, %xmm3
+ucomiss (%rax), %xmm12
+ucomiss 16(%rsp,%r9,4), %xmm7
+ucomisd %xmm1, %xmm2
+ucomisd %xmm10, %xmm3
+ucomisd (%rax), %xmm12
+ucomisd 16(%rsp,%r9,4), %xmm7
+cmpps $1, %xmm1, %xmm2
+cmpps $5, (%r8), %xmm15
+cmppd $1, %xmm1, %xmm2
+cmppd $5, (%r8), %xmm15
+cmpss $1, %xmm1, %xmm2
+cmpss $5, (%r8), %xmm15
+cmpsd $1, %xmm1, %xmm2
+cmpsd $5, (%r8), %xmm15
+shufps $1, %xmm1, %xmm2
+shufps $5, (%r8), %xmm15
+shufpd $1, %xmm1, %xmm2
+shufpd $5, (%r8), %xmm15
+haddps %xmm1, %xmm2
+haddps %xmm10, %xmm3
+haddps (%rax), %xmm12
+haddps 16(%rsp,%r9,4), %xmm7
+haddpd %xmm1, %xmm2
+haddpd %xmm10, %xmm3
+haddpd (%rax), %xmm12
+haddpd 16(%rsp,%r9,4), %xmm7
+hsubps %xmm1, %xmm2
+hsubps %xmm10, %xmm3
+hsubps (%rax), %xmm12
+hsubps 16(%rsp,%r9,4), %xmm7
+hsubpd %xmm1, %xmm2
+hsubpd %xmm10, %xmm3
+hsubpd (%rax), %xmm12
+hsubpd 16(%rsp,%r9,4), %xmm7
+addsubps %xmm1, %xmm2
+addsubps %xmm10, %xmm3
+addsubps (%rax), %xmm12
+addsubps 16(%rsp,%r9,4), %xmm7
+addsubpd %xmm1, %xmm2
+addsubpd %xmm10, %xmm3
+addsubpd (%rax), %xmm12
+addsubpd 16(%rsp,%r9,4), %xmm7
+movddup %xmm1, %xmm2
+movddup %xmm10, %xmm3
+movddup (%rax), %xmm12
+movddup 16(%rsp,%r9,4), %xmm7
+movshdup %xmm1, %xmm2
+movshdup %xmm10, %xmm3
+movshdup (%rax), %xmm12
+movshdup 16(%rsp,%r9,4), %xmm7
+movsldup %xmm1, %xmm2
+movsldup %xmm10, %xmm3
+movsldup (%rax), %xmm12
+movsldup 16(%rsp,%r9,4), %xmm7
+lddqu (%rax), %xmm12
+lddqu 16(%rsp,%r9,4), %xmm7
+cvtps2pd %xmm1, %xmm2
+cvtps2pd %xmm10, %xmm3
+cvtps2pd (%rax), %xmm12
+cvtps2pd 16(%rsp,%r9,4), %xmm7
+cvtpd2ps %xmm1, %xmm2
+cvtpd2ps %xmm10, %xmm3
+cvtpd2ps (%rax), %xmm12
+cvtpd2ps 16(%rsp,%r9,4), %xmm7
+cvtss2sd %xmm1, %xmm2
+cvtss2sd %xmm10, %xmm3
+cvtss2sd (%rax), %xmm12
+cvtss2sd 16(%rsp,%r9,4), %xmm7
+cvtsd2ss %xmm1, %xmm2
+cvtsd2ss %xmm10, %xmm3
+cvtsd2ss (%rax), %xmm12
+cvtsd2ss 16(%rsp,%r9,4), %xmm7
+cvtdq2ps %xmm1, %xmm2
+cvtdq2ps %xmm10, %xmm3
+cvtdq2ps (%rax), %xmm12
+cvtdq2ps 16(%rsp,%r9,4), %xmm7
+cvtps2dq %xmm1, %xmm2
+cvtps2dq %xmm10, %xmm3
+cvtps2dq (%rax), %xmm12
+cvtps2dq 16(%rsp,%r9,4), %xmm7
+cvttps2dq %xmm1, %xmm2
+cvttps2dq %xmm10, %xmm3
+cvttps2dq (%rax), %xmm12
+cvttps2dq 16(%rsp,%r9,4), %xmm7
+cvtdq2pd %xmm1, %xmm2
+cvtdq2pd %xmm10, %xmm3
+cvtdq2pd (%rax), %xmm12
+cvtdq2pd 16(%rsp,%r9,4), %xmm7
+cvtpd2dq %xmm1, %xmm2
+cvtpd2dq %xmm10, %xmm3
+cvtpd2dq (%rax), %xmm12
+cvtpd2dq 16(%rsp,%r9,4), %xmm7
+cvttpd2dq %xmm1, %xmm2
+cvttpd2dq %xmm10, %xmm3
+cvttpd2dq (%rax), %xmm12
+cvttpd2dq 16(%rsp,%r9,4), %xmm7
+cvtsi2ss %eax, %xmm1
+cvtsi2ss %r9, %xmm10
+cvtsi2ssl (%rax), %xmm1
+cvtsi2ssq (%rax), %xmm1
+cvtsi2sd %eax, %xmm1
+cvtsi2sd %r9, %xmm10
+cvtsi2sdl (%rax), %xmm1
+cvtsi2sdq (%rax), %xmm1
+cvtss2si %xmm1, %eax
+cvtss2si %xmm10, %r9
+cvtss2si (%rax), %ecx
+cvtss2si (%rax), %r12
+cvttss2si %xmm1, %eax
+cvttss2si %xmm10, %r9
+cvttss2si (%rax), %ecx
+cvttss2si (%rax), %r12
+cvtsd2si %xmm1, %eax
+cvtsd2si %xmm10, %r9
+cvtsd2si (%rax), %ecx
+cvtsd2si (%rax), %r12
+cvttsd2si %xmm1, %eax
+cvttsd2si %xmm10, %r9
+cvttsd2si (%rax), %ecx
+cvttsd2si (%rax), %r12
+movaps (%rax), %xmm1
+movaps %xmm9, 8(%rbx)
+movaps %xmm1, %xmm2
+movaps %xmm11, %xmm2
+movapd (%rax), %xmm1
+movapd %xmm9, 8(%rbx)
+movapd %xmm1, %xmm2
+movapd %xmm11, %xmm2
+movups (%rax), %xmm1
+movups %xmm9, 8(%rbx)
+movups %xmm1, %xmm2
+movups %xmm11, %xmm2
+movupd (%rax), %xmm1
+movupd %xmm9, 8(%rbx)
+movupd %xmm1, %xmm2
+movupd %xmm11, %xmm2
+movss (%rax), %xmm1
+movss %xmm9, 8(%rbx)
+movss %xmm1, %xmm2
+movss %xmm11, %xmm2
+movsd (%rax), %xmm1
+movsd %xmm9, 8(%rbx)
+movsd %xmm1, %xmm2
+movsd %xmm11, %xmm2
+movdqa (%rax), %xmm1
+movdqa %xmm9, 8(%rbx)
+movdqa %xmm1, %xmm2
+movdqa %xmm11, %xmm2
+movdqu (%rax), %xmm1
+movdqu %xmm9, 8(%rbx)
+movdqu %xmm1, %xmm2
+movdqu %xmm11, %xmm2
+movlps (%rax), %xmm1
+movlps %xmm9, 8(%rbx)
+movhps (%rax), %xmm1
+movhps %xmm9, 8(%rbx)
+movlpd (%rax), %xmm1
+movlpd %xmm9, 8(%rbx)
+movhpd (%rax), %xmm1
+movhpd %xmm9, 8(%rbx)
+movhlps %xmm1, %xmm2
+movhlps %xmm9, %xmm0
+movlhps %xmm1, %xmm2
+movlhps %xmm9, %xmm0
+pmovmskb %xmm1, %eax
+pmovmskb %xmm10, %r9d
+movmskps %xmm1, %eax
+movmskps %xmm10, %r9d
+movmskpd %xmm1, %eax
+movmskpd %xmm10, %r9d
+ldmxcsr (%rax)
+ldmxcsr 4(%rsp)
+stmxcsr (%rax)
+stmxcsr 4(%rsp)
+paddb %xmm1, %xmm2
+paddb %xmm10, %xmm3
+paddb (%rax), %xmm12
+paddb 16(%rsp,%r9,4), %xmm7
+paddw %xmm1, %xmm2
+paddw %xmm10, %xmm3
+paddw (%rax), %xmm12
+paddw 16(%rsp,%r9,4), %xmm7
+paddd %xmm1, %xmm2
+paddd %xmm10, %xmm3
+paddd (%rax), %xmm12
+paddd 16(%rsp,%r9,4), %xmm7
+paddq %xmm1, %xmm2
+paddq %xmm10, %xmm3
+paddq (%rax), %xmm12
+paddq 16(%rsp,%r9,4), %xmm7
+paddsb %xmm1, %xmm2
+paddsb %xmm10, %xmm3
+paddsb (%rax), %xmm12
+paddsb 16(%rsp,%r9,4), %xmm7
+paddsw %xmm1, %xmm2
+paddsw %xmm10, %xmm3
+paddsw (%rax), %xmm12
+paddsw 16(%rsp,%r9,4), %xmm7
+paddusb %xmm1, %xmm2
+paddusb %xmm10, %xmm3
+paddusb (%rax), %xmm12
+paddusb 16(%rsp,%r9,4), %xmm7
+paddusw %xmm1, %xmm2
+paddusw %xmm10, %xmm3
+paddusw (%rax), %xmm12
+paddusw 16(%rsp,%r9,4), %xmm7
+psubb %xmm1, %xmm2
+psubb %xmm10, %xmm3
+psubb (%rax), %xmm12
+psubb 16(%rsp,%r9,4), %xmm7
+psubw %xmm1, %xmm2
+psubw %xmm10, %xmm3
+psubw (%rax), %xmm12
+psubw 16(%rsp,%r9,4), %xmm7
+psubd %xmm1, %xmm2
+psubd %xmm10, %xmm3
+psubd (%rax), %xmm12
+psubd 16(%rsp,%r9,4), %xmm7
+psubq %xmm1, %xmm2
+psubq %xmm10, %xmm3
+psubq (%rax), %xmm12
+psubq 16(%rsp,%r9,4), %xmm7
+psubsb %xmm1, %xmm2
+psubsb %xmm10, %xmm3
+psubsb (%rax), %xmm12
+psubsb 16(%rsp,%r9,4), %xmm7
+psubsw %xmm1, %xmm2
+psubsw %xmm10, %xmm3
+psubsw (%rax), %xmm12
+psubsw 16(%rsp,%r9,4), %xmm7
+psubusb %xmm1, %xmm2
+psubusb %xmm10, %xmm3
+psubusb (%rax), %xmm12
+psubusb 16(%rsp,%r9,4), %xmm7
+psubusw %xmm1, %xmm2
+psubusw %xmm10, %xmm3
+psubusw (%rax), %xmm12
+psubusw 16(%rsp,%r9,4), %xmm7
+pmullw %xmm1, %xmm2
+pmullw %xmm10, %xmm3
+pmullw (%rax), %xmm12
+pmullw 16(%rsp,%r9,4), %xmm7
+pmulhw %xmm1, %xmm2
+pmulhw %xmm10, %xmm3
+pmulhw (%rax), %xmm12
+pmulhw 16(%rsp,%r9,4), %xmm7
+pmulhuw %xmm1, %xmm2
+pmulhuw %xmm10, %xmm3
+pmulhuw (%rax), %xmm12
+pmulhuw 16(%rsp,%r9,4), %xmm7
+pmuludq %xmm1, %xmm2
+pmuludq %xmm10, %xmm3
+pmuludq (%rax), %xmm12
+pmuludq 16(%rsp,%r9,4), %xmm7
+pmaddwd %xmm1, %xmm2
+pmaddwd %xmm10, %xmm3
+pmaddwd (%rax), %xmm12
+pmaddwd 16(%rsp,%r9,4), %xmm7
+psadbw %xmm1, %xmm2
+psadbw %xmm10, %xmm3
+psadbw (%rax), %xmm12
+psadbw 16(%rsp,%r9,4), %xmm7
+pavgb %xmm1, %xmm2
+pavgb %xmm10, %xmm3
+pavgb (%rax), %xmm12
+pavgb 16(%rsp,%r9,4), %xmm7
+pavgw %xmm1, %xmm2
+pavgw %xmm10, %xmm3
+pavgw (%rax), %xmm12
+pavgw 16(%rsp,%r9,4), %xmm7
+pminub %xmm1, %xmm2
+pminub %xmm10, %xmm3
+pminub (%rax), %xmm12
+pminub 16(%rsp,%r9,4), %xmm7
+pmaxub %xmm1, %xmm2
+pmaxub %xmm10, %xmm3
+pmaxub (%rax), %xmm12
+pmaxub 16(%rsp,%r9,4), %xmm7
+pminsw %xmm1, %xmm2
+pminsw %xmm10, %xmm3
+pminsw (%rax), %xmm12
+pminsw 16(%rsp,%r9,4), %xmm7
+pmaxsw %xmm1, %xmm2
+pmaxsw %xmm10, %xmm3
+pmaxsw (%rax), %xmm12
+pmaxsw 16(%rsp,%r9,4), %xmm7
+pand %xmm1, %xmm2
+pand %xmm10, %xmm3
+pand (%rax), %xmm12
+pand 16(%rsp,%r9,4), %xmm7
+pandn %xmm1, %xmm2
+pandn %xmm10, %xmm3
+pandn (%rax), %xmm12
+pandn 16(%rsp,%r9,4), %xmm7
+por %xmm1, %xmm2
+por %xmm10, %xmm3
+por (%rax), %xmm12
+por 16(%rsp,%r9,4), %xmm7
+pxor %xmm1, %xmm2
+pxor %xmm10, %xmm3
+pxor (%rax), %xmm12
+pxor 16(%rsp,%r9,4), %xmm7
+pcmpeqb %xmm1, %xmm2
+pcmpeqb %xmm10, %xmm3
+pcmpeqb (%rax), %xmm12
+pcmpeqb 16(%rsp,%r9,4), %xmm7
+pcmpeqw %xmm1, %xmm2
+pcmpeqw %xmm10, %xmm3
+pcmpeqw (%rax), %xmm12
+pcmpeqw 16(%rsp,%r9,4), %xmm7
+pcmpeqd %xmm1, %xmm2
+pcmpeqd %xmm10, %xmm3
+pcmpeqd (%rax), %xmm12
+pcmpeqd 16(%rsp,%r9,4), %xmm7
+pcmpgtb %xmm1, %xmm2
+pcmpgtb %xmm10, %xmm3
+pcmpgtb (%rax), %xmm12
+pcmpgtb 16(%rsp,%r9,4), %xmm7
+pcmpgtw %xmm1, %xmm2
+pcmpgtw %xmm10, %xmm3
+pcmpgtw (%rax), %xmm12
+pcmpgtw 16(%rsp,%r9,4), %xmm7
+pcmpgtd %xmm1, %xmm2
+pcmpgtd %xmm10, %xmm3
+pcmpgtd (%rax), %xmm12
+pcmpgtd 16(%rsp,%r9,4), %xmm7
+packsswb %xmm1, %xmm2
+packsswb %xmm10, %xmm3
+packsswb (%rax), %xmm12
+packsswb 16(%rsp,%r9,4), %xmm7
+packssdw %xmm1, %xmm2
+packssdw %xmm10, %xmm3
+packssdw (%rax), %xmm12
+packssdw 16(%rsp,%r9,4), %xmm7
+packuswb %xmm1, %xmm2
+packuswb %xmm10, %xmm3
+packuswb (%rax), %xmm12
+packuswb 16(%rsp,%r9,4), %xmm7
+punpcklbw %xmm1, %xmm2
+punpcklbw %xmm10, %xmm3
+punpcklbw (%rax), %xmm12
+punpcklbw 16(%rsp,%r9,4), %xmm7
+punpcklwd %xmm1, %xmm2
+punpcklwd %xmm10, %xmm3
+punpcklwd (%rax), %xmm12
+punpcklwd 16(%rsp,%r9,4), %xmm7
+punpckldq %xmm1, %xmm2
+punpckldq %xmm10, %xmm3
+punpckldq (%rax), %xmm12
+punpckldq 16(%rsp,%r9,4), %xmm7
+punpcklqdq %xmm1, %xmm2
+punpcklqdq %xmm10, %xmm3
+punpcklqdq (%rax), %xmm12
+punpcklqdq 16(%rsp,%r9,4), %xmm7
+punpckhbw %xmm1, %xmm2
+punpckhbw %xmm10, %xmm3
+punpckhbw (%rax), %xmm12
+punpckhbw 16(%rsp,%r9,4), %xmm7
+punpckhwd %xmm1, %xmm2
+punpckhwd %xmm10, %xmm3
+punpckhwd (%rax), %xmm12
+punpckhwd 16(%rsp,%r9,4), %xmm7
+punpckhdq %xmm1, %xmm2
+punpckhdq %xmm10, %xmm3
+punpckhdq (%rax), %xmm12
+punpckhdq 16(%rsp,%r9,4), %xmm7
+punpckhqdq %xmm1, %xmm2
+punpckhqdq %xmm10, %xmm3
+punpckhqdq (%rax), %xmm12
+punpckhqdq 16(%rsp,%r9,4), %xmm7
+pshufd $1, %xmm1, %xmm2
+pshufd $5, (%r8), %xmm15
+pshufhw $1, %xmm1, %xmm2
+pshufhw $5, (%r8), %xmm15
+pshuflw $1, %xmm1, %xmm2
+pshuflw $5, (%r8), %xmm15
+psllw $3, %xmm1
+psllw $7, %xmm13
+psllw %xmm1, %xmm2
+psllw (%rax), %xmm9
+pslld $3, %xmm1
+pslld $7, %xmm13
+pslld %xmm1, %xmm2
+pslld (%rax), %xmm9
+psllq $3, %xmm1
+psllq $7, %xmm13
+psllq %xmm1, %xmm2
+psllq (%rax), %xmm9
+psrlw $3, %xmm1
+psrlw $7, %xmm13
+psrlw %xmm1, %xmm2
+psrlw (%rax), %xmm9
+psrld $3, %xmm1
+psrld $7, %xmm13
+psrld %xmm1, %xmm2
+psrld (%rax), %xmm9
+psrlq $3, %xmm1
+psrlq $7, %xmm13
+psrlq %xmm1, %xmm2
+psrlq (%rax), %xmm9
+psraw $3, %xmm1
+psraw $7, %xmm13
+psraw %xmm1, %xmm2
+psraw (%rax), %xmm9
+psrad $3, %xmm1
+psrad $7, %xmm13
+psrad %xmm1, %xmm2
+psrad (%rax), %xmm9
+pslldq $3, %xmm1
+pslldq $7, %xmm13
+psrldq $3, %xmm1
+psrldq $7, %xmm13
+pshufb %xmm1, %xmm2
+pshufb %xmm10, %xmm3
+pshufb (%rax), %xmm12
+pshufb 16(%rsp,%r9,4), %xmm7
+phaddw %xmm1, %xmm2
+phaddw %xmm10, %xmm3
+phaddw (%rax), %xmm12
+phaddw 16(%rsp,%r9,4), %xmm7
+phaddd %xmm1, %xmm2
+phaddd %xmm10, %xmm3
+phaddd (%rax), %xmm12
+phaddd 16(%rsp,%r9,4), %xmm7
+phaddsw %xmm1, %xmm2
+phaddsw %xmm10, %xmm3
+phaddsw (%rax), %xmm12
+phaddsw 16(%rsp,%r9,4), %xmm7
+pmaddubsw %xmm1, %xmm2
+pmaddubsw %xmm10, %xmm3
+pmaddubsw (%rax), %xmm12
+pmaddubsw 16(%rsp,%r9,4), %xmm7
+phsubw %xmm1, %xmm2
+phsubw %xmm10, %xmm3
+phsubw (%rax), %xmm12
+phsubw 16(%rsp,%r9,4), %xmm7
+phsubd %xmm1, %xmm2
+phsubd %xmm10, %xmm3
+phsubd (%rax), %xmm12
+phsubd 16(%rsp,%r9,4), %xmm7
+phsubsw %xmm1, %xmm2
+phsubsw %xmm10, %xmm3
+phsubsw (%rax), %xmm12
+phsubsw 16(%rsp,%r9,4), %xmm7
+psignb %xmm1, %xmm2
+psignb %xmm10, %xmm3
+psignb (%rax), %xmm12
+psignb 16(%rsp,%r9,4), %xmm7
+psignw %xmm1, %xmm2
+psignw %xmm10, %xmm3
+psignw (%rax), %xmm12
+psignw 16(%rsp,%r9,4), %xmm7
+psignd %xmm1, %xmm2
+psignd %xmm10, %xmm3
+psignd (%rax), %xmm12
+psignd 16(%rsp,%r9,4), %xmm7
+pmulhrsw %xmm1, %xmm2
+pmulhrsw %xmm10, %xmm3
+pmulhrsw (%rax), %xmm12
+pmulhrsw 16(%rsp,%r9,4), %xmm7
+pabsb %xmm1, %xmm2
+pabsb %xmm10, %xmm3
+pabsb (%rax), %xmm12
+pabsb 16(%rsp,%r9,4), %xmm7
+pabsw %xmm1, %xmm2
+pabsw %xmm10, %xmm3
+pabsw (%rax), %xmm12
+pabsw 16(%rsp,%r9,4), %xmm7
+pabsd %xmm1, %xmm2
+pabsd %xmm10, %xmm3
+pabsd (%rax), %xmm12
+pabsd 16(%rsp,%r9,4), %xmm7
+ptest %xmm1, %xmm2
+ptest %xmm10, %xmm3
+ptest (%rax), %xmm12
+ptest 16(%rsp,%r9,4), %xmm7
+pmovsxbw %xmm1, %xmm2
+pmovsxbw %xmm10, %xmm3
+pmovsxbw (%rax), %xmm12
+pmovsxbw 16(%rsp,%r9,4), %xmm7
+pmovsxbd %xmm1, %xmm2
+pmovsxbd %xmm10, %xmm3
+pmovsxbd (%rax), %xmm12
+pmovsxbd 16(%rsp,%r9,4), %xmm7
+pmovsxbq %xmm1, %xmm2
+pmovsxbq %xmm10, %xmm3
+pmovsxbq (%rax), %xmm12
+pmovsxbq 16(%rsp,%r9,4), %xmm7
+pmovsxwd %xmm1, %xmm2
+pmovsxwd %xmm10, %xmm3
+pmovsxwd (%rax), %xmm12
+pmovsxwd 16(%rsp,%r9,4), %xmm7
+pmovsxwq %xmm1, %xmm2
+pmovsxwq %xmm10, %xmm3
+pmovsxwq (%rax), %xmm12
+pmovsxwq 16(%rsp,%r9,4), %xmm7
+pmovsxdq %xmm1, %xmm2
+pmovsxdq %xmm10, %xmm3
+pmovsxdq (%rax), %xmm12
+pmovsxdq 16(%rsp,%r9,4), %xmm7
+pmuldq %xmm1, %xmm2
+pmuldq %xmm10, %xmm3
+pmuldq (%rax), %xmm12
+pmuldq 16(%rsp,%r9,4), %xmm7
+pcmpeqq %xmm1, %xmm2
+pcmpeqq %xmm10, %xmm3
+pcmpeqq (%rax), %xmm12
+pcmpeqq 16(%rsp,%r9,4), %xmm7
+movntdqa (%rax), %xmm12
+movntdqa 16(%rsp,%r9,4), %xmm7
+packusdw %xmm1, %xmm2
+packusdw %xmm10, %xmm3
+packusdw (%rax), %xmm12
+packusdw 16(%rsp,%r9,4), %xmm7
+pmovzxbw %xmm1, %xmm2
+pmovzxbw %xmm10, %xmm3
+pmovzxbw (%rax), %xmm12
+pmovzxbw 16(%rsp,%r9,4), %xmm7
+pmovzxbd %xmm1, %xmm2
+pmovzxbd %xmm10, %xmm3
+pmovzxbd (%rax), %xmm12
+pmovzxbd 16(%rsp,%r9,4), %xmm7
+pmovzxbq %xmm1, %xmm2
+pmovzxbq %xmm10, %xmm3
+pmovzxbq (%rax), %xmm12
+pmovzxbq 16(%rsp,%r9,4), %xmm7
+pmovzxwd %xmm1, %xmm2
+pmovzxwd %xmm10, %xmm3
+pmovzxwd (%rax), %xmm12
+pmovzxwd 16(%rsp,%r9,4), %xmm7
+pmovzxwq %xmm1, %xmm2
+pmovzxwq %xmm10, %xmm3
+pmovzxwq (%rax), %xmm12
+pmovzxwq 16(%rsp,%r9,4), %xmm7
+pmovzxdq %xmm1, %xmm2
+pmovzxdq %xmm10, %xmm3
+pmovzxdq (%rax), %xmm12
+pmovzxdq 16(%rsp,%r9,4), %xmm7
+pcmpgtq %xmm1, %xmm2
+pcmpgtq %xmm10, %xmm3
+pcmpgtq (%rax), %xmm12
+pcmpgtq 16(%rsp,%r9,4), %xmm7
+pminsb %xmm1, %xmm2
+pminsb %xmm10, %xmm3
+pminsb (%rax), %xmm12
+pminsb 16(%rsp,%r9,4), %xmm7
+pminsd %xmm1, %xmm2
+pminsd %xmm10, %xmm3
+pminsd (%rax), %xmm12
+pminsd 16(%rsp,%r9,4), %xmm7
+pminuw %xmm1, %xmm2
+pminuw %xmm10, %xmm3
+pminuw (%rax), %xmm12
+pminuw 16(%rsp,%r9,4), %xmm7
+pminud %xmm1, %xmm2
+pminud %xmm10, %xmm3
+pminud (%rax), %xmm12
+pminud 16(%rsp,%r9,4), %xmm7
+pmaxsb %xmm1, %xmm2
+pmaxsb %xmm10, %xmm3
+pmaxsb (%rax), %xmm12
+pmaxsb 16(%rsp,%r9,4), %xmm7
+pmaxsd %xmm1, %xmm2
+pmaxsd %xmm10, %xmm3
+pmaxsd (%rax), %xmm12
+pmaxsd 16(%rsp,%r9,4), %xmm7
+pmaxuw %xmm1, %xmm2
+pmaxuw %xmm10, %xmm3
+pmaxuw (%rax), %xmm12
+pmaxuw 16(%rsp,%r9,4), %xmm7
+pmaxud %xmm1, %xmm2
+pmaxud %xmm10, %xmm3
+pmaxud (%rax), %xmm12
+pmaxud 16(%rsp,%r9,4), %xmm7
+pmulld %xmm1, %xmm2
+pmulld %xmm10, %xmm3
+pmulld (%rax), %xmm12
+pmulld 16(%rsp,%r9,4), %xmm7
+phminposuw %xmm1, %xmm2
+phminposuw %xmm10, %xmm3
+phminposuw (%rax), %xmm12
+phminposuw 16(%rsp,%r9,4), %xmm7
+pblendvb %xmm0, %xmm1, %xmm2
+pblendvb %xmm0, (%rax), %xmm9
+blendvps %xmm0, %xmm1, %xmm2
+blendvps %xmm0, (%rax), %xmm9
+blendvpd %xmm0, %xmm1, %xmm2
+blendvpd %xmm0, (%rax), %xmm9
+palignr $1, %xmm1, %xmm2
+palignr $5, (%r8), %xmm15
+roundps $1, %xmm1, %xmm2
+roundps $5, (%r8), %xmm15
+roundpd $1, %xmm1, %xmm2
+roundpd $5, (%r8), %xmm15
+roundss $1, %xmm1, %xmm2
+roundss $5, (%r8), %xmm15
+roundsd $1, %xmm1, %xmm2
+roundsd $5, (%r8), %xmm15
+blendps $1, %xmm1, %xmm2
+blendps $5, (%r8), %xmm15
+blendpd $1, %xmm1, %xmm2
+blendpd $5, (%r8), %xmm15
+pblendw $1, %xmm1, %xmm2
+pblendw $5, (%r8), %xmm15
+insertps $1, %xmm1, %xmm2
+insertps $5, (%r8), %xmm15
+dpps $1, %xmm1, %xmm2
+dpps $5, (%r8), %xmm15
+dppd $1, %xmm1, %xmm2
+dppd $5, (%r8), %xmm15
+mpsadbw $1, %xmm1, %xmm2
+mpsadbw $5, (%r8), %xmm15
+pcmpestrm $1, %xmm1, %xmm2
+pcmpestrm $5, (%r8), %xmm15
+pcmpestri $1, %xmm1, %xmm2
+pcmpestri $5, (%r8), %xmm15
+pcmpistrm $1, %xmm1, %xmm2
+pcmpistrm $5, (%r8), %xmm15
+pcmpistri $1, %xmm1, %xmm2
+pcmpistri $5, (%r8), %xmm15
+movd %eax, %xmm1
+movd %xmm1, %eax
+movd (%rax), %xmm9
+movd %xmm9, (%r10)
+movd %r8d, %xmm2
+movq %rax, %xmm1
+movq %xmm1, %rax
+movq (%rax), %xmm1
+movq %xmm1, (%rax)
+movq %xmm1, %xmm2
+movq %xmm9, %xmm10
+movq %rax, %rbx
+movq $1, (%rax)
+pextrb $1, %xmm1, %eax
+pextrb $1, %xmm9, (%rax)
+pextrw $2, %xmm1, %eax
+pextrw $2, %xmm1, (%rax)
+pextrd $3, %xmm1, %r9d
+pextrd $3, %xmm1, (%rax)
+pextrq $1, %xmm1, %rax
+pextrq $1, %xmm12, (%rax)
+extractps $1, %xmm1, %eax
+extractps $2, %xmm1, (%rax)
+pinsrb $1, %eax, %xmm1
+pinsrb $1, (%rax), %xmm9
+pinsrw $2, %eax, %xmm1
+pinsrw $2, (%rax), %xmm1
+pinsrd $3, %r9d, %xmm1
+pinsrq $1, %rax, %xmm1
+pinsrq $1, (%rax), %xmm13
+crc32b %al, %eax
+crc32b %r9b, %rax
+crc32w %ax, %ecx
+crc32l %eax, %edx
+crc32q %rax, %rdx
+crc32b (%rax), %eax
+crc32q (%rdi), %r10
+crc32 %sil, %eax
+crc32l (%rax), %r11d
+pmovmskb %xmm0, %rax
+movaps g(%rip), %xmm0
+pshufd $0x1b, g(%rip), %xmm1
+cvtsi2sd %rax, %xmm0
+g: ret
+start:
+    movdqa (%rdi), %xmm0
+    movdqu %xmm8, 16(%rsi,%rcx,4)
+    pcmpeqb %xmm1, %xmm9
+    pmovmskb %xmm9, %eax
+    pshufb %xmm2, %xmm10
+    pcmpistri $0x0c, (%rdi), %xmm1
+    crc32b %al, %ecx
+    crc32q %rax, %r8
+    crc32l (%rdi), %eax
+    movaps %xmm15, %xmm3
+    addps %xmm1, %xmm2
+    mulsd 8(%rsp), %xmm4
+    cvtsi2sdq %rax, %xmm1
+    cvttsd2si %xmm1, %r9d
+    pextrd $1, %xmm3, %eax
+    pinsrq $1, %rax, %xmm12
+    movq %xmm1, %rax
+    movd %eax, %xmm9
+    movq %xmm1, %xmm2
+    psrldq $4, %xmm5
+    pslld %xmm1, %xmm2
+    shufps $0x1b, %xmm0, %xmm1
+    pblendvb %xmm0, %xmm3, %xmm4
+    roundsd $1, %xmm2, %xmm3
+    vpaddd %ymm1, %ymm2, %ymm3
+    vpaddd %xmm9, %xmm10, %xmm11
+    vpshufb (%rdi), %ymm14, %ymm15
+    vpermd %ymm1, %ymm2, %ymm3
+    vpgatherdd %ymm0, (%rdi,%ymm1,4), %ymm2
+    vgatherqpd %xmm0, 8(%rsi,%xmm9,8), %xmm2
+    vfmadd231ps %ymm1, %ymm2, %ymm3
+    vfmadd213sd (%rax), %xmm1, %xmm2
+    vbroadcastss (%rdi), %ymm0
+    vpbroadcastb %xmm1, %ymm2
+    vinserti128 $1, %xmm1, %ymm2, %ymm3
+    vextractf128 $1, %ymm1, (%rdi)
+    vmovdqu (%rsi), %ymm0
+    vmovdqa %ymm0, (%rdi)
+    vzeroupper
+    andn %rax, %rbx, %rcx
+    bextr %rax, (%rdi), %rcx
+    blsr %rax, %rbx
+    bzhi %eax, %ebx, %ecx
+    pdep %rax, %rbx, %rcx
+    pext %r8, %r9, %r10
+    shlx %rax, %rbx, %rcx
+    sarx %eax, (%rdi), %ecx
+    rorx $5, %rax, %rbx
+    mulx %rax, %rbx, %rcx
+    vpaddd %zmm1, %zmm2, %zmm3
+    vpaddd %zmm17, %zmm18, %zmm19{%k1}{z}
+    vpaddd (%rdi){1to16}, %zmm2, %zmm3
+    vaddps {rn-sae}, %zmm1, %zmm2, %zmm3
+    vmovdqu32 64(%rdi), %zmm0
+    vmovdqu64 %zmm1, -128(%rsi){%k2}
+    vpternlogd $0xff, %zmm1, %zmm2, %zmm3
+    vpcmpeqd %zmm1, %zmm2, %k1
+    vpscatterdd %zmm0, (%rdi,%zmm1,4){%k1}
+    vpcompressd %zmm0, (%rdi){%k1}
+    kmovw %k1, %eax
+    kandw %k1, %k2, %k3
+    vpaddd %xmm17, %xmm1, %xmm2
+    vaddps 256(%rax), %ymm1, %ymm20
+    vpermt2d %zmm1, %zmm2, %zmm3
+    popcntq %rax, %rbx
+    lzcntl (%rdi), %eax
+    tzcntw %ax, %bx
+    bsfq %rax, %rbx
+    bsrl %eax, %ecx
+    btq $5, %rax
+    btsl %eax, (%rdi)
+    lock btrq $1, (%rdi)
+    btcw %ax, %bx
+    adcxq %rax, %rbx
+    adoxl (%rdi), %eax
+    movbeq (%rdi), %rax
+    movbel %eax, (%rsi)
+    prefetcht0 (%rdi)
+    prefetchnta 64(%rsi)
+    prefetchw (%rax)
+    movnti %rax, (%rdi)
+    movntdq %xmm0, (%rdi)
+    movntps %xmm1, (%rsi)
+    clflush (%rdi)
+    clflushopt (%rdi)
+    clwb (%rdi)
+    rdtsc
+    rdtscp
+    rdpmc
+    serialize
+    cpuid
+    lfence
+    mfence
+    sfence
+    pause
+    lock addq $1, (%rdi)
+    lock xaddq %rax, (%rdi)
+    lock incl (%rdi)
+    lock cmpxchgq %rcx, (%rdi)
+    lock cmpxchg16b (%rdi)
+    cmpxchg8b (%rdi)
+    xchgq %rax, (%rdi)
+    cmovneq %rax, %rbx
+    cmovbl (%rdi), %eax
+    sete %al
+    setnbe (%rdi)
+    setb %r9b
+    adcl $1, %eax
+    sbbq %rax, %rbx
+    rep movsb
+    rep stosq
+    repne scasb
+    movsq
+    lodsb
+    cmpsw
+    movl %fs:0x28, %eax
+    movq %gs:8(%rax), %rbx
+    movq %fs:(%rax), %rcx
+    vmovntdq %ymm0, (%rdi)
+    vmovntps %zmm1, (%rsi)
+cmpeqps %xmm1,%xmm2
+cmpltpd (%rax),%xmm9
+cmpless %xmm11,%xmm0
+cmpunordsd 8(%rsp),%xmm3
+cmpneqps %xmm1,%xmm2
+cmpnltpd %xmm1,%xmm2
+cmpnless %xmm1,%xmm2
+cmpordsd %xmm1,%xmm2
+cmpordps x(%rip),%xmm2
+maskmovdqu %xmm1,%xmm2
+maskmovdqu %xmm9,%xmm12
+x: .long 0
@@ -0,0 +1,44 @@
+# String instructions behind rep, repe/repz and repne/repnz
+	rep movsb
+	rep movsw
+	rep movsq
+	rep stosb
+	rep stosl
+	repne scasb
+	repe cmpsb
+	repz cmpsq
+	repnz scasw
+	rep lodsb
+	movsd
+	cmpsd
+	movsl
+	lodsq
+	rep ret
+	repz ret
+	mov %fs:0x28,%rax
+	mov %fs:(%eax),%cx
+	movq %gs:8(%rax,%rbx,4),%r9
+	lock addl $1,%fs:(%rax)
+	mov %fs:counter(%rip),%eax
+	movl $5,%gs:0x10
+	mov %fs:0x28,%eax
+	mov %eax,%fs:-8
+	mov %fs:0,%rax
+	mov %es:(%rax),%eax
+	mov %ds:(%rax),%eax
+	mov %cs:(%rax),%eax
+	mov %ss:(%rax),%eax
+	vmovaps %fs:(%rax),%ymm0
+	vaddps %gs:64(%rax),%zmm1,%zmm2
+	addl %fs:(%rax),%eax
+counter:
+	.long 0
+	mov %ds:(%rbp),%eax
+	mov %ss:(%rbp),%eax
+	mov %ds:8(%rsp),%eax
+	mov %ss:(%rax),%eax
+	mov %ds:0x10,%eax
+	repne movsb
+	rep lodsq
+	lock addw $1,%fs:(%rax)
+	mov %fs:(%eax),%ecx